@@ -0,0 +1,166 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/cachedRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace ephemerides;
+
+//! Rotational ephemeris that counts the number of times that its rotation (derivative) to base frame is computed.
+class CountingRotationalEphemeris : public SimpleRotationalEphemeris
+{
+public:
+
+    CountingRotationalEphemeris( const double rotationRate ):
+        SimpleRotationalEphemeris( Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitX( ) ) ),
+                                   rotationRate, 0.0, "ECLIPJ2000", "IAU_Earth" ),
+        numberOfRotationEvaluations_( 0 ), numberOfDerivativeEvaluations_( 0 ){ }
+
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        numberOfRotationEvaluations_++;
+        return SimpleRotationalEphemeris::getRotationToBaseFrame( secondsSinceEpoch );
+    }
+
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+    {
+        numberOfDerivativeEvaluations_++;
+        return SimpleRotationalEphemeris::getDerivativeOfRotationToBaseFrame( secondsSinceEpoch );
+    }
+
+    int numberOfRotationEvaluations_;
+
+    int numberOfDerivativeEvaluations_;
+};
+
+BOOST_AUTO_TEST_SUITE( test_cached_rotational_ephemeris )
+
+//! Test whether rotations are cached per epoch within a caching scope only, and are equal to the original rotations.
+BOOST_AUTO_TEST_CASE( testCachedRotationalEphemeris )
+{
+    std::shared_ptr< CountingRotationalEphemeris > originalRotationalEphemeris =
+            std::make_shared< CountingRotationalEphemeris >( 2.0 * mathematical_constants::PI / 86164.0 );
+    std::shared_ptr< CachedRotationalEphemeris > cachedRotationalEphemeris =
+            std::make_shared< CachedRotationalEphemeris >( originalRotationalEphemeris );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getBaseFrameOrientation( ), "ECLIPJ2000" );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getTargetFrameOrientation( ), "IAU_Earth" );
+
+    std::vector< double > testTimes = { 1.0E7, 1.0E7 + 60.0, 1.0E7 + 120.0 };
+
+    // Check that rotations are not cached outside of caching scope
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        cachedRotationalEphemeris->getRotationToBaseFrame( testTimes.at( 0 ) );
+        cachedRotationalEphemeris->getDerivativeOfRotationToBaseFrame( testTimes.at( 0 ) );
+    }
+    BOOST_CHECK_EQUAL( originalRotationalEphemeris->numberOfRotationEvaluations_, 2 );
+    BOOST_CHECK_EQUAL( originalRotationalEphemeris->numberOfDerivativeEvaluations_, 2 );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheHits( ), 0 );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheMisses( ), 0 );
+
+    // Request rotations in both directions at each epoch twice, with epochs revisited in reverse order
+    originalRotationalEphemeris->numberOfRotationEvaluations_ = 0;
+    originalRotationalEphemeris->numberOfDerivativeEvaluations_ = 0;
+    {
+        RotationCachingScope rotationCachingScope;
+        for( unsigned int j = 0; j < 2 * testTimes.size( ); j++ )
+        {
+            double testTime = ( j < testTimes.size( ) ) ? testTimes.at( j ) : testTimes.at( 2 * testTimes.size( ) - j - 1 );
+
+            // Retrieve cached rotations
+            Eigen::Matrix3d rotationToBaseFrame =
+                    cachedRotationalEphemeris->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+            Eigen::Matrix3d rotationToTargetFrame =
+                    cachedRotationalEphemeris->getRotationToTargetFrame( testTime ).toRotationMatrix( );
+            Eigen::Matrix3d derivativeOfRotationToBaseFrame =
+                    cachedRotationalEphemeris->getDerivativeOfRotationToBaseFrame( testTime );
+            Eigen::Matrix3d derivativeOfRotationToTargetFrame =
+                    cachedRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime );
+
+            // Compare with rotations computed directly by original model
+            Eigen::Matrix3d expectedRotationToBaseFrame = originalRotationalEphemeris->
+                    SimpleRotationalEphemeris::getRotationToBaseFrame( testTime ).toRotationMatrix( );
+            Eigen::Matrix3d expectedRotationToTargetFrame =
+                    originalRotationalEphemeris->getRotationToTargetFrame( testTime ).toRotationMatrix( );
+            Eigen::Matrix3d expectedDerivativeOfRotationToBaseFrame = originalRotationalEphemeris->
+                    SimpleRotationalEphemeris::getDerivativeOfRotationToBaseFrame( testTime );
+            Eigen::Matrix3d expectedDerivativeOfRotationToTargetFrame =
+                    originalRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime );
+
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( rotationToBaseFrame, expectedRotationToBaseFrame,
+                                               std::numeric_limits< double >::epsilon( ) );
+            BOOST_CHECK_SMALL( ( rotationToTargetFrame - expectedRotationToTargetFrame ).cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( derivativeOfRotationToBaseFrame, expectedDerivativeOfRotationToBaseFrame,
+                                               std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( derivativeOfRotationToTargetFrame, expectedDerivativeOfRotationToTargetFrame,
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+
+        // Check that rotations are not cached when accessed concurrently
+        {
+            utilities::ConcurrentSharedObjectAccess sharedObjectAccess;
+            cachedRotationalEphemeris->getRotationToBaseFrame( testTimes.at( 0 ) );
+        }
+    }
+
+    // Rotations to base frame are evaluated once per epoch (comparison values are computed directly from the base class)
+    BOOST_CHECK_EQUAL( originalRotationalEphemeris->numberOfRotationEvaluations_, 3 + 1 );
+    BOOST_CHECK_EQUAL( originalRotationalEphemeris->numberOfDerivativeEvaluations_, 3 );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheMisses( ), 6 );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheHits( ), 24 - 6 );
+
+    cachedRotationalEphemeris->resetCacheStatistics( );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheHits( ), 0 );
+    BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheMisses( ), 0 );
+
+    // Modify rotation model, and check that rotation is recomputed in new caching scope (in nested scope).
+    originalRotationalEphemeris->resetRotationRate( 2.0 * mathematical_constants::PI / 86400.0 );
+    {
+        RotationCachingScope rotationCachingScope;
+        const unsigned int outerScopeIndex = getCurrentRotationCachingScopeIndex( );
+        {
+            RotationCachingScope nestedRotationCachingScope;
+            BOOST_CHECK_EQUAL( getCurrentRotationCachingScopeIndex( ), outerScopeIndex );
+
+            Eigen::Matrix3d rotationToBaseFrame =
+                    cachedRotationalEphemeris->getRotationToBaseFrame( testTimes.at( 0 ) ).toRotationMatrix( );
+            Eigen::Matrix3d expectedRotationToBaseFrame = originalRotationalEphemeris->
+                    SimpleRotationalEphemeris::getRotationToBaseFrame( testTimes.at( 0 ) ).toRotationMatrix( );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( rotationToBaseFrame, expectedRotationToBaseFrame,
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+        cachedRotationalEphemeris->getRotationToBaseFrame( testTimes.at( 0 ) );
+        BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheMisses( ), 1 );
+        BOOST_CHECK_EQUAL( cachedRotationalEphemeris->getNumberOfCacheHits( ), 1 );
+    }
+    BOOST_CHECK_EQUAL( getCurrentRotationCachingScopeIndex( ), 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshevEphemeris )
+
+//! Test whether Chebyshev ephemeris correctly evaluates a manually defined Chebyshev series and its derivative
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisEvaluation )
+{
+    // Define two segments on [ 10, 14 ], with x = 1 + 2 T1 + 3 T2, y = -T1 and z = 4 T2 in the first segment
+    // (all zero in the second segment).
+    Eigen::MatrixXd chebyshevCoefficients = Eigen::MatrixXd::Zero( 3, 6 );
+    chebyshevCoefficients.block( 0, 0, 3, 3 ) << 1.0, 0.0, 0.0,
+            2.0, -1.0, 0.0,
+            3.0, 0.0, 4.0;
+
+    ephemerides::ChebyshevEphemeris chebyshevEphemeris( chebyshevCoefficients, 10.0, 14.0, "Earth", "J2000" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getNumberOfSegments( ), 2 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getNumberOfCoefficients( ), 3 );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris.getSegmentLength( ), 2.0, std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getReferenceFrameOrigin( ), "Earth" );
+
+    for( double currentTime = 10.0; currentTime < 12.0; currentTime += 0.25 )
+    {
+        // Normalized time is equal to time since start of segment minus one; segment length is 2.
+        const double normalizedTime = currentTime - 11.0;
+        const Eigen::Vector6d computedState = chebyshevEphemeris.getCartesianState( currentTime );
+
+        Eigen::Vector6d expectedState;
+        expectedState << 1.0 + 2.0 * normalizedTime + 3.0 * ( 2.0 * normalizedTime * normalizedTime - 1.0 ),
+                -normalizedTime, 4.0 * ( 2.0 * normalizedTime * normalizedTime - 1.0 ),
+                2.0 + 12.0 * normalizedTime, -1.0, 16.0 * normalizedTime;
+
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_SMALL( computedState( i ) - expectedState( i ), 1.0E-14 );
+        }
+    }
+
+    // Check that second segment is used from its start time up to and including the final time
+    BOOST_CHECK_SMALL( chebyshevEphemeris.getCartesianState( 12.0 ).norm( ), 1.0E-15 );
+    BOOST_CHECK_SMALL( chebyshevEphemeris.getCartesianState( 14.0 ).norm( ), 1.0E-15 );
+
+    // Check that evaluation outside of interval is not allowed.
+    bool isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris.getCartesianState( 14.0 + 1.0E-6 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris.getCartesianState( 10.0 - 1.0E-6 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test whether Chebyshev ephemeris fit to Kepler orbits meets the requested tolerances
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFit )
+{
+    using namespace ephemerides;
+
+    // Define heliocentric (Earth-like) orbit and geocentric (low Earth) orbit.
+    std::vector< std::shared_ptr< Ephemeris > > keplerEphemerides;
+    std::vector< double > fitIntervalLengths;
+
+    Eigen::Vector6d heliocentricKeplerElements;
+    heliocentricKeplerElements << physical_constants::ASTRONOMICAL_UNIT, 0.0167,
+            unit_conversions::convertDegreesToRadians( 7.2 ),  unit_conversions::convertDegreesToRadians( 102.9 ),
+            unit_conversions::convertDegreesToRadians( 348.7 ), unit_conversions::convertDegreesToRadians( 12.0 );
+    keplerEphemerides.push_back( std::make_shared< KeplerEphemeris >(
+                                     heliocentricKeplerElements, 1.0E8, 1.32712440018E20, "SSB", "ECLIPJ2000" ) );
+    fitIntervalLengths.push_back( physical_constants::JULIAN_YEAR );
+
+    Eigen::Vector6d geocentricKeplerElements;
+    geocentricKeplerElements << 6978.0E3, 0.01,
+            unit_conversions::convertDegreesToRadians( 97.8 ),  unit_conversions::convertDegreesToRadians( 40.0 ),
+            unit_conversions::convertDegreesToRadians( 75.0 ), unit_conversions::convertDegreesToRadians( 200.0 );
+    keplerEphemerides.push_back( std::make_shared< KeplerEphemeris >(
+                                     geocentricKeplerElements, 1.0E8, 398600.4415E9, "Earth", "J2000" ) );
+    fitIntervalLengths.push_back( physical_constants::JULIAN_DAY );
+
+    for( unsigned int i = 0; i < keplerEphemerides.size( ); i++ )
+    {
+        const double initialTime = 1.0E8;
+        const double finalTime = initialTime + fitIntervalLengths.at( i );
+
+        std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = createChebyshevEphemeris(
+                    keplerEphemerides.at( i ), initialTime, finalTime );
+
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrigin( ),
+                           keplerEphemerides.at( i )->getReferenceFrameOrigin( ) );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrientation( ),
+                           keplerEphemerides.at( i )->getReferenceFrameOrientation( ) );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getNumberOfCoefficients( ), 14 );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris->getChebyshevCoefficients( ).cols( ),
+                           3 * chebyshevEphemeris->getNumberOfSegments( ) );
+
+        // Compare to Kepler orbit at times not used for the fit, and check sub-millimetre agreement
+        const int numberOfTestTimes = 2000;
+        for( int j = 0; j <= numberOfTestTimes; j++ )
+        {
+            const double currentTime = initialTime + ( finalTime - initialTime ) *
+                    static_cast< double >( j ) / static_cast< double >( numberOfTestTimes );
+            const Eigen::Vector6d stateDifference = chebyshevEphemeris->getCartesianState( currentTime ) -
+                    keplerEphemerides.at( i )->getCartesianState( currentTime );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+
+        // Check that a less strict tolerance requires fewer segments
+        std::shared_ptr< ChebyshevEphemeris > lowAccuracyChebyshevEphemeris = createChebyshevEphemeris(
+                    keplerEphemerides.at( i ), initialTime, finalTime, 1.0E2, 1.0E-1 );
+        BOOST_CHECK( lowAccuracyChebyshevEphemeris->getNumberOfSegments( ) <
+                     chebyshevEphemeris->getNumberOfSegments( ) );
+
+        // Check that fit fails if tolerances can not be met with maximum number of segments
+        bool isExceptionCaught = false;
+        try
+        {
+            createChebyshevEphemeris( keplerEphemerides.at( i ), initialTime, finalTime, 1.0E-3, 1.0E-6, 4, 2 );
+        }
+        catch( std::runtime_error const& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
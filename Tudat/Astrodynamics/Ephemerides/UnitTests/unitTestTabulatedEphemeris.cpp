@@ -137,7 +137,23 @@ BOOST_AUTO_TEST_CASE( testTabulatedEphemeris )
     // Check whether getting of interpolator is correct
     BOOST_CHECK_EQUAL( tabulatedEphemeris->getInterpolator( ), jupiterStateInterpolator );
 
-
+    // Re-sample tabulated ephemeris (using batch interpolation), and compare to ephemeris generated from individually
+    // interrogated states of tabulated ephemeris.
+    std::shared_ptr< Ephemeris > resampledEphemeris = getTabulatedEphemeris< double, double >(
+                tabulatedEphemeris, 1.0E5, 9.0E6, 3600.0 );
+    std::map< double, Eigen::Vector6d > manuallyResampledStateHistory;
+    for( double currentTime = 1.0E5; currentTime <= 9.0E6; currentTime += 3600.0 )
+    {
+        manuallyResampledStateHistory[ currentTime ] = tabulatedEphemeris->getCartesianState( currentTime );
+    }
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d > > manuallyResampledInterpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >(
+                manuallyResampledStateHistory, 8 );
+    for( double currentTime = 2.0E5; currentTime < 8.9E6; currentTime += 123456.7 )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( resampledEphemeris->getCartesianState( currentTime ),
+                                           manuallyResampledInterpolator->interpolate( currentTime ), 1.0E-14 );
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
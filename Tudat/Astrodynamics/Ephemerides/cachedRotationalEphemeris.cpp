@@ -0,0 +1,133 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <atomic>
+
+#include "Tudat/Astrodynamics/Ephemerides/cachedRotationalEphemeris.h"
+#include "Tudat/Basics/parallelExecution.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Number of outermost rotation caching scopes created so far (in all threads), used to assign a new index to each scope.
+static std::atomic< unsigned int > numberOfRotationCachingScopes( 0 );
+
+//! Index of the rotation caching scope that is active in the current thread (0 if none is active).
+static thread_local unsigned int currentRotationCachingScopeIndex = 0;
+
+//! Function to retrieve the index of the rotation caching scope that is active in the current thread
+unsigned int getCurrentRotationCachingScopeIndex( )
+{
+    return currentRotationCachingScopeIndex;
+}
+
+//! Constructor, enables the caching of rotations in the current thread (if not yet enabled).
+RotationCachingScope::RotationCachingScope( ):
+    previousCachingScopeIndex_( currentRotationCachingScopeIndex )
+{
+    if( currentRotationCachingScopeIndex == 0 )
+    {
+        currentRotationCachingScopeIndex = ++numberOfRotationCachingScopes;
+    }
+}
+
+//! Destructor, restores the rotation caching scope that was active when this object was created.
+RotationCachingScope::~RotationCachingScope( )
+{
+    currentRotationCachingScopeIndex = previousCachingScopeIndex_;
+}
+
+//! Get rotation quaternion from target frame to base frame.
+Eigen::Quaterniond CachedRotationalEphemeris::getRotationToBaseFrame( const double secondsSinceEpoch )
+{
+    if( !isCacheUsed( ) )
+    {
+        return originalRotationalEphemeris_->getRotationToBaseFrame( secondsSinceEpoch );
+    }
+
+    auto cacheIterator = rotationToBaseFrameCache_.find( secondsSinceEpoch );
+    if( cacheIterator != rotationToBaseFrameCache_.end( ) )
+    {
+        numberOfCacheHits_++;
+        return cacheIterator->second;
+    }
+
+    numberOfCacheMisses_++;
+    Eigen::Quaterniond rotationToBaseFrame = originalRotationalEphemeris_->getRotationToBaseFrame( secondsSinceEpoch );
+    rotationToBaseFrameCache_[ secondsSinceEpoch ] = rotationToBaseFrame;
+    return rotationToBaseFrame;
+}
+
+//! Get rotation quaternion to target frame from base frame.
+Eigen::Quaterniond CachedRotationalEphemeris::getRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    if( !isCacheUsed( ) )
+    {
+        return originalRotationalEphemeris_->getRotationToTargetFrame( secondsSinceEpoch );
+    }
+    return getRotationToBaseFrame( secondsSinceEpoch ).inverse( );
+}
+
+//! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+Eigen::Matrix3d CachedRotationalEphemeris::getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch )
+{
+    if( !isCacheUsed( ) )
+    {
+        return originalRotationalEphemeris_->getDerivativeOfRotationToBaseFrame( secondsSinceEpoch );
+    }
+
+    auto cacheIterator = derivativeOfRotationToBaseFrameCache_.find( secondsSinceEpoch );
+    if( cacheIterator != derivativeOfRotationToBaseFrameCache_.end( ) )
+    {
+        numberOfCacheHits_++;
+        return cacheIterator->second;
+    }
+
+    numberOfCacheMisses_++;
+    Eigen::Matrix3d derivativeOfRotationToBaseFrame =
+            originalRotationalEphemeris_->getDerivativeOfRotationToBaseFrame( secondsSinceEpoch );
+    derivativeOfRotationToBaseFrameCache_[ secondsSinceEpoch ] = derivativeOfRotationToBaseFrame;
+    return derivativeOfRotationToBaseFrame;
+}
+
+//! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+Eigen::Matrix3d CachedRotationalEphemeris::getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch )
+{
+    if( !isCacheUsed( ) )
+    {
+        return originalRotationalEphemeris_->getDerivativeOfRotationToTargetFrame( secondsSinceEpoch );
+    }
+    return getDerivativeOfRotationToBaseFrame( secondsSinceEpoch ).transpose( );
+}
+
+//! Function to check whether the cache is to be used, and to empty it if a new caching scope was entered.
+bool CachedRotationalEphemeris::isCacheUsed( )
+{
+    const unsigned int currentCachingScopeIndex = getCurrentRotationCachingScopeIndex( );
+    if( currentCachingScopeIndex == 0 || utilities::isAccessingSharedObjectsConcurrently( ) )
+    {
+        return false;
+    }
+
+    if( currentCachingScopeIndex != cachingScopeIndex_ )
+    {
+        rotationToBaseFrameCache_.clear( );
+        derivativeOfRotationToBaseFrameCache_.clear( );
+        cachingScopeIndex_ = currentCachingScopeIndex;
+    }
+    return true;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,273 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CACHED_ROTATIONAL_EPHEMERIS_H
+#define TUDAT_CACHED_ROTATIONAL_EPHEMERIS_H
+
+#include <map>
+#include <memory>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to retrieve the index of the rotation caching scope that is active in the current thread
+/*!
+ *  Function to retrieve the index of the rotation caching scope that is active in the current thread (see
+ *  RotationCachingScope).
+ *  \return Index of the rotation caching scope that is active in the current thread (0 if none is active)
+ */
+unsigned int getCurrentRotationCachingScopeIndex( );
+
+//! Class that enables the caching of rotations by CachedRotationalEphemeris objects in the current thread.
+/*!
+ *  Class that enables the caching of rotations by CachedRotationalEphemeris objects in the current thread, during the
+ *  lifetime of the object. Rotations are only reused within the same (outermost) scope: each time that an outermost
+ *  scope is created, it receives a new index, and all rotations cached in a previous scope are discarded. In this way,
+ *  modifications of the rotation models between two scopes (e.g. of their estimated parameters) are always taken into
+ *  account. An object of this type should only be created in code during which the rotation models are not modified,
+ *  such as the computation of a set of observations and their partials. Nested scopes use the index of the outermost
+ *  scope.
+ */
+class RotationCachingScope
+{
+public:
+
+    //! Constructor, enables the caching of rotations in the current thread (if not yet enabled).
+    RotationCachingScope( );
+
+    //! Destructor, restores the rotation caching scope that was active when this object was created.
+    ~RotationCachingScope( );
+
+    //! Deleted copy constructor
+    RotationCachingScope( const RotationCachingScope& ) = delete;
+
+    //! Deleted assignment operator
+    RotationCachingScope& operator=( const RotationCachingScope& ) = delete;
+
+private:
+
+    //! Index of the rotation caching scope that was active in the current thread when this object was created
+    unsigned int previousCachingScopeIndex_;
+};
+
+//! Rotational ephemeris that caches the rotation (and its derivative) computed by another rotational ephemeris per epoch.
+/*!
+ *  Rotational ephemeris that caches the rotation to the base frame (and its time derivative) computed by another rotational
+ *  ephemeris, per epoch at which it is requested. This class is used for the rotations of ground stations and other link
+ *  ends, which are requested at the same epochs by the light-time solution, the viability calculators and the observation
+ *  partials. The rotation to the target frame (and its time derivative) is computed as the inverse of the cached rotation
+ *  to the base frame, so that both directions are obtained from a single evaluation of the original rotation model (the
+ *  results are equal to those of the original rotation model to within rounding error).
+ *
+ *  Rotations are only cached while a RotationCachingScope is active in the current thread, and the cache is emptied when
+ *  a new scope is entered. Outside of such a scope, or when the object is accessed concurrently from multiple threads
+ *  (see utilities::isAccessingSharedObjectsConcurrently), all functions are passed directly to the original rotation
+ *  model. Functions that take the time as a Time object, and the functions for the angular velocity vector, are always
+ *  passed to the original rotation model.
+ */
+class CachedRotationalEphemeris : public RotationalEphemeris
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param originalRotationalEphemeris Rotational ephemeris of which the rotations are to be cached.
+     */
+    CachedRotationalEphemeris( const std::shared_ptr< RotationalEphemeris > originalRotationalEphemeris ):
+        RotationalEphemeris( originalRotationalEphemeris->getBaseFrameOrientation( ),
+                             originalRotationalEphemeris->getTargetFrameOrientation( ) ),
+        originalRotationalEphemeris_( originalRotationalEphemeris ), cachingScopeIndex_( 0 ),
+        numberOfCacheHits_( 0 ), numberOfCacheMisses_( 0 ){ }
+
+    //! Destructor
+    ~CachedRotationalEphemeris( ){ }
+
+    //! Get rotation quaternion from target frame to base frame.
+    /*!
+     * Function to retrieve the rotation quaternion from target frame to base frame at specified time, from the cache if
+     * it was computed at the same time in the current caching scope.
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     * \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame( const double secondsSinceEpoch );
+
+    //! Get rotation quaternion to target frame from base frame.
+    /*!
+     * Function to retrieve the rotation quaternion to target frame from base frame at specified time, computed from the
+     * (cached) rotation from target frame to base frame.
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     * \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to base frame.
+    /*!
+     * Function to retrieve the derivative of the rotation matrix from target frame to base frame at specified time, from
+     * the cache if it was computed at the same time in the current caching scope.
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     * \return Derivative of rotation from target to base frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double secondsSinceEpoch );
+
+    //! Function to calculate the derivative of the rotation matrix from base frame to target frame.
+    /*!
+     * Function to retrieve the derivative of the rotation matrix from base frame to target frame at specified time,
+     * computed from the (cached) derivative of the rotation matrix from target frame to base frame.
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     * \return Derivative of rotation from base to target frame at specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double secondsSinceEpoch );
+
+    //! Get rotation quaternion from target frame to base frame in Time precision (not cached).
+    Eigen::Quaterniond getRotationToBaseFrameFromExtendedTime( const Time timeSinceEpoch )
+    {
+        return originalRotationalEphemeris_->getRotationToBaseFrameFromExtendedTime( timeSinceEpoch );
+    }
+
+    //! Get rotation quaternion to target frame from base frame in Time precision (not cached).
+    Eigen::Quaterniond getRotationToTargetFrameFromExtendedTime( const Time timeSinceEpoch )
+    {
+        return originalRotationalEphemeris_->getRotationToTargetFrameFromExtendedTime( timeSinceEpoch );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to base frame in Time precision (not
+    //! cached).
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrameFromExtendedTime( const Time timeSinceEpoch )
+    {
+        return originalRotationalEphemeris_->getDerivativeOfRotationToBaseFrameFromExtendedTime( timeSinceEpoch );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from base frame to target frame in Time precision (not
+    //! cached).
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrameFromExtendedTime( const Time timeSinceEpoch )
+    {
+        return originalRotationalEphemeris_->getDerivativeOfRotationToTargetFrameFromExtendedTime( timeSinceEpoch );
+    }
+
+    //! Function to retrieve the angular velocity vector, expressed in base frame (not cached).
+    Eigen::Vector3d getRotationalVelocityVectorInBaseFrame( const double secondsSinceEpoch )
+    {
+        return originalRotationalEphemeris_->getRotationalVelocityVectorInBaseFrame( secondsSinceEpoch );
+    }
+
+    //! Function to retrieve the angular velocity vector, expressed in target frame (not cached).
+    Eigen::Vector3d getRotationalVelocityVectorInTargetFrame( const double secondsSinceEpoch )
+    {
+        return originalRotationalEphemeris_->getRotationalVelocityVectorInTargetFrame( secondsSinceEpoch );
+    }
+
+    //! Function to calculate the full rotational state at given time (not cached).
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch )
+    {
+        originalRotationalEphemeris_->getFullRotationalQuantitiesToTargetFrame(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative,
+                    currentAngularVelocityVectorInGlobalFrame, secondsSinceEpoch );
+    }
+
+    //! Function to calculate the full rotational state at given time in Time precision (not cached).
+    void getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const Time timeSinceEpoch )
+    {
+        originalRotationalEphemeris_->getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative,
+                    currentAngularVelocityVectorInGlobalFrame, timeSinceEpoch );
+    }
+
+    //! Function to retrieve the rotational ephemeris of which the rotations are cached
+    /*!
+     * Function to retrieve the rotational ephemeris of which the rotations are cached
+     * \return Rotational ephemeris of which the rotations are cached
+     */
+    std::shared_ptr< RotationalEphemeris > getOriginalRotationalEphemeris( )
+    {
+        return originalRotationalEphemeris_;
+    }
+
+    //! Function to retrieve the number of times that a rotation (or its derivative) was retrieved from the cache
+    /*!
+     * Function to retrieve the number of times that a rotation (or its derivative) was retrieved from the cache, since
+     * the creation of this object or the last call to resetCacheStatistics
+     * \return Number of times that a rotation (or its derivative) was retrieved from the cache
+     */
+    unsigned int getNumberOfCacheHits( )
+    {
+        return numberOfCacheHits_;
+    }
+
+    //! Function to retrieve the number of times that a rotation (or its derivative) was computed and added to the cache
+    /*!
+     * Function to retrieve the number of times that a rotation (or its derivative) was computed by the original rotation
+     * model and added to the cache, since the creation of this object or the last call to resetCacheStatistics
+     * \return Number of times that a rotation (or its derivative) was computed and added to the cache
+     */
+    unsigned int getNumberOfCacheMisses( )
+    {
+        return numberOfCacheMisses_;
+    }
+
+    //! Function to reset the number of cache hits and misses to zero
+    void resetCacheStatistics( )
+    {
+        numberOfCacheHits_ = 0;
+        numberOfCacheMisses_ = 0;
+    }
+
+private:
+
+    //! Function to check whether the cache is to be used, and to empty it if a new caching scope was entered.
+    /*!
+     * Function to check whether the cache is to be used (i.e. whether a RotationCachingScope is active in the current
+     * thread, and the object is not accessed concurrently), and to empty the cache if a new caching scope was entered since
+     * the last call.
+     * \return True if the cache is to be used, false if the original rotation model is to be called directly.
+     */
+    bool isCacheUsed( );
+
+    //! Rotational ephemeris of which the rotations are cached
+    std::shared_ptr< RotationalEphemeris > originalRotationalEphemeris_;
+
+    //! Index of the rotation caching scope in which the current cache contents were computed.
+    unsigned int cachingScopeIndex_;
+
+    //! Cached rotations from target frame to base frame, with the epoch as key.
+    std::map< double, Eigen::Quaterniond, std::less< double >,
+    Eigen::aligned_allocator< std::pair< const double, Eigen::Quaterniond > > > rotationToBaseFrameCache_;
+
+    //! Cached derivatives of the rotation matrix from target frame to base frame, with the epoch as key.
+    std::map< double, Eigen::Matrix3d > derivativeOfRotationToBaseFrameCache_;
+
+    //! Number of times that a rotation (or its derivative) was retrieved from the cache
+    unsigned int numberOfCacheHits_;
+
+    //! Number of times that a rotation (or its derivative) was computed and added to the cache
+    unsigned int numberOfCacheMisses_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CACHED_ROTATIONAL_EPHEMERIS_H
@@ -0,0 +1,228 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/LU>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor
+ChebyshevEphemeris::ChebyshevEphemeris( const Eigen::MatrixXd& chebyshevCoefficients,
+                                        const double initialTime,
+                                        const double finalTime,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    chebyshevCoefficients_( chebyshevCoefficients ), initialTime_( initialTime ), finalTime_( finalTime )
+{
+    if( ( chebyshevCoefficients_.rows( ) < 2 ) || ( chebyshevCoefficients_.cols( ) == 0 ) ||
+            ( chebyshevCoefficients_.cols( ) % 3 != 0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, size of coefficient matrix is incompatible" );
+    }
+
+    if( !( finalTime_ > initialTime_ ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, final time must be larger than initial time" );
+    }
+
+    numberOfSegments_ = static_cast< int >( chebyshevCoefficients_.cols( ) / 3 );
+    segmentLength_ = ( finalTime_ - initialTime_ ) / static_cast< double >( numberOfSegments_ );
+}
+
+//! Function to get state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    if( ( secondsSinceEpoch < initialTime_ ) || ( secondsSinceEpoch > finalTime_ ) )
+    {
+        throw std::runtime_error( "Error when evaluating Chebyshev ephemeris, time " + std::to_string( secondsSinceEpoch ) +
+                                  " is outside of interval [" + std::to_string( initialTime_ ) + ", " +
+                                  std::to_string( finalTime_ ) + "]" );
+    }
+
+    // Retrieve segment containing current time (final time is included in last segment)
+    int segmentIndex = static_cast< int >( ( secondsSinceEpoch - initialTime_ ) / segmentLength_ );
+    if( segmentIndex >= numberOfSegments_ )
+    {
+        segmentIndex = numberOfSegments_ - 1;
+    }
+
+    // Compute normalized time in segment, in interval [-1, 1]
+    const double normalizedTime =
+            2.0 * ( secondsSinceEpoch - initialTime_ - segmentIndex * segmentLength_ ) / segmentLength_ - 1.0;
+
+    // Evaluate Chebyshev polynomials and their derivatives using recurrence relations, and add contributions to state.
+    double previousPolynomial = 1.0, currentPolynomial = normalizedTime;
+    double previousDerivative = 0.0, currentDerivative = 1.0;
+
+    Eigen::Vector3d position = chebyshevCoefficients_.block( 0, 3 * segmentIndex, 1, 3 ).transpose( ) +
+            normalizedTime * chebyshevCoefficients_.block( 1, 3 * segmentIndex, 1, 3 ).transpose( );
+    Eigen::Vector3d velocity = chebyshevCoefficients_.block( 1, 3 * segmentIndex, 1, 3 ).transpose( );
+    for( int i = 2; i < chebyshevCoefficients_.rows( ); i++ )
+    {
+        const double nextPolynomial = 2.0 * normalizedTime * currentPolynomial - previousPolynomial;
+        const double nextDerivative =
+                2.0 * currentPolynomial + 2.0 * normalizedTime * currentDerivative - previousDerivative;
+
+        position += nextPolynomial * chebyshevCoefficients_.block( i, 3 * segmentIndex, 1, 3 ).transpose( );
+        velocity += nextDerivative * chebyshevCoefficients_.block( i, 3 * segmentIndex, 1, 3 ).transpose( );
+
+        previousPolynomial = currentPolynomial;
+        currentPolynomial = nextPolynomial;
+        previousDerivative = currentDerivative;
+        currentDerivative = nextDerivative;
+    }
+
+    Eigen::Vector6d cartesianState;
+    cartesianState << position, velocity * 2.0 / segmentLength_;
+    return cartesianState;
+}
+
+//! Function to create a Chebyshev ephemeris by fitting the position from a state function, with error control
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemeris(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int numberOfCoefficients,
+        const int maximumNumberOfSegments,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation )
+{
+    if( numberOfCoefficients < 2 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, at least 2 coefficients are required" );
+    }
+
+    if( !( finalTime > initialTime ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, final time must be larger than initial time" );
+    }
+
+    // Compute Chebyshev nodes (at which the series is fit), and nodes at which the fit is checked (extrema of the
+    // highest-degree polynomial and segment boundaries)
+    Eigen::VectorXd fitNodes = Eigen::VectorXd( numberOfCoefficients );
+    for( int k = 0; k < numberOfCoefficients; k++ )
+    {
+        fitNodes( k ) = std::cos( mathematical_constants::PI * ( static_cast< double >( k ) + 0.5 ) /
+                                  static_cast< double >( numberOfCoefficients ) );
+    }
+
+    Eigen::VectorXd checkNodes = Eigen::VectorXd( numberOfCoefficients + 1 );
+    for( int k = 0; k <= numberOfCoefficients; k++ )
+    {
+        checkNodes( k ) = std::cos( mathematical_constants::PI * static_cast< double >( k ) /
+                                    static_cast< double >( numberOfCoefficients ) );
+    }
+
+    // Double number of segments until tolerances are met in all segments
+    Eigen::MatrixXd chebyshevCoefficients;
+    Eigen::MatrixXd positionsAtNodes = Eigen::MatrixXd( numberOfCoefficients, 3 );
+    Eigen::MatrixXd polynomialsAtNodes = Eigen::MatrixXd( numberOfCoefficients, numberOfCoefficients );
+    for( int numberOfSegments = 1; numberOfSegments <= maximumNumberOfSegments; numberOfSegments *= 2 )
+    {
+        const double segmentLength = ( finalTime - initialTime ) / static_cast< double >( numberOfSegments );
+
+        // Fit coefficients of each segment
+        chebyshevCoefficients.resize( numberOfCoefficients, 3 * numberOfSegments );
+        for( int i = 0; i < numberOfSegments; i++ )
+        {
+            // Since the times of the nodes are rounded, the series is fit at the normalized times that are actually used
+            // when evaluating the ephemeris at these times (instead of the exact Chebyshev nodes).
+            const double segmentStartTime = initialTime + static_cast< double >( i ) * segmentLength;
+            for( int k = 0; k < numberOfCoefficients; k++ )
+            {
+                const double currentTime = segmentStartTime + 0.5 * segmentLength * ( fitNodes( k ) + 1.0 );
+                const double normalizedTime =
+                        2.0 * ( currentTime - initialTime - i * segmentLength ) / segmentLength - 1.0;
+
+                polynomialsAtNodes( k, 0 ) = 1.0;
+                polynomialsAtNodes( k, 1 ) = normalizedTime;
+                for( int j = 2; j < numberOfCoefficients; j++ )
+                {
+                    polynomialsAtNodes( k, j ) =
+                            2.0 * normalizedTime * polynomialsAtNodes( k, j - 1 ) - polynomialsAtNodes( k, j - 2 );
+                }
+                positionsAtNodes.row( k ) = stateFunction( currentTime ).segment( 0, 3 ).transpose( );
+            }
+            chebyshevCoefficients.block( 0, 3 * i, numberOfCoefficients, 3 ) =
+                    polynomialsAtNodes.partialPivLu( ).solve( positionsAtNodes );
+        }
+
+        // Check fit of each segment, and stop at first segment violating the tolerances
+        std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = std::make_shared< ChebyshevEphemeris >(
+                    chebyshevCoefficients, initialTime, finalTime, referenceFrameOrigin, referenceFrameOrientation );
+        bool isFitConverged = true;
+        for( int i = 0; ( i < numberOfSegments ) && isFitConverged; i++ )
+        {
+            const double segmentStartTime = initialTime + static_cast< double >( i ) * segmentLength;
+            for( int k = 0; k <= numberOfCoefficients; k++ )
+            {
+                const double currentTime = std::min( std::max(
+                        segmentStartTime + 0.5 * segmentLength * ( checkNodes( k ) + 1.0 ), initialTime ), finalTime );
+                const Eigen::Vector6d stateDifference =
+                        chebyshevEphemeris->getCartesianState( currentTime ) - stateFunction( currentTime );
+                if( ( stateDifference.segment( 0, 3 ).norm( ) > positionTolerance ) ||
+                        ( stateDifference.segment( 3, 3 ).norm( ) > velocityTolerance ) )
+                {
+                    isFitConverged = false;
+                    break;
+                }
+            }
+        }
+
+        if( isFitConverged )
+        {
+            return chebyshevEphemeris;
+        }
+    }
+
+    throw std::runtime_error( "Error when creating Chebyshev ephemeris, tolerances not met with maximum number of " +
+                              std::to_string( maximumNumberOfSegments ) + " segments" );
+}
+
+//! Function to create a Chebyshev ephemeris by fitting the position from an existing ephemeris, with error control
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemeris(
+        const std::shared_ptr< Ephemeris > sourceEphemeris,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int numberOfCoefficients,
+        const int maximumNumberOfSegments )
+{
+    if( sourceEphemeris == nullptr )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, source ephemeris is not defined" );
+    }
+
+    return createChebyshevEphemeris(
+                [ = ]( const double currentTime ){ return sourceEphemeris->getCartesianState( currentTime ); },
+                initialTime, finalTime, positionTolerance, velocityTolerance, numberOfCoefficients,
+                maximumNumberOfSegments, sourceEphemeris->getReferenceFrameOrigin( ),
+                sourceEphemeris->getReferenceFrameOrientation( ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
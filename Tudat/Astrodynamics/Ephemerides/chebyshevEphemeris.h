@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <functional>
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Ephemeris derived class that computes the state from piecewise Chebyshev polynomials of the position.
+/*!
+ *  Ephemeris derived class that computes the state from piecewise Chebyshev polynomials of the position, in the same
+ *  manner as the JPL DE ephemerides. The time interval on which the ephemeris is valid is divided into segments of equal
+ *  length, so that the segment containing a given time is found directly (without search). In each segment, each
+ *  position component is represented by a Chebyshev series in the normalized time in the segment, and the velocity is
+ *  computed from the derivative of this series. The coefficients of all segments are stored in a single contiguous
+ *  matrix. An object of this class is typically created by the createChebyshevEphemeris function, which fits the
+ *  coefficients to an existing (e.g. Spice) ephemeris.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param chebyshevCoefficients Chebyshev coefficients of all segments. Each row corresponds to a single degree of the
+     *  Chebyshev polynomials; columns 3*i, 3*i+1 and 3*i+2 contain the coefficients of the x-, y- and z-position in
+     *  segment i.
+     *  \param initialTime Start time of the first segment
+     *  \param finalTime End time of the last segment
+     *  \param referenceFrameOrigin Origin of reference frame (string identifier) (default SSB).
+     *  \param referenceFrameOrientation Orientation of reference frame (string identifier) (default ECLIPJ2000).
+     */
+    ChebyshevEphemeris( const Eigen::MatrixXd& chebyshevCoefficients,
+                        const double initialTime,
+                        const double finalTime,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Function to get state from ephemeris.
+    /*!
+     *  Returns state from ephemeris at given time, evaluated from the Chebyshev series of the segment containing the time.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated (must be in the interval
+     *  between the initial and final time of the ephemeris).
+     *  \return Cartesian state at given time.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to retrieve the Chebyshev coefficients of all segments
+    /*!
+     *  Function to retrieve the Chebyshev coefficients of all segments (see constructor for ordering)
+     *  \return Chebyshev coefficients of all segments
+     */
+    Eigen::MatrixXd getChebyshevCoefficients( )
+    {
+        return chebyshevCoefficients_;
+    }
+
+    //! Function to retrieve the start time of the first segment
+    /*!
+     *  Function to retrieve the start time of the first segment
+     *  \return Start time of the first segment
+     */
+    double getInitialTime( )
+    {
+        return initialTime_;
+    }
+
+    //! Function to retrieve the end time of the last segment
+    /*!
+     *  Function to retrieve the end time of the last segment
+     *  \return End time of the last segment
+     */
+    double getFinalTime( )
+    {
+        return finalTime_;
+    }
+
+    //! Function to retrieve the length of each of the segments
+    /*!
+     *  Function to retrieve the length of each of the segments
+     *  \return Length of each of the segments
+     */
+    double getSegmentLength( )
+    {
+        return segmentLength_;
+    }
+
+    //! Function to retrieve the number of segments
+    /*!
+     *  Function to retrieve the number of segments
+     *  \return Number of segments
+     */
+    int getNumberOfSegments( )
+    {
+        return numberOfSegments_;
+    }
+
+    //! Function to retrieve the number of Chebyshev coefficients per position component per segment
+    /*!
+     *  Function to retrieve the number of Chebyshev coefficients per position component per segment
+     *  \return Number of Chebyshev coefficients per position component per segment
+     */
+    int getNumberOfCoefficients( )
+    {
+        return static_cast< int >( chebyshevCoefficients_.rows( ) );
+    }
+
+private:
+
+    //! Chebyshev coefficients of all segments (see constructor for ordering)
+    Eigen::MatrixXd chebyshevCoefficients_;
+
+    //! Start time of the first segment
+    double initialTime_;
+
+    //! End time of the last segment
+    double finalTime_;
+
+    //! Number of segments
+    int numberOfSegments_;
+
+    //! Length of each of the segments
+    double segmentLength_;
+};
+
+//! Function to create a Chebyshev ephemeris by fitting the position from a state function, with error control
+/*!
+ *  Function to create a Chebyshev ephemeris by fitting the position from a state function, with error control. The
+ *  time interval is divided into segments of equal length, and in each segment the Chebyshev series interpolating the
+ *  position at the Chebyshev nodes of the segment is computed. The position and velocity computed from the series are
+ *  then compared to those of the state function at the extrema of the highest-degree Chebyshev polynomial (including the
+ *  segment boundaries). If the difference exceeds the tolerance in any of the segments, the number of segments is
+ *  doubled and the fit is repeated, until the tolerances are met.
+ *  \param stateFunction Function returning the Cartesian state as a function of time, to which the ephemeris is fit
+ *  \param initialTime Start time of the interval on which the ephemeris is to be valid
+ *  \param finalTime End time of the interval on which the ephemeris is to be valid
+ *  \param positionTolerance Maximum permitted difference in position (norm) w.r.t. the state function
+ *  \param velocityTolerance Maximum permitted difference in velocity (norm) w.r.t. the state function
+ *  \param numberOfCoefficients Number of Chebyshev coefficients per position component per segment
+ *  \param maximumNumberOfSegments Maximum number of segments, an exception is thrown if the tolerances are not met
+ *  with this number of segments.
+ *  \param referenceFrameOrigin Origin of reference frame (string identifier) of the state function
+ *  \param referenceFrameOrientation Orientation of reference frame (string identifier) of the state function
+ *  \return Chebyshev ephemeris meeting the tolerances w.r.t. the state function
+ */
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemeris(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance = 1.0E-3,
+        const double velocityTolerance = 1.0E-6,
+        const int numberOfCoefficients = 14,
+        const int maximumNumberOfSegments = 1048576,
+        const std::string& referenceFrameOrigin = "SSB",
+        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+//! Function to create a Chebyshev ephemeris by fitting the position from an existing ephemeris, with error control
+/*!
+ *  Function to create a Chebyshev ephemeris by fitting the position from an existing ephemeris (e.g. a Spice
+ *  ephemeris), with error control, in the same frame as the existing ephemeris (see function above for details).
+ *  \param sourceEphemeris Ephemeris to which the Chebyshev ephemeris is fit
+ *  \param initialTime Start time of the interval on which the ephemeris is to be valid
+ *  \param finalTime End time of the interval on which the ephemeris is to be valid
+ *  \param positionTolerance Maximum permitted difference in position (norm) w.r.t. the existing ephemeris
+ *  \param velocityTolerance Maximum permitted difference in velocity (norm) w.r.t. the existing ephemeris
+ *  \param numberOfCoefficients Number of Chebyshev coefficients per position component per segment
+ *  \param maximumNumberOfSegments Maximum number of segments, an exception is thrown if the tolerances are not met
+ *  with this number of segments.
+ *  \return Chebyshev ephemeris meeting the tolerances w.r.t. the existing ephemeris
+ */
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemeris(
+        const std::shared_ptr< Ephemeris > sourceEphemeris,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance = 1.0E-3,
+        const double velocityTolerance = 1.0E-6,
+        const int numberOfCoefficients = 14,
+        const int maximumNumberOfSegments = 1048576 );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
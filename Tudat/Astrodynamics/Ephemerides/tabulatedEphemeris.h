@@ -13,6 +13,7 @@
 #define TUDAT_TABULATEDEPHEMERIS_H
 
 #include <map>
+#include <vector>
 #include <boost/make_shared.hpp>
 
 #include <Eigen/Core>
@@ -251,16 +252,40 @@ std::shared_ptr< Ephemeris > getTabulatedEphemeris(
 {
     typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
 
-    // Create state map that is to be interpolated
-    std::map< TimeType, StateType >  stateMap;
+    // Create times at which ephemeris is to be tabulated
+    std::vector< TimeType > tabulationTimes;
     TimeType currentTime = startTime;
     while( currentTime <= endTime )
     {
-        stateMap[ currentTime ] = ephemerisToInterrogate->getTemplatedStateFromEphemeris<
-                StateScalarType, TimeType >( currentTime );
+        tabulationTimes.push_back( currentTime );
         currentTime += timeStep;
     }
 
+    // If ephemeris is itself tabulated (with same types), re-sample its interpolator in a single call, otherwise
+    // interrogate ephemeris at each time.
+    std::vector< StateType > tabulatedStates;
+    std::shared_ptr< TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemerisToInterrogate =
+            std::dynamic_pointer_cast< TabulatedCartesianEphemeris< StateScalarType, TimeType > >( ephemerisToInterrogate );
+    if( tabulatedEphemerisToInterrogate != nullptr && tabulatedEphemerisToInterrogate->getInterpolator( ) != nullptr )
+    {
+        tabulatedStates = tabulatedEphemerisToInterrogate->getInterpolator( )->interpolateMultipleValues( tabulationTimes );
+    }
+    else
+    {
+        for( unsigned int i = 0; i < tabulationTimes.size( ); i++ )
+        {
+            tabulatedStates.push_back( ephemerisToInterrogate->getTemplatedStateFromEphemeris<
+                                       StateScalarType, TimeType >( tabulationTimes.at( i ) ) );
+        }
+    }
+
+    // Create state map that is to be interpolated
+    std::map< TimeType, StateType >  stateMap;
+    for( unsigned int i = 0; i < tabulationTimes.size( ); i++ )
+    {
+        stateMap[ tabulationTimes.at( i ) ] = tabulatedStates.at( i );
+    }
+
     // Create tabulated ephemeris model
     return std::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                 interpolators::createOneDimensionalInterpolator( stateMap, interpolatorSettings ),
@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsBatchEvaluator.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::gravitation;
+
+//! Function to create a spherical harmonic gravity field with random coefficients with a Kaula-like decay in magnitude
+std::shared_ptr< SphericalHarmonicsGravityField > getTestGravityField( const int maximumDegree, const int maximumOrder )
+{
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumOrder + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= maximumOrder; order++ )
+        {
+            double scaling = ( degree == 0 || order > degree ) ? 0.0 : 1.0E-3 / static_cast< double >( degree * degree );
+            cosineCoefficients( degree, order ) *= scaling;
+            sineCoefficients( degree, order ) *= ( order == 0 ) ? 0.0 : scaling;
+        }
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+
+    return std::make_shared< SphericalHarmonicsGravityField >(
+                3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients );
+}
+
+//! Function to generate random body-fixed positions at a distance between 1.05 and 3 reference radii
+Eigen::Matrix3Xd getTestPositions( const int numberOfPoints )
+{
+    Eigen::Matrix3Xd positions = Eigen::Matrix3Xd::Random( 3, numberOfPoints );
+    Eigen::VectorXd distances = 6378137.0 * ( 2.025 + 0.975 * Eigen::VectorXd::Random( numberOfPoints ).array( ) );
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        positions.col( i ) *= distances( i ) / positions.col( i ).norm( );
+    }
+    return positions;
+}
+
+BOOST_AUTO_TEST_SUITE( test_spherical_harmonics_batch_evaluator )
+
+//! Test whether batch potentials and gradients are equal to single-point evaluations, for different numbers of threads
+BOOST_AUTO_TEST_CASE( testBatchPotentialAndGradient )
+{
+    std::vector< std::pair< int, int > > testDegreesAndOrders = { { 0, 0 }, { 4, 2 }, { 20, 20 }, { 100, 60 } };
+
+    for( unsigned int i = 0; i < testDegreesAndOrders.size( ); i++ )
+    {
+        std::shared_ptr< SphericalHarmonicsGravityField > gravityField = getTestGravityField(
+                    testDegreesAndOrders.at( i ).first, testDegreesAndOrders.at( i ).second );
+
+        // Use number of points that is not a multiple of the tile size.
+        Eigen::Matrix3Xd positions = getTestPositions( 37 );
+
+        Eigen::Matrix3Xd singleThreadGradients, multiThreadGradients;
+        Eigen::VectorXd singleThreadPotentials, multiThreadPotentials;
+        std::vector< Eigen::Matrix3d > potentialHessians;
+
+        gravityField->computePotentialsAndDerivatives(
+                    positions, singleThreadGradients, singleThreadPotentials, potentialHessians );
+        BOOST_CHECK_EQUAL( potentialHessians.size( ), 0 );
+
+        gravityField->setNumberOfBatchEvaluationThreads( 4 );
+        gravityField->computePotentialsAndDerivatives(
+                    positions, multiThreadGradients, multiThreadPotentials, potentialHessians );
+        Eigen::Matrix3Xd gradients = gravityField->getGradientsOfPotential( positions );
+
+        for( int j = 0; j < positions.cols( ); j++ )
+        {
+            // Results must be independent of the number of threads.
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_EQUAL( singleThreadGradients( k, j ), multiThreadGradients( k, j ) );
+                BOOST_CHECK_EQUAL( singleThreadGradients( k, j ), gradients( k, j ) );
+            }
+            BOOST_CHECK_EQUAL( singleThreadPotentials( j ), multiThreadPotentials( j ) );
+
+            // Compare to single-point evaluation.
+            Eigen::Vector3d expectedGradient = gravityField->getGradientOfPotential( positions.col( j ) );
+            double expectedPotential = gravityField->getGravitationalPotential( positions.col( j ) );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( ( gradients( k, j ) - expectedGradient( k ) ) / expectedGradient.norm( ), 1.0E-13 );
+            }
+            BOOST_CHECK_SMALL( ( singleThreadPotentials( j ) - expectedPotential ) / expectedPotential, 1.0E-13 );
+        }
+    }
+
+    // Check empty batch
+    SphericalHarmonicsBatchEvaluator batchEvaluator( 10, 10, 2 );
+    Eigen::Matrix3Xd emptyGradients = batchEvaluator.computePotentialGradients(
+                Eigen::Matrix3Xd::Zero( 3, 0 ), 1.0, 1.0, Eigen::MatrixXd::Identity( 11, 11 ),
+                Eigen::MatrixXd::Zero( 11, 11 ) );
+    BOOST_CHECK_EQUAL( emptyGradients.cols( ), 0 );
+
+    // Check that field exceeding evaluator degree is rejected
+    BOOST_CHECK_THROW( batchEvaluator.computePotentialGradients(
+                           getTestPositions( 3 ), 1.0, 1.0, Eigen::MatrixXd::Identity( 12, 12 ),
+                           Eigen::MatrixXd::Zero( 12, 12 ) ), std::runtime_error );
+}
+
+//! Test whether batch second derivatives are consistent with numerical differentiation of the gradient
+BOOST_AUTO_TEST_CASE( testBatchSecondDerivatives )
+{
+    std::shared_ptr< SphericalHarmonicsGravityField > gravityField = getTestGravityField( 30, 30 );
+    Eigen::Matrix3Xd positions = getTestPositions( 11 );
+
+    Eigen::Matrix3Xd gradients;
+    Eigen::VectorXd potentials;
+    std::vector< Eigen::Matrix3d > potentialHessians;
+    gravityField->computePotentialsAndDerivatives( positions, gradients, potentials, potentialHessians, true );
+    BOOST_CHECK_EQUAL( potentialHessians.size( ), 11 );
+
+    // Compute central differences of gradient for all points and perturbation directions in a single batch
+    const double positionPerturbation = 10.0;
+    Eigen::Matrix3Xd perturbedPositions( 3, 6 * positions.cols( ) );
+    for( int j = 0; j < positions.cols( ); j++ )
+    {
+        for( int k = 0; k < 3; k++ )
+        {
+            perturbedPositions.col( 6 * j + 2 * k ) = positions.col( j ) + positionPerturbation * Eigen::Vector3d::Unit( k );
+            perturbedPositions.col( 6 * j + 2 * k + 1 ) = positions.col( j ) -
+                    positionPerturbation * Eigen::Vector3d::Unit( k );
+        }
+    }
+    Eigen::Matrix3Xd perturbedGradients = gravityField->getGradientsOfPotential( perturbedPositions );
+
+    for( int j = 0; j < positions.cols( ); j++ )
+    {
+        Eigen::Matrix3d numericalHessian;
+        for( int k = 0; k < 3; k++ )
+        {
+            numericalHessian.col( k ) = ( perturbedGradients.col( 6 * j + 2 * k ) -
+                                          perturbedGradients.col( 6 * j + 2 * k + 1 ) ) / ( 2.0 * positionPerturbation );
+        }
+
+        double hessianNorm = potentialHessians.at( j ).norm( );
+        for( int k = 0; k < 3; k++ )
+        {
+            for( int l = 0; l < 3; l++ )
+            {
+                BOOST_CHECK_SMALL( ( potentialHessians.at( j )( k, l ) - numericalHessian( k, l ) ) / hessianNorm,
+                                   1.0E-7 );
+                BOOST_CHECK_SMALL( ( potentialHessians.at( j )( k, l ) - potentialHessians.at( j )( l, k ) ) /
+                                   hessianNorm, 1.0E-14 );
+            }
+        }
+
+        // Potential satisfies Laplace equation outside of body
+        BOOST_CHECK_SMALL( potentialHessians.at( j ).trace( ) / hessianNorm, 1.0E-12 );
+    }
+}
+
+//! Compare computation times of batch and single-point evaluation.
+BOOST_AUTO_TEST_CASE( testBatchEvaluationTimes )
+{
+    std::shared_ptr< SphericalHarmonicsGravityField > gravityField = getTestGravityField( 200, 200 );
+    Eigen::Matrix3Xd positions = getTestPositions( 256 );
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+    Eigen::Matrix3Xd singlePointGradients( 3, positions.cols( ) );
+    for( int j = 0; j < positions.cols( ); j++ )
+    {
+        singlePointGradients.col( j ) = gravityField->getGradientOfPotential( positions.col( j ) );
+    }
+    double singlePointTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    startTime = std::chrono::steady_clock::now( );
+    Eigen::Matrix3Xd batchGradients = gravityField->getGradientsOfPotential( positions );
+    double batchTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+    std::cout << "Degree/order 200/200, 256 points: single-point " << singlePointTime << " s, batch (1 thread) "
+              << batchTime << " s (speed-up " << singlePointTime / batchTime << ")" << std::endl;
+
+    BOOST_CHECK_SMALL( ( singlePointGradients - batchGradients ).norm( ) / singlePointGradients.norm( ), 1.0E-13 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
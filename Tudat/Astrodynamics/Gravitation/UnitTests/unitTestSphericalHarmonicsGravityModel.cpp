@@ -296,6 +296,13 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationWrapperCla
 
     // Check if expected result matches computed result.
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, acceleration, 1.0e-15 );
+
+    // Check if result is unchanged (up to round-off) when using the blocked spherical harmonics kernel.
+    earthGravity->setUseBlockedSphericalHarmonicsKernel( true );
+    earthGravity->resetTime( TUDAT_NAN );
+    earthGravity->updateMembers( 0.0 );
+    BOOST_CHECK( earthGravity->getBlockedSphericalHarmonicsKernel( ) != nullptr );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, earthGravity->getAcceleration( ), 1.0e-14 );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
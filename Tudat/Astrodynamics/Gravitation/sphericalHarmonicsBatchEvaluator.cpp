@@ -0,0 +1,148 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsBatchEvaluator.h"
+#include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+using basic_mathematics::BlockedSphericalHarmonicsTileKernel;
+
+//! Constructor
+SphericalHarmonicsBatchEvaluator::SphericalHarmonicsBatchEvaluator(
+        const int maximumDegree, const int maximumOrder, const unsigned int numberOfThreads ):
+    maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ),
+    numberOfThreads_( ( numberOfThreads == 0 ) ? utilities::getNumberOfAvailableThreads( ) : numberOfThreads )
+{
+    for( unsigned int i = 0; i < numberOfThreads_; i++ )
+    {
+        tileKernels_.push_back( std::make_shared< BlockedSphericalHarmonicsTileKernel >(
+                                    maximumDegree_, maximumOrder_ ) );
+    }
+}
+
+//! Function to compute the potential, its gradient and (optionally) its second derivatives at a batch of points.
+void SphericalHarmonicsBatchEvaluator::evaluate(
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        Eigen::Matrix3Xd& potentialGradients,
+        Eigen::VectorXd& potentials,
+        std::vector< Eigen::Matrix3d >& potentialHessians,
+        const bool computeSecondDerivatives )
+{
+    const int numberOfPoints = static_cast< int >( bodyFixedPositions.cols( ) );
+    const int tileSize = BlockedSphericalHarmonicsTileKernel::tileSize;
+    const int numberOfTiles = ( numberOfPoints + tileSize - 1 ) / tileSize;
+
+    potentialGradients.resize( 3, numberOfPoints );
+    potentials.resize( numberOfPoints );
+    if( computeSecondDerivatives )
+    {
+        potentialHessians.resize( numberOfPoints );
+    }
+
+    if( numberOfPoints == 0 )
+    {
+        return;
+    }
+
+    const double preMultiplier = gravitationalParameter / referenceRadius;
+
+    // Evaluate single tile of points, using the kernel of the current thread
+    auto evaluateTile = [ & ]( const unsigned int tileIndex, const unsigned int threadIndex )
+    {
+        std::shared_ptr< BlockedSphericalHarmonicsTileKernel > tileKernel = tileKernels_.at( threadIndex );
+
+        // Set spherical positions of points in tile; unused entries are filled with the last point of the tile.
+        const int firstPointIndex = tileIndex * tileSize;
+        const int numberOfPointsInTile = std::min( tileSize, numberOfPoints - firstPointIndex );
+
+        BlockedSphericalHarmonicsTileKernel::TileArray radii, polynomialParameters, longitudes;
+        for( int i = 0; i < tileSize; i++ )
+        {
+            const int pointIndex = firstPointIndex + std::min( i, numberOfPointsInTile - 1 );
+            radii( i ) = bodyFixedPositions.col( pointIndex ).norm( );
+            polynomialParameters( i ) = bodyFixedPositions( 2, pointIndex ) / radii( i );
+            longitudes( i ) = std::atan2( bodyFixedPositions( 1, pointIndex ), bodyFixedPositions( 0, pointIndex ) );
+        }
+
+        tileKernel->update( radii, polynomialParameters, longitudes, referenceRadius );
+        tileKernel->computeSphericalQuantities(
+                    preMultiplier, cosineHarmonicCoefficients, sineHarmonicCoefficients, computeSecondDerivatives );
+
+        // Convert spherical results to Cartesian results.
+        for( int i = 0; i < numberOfPointsInTile; i++ )
+        {
+            const int pointIndex = firstPointIndex + i;
+            const Eigen::Vector3d cartesianPosition = bodyFixedPositions.col( pointIndex );
+            const Eigen::Vector3d sphericalGradient = tileKernel->getSphericalGradients( ).row( i ).transpose( );
+            const Eigen::Matrix3d sphericalToCartesianGradientMatrix =
+                    coordinate_conversions::getSphericalToCartesianGradientMatrix( cartesianPosition );
+
+            potentials( pointIndex ) = tileKernel->getPotentials( )( i, 0 );
+            potentialGradients.col( pointIndex ) = sphericalToCartesianGradientMatrix * sphericalGradient;
+
+            if( computeSecondDerivatives )
+            {
+                const BlockedSphericalHarmonicsTileKernel::TileBlock& sphericalHessianEntries =
+                        tileKernel->getSphericalHessians( );
+                Eigen::Matrix3d sphericalHessian;
+                sphericalHessian <<
+                        sphericalHessianEntries( i, 0 ), sphericalHessianEntries( i, 1 ), sphericalHessianEntries( i, 2 ),
+                        sphericalHessianEntries( i, 1 ), sphericalHessianEntries( i, 3 ), sphericalHessianEntries( i, 4 ),
+                        sphericalHessianEntries( i, 2 ), sphericalHessianEntries( i, 4 ), sphericalHessianEntries( i, 5 );
+
+                // Convert to Cartesian Hessian, and add effect of change in conversion matrix
+                potentialHessians[ pointIndex ] =
+                        sphericalToCartesianGradientMatrix * sphericalHessian *
+                        sphericalToCartesianGradientMatrix.transpose( ) +
+                        coordinate_conversions::getDerivativeOfSphericalToCartesianGradient(
+                            sphericalGradient, cartesianPosition );
+            }
+        }
+    };
+
+    utilities::executeParallelTasks(
+                numberOfTiles, std::min( numberOfThreads_, static_cast< unsigned int >( numberOfTiles ) ),
+                evaluateTile );
+}
+
+//! Function to compute the gradient of the potential at a batch of points.
+Eigen::Matrix3Xd SphericalHarmonicsBatchEvaluator::computePotentialGradients(
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    Eigen::Matrix3Xd potentialGradients;
+    Eigen::VectorXd potentials;
+    std::vector< Eigen::Matrix3d > potentialHessians;
+    evaluate( bodyFixedPositions, gravitationalParameter, referenceRadius,
+              cosineHarmonicCoefficients, sineHarmonicCoefficients,
+              potentialGradients, potentials, potentialHessians, false );
+    return potentialGradients;
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,147 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_SPHERICAL_HARMONICS_BATCH_EVALUATOR_H
+#define TUDAT_SPHERICAL_HARMONICS_BATCH_EVALUATOR_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/blockedSphericalHarmonics.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class for the evaluation of a geodesy-normalized spherical harmonic gravity field at a batch of points.
+/*!
+ *  Class for the evaluation of the potential, the gradient of the potential (i.e. the gravitational acceleration) and,
+ *  optionally, the second derivatives of the potential of a geodesy-normalized spherical harmonic gravity field at a batch
+ *  of (body-fixed) points, such as required for gravity field grid generation, numerical differentiation or the
+ *  evaluation of a single field for multiple spacecraft. The points are divided into tiles, which are evaluated using a
+ *  BlockedSphericalHarmonicsTileKernel, so that the coefficients are loaded once per tile instead of once per point.
+ *  The tiles are distributed over a fixed number of threads, each of which uses its own kernel; the results do not
+ *  depend on the number of threads.
+ */
+class SphericalHarmonicsBatchEvaluator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param maximumDegree Maximum degree of fields that can be evaluated.
+     *  \param maximumOrder Maximum order of fields that can be evaluated.
+     *  \param numberOfThreads Number of threads over which the points are distributed (if 0, the number of threads that
+     *  can be executed concurrently on the current hardware is used).
+     */
+    SphericalHarmonicsBatchEvaluator( const int maximumDegree,
+                                      const int maximumOrder,
+                                      const unsigned int numberOfThreads = 1 );
+
+    //! Function to compute the potential, its gradient and (optionally) its second derivatives at a batch of points.
+    /*!
+     *  Function to compute the potential, its gradient and (optionally) its second derivatives at a batch of points,
+     *  summed over all degrees and orders of the coefficient matrices.
+     *  \param bodyFixedPositions Positions at which the field is to be evaluated, in the body-fixed frame (one column per
+     *  point).
+     *  \param gravitationalParameter Gravitational parameter of the body.
+     *  \param referenceRadius Reference radius of the spherical harmonic expansion.
+     *  \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (row index: degree; column index: order).
+     *  \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (row index: degree; column index: order).
+     *  \param potentialGradients Gradient of the potential at each point, in the body-fixed frame (returned by reference).
+     *  \param potentials Potential at each point (returned by reference).
+     *  \param potentialHessians Second derivatives of the potential w.r.t. the body-fixed position at each point
+     *  (returned by reference; only set if computeSecondDerivatives is true).
+     *  \param computeSecondDerivatives Boolean denoting whether the second derivatives are to be computed.
+     */
+    void evaluate( const Eigen::Matrix3Xd& bodyFixedPositions,
+                   const double gravitationalParameter,
+                   const double referenceRadius,
+                   const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                   const Eigen::MatrixXd& sineHarmonicCoefficients,
+                   Eigen::Matrix3Xd& potentialGradients,
+                   Eigen::VectorXd& potentials,
+                   std::vector< Eigen::Matrix3d >& potentialHessians,
+                   const bool computeSecondDerivatives = false );
+
+    //! Function to compute the gradient of the potential at a batch of points.
+    /*!
+     *  Function to compute the gradient of the potential at a batch of points, summed over all degrees and orders of the
+     *  coefficient matrices.
+     *  \param bodyFixedPositions Positions at which the field is to be evaluated, in the body-fixed frame (one column per
+     *  point).
+     *  \param gravitationalParameter Gravitational parameter of the body.
+     *  \param referenceRadius Reference radius of the spherical harmonic expansion.
+     *  \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (row index: degree; column index: order).
+     *  \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (row index: degree; column index: order).
+     *  \return Gradient of the potential at each point, in the body-fixed frame (one column per point).
+     */
+    Eigen::Matrix3Xd computePotentialGradients( const Eigen::Matrix3Xd& bodyFixedPositions,
+                                                const double gravitationalParameter,
+                                                const double referenceRadius,
+                                                const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                                                const Eigen::MatrixXd& sineHarmonicCoefficients );
+
+    //! Function to get the maximum degree of fields that can be evaluated.
+    /*!
+     *  Function to get the maximum degree of fields that can be evaluated.
+     *  \return Maximum degree of fields that can be evaluated.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of fields that can be evaluated.
+    /*!
+     *  Function to get the maximum order of fields that can be evaluated.
+     *  \return Maximum order of fields that can be evaluated.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to get the number of threads over which the points are distributed.
+    /*!
+     *  Function to get the number of threads over which the points are distributed.
+     *  \return Number of threads over which the points are distributed.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+private:
+
+    //! Maximum degree of fields that can be evaluated.
+    int maximumDegree_;
+
+    //! Maximum order of fields that can be evaluated.
+    int maximumOrder_;
+
+    //! Number of threads over which the points are distributed.
+    unsigned int numberOfThreads_;
+
+    //! Kernels used for the evaluation of the tiles (one per thread).
+    std::vector< std::shared_ptr< basic_mathematics::BlockedSphericalHarmonicsTileKernel > > tileKernels_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_SPHERICAL_HARMONICS_BATCH_EVALUATOR_H
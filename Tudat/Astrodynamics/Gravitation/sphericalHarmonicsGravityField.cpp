@@ -14,6 +14,7 @@
  *
  */
 
+#include <algorithm>
 #include <iomanip>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
@@ -99,6 +100,38 @@ double calculateSphericalHarmonicGravitationalPotential(
     return potential * gravitationalParameter / bodyFixedPosition.norm( );
 }
 
+//! Get the gradient of the potential at a batch of points.
+Eigen::Matrix3Xd SphericalHarmonicsGravityField::getGradientsOfPotential( const Eigen::Matrix3Xd& bodyFixedPositions )
+{
+    Eigen::Matrix3Xd potentialGradients;
+    Eigen::VectorXd potentials;
+    std::vector< Eigen::Matrix3d > potentialHessians;
+    computePotentialsAndDerivatives( bodyFixedPositions, potentialGradients, potentials, potentialHessians, false );
+    return potentialGradients;
+}
+
+//! Function to compute the potential, its gradient and (optionally) its second derivatives at a batch of points.
+void SphericalHarmonicsGravityField::computePotentialsAndDerivatives(
+        const Eigen::Matrix3Xd& bodyFixedPositions,
+        Eigen::Matrix3Xd& potentialGradients,
+        Eigen::VectorXd& potentials,
+        std::vector< Eigen::Matrix3d >& potentialHessians,
+        const bool computeSecondDerivatives )
+{
+    // Create (or resize) batch evaluator if needed.
+    if( batchEvaluator_ == nullptr ||
+            batchEvaluator_->getMaximumDegree( ) < cosineCoefficients_.rows( ) - 1 ||
+            batchEvaluator_->getMaximumOrder( ) < std::min( cosineCoefficients_.rows( ), cosineCoefficients_.cols( ) ) - 1 )
+    {
+        batchEvaluator_ = std::make_shared< SphericalHarmonicsBatchEvaluator >(
+                    cosineCoefficients_.rows( ) - 1, cosineCoefficients_.cols( ) - 1, numberOfBatchEvaluationThreads_ );
+    }
+
+    batchEvaluator_->evaluate( bodyFixedPositions, gravitationalParameter_, referenceRadius_,
+                               cosineCoefficients_, sineCoefficients_,
+                               potentialGradients, potentials, potentialHessians, computeSecondDerivatives );
+}
+
 //! Function to determine a body's inertia tensor from its degree two unnormalized gravity field coefficients
 Eigen::Matrix3d getInertiaTensor(
         const double c20Coefficient,
@@ -28,6 +28,7 @@
 #include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsBatchEvaluator.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
 
 namespace tudat
@@ -88,7 +89,7 @@ public:
             const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) )
         : GravityFieldModel( gravitationalParameter, updateInertiaTensor ), referenceRadius_( referenceRadius ),
           cosineCoefficients_( cosineCoefficients ), sineCoefficients_( sineCoefficients ),
-          fixedReferenceFrame_( fixedReferenceFrame )
+          fixedReferenceFrame_( fixedReferenceFrame ), numberOfBatchEvaluationThreads_( 1 )
     {
         sphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder( cosineCoefficients_.rows( ) + 1,
@@ -285,6 +286,45 @@ public:
                     sineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ), sphericalHarmonicsCache_, dummyMap );
     }
 
+    //! Get the gradient of the potential at a batch of points.
+    /*!
+     *  Returns the gradient of the potential, expanded to the maximum degree and order of the field, at a batch of points,
+     *  using a SphericalHarmonicsBatchEvaluator (\sa setNumberOfBatchEvaluationThreads).
+     *  \param bodyFixedPositions Positions at which gradient of potential is to be determined (one column per point)
+     *  \return Gradient of potential at each point (one column per point).
+     */
+    Eigen::Matrix3Xd getGradientsOfPotential( const Eigen::Matrix3Xd& bodyFixedPositions );
+
+    //! Function to compute the potential, its gradient and (optionally) its second derivatives at a batch of points.
+    /*!
+     *  Function to compute the potential, its gradient and (optionally) its second derivatives, expanded to the maximum
+     *  degree and order of the field, at a batch of points, using a SphericalHarmonicsBatchEvaluator
+     *  (\sa setNumberOfBatchEvaluationThreads).
+     *  \param bodyFixedPositions Positions at which the field is to be evaluated (one column per point)
+     *  \param potentialGradients Gradient of potential at each point (returned by reference).
+     *  \param potentials Potential at each point (returned by reference).
+     *  \param potentialHessians Second derivatives of potential w.r.t. body-fixed position at each point (returned by
+     *  reference; only set if computeSecondDerivatives is true).
+     *  \param computeSecondDerivatives Boolean denoting whether the second derivatives are to be computed.
+     */
+    void computePotentialsAndDerivatives( const Eigen::Matrix3Xd& bodyFixedPositions,
+                                          Eigen::Matrix3Xd& potentialGradients,
+                                          Eigen::VectorXd& potentials,
+                                          std::vector< Eigen::Matrix3d >& potentialHessians,
+                                          const bool computeSecondDerivatives = false );
+
+    //! Function to set the number of threads used for the evaluation of the field at a batch of points.
+    /*!
+     *  Function to set the number of threads used for the evaluation of the field at a batch of points
+     *  (default 1; if 0, the number of threads that can be executed concurrently on the current hardware is used).
+     *  \param numberOfBatchEvaluationThreads Number of threads used for the evaluation of the field at a batch of points.
+     */
+    void setNumberOfBatchEvaluationThreads( const unsigned int numberOfBatchEvaluationThreads )
+    {
+        numberOfBatchEvaluationThreads_ = numberOfBatchEvaluationThreads;
+        batchEvaluator_ = nullptr;
+    }
+
     //! Function to retrieve the tdentifier for body-fixed reference frame
     /*!
      *  Function to retrieve the tdentifier for body-fixed reference frame
@@ -343,6 +383,12 @@ protected:
 
     //! Cache object for potential calculations.
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
+
+    //! Number of threads used for the evaluation of the field at a batch of points.
+    unsigned int numberOfBatchEvaluationThreads_;
+
+    //! Object used for the evaluation of the field at a batch of points (created upon first use).
+    std::shared_ptr< SphericalHarmonicsBatchEvaluator > batchEvaluator_;
 };
 
 //! Function to determine a body's inertia tensor from its degree two unnormalized gravity field coefficients
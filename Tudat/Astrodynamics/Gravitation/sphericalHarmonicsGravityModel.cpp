@@ -127,6 +127,38 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
     return accelerationRotation * ( transformationToCartesianCoordinates * sphericalGradient );
 }
 
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization,
+//! using the blocked spherical harmonics kernel.
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        const std::shared_ptr< basic_mathematics::BlockedSphericalHarmonicsKernel > sphericalHarmonicsKernel,
+        const Eigen::Matrix3d& accelerationRotation )
+{
+    // Declare spherical position vector.
+    Eigen::Vector3d sphericalpositionOfBodySubjectToAcceleration = coordinate_conversions::
+            convertCartesianToSpherical( positionOfBodySubjectToAcceleration );
+    sphericalpositionOfBodySubjectToAcceleration( 1 ) = mathematical_constants::PI / 2.0 -
+            sphericalpositionOfBodySubjectToAcceleration( 1 );
+
+    sphericalHarmonicsKernel->update( sphericalpositionOfBodySubjectToAcceleration( 0 ),
+                                      std::sin( sphericalpositionOfBodySubjectToAcceleration( 1 ) ),
+                                      sphericalpositionOfBodySubjectToAcceleration( 2 ),
+                                      equatorialRadius );
+
+    // Compute gradient in spherical coordinates, summed over all terms.
+    Eigen::Vector3d sphericalGradient = sphericalHarmonicsKernel->computePotentialGradient(
+                gravitationalParameter / equatorialRadius, cosineHarmonicCoefficients, sineHarmonicCoefficients );
+
+    // Convert from spherical gradient to Cartesian gradient (which equals acceleration vector) and
+    // return the resulting acceleration vector.
+    return accelerationRotation * ( coordinate_conversions::getSphericalToCartesianGradientMatrix(
+                                        positionOfBodySubjectToAcceleration ) * sphericalGradient );
+}
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
@@ -26,6 +26,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModelBase.h"
+#include "Tudat/Mathematics/BasicMathematics/blockedSphericalHarmonics.h"
 #include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
 
 namespace tudat
@@ -93,6 +94,36 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const bool saveSeparateTerms = 0,
         const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
 
+//! Compute gravitational acceleration due to multiple spherical harmonics terms, defined using geodesy-normalization,
+//! using the blocked spherical harmonics kernel.
+/*!
+ * This function computes the acceleration caused by gravitational spherical harmonics, with the coefficients expressed
+ * using a geodesy-normalization (see computeGeodesyNormalizedGravitationalAccelerationSum with SphericalHarmonicsCache
+ * input for details). As opposed to that function, the summation over all terms is performed by a
+ * BlockedSphericalHarmonicsKernel, which is considerably faster for high degree and order, but does not provide the
+ * contributions of the separate terms.
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector with respect to the reference frame that is
+ *          associated with the harmonic coefficients.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics [m^3 s^-2].
+ * \param equatorialRadius Reference radius of the spherical harmonics [m].
+ * \param cosineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> cosine harmonic coefficients. The row index
+ *          indicates the degree and the column index indicates the order of coefficients.
+ * \param sineHarmonicCoefficients Matrix with <B>geodesy-normalized</B> sine harmonic coefficients. The matrix must be
+ *          equal in size to cosineHarmonicCoefficients.
+ * \param sphericalHarmonicsKernel Kernel with which the summation over all terms is performed; maximum degree and order
+ *          must be at least those of the coefficient matrices.
+ * \param accelerationRotation Rotation from body-fixed frame (in which coefficients are defined) to inertial frame.
+ * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
+ */
+Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double equatorialRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        const std::shared_ptr< basic_mathematics::BlockedSphericalHarmonicsKernel > sphericalHarmonicsKernel,
+        const Eigen::Matrix3d& accelerationRotation = Eigen::Matrix3d::Identity( ) );
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 /*!
  * This function computes the acceleration caused by a single gravitational spherical harmonics
@@ -341,16 +372,30 @@ public:
             currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
                         currentInertialRelativePosition_ );
 
-            currentAcceleration_ =
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_,
-                        accelerationPerTerm_,
-                        saveSphericalHarmonicTermsSeparately_,
-                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+            if( blockedSphericalHarmonicsKernel_ != nullptr && !saveSphericalHarmonicTermsSeparately_ )
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSum(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, blockedSphericalHarmonicsKernel_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+            }
+            else
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSum(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, sphericalHarmonicsCache_,
+                            accelerationPerTerm_,
+                            saveSphericalHarmonicTermsSeparately_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+            }
             currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
         }
     }
@@ -366,6 +411,17 @@ public:
     Eigen::VectorXd getAccelerationWithAlternativeCoefficients(
             const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients)
     {
+        if( blockedSphericalHarmonicsKernel_ != nullptr )
+        {
+            return computeGeodesyNormalizedGravitationalAccelerationSum(
+                        currentRelativePosition_,
+                        gravitationalParameter,
+                        equatorialRadius,
+                        cosineCoefficients,
+                        sineCoefficients, blockedSphericalHarmonicsKernel_,
+                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+        }
+
         std::map< std::pair< int, int >, Eigen::Vector3d > dummy;
         return computeGeodesyNormalizedGravitationalAccelerationSum(
                     currentRelativePosition_,
@@ -507,6 +563,36 @@ public:
         saveSphericalHarmonicTermsSeparately_ = saveSphericalHarmonicTermsSeparately;
     }
 
+    //! Function to set whether the blocked spherical harmonics kernel is to be used to compute the acceleration
+    /*!
+     * Function to set whether the blocked spherical harmonics kernel is to be used to compute the acceleration. The
+     * kernel is considerably faster for high degree and order fields, but results may differ from the term-by-term
+     * summation at the level of numerical round-off. The kernel is not used when the separate terms are to be saved.
+     * \param useBlockedKernel Boolean denoting whether the blocked spherical harmonics kernel is to be used.
+     */
+    void setUseBlockedSphericalHarmonicsKernel( const bool useBlockedKernel )
+    {
+        if( useBlockedKernel && blockedSphericalHarmonicsKernel_ == nullptr )
+        {
+            blockedSphericalHarmonicsKernel_ = std::make_shared< basic_mathematics::BlockedSphericalHarmonicsKernel >(
+                        maximumDegree_ - 1, maximumOrder_ - 1 );
+        }
+        else if( !useBlockedKernel )
+        {
+            blockedSphericalHarmonicsKernel_ = nullptr;
+        }
+    }
+
+    //! Function to retrieve the blocked spherical harmonics kernel (nullptr if not used)
+    /*!
+     * Function to retrieve the blocked spherical harmonics kernel (nullptr if not used)
+     * \return Blocked spherical harmonics kernel (nullptr if not used)
+     */
+    std::shared_ptr< basic_mathematics::BlockedSphericalHarmonicsKernel > getBlockedSphericalHarmonicsKernel( )
+    {
+        return blockedSphericalHarmonicsKernel_;
+    }
+
     //! Function to retrieve the contributions of separate degrees/ordesr to the acceleration, concatenated in a single vector
     /*!
      * Function to retrieve the contributions of specific separate degree/order to the acceleration, concatenated in a single
@@ -602,6 +688,9 @@ private:
     //!  Spherical harmonics cache for this acceleration
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
 
+    //! Blocked spherical harmonics kernel, used to compute the acceleration if not nullptr
+    std::shared_ptr< basic_mathematics::BlockedSphericalHarmonicsKernel > blockedSphericalHarmonicsKernel_;
+
     //! Current acceleration in inertial frame, as computed by last call to updateMembers function
     Eigen::Vector3d currentAcceleration_;
 
@@ -17,6 +17,8 @@
 #include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
 #include "Tudat/Astrodynamics/ObservationModels/UnitTests/testLightTimeCorrections.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
 
@@ -230,6 +232,95 @@ BOOST_AUTO_TEST_CASE( testLightWithSpice )
                                 1E-14 );
 }
 
+//! Test light-time calculation for a list of times, using solution at preceding times as initial guess.
+BOOST_AUTO_TEST_CASE( testLightTimeForListOfTimes )
+{
+    // Define transmitter and receiver on circular orbits (around origin), and count number of state function evaluations
+    int numberOfTransmitterEvaluations = 0, numberOfReceiverEvaluations = 0;
+    std::function< Eigen::Vector6d( const double ) > transmitterStateFunction = [ & ]( const double time )
+    {
+        numberOfTransmitterEvaluations++;
+        const double angle = 2.0E-7 * time;
+        return ( Eigen::Vector6d( ) << 1.5E11 * std::cos( angle ), 1.5E11 * std::sin( angle ), 0.0,
+                 -3.0E4 * std::sin( angle ), 3.0E4 * std::cos( angle ), 0.0 ).finished( );
+    };
+    std::function< Eigen::Vector6d( const double ) > receiverStateFunction = [ & ]( const double time )
+    {
+        numberOfReceiverEvaluations++;
+        const double angle = 1.0E-7 * time + 1.0;
+        return ( Eigen::Vector6d( ) << 2.3E11 * std::cos( angle ), 2.3E11 * std::sin( angle ), 0.0,
+                 -2.3E4 * std::sin( angle ), 2.3E4 * std::cos( angle ), 0.0 ).finished( );
+    };
+
+    // Create light-time calculator, with light-time corrections
+    std::vector< LightTimeCorrectionFunction > lightTimeCorrections;
+    lightTimeCorrections.push_back( &getTimeDifferenceLightTimeCorrection );
+    LightTimeCalculator< > lightTimeCalculator(
+                transmitterStateFunction, receiverStateFunction, lightTimeCorrections );
+
+    // Define times of 1 Hz pass
+    std::vector< double > times;
+    for( int i = 0; i < 3600; i++ )
+    {
+        times.push_back( 1.0E6 + static_cast< double >( i ) );
+    }
+
+    // Test for default tolerance, and for tolerance for which the solutions visibly differ
+    std::vector< double > tolerances = { getDefaultLightTimeTolerance< double >( ), 1.0E-7 };
+    for( unsigned int toleranceIndex = 0; toleranceIndex < tolerances.size( ); toleranceIndex++ )
+    {
+        const double tolerance = tolerances.at( toleranceIndex );
+        for( unsigned int isTimeAtReception = 0; isTimeAtReception < 2; isTimeAtReception++ )
+        {
+            // Compute light times and link end states for each time separately
+            std::vector< double > lightTimes;
+            std::vector< Eigen::Vector6d > receiverStates, transmitterStates;
+            Eigen::Vector6d receiverState, transmitterState;
+            numberOfTransmitterEvaluations = 0;
+            numberOfReceiverEvaluations = 0;
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                lightTimes.push_back( lightTimeCalculator.calculateLightTimeWithLinkEndsStates(
+                                          receiverState, transmitterState, times.at( i ), isTimeAtReception, tolerance ) );
+                receiverStates.push_back( receiverState );
+                transmitterStates.push_back( transmitterState );
+            }
+            int numberOfSingleTimeEvaluations = numberOfTransmitterEvaluations + numberOfReceiverEvaluations;
+
+            // Compute light times and link end states for list of times
+            std::vector< Eigen::Vector6d > listReceiverStates, listTransmitterStates;
+            numberOfTransmitterEvaluations = 0;
+            numberOfReceiverEvaluations = 0;
+            std::vector< double > listLightTimes = lightTimeCalculator.calculateLightTimesWithLinkEndsStates(
+                        listReceiverStates, listTransmitterStates, times, isTimeAtReception, tolerance );
+            int numberOfListEvaluations = numberOfTransmitterEvaluations + numberOfReceiverEvaluations;
+
+            // Check that light times differ by less than the tolerance (each solution is converged to well within the
+            // tolerance, but from a different initial guess). Link end states may then differ by the distance travelled
+            // in the light-time difference (velocities below 3.0E4 m/s), or by rounding error in the state functions.
+            BOOST_CHECK_EQUAL( listLightTimes.size( ), times.size( ) );
+            const double positionTolerance = std::max( 3.0E4 * tolerance, 1.0E-4 );
+            double maximumLightTimeDifference = 0.0;
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                maximumLightTimeDifference = std::max(
+                            maximumLightTimeDifference, std::fabs( listLightTimes.at( i ) - lightTimes.at( i ) ) );
+                BOOST_CHECK_SMALL( ( listReceiverStates.at( i ) - receiverStates.at( i ) ).segment( 0, 3 ).norm( ),
+                                   positionTolerance );
+                BOOST_CHECK_SMALL( ( listTransmitterStates.at( i ) - transmitterStates.at( i ) ).segment( 0, 3 ).norm( ),
+                                   positionTolerance );
+            }
+            BOOST_CHECK( maximumLightTimeDifference < tolerance );
+
+            // Check that fewer state evaluations are needed
+            if( toleranceIndex == 0 )
+            {
+                BOOST_CHECK( 2 * numberOfListEvaluations < numberOfSingleTimeEvaluations );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
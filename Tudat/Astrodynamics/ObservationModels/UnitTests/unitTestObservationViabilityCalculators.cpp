@@ -17,6 +17,7 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/testMacros.h"
 
 #include "Tudat/Astrodynamics/GroundStations/pointingAnglesCalculator.h"
@@ -776,6 +777,270 @@ BOOST_AUTO_TEST_CASE( testObservationViabilityCalculators )
     }
 }
 
+//! Test whether observations simulated in parallel are identical to those simulated serially
+/*!
+ *  Test whether observations simulated in parallel (distributing the sets of link ends over threads, or the blocks of
+ *  observation times of a single set of link ends over threads) are identical to those simulated serially, and whether
+ *  the block-wise viability checks give the same results as checking the viability of each observation separately.
+ *  Tabulated ephemerides and simple rotation models are used, since Spice may not be called from multiple threads.
+ */
+BOOST_AUTO_TEST_CASE( testParallelObservationSimulation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define observation times: one observation every 30 minutes, over a period of 180 days.
+    double initialTime = 0.0, finalTime = 180.0 * physical_constants::JULIAN_DAY, timeStep = 1800.0;
+    std::vector< double > observationTimes;
+    double currentTime = initialTime;
+    while( currentTime <= finalTime )
+    {
+        observationTimes.push_back( currentTime );
+        currentTime += timeStep;
+    }
+
+    // Define environment settings
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Mars" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, initialTime - physical_constants::JULIAN_DAY,
+                                    finalTime + physical_constants::JULIAN_DAY, 3600.0 );
+    bodySettings[ "Earth" ]->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Earth",
+                spice_interface::computeRotationQuaternionBetweenFrames(
+                    "ECLIPJ2000", "IAU_Earth", 0.0 ),
+                0.0, 2.0 * mathematical_constants::PI /
+                ( physical_constants::JULIAN_DAY ) );
+    bodySettings[ "Mars" ]->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Mars",
+                spice_interface::computeRotationQuaternionBetweenFrames(
+                    "ECLIPJ2000", "IAU_Mars", 0.0 ),
+                0.0, 2.0 * mathematical_constants::PI /
+                ( physical_constants::JULIAN_DAY + 40.0 * 60.0 ) );
+    bodySettings[ "Moon" ]->shapeModelSettings = std::make_shared< SphericalBodyShapeSettings >( 1.0E9 );
+
+    // Create list of body objects
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create ground stations
+    createGroundStation( bodyMap.at( "Mars" ), "MarsStation1", ( Eigen::Vector3d( ) << 100.0, 0.2, 2.1 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+    createGroundStation( bodyMap.at( "Earth" ), "EarthStation1", ( Eigen::Vector3d( ) << 800.0, 0.12, 5.3 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+    createGroundStation( bodyMap.at( "Earth" ), "EarthStation2", ( Eigen::Vector3d( ) << 100.0, 0.15, 0.0 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+
+    // Define link ends
+    LinkEnds oneWayLinkEnds1;
+    oneWayLinkEnds1[ transmitter ] = std::make_pair( "Mars", "MarsStation1" );
+    oneWayLinkEnds1[ receiver ] = std::make_pair( "Earth", "EarthStation1" );
+
+    LinkEnds oneWayLinkEnds2;
+    oneWayLinkEnds2[ transmitter ] = std::make_pair( "Earth", "EarthStation2" );
+    oneWayLinkEnds2[ receiver ] = std::make_pair( "Mars", "MarsStation1" );
+
+    LinkEnds twoWayLinkEnds;
+    twoWayLinkEnds[ transmitter ] = std::make_pair( "Mars", "MarsStation1" );
+    twoWayLinkEnds[ reflector1 ] = std::make_pair( "Earth", "EarthStation1" );
+    twoWayLinkEnds[ receiver ] = std::make_pair( "Mars", "MarsStation1" );
+
+    std::map< ObservableType, std::vector< LinkEnds > > testLinkEndsList;
+    testLinkEndsList[ one_way_range ] = { oneWayLinkEnds1, oneWayLinkEnds2 };
+    testLinkEndsList[ angular_position ] = { oneWayLinkEnds1 };
+    testLinkEndsList[ n_way_range ] = { twoWayLinkEnds };
+
+    // Create observation settings and observation time settings
+    std::map< ObservableType, std::map< LinkEnds, std::shared_ptr< ObservationSimulationTimeSettings< double > > > >
+            observationTimeSettings;
+    std::map< ObservableType, std::map< LinkEnds, std::shared_ptr< ObservationSettings > > > observationSettingsMap;
+    for( auto observableIterator : testLinkEndsList )
+    {
+        for( unsigned int i = 0; i < observableIterator.second.size( ); i++ )
+        {
+            if( observableIterator.first == n_way_range )
+            {
+                observationSettingsMap[ observableIterator.first ][ observableIterator.second.at( i ) ] =
+                        std::make_shared< NWayRangeObservationSettings >(
+                            std::shared_ptr< LightTimeCorrectionSettings >( ), observableIterator.second.at( i ).size( ) );
+            }
+            else
+            {
+                observationSettingsMap[ observableIterator.first ][ observableIterator.second.at( i ) ] =
+                        std::make_shared< ObservationSettings >(
+                            observableIterator.first, std::shared_ptr< LightTimeCorrectionSettings >( ) );
+            }
+            observationTimeSettings[ observableIterator.first ][ observableIterator.second.at( i ) ] =
+                    std::make_shared< TabulatedObservationSimulationTimeSettings< double > >(
+                        transmitter, observationTimes );
+        }
+    }
+
+    // Create observation viability calculators
+    std::vector< std::shared_ptr< ObservationViabilitySettings > > observationViabilitySettings;
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+                                                minimum_elevation_angle, std::make_pair( "Earth", "" ), "",
+                                                4.0 * mathematical_constants::PI / 180.0 ) );
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+                                                minimum_elevation_angle, std::make_pair( "Mars", "" ), "",
+                                                10.0 * mathematical_constants::PI / 180.0 ) );
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+                                                body_avoidance_angle, std::make_pair( "Earth", "" ), "Sun",
+                                                30.0 * mathematical_constants::PI / 180.0 ) );
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+                                                body_occultation, std::make_pair( "Earth", "" ), "Moon" ) );
+    PerObservableObservationViabilityCalculatorList viabilityCalculators = createObservationViabilityCalculators(
+                bodyMap, testLinkEndsList, observationViabilitySettings );
+
+    // Create observation simulators
+    std::map< ObservableType,  std::shared_ptr< ObservationSimulatorBase< double, double > > > observationSimulators =
+            createObservationSimulators( observationSettingsMap, bodyMap );
+
+    typedef std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::VectorXd, std::vector< double > > > >
+            SimulatedObservationsMap;
+    std::vector< SimulatedObservationsMap > simulatedObservationsList;
+
+    // Simulate observations serially
+    simulatedObservationsList.push_back( removeLinkIdFromSimulatedObservations(
+                simulateObservations( observationTimeSettings, observationSimulators, viabilityCalculators ) ) );
+
+    // Simulate observations, with sets of link ends distributed over threads
+    simulatedObservationsList.push_back( removeLinkIdFromSimulatedObservations(
+                simulateObservations( observationTimeSettings, observationSimulators, viabilityCalculators, 4 ) ) );
+
+    // Simulate observations, with observation times of each set of link ends distributed over threads
+    const unsigned int numberOfThreads = 3;
+    std::vector< std::map< ObservableType,  std::shared_ptr< ObservationSimulatorBase< double, double > > > >
+            threadLocalObservationSimulators;
+    for( unsigned int i = 0; i < numberOfThreads - 1; i++ )
+    {
+        threadLocalObservationSimulators.push_back( createObservationSimulators( observationSettingsMap, bodyMap ) );
+    }
+    for( auto simulatorIterator : observationSimulators )
+    {
+        std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > currentThreadLocalSimulators;
+        for( unsigned int i = 0; i < numberOfThreads - 1; i++ )
+        {
+            currentThreadLocalSimulators.push_back( threadLocalObservationSimulators.at( i ).at( simulatorIterator.first ) );
+        }
+        simulatorIterator.second->setThreadLocalObservationSimulators( currentThreadLocalSimulators );
+        BOOST_CHECK_EQUAL( simulatorIterator.second->getNumberOfObservationThreads( ), numberOfThreads );
+    }
+    simulatedObservationsList.push_back( removeLinkIdFromSimulatedObservations(
+                simulateObservations( observationTimeSettings, observationSimulators, viabilityCalculators ) ) );
+
+    // Check that results are identical
+    for( unsigned int i = 1; i < simulatedObservationsList.size( ); i++ )
+    {
+        for( auto observableIterator : testLinkEndsList )
+        {
+            for( unsigned int j = 0; j < observableIterator.second.size( ); j++ )
+            {
+                std::pair< Eigen::VectorXd, std::vector< double > > expectedObservations =
+                        simulatedObservationsList.at( 0 ).at( observableIterator.first ).at( observableIterator.second.at( j ) );
+                std::pair< Eigen::VectorXd, std::vector< double > > computedObservations =
+                        simulatedObservationsList.at( i ).at( observableIterator.first ).at( observableIterator.second.at( j ) );
+
+                // Check that viability constraints are active
+                BOOST_CHECK( expectedObservations.second.size( ) > 0 );
+                BOOST_CHECK( expectedObservations.second.size( ) < observationTimes.size( ) );
+
+                BOOST_CHECK_EQUAL( computedObservations.second.size( ), expectedObservations.second.size( ) );
+                BOOST_CHECK_EQUAL( computedObservations.first.rows( ), expectedObservations.first.rows( ) );
+                if( computedObservations.first.rows( ) == expectedObservations.first.rows( ) )
+                {
+                    for( unsigned int k = 0; k < expectedObservations.second.size( ); k++ )
+                    {
+                        BOOST_CHECK_EQUAL( computedObservations.second.at( k ), expectedObservations.second.at( k ) );
+                    }
+                    for( int k = 0; k < expectedObservations.first.rows( ); k++ )
+                    {
+                        BOOST_CHECK_EQUAL( computedObservations.first( k ), expectedObservations.first( k ) );
+                    }
+                }
+            }
+        }
+    }
+
+    // Check block-wise viability checks against viability checks of single observations
+    std::shared_ptr< ObservationSimulator< 1, double, double > > rangeSimulator =
+            std::dynamic_pointer_cast< ObservationSimulator< 1, double, double > >(
+                observationSimulators.at( one_way_range ) );
+    std::vector< std::shared_ptr< ObservationViabilityCalculator > > rangeViabilityCalculators =
+            viabilityCalculators.at( one_way_range ).at( oneWayLinkEnds1 );
+    std::vector< double > expectedObservationTimes;
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        if( simulateObservationWithCheck< 1, double, double >(
+                    observationTimes.at( i ), rangeSimulator->getObservationModel( oneWayLinkEnds1 ), transmitter,
+                    rangeViabilityCalculators ).second )
+        {
+            expectedObservationTimes.push_back( observationTimes.at( i ) );
+        }
+    }
+    std::vector< double > computedObservationTimes =
+            simulatedObservationsList.at( 0 ).at( one_way_range ).at( oneWayLinkEnds1 ).second;
+    BOOST_CHECK_EQUAL( computedObservationTimes.size( ), expectedObservationTimes.size( ) );
+    if( computedObservationTimes.size( ) == expectedObservationTimes.size( ) )
+    {
+        for( unsigned int i = 0; i < expectedObservationTimes.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( computedObservationTimes.at( i ), expectedObservationTimes.at( i ) );
+        }
+    }
+
+    // Check viability checks with calculators shared by concurrently executing threads (as done when simulating
+    // observations with thread-local observation models) against serial checks
+    std::vector< Eigen::Matrix< double, 1, 1 > > rangeObservations;
+    std::vector< std::vector< double > > rangeLinkEndTimes;
+    std::vector< std::vector< Eigen::Vector6d > > rangeLinkEndStates;
+    rangeSimulator->getObservationModel( oneWayLinkEnds1 )->computeObservationsWithLinkEndDataForTimes(
+                observationTimes, transmitter, rangeObservations, rangeLinkEndTimes, rangeLinkEndStates );
+    std::vector< bool > expectedViability = checkObservationsViability(
+                rangeLinkEndStates, rangeLinkEndTimes, rangeViabilityCalculators );
+
+    const unsigned int numberOfViabilityTasks = 8;
+    std::vector< std::vector< bool > > concurrentViability( numberOfViabilityTasks );
+    utilities::executeParallelTasks(
+                numberOfViabilityTasks, 4, [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        utilities::ConcurrentSharedObjectAccess sharedEnvironmentAccess;
+        concurrentViability[ taskIndex ] = checkObservationsViability(
+                    rangeLinkEndStates, rangeLinkEndTimes, rangeViabilityCalculators );
+    } );
+    for( unsigned int i = 0; i < numberOfViabilityTasks; i++ )
+    {
+        BOOST_CHECK( concurrentViability.at( i ) == expectedViability );
+    }
+
+    // Check simulation without any observation times, for single and multiple (thread-local) observation models
+    std::vector< std::shared_ptr< ObservationModel< 1, double, double > > > rangeModels;
+    rangeModels.push_back( rangeSimulator->getObservationModel( oneWayLinkEnds1 ) );
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        std::pair< Eigen::VectorXd, std::vector< double > > emptyObservations =
+                simulateObservationsWithCheck< 1, double, double >(
+                    std::vector< double >( ), rangeModels, transmitter, rangeViabilityCalculators );
+        BOOST_CHECK_EQUAL( emptyObservations.first.rows( ), 0 );
+        BOOST_CHECK_EQUAL( emptyObservations.second.size( ), 0 );
+        rangeModels.push_back( std::dynamic_pointer_cast< ObservationSimulator< 1, double, double > >(
+                                   threadLocalObservationSimulators.at( i % ( numberOfThreads - 1 ) ).at(
+                                       one_way_range ) )->getObservationModel( oneWayLinkEnds1 ) );
+    }
+
+    // Check simulation without any observables, both for default and for specified number of threads
+    std::map< ObservableType, std::map< LinkEnds, std::shared_ptr< ObservationSimulationTimeSettings< double > > > >
+            emptyObservationTimeSettings;
+    BOOST_CHECK_EQUAL( simulateObservations(
+                           emptyObservationTimeSettings, observationSimulators, viabilityCalculators ).size( ), 0 );
+    BOOST_CHECK_EQUAL( simulateObservations(
+                           emptyObservationTimeSettings, observationSimulators, viabilityCalculators, 4 ).size( ), 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
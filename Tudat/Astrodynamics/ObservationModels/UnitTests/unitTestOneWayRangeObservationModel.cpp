@@ -177,6 +177,43 @@ BOOST_AUTO_TEST_CASE( testOneWayRangeModel )
                 std::numeric_limits< double >::epsilon( ) );
 
 
+    // Check that observations computed for a list of times are equal to those computed for each time separately, to within
+    // the light-time tolerance (times speed of light)
+    std::vector< double > listObservationTimes;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        listObservationTimes.push_back( receiverObservationTime + 60.0 * static_cast< double >( i ) );
+    }
+    for( unsigned int linkEndTest = 0; linkEndTest < 2; linkEndTest++ )
+    {
+        LinkEndType referenceLinkEnd = ( linkEndTest == 0 ) ? receiver : transmitter;
+
+        std::vector< Eigen::Matrix< double, 1, 1 > > listObservations;
+        std::vector< std::vector< double > > listLinkEndTimes;
+        std::vector< std::vector< Eigen::Vector6d > > listLinkEndStates;
+        observationModel->computeObservationsWithLinkEndDataForTimes(
+                    listObservationTimes, referenceLinkEnd, listObservations, listLinkEndTimes, listLinkEndStates );
+        BOOST_CHECK_EQUAL( listObservations.size( ), listObservationTimes.size( ) );
+
+        for( unsigned int i = 0; i < listObservationTimes.size( ); i++ )
+        {
+            std::vector< double > singleLinkEndTimes;
+            std::vector< Eigen::Vector6d > singleLinkEndStates;
+            double singleObservation = observationModel->computeObservationsWithLinkEndData(
+                        listObservationTimes.at( i ), referenceLinkEnd, singleLinkEndTimes, singleLinkEndStates )( 0 );
+
+            BOOST_CHECK_SMALL( listObservations.at( i )( 0 ) - singleObservation, 1.0E-4 );
+            BOOST_CHECK_EQUAL( listLinkEndTimes.at( i ).size( ), 2 );
+            BOOST_CHECK_EQUAL( listLinkEndStates.at( i ).size( ), 2 );
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_SMALL( listLinkEndTimes.at( i ).at( j ) - singleLinkEndTimes.at( j ), 1.0E-10 );
+                BOOST_CHECK_SMALL( ( listLinkEndStates.at( i ).at( j ) - singleLinkEndStates.at( j ) ).
+                                   segment( 0, 3 ).norm( ), 1.0E-4 );
+            }
+        }
+    }
+
     std::vector< double > observationTimes;
     observationTimes.push_back( 1.0E6 );
     observationTimes.push_back( 2.0E6 );
@@ -281,12 +281,218 @@ public:
             const ObservationScalarType tolerance =
             ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
     {
-        // Initialize reception and transmission times and states to initial guess (zero light time)
+        return iterateLightTimeSolution(
+                    receiverStateOutput, transmitterStateOutput, time,
+                    isTimeAtReception ? stateFunctionOfReceivingBody_( time ) : stateFunctionOfTransmittingBody_( time ),
+                    isTimeAtReception, tolerance,
+                    mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 ) );
+    }
+
+    //! Function to calculate the light times and link-ends states for a list of times.
+    /*!
+     *  Function to calculate the transmitter states at transmission time, the receiver states at reception time, and the
+     *  light times, for a list of times (e.g. the reception times of a pass of range data). The states are evaluated through
+     *  the same state functions, one time at a time, as in calculateLightTimeWithLinkEndsStates (there is no bulk evaluation
+     *  of the ephemerides). The iterative solution of the light-time equation at each time is started from the light time
+     *  extrapolated from the solutions at the two preceding times (or the solution at the preceding time), instead of from
+     *  a zero light time. For closely spaced times, this initial guess is typically converged to well below the tolerance,
+     *  so that fewer evaluations of the state function of the other link end are required than when calling
+     *  calculateLightTimeWithLinkEndsStates for each time. Since the iterations start from a different initial guess, the
+     *  results are NOT identical to those of calculateLightTimeWithLinkEndsStates, but differ by less than the tolerance.
+     *  The times need not be sorted, but the reduction in number of iterations is largest if they are. Currently, this
+     *  function is only used by the one-way range observation model (see
+     *  OneWayRangeObservationModel::computeIdealObservationsWithLinkEndDataForTimes); all other observation models solve
+     *  the light-time equation for each time separately.
+     *  \param receiverStatesOutput Output by reference of receiver states (one per time).
+     *  \param transmitterStatesOutput Output by reference of transmitter states (one per time).
+     *  \param times Times at reception or transmission.
+     *  \param isTimeAtReception True if input times are at reception, false if at transmission.
+     *  \param tolerance Maximum allowed light-time difference between two subsequent iterations
+     *  for which solution is accepted.
+     *  \return The values of the light time between the reciever states and the transmitter states (one per time).
+     */
+    std::vector< ObservationScalarType > calculateLightTimesWithLinkEndsStates(
+            std::vector< StateType >& receiverStatesOutput,
+            std::vector< StateType >& transmitterStatesOutput,
+            const std::vector< TimeType >& times,
+            const bool isTimeAtReception = 1,
+            const ObservationScalarType tolerance =
+            ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
+    {
+        const unsigned int numberOfTimes = times.size( );
+
+        // Evaluate states of link end at which times are defined
+        std::vector< StateType > fixedLinkEndStates( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            fixedLinkEndStates[ i ] = isTimeAtReception ? stateFunctionOfReceivingBody_( times[ i ] ) :
+                                                          stateFunctionOfTransmittingBody_( times[ i ] );
+        }
+
+        receiverStatesOutput.resize( numberOfTimes );
+        transmitterStatesOutput.resize( numberOfTimes );
+        std::vector< ObservationScalarType > lightTimes( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            // Set initial guess of light time from solution(s) at preceding time(s)
+            ObservationScalarType initialLightTimeGuess =
+                    mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+            if( i > 0 )
+            {
+                initialLightTimeGuess = lightTimes[ i - 1 ];
+            }
+            if( i > 1 && !( times[ i - 1 ] == times[ i - 2 ] ) )
+            {
+                initialLightTimeGuess += ( lightTimes[ i - 1 ] - lightTimes[ i - 2 ] ) *
+                        static_cast< ObservationScalarType >( times[ i ] - times[ i - 1 ] ) /
+                        static_cast< ObservationScalarType >( times[ i - 1 ] - times[ i - 2 ] );
+            }
+
+            lightTimes[ i ] = iterateLightTimeSolution(
+                        receiverStatesOutput[ i ], transmitterStatesOutput[ i ], times[ i ], fixedLinkEndStates[ i ],
+                        isTimeAtReception, tolerance, initialLightTimeGuess );
+        }
+
+        return lightTimes;
+    }
+
+    //! Function to calculate the light times for a list of times.
+    /*!
+     *  Function to calculate the light times between the link ends defined in the constructor, for a list of times (see
+     *  calculateLightTimesWithLinkEndsStates).
+     *  \param times Times at reception or transmission.
+     *  \param isTimeAtReception True if input times are at reception, false if at transmission.
+     *  \param tolerance Maximum allowed light-time difference between two subsequent iterations
+     *  for which solution is accepted.
+     *  \return The values of the light time between the link ends (one per time).
+     */
+    std::vector< ObservationScalarType > calculateLightTimes(
+            const std::vector< TimeType >& times,
+            const bool isTimeAtReception = true,
+            const ObservationScalarType tolerance =
+            getDefaultLightTimeTolerance< ObservationScalarType >( ) )
+    {
+        std::vector< StateType > receiverStates;
+        std::vector< StateType > transmitterStates;
+        return calculateLightTimesWithLinkEndsStates(
+                    receiverStates, transmitterStates, times, isTimeAtReception, tolerance );
+    }
+
+
+    //! Function to get the part wrt linkend position
+    /*!
+     *  Function to get the part wrt linkend position
+     *  \param transmitterState State of transmitter.
+     *  \param receiverState State of receiver.
+     *  \param transmitterTime Time at transmission.
+     *  \param receiverTime Time at reiver.
+     *  \param isPartialWrtReceiver If partial is to be calculated w.r.t. receiver or transmitter.
+     */
+    Eigen::Matrix< ObservationScalarType, 1, 3 > getPartialOfLightTimeWrtLinkEndPosition(
+            const StateType& transmitterState,
+            const StateType& receiverState,
+            const TimeType transmitterTime,
+            const TimeType receiverTime,
+            const bool isPartialWrtReceiver )
+    {
+        setTotalLightTimeCorrection( transmitterState, receiverState, transmitterTime, receiverTime );
+
+        Eigen::Matrix< ObservationScalarType, 3, 1 > relativePosition =
+                receiverState.segment( 0, 3 ) - transmitterState.segment( 0, 3 );
+        return ( relativePosition.normalized( ) ).transpose( ) *
+                ( mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) +
+                  currentCorrection_ / relativePosition.norm( ) ) *
+                ( isPartialWrtReceiver ? mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) :
+                                         mathematical_constants::getFloatingInteger< ObservationScalarType >( -1 ) );
+    }
+
+    //! Function to get list of light-time correction functions
+    /*!
+     * Function to get list of light-time correction functions
+     * \return List of light-time correction functions
+     */
+    std::vector< std::shared_ptr< LightTimeCorrection > > getLightTimeCorrection( )
+    {
+        return correctionFunctions_;
+    }
+
+protected:
+
+    //! Transmitter state function.
+    /*!
+     *  Transmitter state function.
+     */
+    std::function< StateType( const double ) >
+    stateFunctionOfTransmittingBody_;
+
+    //! Receiver state function.
+    /*!
+     *  Receiver state function.
+     */
+    std::function< StateType( const double ) >
+    stateFunctionOfReceivingBody_;
+
+    //! List of light-time correction functions.
+    /*!
+     *  List of light-time correction functions, i.e. tropospheric, relativistic, etc.
+     */
+    std::vector< std::shared_ptr< LightTimeCorrection > > correctionFunctions_;
+
+    //! Boolean deciding whether to recalculate the correction during each iteration.
+    /*!
+     *  Boolean deciding whether to recalculate the correction during each iteration.
+     *  If it is set true, the corrections are calculated during each iteration of the
+     *  light-time calculations. If it is set to false, it is calculated once at the begining.
+     *  Additionally, when convergence is reached, it is recalculated to check
+     *  whether the light time with new correction violates the convergence. If so,
+     *  another iteration is performed.
+     */
+    bool iterateCorrections_;
+
+    //! Current light-time correction.
+    double currentCorrection_;
+
+    //! Function to iteratively solve the light-time equation, starting from an initial guess of the light time.
+    /*!
+     *  Function to iteratively solve the light-time equation, starting from an initial guess of the light time, and to
+     *  calculate the transmitter state at transmission time and the receiver state at reception time.
+     *  \param receiverStateOutput Output by reference of receiver state.
+     *  \param transmitterStateOutput Output by reference of transmitter state.
+     *  \param time Time at reception or transmission.
+     *  \param fixedLinkEndState State of the link end at which the input time is defined (receiver if isTimeAtReception
+     *  is true, transmitter otherwise), at the input time.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \param tolerance Maximum allowed light-time difference between two subsequent iterations
+     *  for which solution is accepted.
+     *  \param initialLightTimeGuess Light time with which the iteration is started
+     *  \return The value of the light time between the reciever state and the transmitter state.
+     */
+    ObservationScalarType iterateLightTimeSolution(
+            StateType& receiverStateOutput,
+            StateType& transmitterStateOutput,
+            const TimeType time,
+            const StateType& fixedLinkEndState,
+            const bool isTimeAtReception,
+            const ObservationScalarType tolerance,
+            const ObservationScalarType initialLightTimeGuess )
+    {
+        // Initialize reception and transmission times and states to initial guess
         TimeType receptionTime = time;
         TimeType transmissionTime = time;
-        StateType receiverState = stateFunctionOfReceivingBody_( receptionTime );
-        StateType transmitterState =
-                stateFunctionOfTransmittingBody_( transmissionTime );
+        StateType receiverState;
+        StateType transmitterState;
+        if( isTimeAtReception )
+        {
+            transmissionTime = time - initialLightTimeGuess;
+            receiverState = fixedLinkEndState;
+            transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+        }
+        else
+        {
+            receptionTime = time + initialLightTimeGuess;
+            receiverState = stateFunctionOfReceivingBody_( receptionTime );
+            transmitterState = fixedLinkEndState;
+        }
 
         // Set initial light-time correction.
         setTotalLightTimeCorrection(
@@ -380,79 +586,6 @@ public:
         return newLightTimeCalculation;
     }
 
-    //! Function to get the part wrt linkend position
-    /*!
-     *  Function to get the part wrt linkend position
-     *  \param transmitterState State of transmitter.
-     *  \param receiverState State of receiver.
-     *  \param transmitterTime Time at transmission.
-     *  \param receiverTime Time at reiver.
-     *  \param isPartialWrtReceiver If partial is to be calculated w.r.t. receiver or transmitter.
-     */
-    Eigen::Matrix< ObservationScalarType, 1, 3 > getPartialOfLightTimeWrtLinkEndPosition(
-            const StateType& transmitterState,
-            const StateType& receiverState,
-            const TimeType transmitterTime,
-            const TimeType receiverTime,
-            const bool isPartialWrtReceiver )
-    {
-        setTotalLightTimeCorrection( transmitterState, receiverState, transmitterTime, receiverTime );
-
-        Eigen::Matrix< ObservationScalarType, 3, 1 > relativePosition =
-                receiverState.segment( 0, 3 ) - transmitterState.segment( 0, 3 );
-        return ( relativePosition.normalized( ) ).transpose( ) *
-                ( mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) +
-                  currentCorrection_ / relativePosition.norm( ) ) *
-                ( isPartialWrtReceiver ? mathematical_constants::getFloatingInteger< ObservationScalarType >( 1 ) :
-                                         mathematical_constants::getFloatingInteger< ObservationScalarType >( -1 ) );
-    }
-
-    //! Function to get list of light-time correction functions
-    /*!
-     * Function to get list of light-time correction functions
-     * \return List of light-time correction functions
-     */
-    std::vector< std::shared_ptr< LightTimeCorrection > > getLightTimeCorrection( )
-    {
-        return correctionFunctions_;
-    }
-
-protected:
-
-    //! Transmitter state function.
-    /*!
-     *  Transmitter state function.
-     */
-    std::function< StateType( const double ) >
-    stateFunctionOfTransmittingBody_;
-
-    //! Receiver state function.
-    /*!
-     *  Receiver state function.
-     */
-    std::function< StateType( const double ) >
-    stateFunctionOfReceivingBody_;
-
-    //! List of light-time correction functions.
-    /*!
-     *  List of light-time correction functions, i.e. tropospheric, relativistic, etc.
-     */
-    std::vector< std::shared_ptr< LightTimeCorrection > > correctionFunctions_;
-
-    //! Boolean deciding whether to recalculate the correction during each iteration.
-    /*!
-     *  Boolean deciding whether to recalculate the correction during each iteration.
-     *  If it is set true, the corrections are calculated during each iteration of the
-     *  light-time calculations. If it is set to false, it is calculated once at the begining.
-     *  Additionally, when convergence is reached, it is recalculated to check
-     *  whether the light time with new correction violates the convergence. If so,
-     *  another iteration is performed.
-     */
-    bool iterateCorrections_;
-
-    //! Current light-time correction.
-    double currentCorrection_;
-
     //! Function to calculate a new light-time estimate from the link-ends states.
     /*!
      *  Function to calculate a new light-time estimate from the states of the two ends of the
@@ -165,6 +165,15 @@ std::vector< LinkEndType > getNWayLinkIndicesFromLinkEndId( const LinkEndId& lin
     return matchingLinkEndTypes;
 }
 
+//! Function to get the link ends of one of the constituent one-way links of an n-way observable.
+LinkEnds getNWayConstituentOneWayLinkEnds( const LinkEnds& linkEnds, const int linkIndex )
+{
+    LinkEnds oneWayLinkEnds;
+    oneWayLinkEnds[ transmitter ] = linkEnds.at( getNWayLinkEnumFromIndex( linkIndex, linkEnds.size( ) ) );
+    oneWayLinkEnds[ receiver ] = linkEnds.at( getNWayLinkEnumFromIndex( linkIndex + 1, linkEnds.size( ) ) );
+    return oneWayLinkEnds;
+}
+
 } // namespace observation_models
 
 } // namespace tudat
@@ -107,6 +107,16 @@ std::vector< int > getNWayLinkEndIndicesFromLinkEndId( const std::vector< LinkEn
  */
 std::vector< LinkEndType > getNWayLinkIndicesFromLinkEndId( const LinkEndId& linkEndid, const LinkEnds& linkEnds );
 
+//! Function to get the link ends of one of the constituent one-way links of an n-way observable.
+/*!
+ * Function to get the link ends of one of the constituent one-way links of an n-way observable.
+ * \param linkEnds N-way link ends
+ * \param linkIndex Index of the one-way link (0 = link starting at transmitter, linkEnds.size( ) - 2 = link ending at
+ * receiver)
+ * \return Link ends (transmitter and receiver) of the requested one-way link
+ */
+LinkEnds getNWayConstituentOneWayLinkEnds( const LinkEnds& linkEnds, const int linkIndex );
+
 } // namespace observation_models
 
 } // namespace tudat
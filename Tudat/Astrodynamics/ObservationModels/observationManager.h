@@ -11,6 +11,10 @@
 #ifndef TUDAT_OBSERVATIONMANAGER_H
 #define TUDAT_OBSERVATIONMANAGER_H
 
+#include <algorithm>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Astrodynamics/Ephemerides/cachedRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationModel.h"
 #include "Tudat/Astrodynamics/ObservationModels/linkTypeDefs.h"
@@ -52,7 +56,7 @@ public:
             const std::map< LinkEnds, std::shared_ptr< observation_partials::PositionPartialScaling  > >&
             observationPartialScalers ):
         observableType_( observableType ), stateTransitionMatrixInterface_( stateTransitionMatrixInterface ),
-        observationPartialScalers_( observationPartialScalers )
+        observationPartialScalers_( observationPartialScalers ), stateTransitionMatrixLookUpHint_( -1 )
     {
         if( stateTransitionMatrixInterface_ != nullptr )
         {
@@ -98,18 +102,40 @@ public:
      */
     virtual std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > getObservationSimulator( ) = 0;
 
+    //! Function (pure virtual) to set the observation managers used by additional threads when computing observations and
+    //! partials.
+    /*!
+     * Function (pure virtual) to set the observation managers used by additional threads when computing observations and
+     * partials. Each of the managers must be an independent copy of this object (created from the same observation
+     * settings and parameters), so that each thread uses its own light-time calculators and partial objects.
+     * \param threadLocalObservationManagers List of observation managers, one for each thread in addition to the
+     * calling thread (empty to compute observations and partials serially).
+     */
+    virtual void setThreadLocalObservationManagers(
+            const std::vector< std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > >&
+            threadLocalObservationManagers ) = 0;
+
+    //! Function (pure virtual) to get the number of threads used when computing observations and partials.
+    /*!
+     * Function (pure virtual) to get the number of threads used when computing observations and partials.
+     * \return Number of threads used when computing observations and partials.
+     */
+    virtual unsigned int getNumberOfObservationThreads( ) = 0;
 
 protected:
 
     //! Function to get the state transition and sensitivity matrix.
     /*!
-     *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S]
+     *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S].
+     *  The interpolator lookup uses the hint stored by this object, so that the (thread-local) observation managers used by
+     *  different threads do not reset each other's lookups.
      *  \param evaluationTime Time at which matrices are to be evaluated
      *  \return Concatenated state transition and sensitivity matrices at given time.
      */
     Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
     {
-        return stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+        return stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrixWithLookUpHint(
+                    evaluationTime, stateTransitionMatrixLookUpHint_ );
     }
 
 
@@ -123,6 +149,10 @@ protected:
     //! compute the observation partials in the derived class
     std::map< LinkEnds, std::shared_ptr< observation_partials::PositionPartialScaling  > > observationPartialScalers_;
 
+    //! Interval of state transition matrix interpolators found during previous call to
+    //! getCombinedStateTransitionAndSensitivityMatrix (-1 if not yet called).
+    int stateTransitionMatrixLookUpHint_;
+
     //! Size of (square) state transition matrix.
     /*!
      *  Size of (square) state transition matrix.
@@ -214,10 +244,60 @@ public:
         return observationSimulator_;
     }
 
+    //! Function to set the observation managers used by additional threads when computing observations and partials.
+    /*!
+     * Function to set the observation managers used by additional threads when computing observations and partials.
+     * Each of the managers must be an independent copy of this object (created from the same observation settings and
+     * parameters), so that each thread uses its own light-time calculators and partial objects. The observation
+     * simulators of the copies are also set as thread-local simulators of this object's observation simulator (see
+     * ObservationSimulator::setThreadLocalObservationSimulators), so that observation simulation uses the same threads.
+     * \param threadLocalObservationManagers List of observation managers, one for each thread in addition to the
+     * calling thread (empty to compute observations and partials serially).
+     */
+    void setThreadLocalObservationManagers(
+            const std::vector< std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > >&
+            threadLocalObservationManagers )
+    {
+        std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >
+                threadLocalObservationSimulators;
+
+        threadLocalObservationManagers_.clear( );
+        for( unsigned int i = 0; i < threadLocalObservationManagers.size( ); i++ )
+        {
+            std::shared_ptr< ObservationManager< ObservationSize, ObservationScalarType, TimeType > >
+                    currentObservationManager = std::dynamic_pointer_cast<
+                    ObservationManager< ObservationSize, ObservationScalarType, TimeType > >(
+                        threadLocalObservationManagers.at( i ) );
+            if( currentObservationManager == nullptr ||
+                    currentObservationManager->observableType_ != this->observableType_ )
+            {
+                throw std::runtime_error( "Error when setting thread-local observation managers, type is inconsistent." );
+            }
+
+            threadLocalObservationSimulators.push_back( currentObservationManager->getObservationSimulator( ) );
+            threadLocalObservationManagers_.push_back( currentObservationManager );
+        }
+
+        // Set thread-local simulators, and share observation biases with thread-local observation models
+        observationSimulator_->setThreadLocalObservationSimulators( threadLocalObservationSimulators );
+    }
+
+    //! Function to get the number of threads used when computing observations and partials.
+    /*!
+     * Function to get the number of threads used when computing observations and partials.
+     * \return Number of threads used when computing observations and partials.
+     */
+    unsigned int getNumberOfObservationThreads( )
+    {
+        return threadLocalObservationManagers_.size( ) + 1;
+    }
+
     //! Function to simulate observations between specified link ends and associated partials at set of observation times.
     /*!
      *  Function to simulate observations between specified link ends  and associated partials at set of observation times,
-     *  used the sensitivity and state transition matrix interpolators set in the base class.
+     *  used the sensitivity and state transition matrix interpolators set in the base class. If thread-local observation
+     *  managers have been set, the list of times is split into contiguous sections, which are evaluated concurrently
+     *  (see setThreadLocalObservationManagers). The results are independent of the number of threads.
      *  \param times Vector of times at which observations are performed
      *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
      *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
@@ -233,34 +313,43 @@ public:
         std::map< TimeType, Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
         std::map< TimeType, Eigen::Matrix< double, ObservationSize, Eigen::Dynamic > > observationMatrices;
 
-        // Get observation model.
-        std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
-                observationSimulator_->getObservationModel( linkEnds );
+        const unsigned int numberOfTimes = times.size( );
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observationList( numberOfTimes );
+        std::vector< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic > > observationMatrixList( numberOfTimes );
 
-        // Initialize vectors of states and times of link ends to be used in calculations.
-        std::vector< Eigen::Vector6d > vectorOfStates;
-        std::vector< double > vectorOfTimes;
+        // Reuse link end rotations computed for the observations in the partials (if environment is not shared by threads)
+        ephemerides::RotationCachingScope rotationCachingScope;
 
-        Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
-
-        // Iterate over all observation times
-        int currentObservationSize;
-        for( unsigned int i = 0; i < times.size( ); i++ )
+        // Compute observations and partials, using a contiguous section of the observation times per thread.
+        const unsigned int numberOfThreads = std::min( getNumberOfObservationThreads( ), numberOfTimes );
+        if( numberOfThreads > 1 )
         {
-            vectorOfTimes.clear( );
-            vectorOfStates.clear( );
-
-            // Compute observation
-            currentObservation = selectedObservationModel->computeObservationsWithLinkEndData(
-                        times[ i ], linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates );
-            observations[ times[ i ] ] = currentObservation;
-
-            // Compute observation partial
-            currentObservationSize = currentObservation.rows( );
-            observationMatrices[ times[ i ] ] = determineObservationPartialMatrix(
-                        currentObservationSize, vectorOfStates, vectorOfTimes, linkEnds, currentObservation,
-                        linkEndAssociatedWithTime );
+            utilities::executeParallelTasks(
+                        numberOfThreads, numberOfThreads, [ & ]( const unsigned int taskIndex, const unsigned int )
+            {
+                // Thread-local observation managers share the environment (bodies)
+                utilities::ConcurrentSharedObjectAccess sharedEnvironmentAccess;
+
+                ObservationManager< ObservationSize, ObservationScalarType, TimeType >* currentObservationManager =
+                        ( taskIndex == 0 ) ? this : threadLocalObservationManagers_.at( taskIndex - 1 ).get( );
+                currentObservationManager->computeObservationsWithPartialsForTimeRange(
+                            times, taskIndex * numberOfTimes / numberOfThreads,
+                            ( taskIndex + 1 ) * numberOfTimes / numberOfThreads, linkEnds, linkEndAssociatedWithTime,
+                            observationList, observationMatrixList );
+            } );
+        }
+        else
+        {
+            computeObservationsWithPartialsForTimeRange(
+                        times, 0, numberOfTimes, linkEnds, linkEndAssociatedWithTime,
+                        observationList, observationMatrixList );
+        }
 
+        // Sort observations and partials by time.
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            observations[ times[ i ] ] = observationList[ i ];
+            observationMatrices[ times[ i ] ] = observationMatrixList[ i ];
         }
 
         return std::make_pair( utilities::createConcatenatedEigenMatrixFromMapValues( observations ),
@@ -292,6 +381,54 @@ public:
 
 protected:
 
+    //! Function to simulate observations and associated partials for a range of entries in a list of observation times.
+    /*!
+     *  Function to simulate observations and associated partials for a range of entries in a list of observation times,
+     *  using the observation model and partial objects of this object only.
+     *  \param times Vector of times at which observations are performed
+     *  \param startIndex Index of first entry in times for which observation is to be computed
+     *  \param endIndex Index of entry in times after last entry for which observation is to be computed
+     *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
+     *  \param linkEndAssociatedWithTime Link end at which input times are valid
+     *  \param observationList List of observations, with entry i associated with times[ i ] (modified by this function)
+     *  \param observationMatrixList List of observation partials, with entry i associated with times[ i ] (modified by
+     *  this function)
+     */
+    void computeObservationsWithPartialsForTimeRange(
+            const std::vector< TimeType >& times,
+            const unsigned int startIndex,
+            const unsigned int endIndex,
+            const LinkEnds& linkEnds,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observationList,
+            std::vector< Eigen::Matrix< double, ObservationSize, Eigen::Dynamic > >& observationMatrixList )
+    {
+        // Get observation model.
+        std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
+                observationSimulator_->getObservationModel( linkEnds );
+
+        // Compute observations, and states and times of link ends, for all observation times in range
+        std::vector< TimeType > rangeTimes( times.begin( ) + startIndex, times.begin( ) + endIndex );
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > rangeObservations;
+        std::vector< std::vector< Eigen::Vector6d > > linkEndStatesList;
+        std::vector< std::vector< double > > linkEndTimesList;
+        selectedObservationModel->computeObservationsWithLinkEndDataForTimes(
+                    rangeTimes, linkEndAssociatedWithTime, rangeObservations, linkEndTimesList, linkEndStatesList );
+
+        // Iterate over all observation times
+        int currentObservationSize;
+        for( unsigned int i = startIndex; i < endIndex; i++ )
+        {
+            observationList[ i ] = rangeObservations[ i - startIndex ];
+
+            // Compute observation partial
+            currentObservationSize = observationList[ i ].rows( );
+            observationMatrixList[ i ] = determineObservationPartialMatrix(
+                        currentObservationSize, linkEndStatesList[ i - startIndex ], linkEndTimesList[ i - startIndex ],
+                        linkEnds, observationList[ i ], linkEndAssociatedWithTime );
+        }
+    }
+
     //! Function to perform updates of dependent variables used by (subset of) observation partials.
     /*!
      *  Function to perform updates of dependent variables used by (subset of) observation partials, in order
@@ -419,6 +556,10 @@ protected:
     std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
     currentLinkEndPartials;
 
+    //! Observation managers used by additional threads when computing observations and partials.
+    std::vector< std::shared_ptr< ObservationManager< ObservationSize, ObservationScalarType, TimeType > > >
+    threadLocalObservationManagers_;
+
 };
 
 extern template class ObservationManagerBase< double, double >;
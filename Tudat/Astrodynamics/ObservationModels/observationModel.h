@@ -204,6 +204,70 @@ public:
         }
     }
 
+    //! Function to compute the observables without any corrections at a list of times.
+    /*!
+     * Function to compute the observables without any corrections at a list of times (see
+     * computeIdealObservationsWithLinkEndData), as well as the times and states of the link ends for each observation.
+     * By default, each observable is computed separately. This function may be redefined in derived class for improved
+     * efficiency, e.g. by using the light-time solutions at preceding times as initial guess.
+     * \param times Times at which observables are to be evaluated.
+     * \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     * is kept constant (to input value)
+     * \param observations List of ideal observables, one per time (returned by reference).
+     * \param linkEndTimes List of times at each link end, one list per observation (returned by reference).
+     * \param linkEndStates List of states at each link end, one list per observation (returned by reference).
+     */
+    virtual void computeIdealObservationsWithLinkEndDataForTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        observations.resize( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observations[ i ] = computeIdealObservationsWithLinkEndData(
+                        times[ i ], linkEndAssociatedWithTime, linkEndTimes[ i ], linkEndStates[ i ] );
+        }
+    }
+
+    //! Function to compute full observations at a list of times.
+    /*!
+     *  Function to compute observations at a list of times (include any defined non-ideal corrections), as well as the
+     *  times and states of the link ends for each observation (see computeIdealObservationsWithLinkEndDataForTimes).
+     *  \param times Times at which observations are to be simulated
+     *  \param linkEndAssociatedWithTime Link end at which current times are measured, i.e. reference
+     *  link end for observable.
+     *  \param observations List of calculated observables, one per time (returned by reference).
+     *  \param linkEndTimes List of times at each link end, one list per observation (returned by reference).
+     *  \param linkEndStates List of states at each link end, one list per observation (returned by reference).
+     */
+    void computeObservationsWithLinkEndDataForTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        // Compute ideal observables
+        computeIdealObservationsWithLinkEndDataForTimes(
+                    times, linkEndAssociatedWithTime, observations, linkEndTimes, linkEndStates );
+
+        // Add correction, if any non-ideal models are set.
+        if( !isBiasnullptr_ )
+        {
+            for( unsigned int i = 0; i < observations.size( ); i++ )
+            {
+                observations[ i ] += this->observationBiasCalculator_->getObservationBias(
+                            linkEndTimes[ i ], linkEndStates[ i ], observations[ i ].template cast< double >( ) ).
+                        template cast< ObservationScalarType >( );
+            }
+        }
+    }
+
     //! Function to retrieve a single entry of the observation value
     /*!
      *  Function to retrieve a single entry of the observation value. Generally, the observable is a vector, this function
@@ -249,6 +313,25 @@ public:
         return observationBiasCalculator_;
     }
 
+    //! Function to reset the object for calculating system-dependent errors in the observable.
+    /*!
+     * Function to reset the object for calculating system-dependent errors in the observable. Used to let multiple
+     * observation models (e.g. thread-local copies of a single model) share a single bias object.
+     * \param observationBiasCalculator Object for calculating system-dependent errors in the observable.
+     */
+    void setObservationBiasCalculator(
+            const std::shared_ptr< ObservationBias< ObservationSize > > observationBiasCalculator )
+    {
+        if( observationBiasCalculator != nullptr &&
+                observationBiasCalculator->getObservationSize( ) != ObservationSize )
+        {
+            throw std::runtime_error( "Error when resetting observation bias, bias size is inconsistent" );
+        }
+
+        observationBiasCalculator_ = observationBiasCalculator;
+        isBiasnullptr_ = ( observationBiasCalculator_ == nullptr );
+    }
+
 
 protected:
 
@@ -11,7 +11,11 @@
 #ifndef TUDAT_OBSERVATIONSIMULATOR_H
 #define TUDAT_OBSERVATIONSIMULATOR_H
 
+#include <algorithm>
+
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/utilities.h"
+#include "Tudat/Astrodynamics/Ephemerides/cachedRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationModel.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
@@ -23,6 +27,8 @@ namespace tudat
 namespace observation_models
 {
 
+//! Number of observations that are simulated and checked for viability as a single block.
+const unsigned int OBSERVATION_SIMULATION_BLOCK_SIZE = 1000;
 
 //! Function to simulate an observable, checking whether it is viable according to settings passed to this function
 /*!
@@ -62,9 +68,20 @@ std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool > sim
 //! Function to simulate observables, checking whether they are viable according to settings passed to this function
 /*!
  *  Function to simulate observables, checking whether they are viable according to settings passed to this function
- *  (if viability calculators are passed to this function).
+ *  (if viability calculators are passed to this function). The observation times are processed in blocks of (at most)
+ *  OBSERVATION_SIMULATION_BLOCK_SIZE entries: the observations and link end states/times of a full block are computed
+ *  first (see ObservationModel::computeObservationsWithLinkEndDataForTimes), after which the viability of the observations
+ *  in the block is checked (see checkObservationsViability). Note that the viability checks are performed on the output of
+ *  the light-time solution, so that observations are computed for all times, including those that are subsequently
+ *  rejected. Multiple observation models may be provided, in which case the blocks are distributed over multiple threads,
+ *  with each thread using its own observation model. The observation models must then be independent copies, since
+ *  observation models (i.e. their light-time calculators) cannot be used from different threads concurrently. The
+ *  viability calculators are shared by all threads (see ObservationViabilityCalculator), as are the bodies, which are
+ *  accessed without using their cached states in that case (see utilities::ConcurrentSharedObjectAccess). The results are
+ *  independent of the number of observation models. If this function is called from a thread that is already executing
+ *  parallel tasks, only the first observation model is used.
  *  \param observationTimes Times at which observables are to be computed
- *  \param observationModel Model used to compute observables
+ *  \param observationModels Models used to compute observables, one for each thread that is to be used.
  *  \param linkEndAssociatedWithTime Model Reference link end for observables
  *  \param linkViabilityCalculators List of observation viability calculators, which are used to reject simulated
  *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
@@ -74,24 +91,79 @@ template< int ObservationSize = 1, typename ObservationScalarType = double, type
 std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::vector< TimeType > >
 simulateObservationsWithCheck(
         const std::vector< TimeType >& observationTimes,
-        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >&
+        observationModels,
         const LinkEndType linkEndAssociatedWithTime,
         const std::vector< std::shared_ptr< ObservationViabilityCalculator > > linkViabilityCalculators =
         std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
 {
-    std::map< TimeType, Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
-    std::pair< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 >, bool > simulatedObservation;
+    if( observationModels.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when simulating observations, no observation model provided." );
+    }
+
+    const unsigned int numberOfTimes = observationTimes.size( );
+    const unsigned int numberOfBlocks =
+            ( numberOfTimes + OBSERVATION_SIMULATION_BLOCK_SIZE - 1 ) / OBSERVATION_SIMULATION_BLOCK_SIZE;
+
+    // Declare list of observations and viability, with entry i associated with observationTimes[ i ]
+    std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observationList( numberOfTimes );
+    std::vector< char > observationViability( numberOfTimes );
 
-    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    // Use at least one thread, also if there are no observation times (in which case no tasks are executed)
+    unsigned int numberOfThreads = std::max(
+                std::min( static_cast< unsigned int >( observationModels.size( ) ), numberOfBlocks ), 1U );
+    if( utilities::isExecutingParallelTasks( ) )
     {
-        simulatedObservation = simulateObservationWithCheck< ObservationSize, ObservationScalarType, TimeType >(
-                    observationTimes.at( i ), observationModel, linkEndAssociatedWithTime, linkViabilityCalculators );
+        numberOfThreads = 1;
+    }
+
+    // Simulate single block of observations, using the observation model of the current thread (the environment is shared
+    // by all threads). Link end rotations are reused by the viability checks of the block (if not shared by threads).
+    auto simulateObservationBlock = [ & ]( const unsigned int blockIndex, const unsigned int threadIndex )
+    {
+        utilities::ConcurrentSharedObjectAccess sharedEnvironmentAccess( numberOfThreads > 1 );
+        ephemerides::RotationCachingScope rotationCachingScope;
+
+        std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel =
+                observationModels.at( threadIndex );
+
+        const unsigned int startIndex = blockIndex * OBSERVATION_SIMULATION_BLOCK_SIZE;
+        const unsigned int numberOfObservationsInBlock =
+                std::min( OBSERVATION_SIMULATION_BLOCK_SIZE, numberOfTimes - startIndex );
+
+        std::vector< TimeType > blockObservationTimes(
+                    observationTimes.begin( ) + startIndex,
+                    observationTimes.begin( ) + startIndex + numberOfObservationsInBlock );
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > blockObservations;
+        std::vector< std::vector< Eigen::Vector6d > > linkEndStatesList;
+        std::vector< std::vector< double > > linkEndTimesList;
+        observationModel->computeObservationsWithLinkEndDataForTimes(
+                    blockObservationTimes, linkEndAssociatedWithTime, blockObservations,
+                    linkEndTimesList, linkEndStatesList );
+        for( unsigned int i = 0; i < numberOfObservationsInBlock; i++ )
+        {
+            observationList[ startIndex + i ] = blockObservations[ i ];
+        }
 
         // Check if receiving station can view transmitting station.
-        if( simulatedObservation.second )
+        std::vector< bool > blockViability =
+                checkObservationsViability( linkEndStatesList, linkEndTimesList, linkViabilityCalculators );
+        for( unsigned int i = 0; i < numberOfObservationsInBlock; i++ )
         {
-            // If viable, add observable and time to vector of simulated data.
-            observations[ observationTimes[ i ]  ] = simulatedObservation.first;
+            observationViability[ startIndex + i ] = blockViability[ i ];
+        }
+    };
+
+    utilities::executeParallelTasks( numberOfBlocks, numberOfThreads, simulateObservationBlock );
+
+    // If viable, add observable and time to vector of simulated data.
+    std::map< TimeType, Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
+    for( unsigned int i = 0; i < numberOfTimes; i++ )
+    {
+        if( observationViability[ i ] )
+        {
+            observations[ observationTimes[ i ] ] = observationList[ i ];
         }
     }
 
@@ -109,23 +181,78 @@ simulateObservationsWithCheck(
  *  \param linkEndAssociatedWithTime Model Reference link end for observables
  *  \param linkViabilityCalculators List of observation viability calculators, which are used to reject simulated
  *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \return Observations at given time (concatenated in an Eigen vector) and associated times.
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::vector< TimeType > >
+simulateObservationsWithCheck(
+        const std::vector< TimeType >& observationTimes,
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const LinkEndType linkEndAssociatedWithTime,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > > linkViabilityCalculators =
+        std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
+{
+    return simulateObservationsWithCheck< ObservationSize, ObservationScalarType, TimeType >(
+                observationTimes,
+                std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >(
+                    1, observationModel ), linkEndAssociatedWithTime, linkViabilityCalculators );
+}
+
+//! Function to simulate observables, checking whether they are viable according to settings passed to this function
+/*!
+ *  Function to simulate observables, checking whether they are viable according to settings passed to this function
+ *  (if viability calculators are passed to this function).
+ *  \param observationTimes Times at which observables are to be computed
+ *  \param observationModels Models used to compute observables, one for each thread that is to be used (see
+ *  simulateObservationsWithCheck).
+ *  \param linkEndAssociatedWithTime Model Reference link end for observables
+ *  \param linkViabilityCalculators List of observation viability calculators, which are used to reject simulated
+ *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
  *  \return Observations at given times (concatenated in an Eigen vector), with associated times and reference link end.
  */
 template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
 std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::pair< std::vector< TimeType >, LinkEndType > >
 simulateObservationsWithCheckAndLinkEndIdOutput(
         const std::vector< TimeType >& observationTimes,
-        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >&
+        observationModels,
         const LinkEndType linkEndAssociatedWithTime,
         const std::vector< std::shared_ptr< ObservationViabilityCalculator > > linkViabilityCalculators =
         std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
 {
     std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::vector< TimeType > > simulatedObservations =
-            simulateObservationsWithCheck( observationTimes, observationModel, linkEndAssociatedWithTime, linkViabilityCalculators );
+            simulateObservationsWithCheck< ObservationSize, ObservationScalarType, TimeType >(
+                observationTimes, observationModels, linkEndAssociatedWithTime, linkViabilityCalculators );
 
     return std::make_pair( simulatedObservations.first, std::make_pair( simulatedObservations.second, linkEndAssociatedWithTime ) );
 }
 
+//! Function to simulate observables, checking whether they are viable according to settings passed to this function
+/*!
+ *  Function to simulate observables, checking whether they are viable according to settings passed to this function
+ *  (if viability calculators are passed to this function).
+ *  \param observationTimes Times at which observables are to be computed
+ *  \param observationModel Model used to compute observables
+ *  \param linkEndAssociatedWithTime Model Reference link end for observables
+ *  \param linkViabilityCalculators List of observation viability calculators, which are used to reject simulated
+ *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \return Observations at given times (concatenated in an Eigen vector), with associated times and reference link end.
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::pair< std::vector< TimeType >, LinkEndType > >
+simulateObservationsWithCheckAndLinkEndIdOutput(
+        const std::vector< TimeType >& observationTimes,
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const LinkEndType linkEndAssociatedWithTime,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > > linkViabilityCalculators =
+        std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
+{
+    return simulateObservationsWithCheckAndLinkEndIdOutput< ObservationSize, ObservationScalarType, TimeType >(
+                observationTimes,
+                std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >(
+                    1, observationModel ), linkEndAssociatedWithTime, linkViabilityCalculators );
+}
+
 //! Virtual base class for the observation simulator class.
 /*!
  *  Virtual base class for the observation simulator class, which is used to compute observable values of a
@@ -220,6 +347,25 @@ public:
                                        const LinkEndType linkEndAssociatedWithTime,
                                        const bool checkTimes = true ) = 0;
 
+    //! Function (pure virtual) to set the observation simulators used by additional threads when simulating observations.
+    /*!
+     * Function (pure virtual) to set the observation simulators used by additional threads when simulating observations.
+     * Each of the simulators must be an independent copy of this object (created from the same observation settings), so
+     * that each thread uses its own observation models.
+     * \param threadLocalObservationSimulators List of observation simulators, one for each thread in addition to the
+     * calling thread (empty to simulate observations serially).
+     */
+    virtual void setThreadLocalObservationSimulators(
+            const std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >&
+            threadLocalObservationSimulators ) = 0;
+
+    //! Function (pure virtual) to get the number of threads used when simulating observations.
+    /*!
+     * Function (pure virtual) to get the number of threads used when simulating observations.
+     * \return Number of threads used when simulating observations.
+     */
+    virtual unsigned int getNumberOfObservationThreads( ) = 0;
+
     //! Function to set observation viability calculators
     /*!
      * Function to set observation viability calculators, a different list must be provided for each set of link ends.
@@ -326,6 +472,78 @@ public:
         return observationModels_;
     }
 
+    //! Function to set the observation simulators used by additional threads when simulating observations.
+    /*!
+     * Function to set the observation simulators used by additional threads when simulating observations. Each of the
+     * simulators must be an independent copy of this object (created from the same observation settings), so that each
+     * thread uses its own observation models. The observation biases of this object are shared with the copies, so that
+     * changes in estimated bias parameters are applied to all threads.
+     * \param threadLocalObservationSimulators List of observation simulators, one for each thread in addition to the
+     * calling thread (empty to simulate observations serially).
+     */
+    void setThreadLocalObservationSimulators(
+            const std::vector< std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >&
+            threadLocalObservationSimulators )
+    {
+        threadLocalObservationSimulators_.clear( );
+        for( unsigned int i = 0; i < threadLocalObservationSimulators.size( ); i++ )
+        {
+            std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > >
+                    currentObservationSimulator = std::dynamic_pointer_cast<
+                    ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > >(
+                        threadLocalObservationSimulators.at( i ) );
+            if( currentObservationSimulator == nullptr ||
+                    currentObservationSimulator->getObservableType( ) != observableType_ )
+            {
+                throw std::runtime_error( "Error when setting thread-local observation simulators, type is inconsistent." );
+            }
+
+            // Share observation biases with thread-local observation models
+            for( auto modelIterator : observationModels_ )
+            {
+                if( currentObservationSimulator->getObservationModel( modelIterator.first ) == modelIterator.second )
+                {
+                    throw std::runtime_error(
+                                "Error when setting thread-local observation simulators, observation model is not a copy." );
+                }
+                currentObservationSimulator->getObservationModel( modelIterator.first )->setObservationBiasCalculator(
+                            modelIterator.second->getObservationBiasCalculator( ) );
+            }
+
+            threadLocalObservationSimulators_.push_back( currentObservationSimulator );
+        }
+    }
+
+    //! Function to get the number of threads used when simulating observations.
+    /*!
+     * Function to get the number of threads used when simulating observations.
+     * \return Number of threads used when simulating observations.
+     */
+    unsigned int getNumberOfObservationThreads( )
+    {
+        return threadLocalObservationSimulators_.size( ) + 1;
+    }
+
+    //! Function to get the observation models for a given set of link ends, for all threads
+    /*!
+     * Function to get the observation models for a given set of link ends, for all threads used when simulating
+     * observations (first entry is the model of this object, subsequent entries from thread-local simulators).
+     * \param linkEnds Link ends for which observation models are to be retrieved
+     * \return Observation models for a given set of link ends, for all threads
+     */
+    std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
+    getThreadLocalObservationModels( const LinkEnds linkEnds )
+    {
+        std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
+                threadLocalObservationModels;
+        threadLocalObservationModels.push_back( getObservationModel( linkEnds ) );
+        for( unsigned int i = 0; i < threadLocalObservationSimulators_.size( ); i++ )
+        {
+            threadLocalObservationModels.push_back( threadLocalObservationSimulators_.at( i )->getObservationModel( linkEnds ) );
+        }
+        return threadLocalObservationModels;
+    }
+
 
     //! Function to simulate a single observation between specified link ends.
     /*!
@@ -358,7 +576,8 @@ public:
     //! Function to simulate observations between specified link ends.
     /*!
      *  Function to simulate observations between specified link ends. Users can specify whether to check for availability of
-     *  link at given reception time.
+     *  link at given reception time. If thread-local observation simulators have been set, blocks of observation times are
+     *  simulated concurrently (see simulateObservationsWithCheck).
      *  \param observationTimes Vector of times at which observations taked place (i.e. reception time)
      *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
      *  \param linkEndAssociatedWithTime Reference link end for observable
@@ -378,8 +597,6 @@ public:
                         "Error when simulating observtions, could not find observation model for given linke ends" );
         }
 
-        std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
-                observationModels_.at( linkEnds );
         std::vector< std::shared_ptr< ObservationViabilityCalculator > > currentLinkViabilityCalculators;
         if( checkTimes == true && this->viabilityCalculators_.count( linkEnds ) > 0 )
         {
@@ -387,7 +604,8 @@ public:
         }
 
         return simulateObservationsWithCheck< ObservationSize, ObservationScalarType, TimeType >(
-                    observationTimes, selectedObservationModel, linkEndAssociatedWithTime, currentLinkViabilityCalculators );
+                    observationTimes, getThreadLocalObservationModels( linkEnds ), linkEndAssociatedWithTime,
+                    currentLinkViabilityCalculators );
     }
 
     //! Function to simulate observations between specified link ends.
@@ -423,6 +641,10 @@ protected:
     //! List of observation models of type observableType
     std::map< LinkEnds, std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >
     observationModels_;
+
+    //! Observation simulators used by additional threads when simulating observations.
+    std::vector< std::shared_ptr< ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > >
+    threadLocalObservationSimulators_;
 };
 
 extern template class ObservationSimulatorBase< double, double >;
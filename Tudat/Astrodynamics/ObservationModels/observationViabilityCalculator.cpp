@@ -8,6 +8,8 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+
 #include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
 
 namespace tudat
@@ -50,6 +52,38 @@ bool isObservationViable(
     return isObservationFeasible;
 }
 
+//! Function to check whether each of a set of observations is viable
+std::vector< bool > checkObservationsViability(
+        const std::vector< std::vector< Eigen::Vector6d > >& statesList,
+        const std::vector< std::vector< double > >& timesList,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators )
+{
+    if( statesList.size( ) != timesList.size( ) )
+    {
+        throw std::runtime_error( "Error when checking observations viability, number of states and times is inconsistent." );
+    }
+
+    // Apply each check to all observations that have passed the preceding checks.
+    std::vector< bool > observationViability( statesList.size( ), true );
+    for( unsigned int i = 0; i < viabilityCalculators.size( ); i++ )
+    {
+        if( std::find( observationViability.begin( ), observationViability.end( ), true ) == observationViability.end( ) )
+        {
+            break;
+        }
+        for( unsigned int j = 0; j < observationViability.size( ); j++ )
+        {
+            if( observationViability[ j ] )
+            {
+                observationViability[ j ] = viabilityCalculators.at( i )->isObservationViable(
+                            statesList.at( j ), timesList.at( j ) );
+            }
+        }
+    }
+
+    return observationViability;
+}
+
 //! Function for determining whether the elevation angle at station is sufficient to allow observation
 bool MinimumElevationAngleCalculator::isObservationViable(
         const std::vector< Eigen::Vector6d >& linkEndStates,
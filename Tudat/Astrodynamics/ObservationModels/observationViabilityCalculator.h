@@ -35,7 +35,10 @@ namespace observation_models
  *  Base class for determining whether an observation is possible or not. Derived classes implement specific checks, such as
  *  minimum elevation angle, body occultation, etc. The input from which the viability of an observation is calculated is a vector
  *  of times and states of the link ends involved in the observation for which the viability is checked, in the order as provided
- *  by the computeObservationsAndLinkEndData of the associated ObservationModel.
+ *  by the computeObservationsAndLinkEndData of the associated ObservationModel. The derived classes in this file do not
+ *  modify any member variables when checking viability, and only retrieve environment properties (body states and
+ *  rotations) through the bodies. They can therefore be shared by threads that simulate observations concurrently, in the
+ *  same way as the bodies are shared by the observation models of those threads (see simulateObservationsWithCheck).
  */
 class ObservationViabilityCalculator
 {
@@ -94,6 +97,24 @@ bool isObservationViable(
         const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
         const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
 
+//! Function to check whether each of a set of observations is viable
+/*!
+ * Function to check whether each of a set of observations is viable. Each viability calculator is applied to the full set of
+ * observations in turn, where each calculator only checks the observations that have passed all preceding checks. The
+ * results are identical to those of calling isObservationViable for each observation separately. The checks are performed
+ * on the link end states and times, which are obtained from the (light-time) solution of the observations.
+ * \param statesList List of vectors of states of the link ends involved in each observation, in the order as provided by the
+ * function computeObservationsAndLinkEndData of the associated ObservationModel.
+ * \param timesList List of vectors of times of the link ends involved in each observation, in the order as provided by the
+ * function computeObservationsAndLinkEndData of the associated ObservationModel.
+ * \param viabilityCalculators List of viability calculators
+ * \return Boolean for each observation denoting whether it is viable.
+ */
+std::vector< bool > checkObservationsViability(
+        const std::vector< std::vector< Eigen::Vector6d > >& statesList,
+        const std::vector< std::vector< double > >& timesList,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
+
 
 //! Function to check whether an observation is possible based on minimum elevation angle criterion at one link end.
 class MinimumElevationAngleCalculator: public ObservationViabilityCalculator
@@ -133,6 +154,7 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors are to be used in isObservationViable  function
@@ -161,6 +161,72 @@ public:
         return ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) << observation ).finished( );
     }
 
+    //! Function to compute one-way range observables without any corrections at a list of times.
+    /*!
+     *  Function to compute one-way range observables without any corrections at a list of times, as well as the times
+     *  and states of the link ends for each observation (see computeIdealObservationsWithLinkEndData). The light times
+     *  are computed for all times at once (see LightTimeCalculator::calculateLightTimesWithLinkEndsStates), so that the
+     *  light-time solution at each time is started from the solutions at the preceding times. The resulting observables
+     *  differ from those computed by computeIdealObservationsWithLinkEndData for each time separately by less than the
+     *  speed of light times the light-time tolerance.
+     *  \param times Times at which observables are to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param observations List of ideal one-way range observables, one per time (returned by reference).
+     *  \param linkEndTimes List of times at each link end, one list per observation (returned by reference).
+     *  \param linkEndStates List of states at each link end, one list per observation (returned by reference).
+     */
+    void computeIdealObservationsWithLinkEndDataForTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > >& observations,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        // Check link end associated with input time.
+        bool isTimeAtReception;
+        if( linkEndAssociatedWithTime == receiver )
+        {
+            isTimeAtReception = true;
+        }
+        else if( linkEndAssociatedWithTime == transmitter )
+        {
+            isTimeAtReception = false;
+        }
+        else
+        {
+            std::string errorMessage = "Error, cannot have link end type: " +
+                    std::to_string( linkEndAssociatedWithTime ) + "for one-way range";
+            throw std::runtime_error( errorMessage );
+        }
+
+        // Compute light times and link end states at all times
+        std::vector< ObservationScalarType > lightTimes = lightTimeCalculator_->calculateLightTimesWithLinkEndsStates(
+                    receiverStates_, transmitterStates_, times, isTimeAtReception );
+
+        observations.resize( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            TimeType transmissionTime = isTimeAtReception ? times[ i ] - lightTimes[ i ] : times[ i ];
+            TimeType receptionTime = isTimeAtReception ? times[ i ] : times[ i ] + lightTimes[ i ];
+
+            // Convert light time to range.
+            observations[ i ] = ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) <<
+                                  lightTimes[ i ] * physical_constants::getSpeedOfLight< ObservationScalarType >( ) ).finished( );
+
+            // Set link end states and times.
+            linkEndTimes[ i ].clear( );
+            linkEndTimes[ i ].push_back( static_cast< double >( transmissionTime ) );
+            linkEndTimes[ i ].push_back( static_cast< double >( receptionTime ) );
+
+            linkEndStates[ i ].clear( );
+            linkEndStates[ i ].push_back( transmitterStates_[ i ].template cast< double >( ) );
+            linkEndStates[ i ].push_back( receiverStates_[ i ].template cast< double >( ) );
+        }
+    }
+
     //! Function to get the object to calculate light time.
     /*!
      * Function to get the object to calculate light time.
@@ -187,6 +253,12 @@ private:
     //! Pre-declared transmitter state, to prevent many (de-)allocations
     StateType transmitterState;
 
+    //! Pre-declared list of receiver states, to prevent many (de-)allocations
+    std::vector< StateType > receiverStates_;
+
+    //! Pre-declared list of transmitter states, to prevent many (de-)allocations
+    std::vector< StateType > transmitterStates_;
+
 };
 
 } // namespace observation_models
@@ -12,8 +12,10 @@
 #define TUDAT_SIMULATEOBSERVATIONS_H
 
 #include <memory>
+#include <tuple>
 #include <boost/bind.hpp>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
 
 namespace tudat
@@ -62,11 +64,13 @@ struct TabulatedObservationSimulationTimeSettings: public ObservationSimulationT
     std::vector< TimeType > simulationTimes_;
 };
 
-//! Function to compute observations at times defined by settings object using a given observation model
+//! Function to compute observations at times defined by settings object using a given list of observation models
 /*!
- *  Function to compute observations at times defined by settings object using a given observation model
+ *  Function to compute observations at times defined by settings object using a given list of observation models, one
+ *  for each thread over which the observation times are to be distributed (see simulateObservationsWithCheck).
  *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
- *  \param observationModel Observation model that is to be used to compute observations
+ *  \param observationModels Observation models that are to be used to compute observations (independent copies, one for
+ *  each thread).
  *  \param currentObservationViabilityCalculators List of observation viability calculators, which are used to reject simulated
  *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
  *  \return Pair of observable values and observation time (with associated reference link end)
@@ -76,7 +80,8 @@ template< typename ObservationScalarType = double, typename TimeType = double,
 std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,std::pair< std::vector< TimeType >, LinkEndType > >
 simulateSingleObservationSet(
         const std::shared_ptr< ObservationSimulationTimeSettings< TimeType > > observationsToSimulate,
-        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >&
+        observationModels,
         const std::vector< std::shared_ptr< ObservationViabilityCalculator > > currentObservationViabilityCalculators =
         std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
 {
@@ -93,7 +98,7 @@ simulateSingleObservationSet(
         // Simulate observations at requested pre-defined time.
         simulatedObservations = simulateObservationsWithCheckAndLinkEndIdOutput<
                 ObservationSize, ObservationScalarType, TimeType >(
-                    tabulatedObservationSettings->simulationTimes_, observationModel, observationsToSimulate->linkEndType_,
+                    tabulatedObservationSettings->simulationTimes_, observationModels, observationsToSimulate->linkEndType_,
                     currentObservationViabilityCalculators );
 
     }
@@ -101,6 +106,30 @@ simulateSingleObservationSet(
     return simulatedObservations;
 }
 
+//! Function to compute observations at times defined by settings object using a given observation model
+/*!
+ *  Function to compute observations at times defined by settings object using a given observation model
+ *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
+ *  \param observationModel Observation model that is to be used to compute observations
+ *  \param currentObservationViabilityCalculators List of observation viability calculators, which are used to reject simulated
+ *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \return Pair of observable values and observation time (with associated reference link end)
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+          int ObservationSize = 1 >
+std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,std::pair< std::vector< TimeType >, LinkEndType > >
+simulateSingleObservationSet(
+        const std::shared_ptr< ObservationSimulationTimeSettings< TimeType > > observationsToSimulate,
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > > currentObservationViabilityCalculators =
+        std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
+{
+    return simulateSingleObservationSet< ObservationScalarType, TimeType, ObservationSize >(
+                observationsToSimulate,
+                std::vector< std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > >(
+                    1, observationModel ), currentObservationViabilityCalculators );
+}
+
 //! Function to simulate observations for single observable and single set of link ends.
 /*!
  *  Function to simulate observations for single observable and single set of link ends. From the observation time settings and
@@ -108,6 +137,8 @@ simulateSingleObservationSet(
  *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
  *  \param observationSimulator Observation simulator for observable for which observations are to be calculated.
  *  \param linkEnds Link end set for which observations are to be calculated.
+ *  If thread-local observation simulators have been set for observationSimulator, the observation times are distributed
+ *  over multiple threads (see ObservationSimulator::setThreadLocalObservationSimulators).
  *  \param currentObservationViabilityCalculators List of observation viability calculators, which are used to reject simulated
  *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
  *  \return Pair of first: vector of observations; second: vector of times at which observations are taken
@@ -142,7 +173,7 @@ simulateSingleObservationSet(
     }
 
     return simulateSingleObservationSet< ObservationScalarType, TimeType, ObservationSize >(
-                observationsToSimulate, observationSimulator->getObservationModel( linkEnds ),
+                observationsToSimulate, observationSimulator->getThreadLocalObservationModels( linkEnds ),
                 observationViabilityCalculatorsToUse );
 }
 
@@ -187,6 +218,8 @@ createObservationSimulationTimeSettingsMap(
  *  to observation simulation function.
  *  \param observationsToSimulate List of observation times per link end set per observable type.
  *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param numberOfThreads Number of threads over which the sets of link ends are distributed (default 1; see
+ *  overload taking ObservationSimulationTimeSettings).
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -196,21 +229,32 @@ simulateObservations(
         const std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< TimeType >, LinkEndType > > >&
         observationsToSimulate,
         const std::map< ObservableType, std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >&
-        observationSimulators )
+        observationSimulators,
+        const unsigned int numberOfThreads = 1 )
 {
     return simulateObservations< ObservationScalarType, TimeType >(
-                createObservationSimulationTimeSettingsMap( observationsToSimulate ), observationSimulators );
+                createObservationSimulationTimeSettingsMap( observationsToSimulate ), observationSimulators,
+                PerObservableObservationViabilityCalculatorList( ), numberOfThreads );
 }
 
 //! Function to simulate observations from set of observables and link and sets
 /*!
  *  Function to simulate observations from set of observables, link ends and observation time settings
- *  Iterates over all observables and link ends and simulates observations.
+ *  Iterates over all observables and link ends and simulates observations. The combinations of observable type and
+ *  link ends may be distributed over multiple threads, in which case each combination is simulated by a single thread.
+ *  Since observation models for different link ends are distinct objects, this requires no copies of the observation
+ *  simulators. However, the environment models used by the observation models must be thread-safe (which is not the
+ *  case for ephemerides/rotation models that directly call Spice). For a single set of link ends, observations may
+ *  instead be distributed over multiple threads by setting thread-local observation simulators (see
+ *  ObservationSimulator::setThreadLocalObservationSimulators); these are used only if numberOfThreads is 1. The results
+ *  are independent of the number of threads.
  *  \param observationsToSimulate List of observation time settings per link end set per observable type.
  *  \param observationSimulators List of Observation simulators per link end set per observable type.
  *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
  *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
  *  (default none).
+ *  \param numberOfThreads Number of threads over which the combinations of observable type and link ends are distributed
+ *  (default 1; if 0, the number of threads that can be executed concurrently on the current hardware is used).
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -222,13 +266,14 @@ simulateObservations(
         const std::map< ObservableType,
         std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+        PerObservableObservationViabilityCalculatorList( ),
+        const unsigned int numberOfThreads = 1 )
 {
-    // Declare return map.
-    std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
-            std::pair< std::vector< TimeType >, LinkEndType > > > > observations;
+    typedef std::tuple< ObservableType, LinkEnds, std::shared_ptr< ObservationSimulationTimeSettings< TimeType > >,
+            std::vector< std::shared_ptr< ObservationViabilityCalculator > > > ObservationSimulationTask;
 
-    // Iterate over all observables.
+    // Create list of observable type/link end combinations that are to be simulated
+    std::vector< ObservationSimulationTask > observationSimulationTasks;
     for( typename std::map< ObservableType, std::map< LinkEnds,
          std::shared_ptr< ObservationSimulationTimeSettings< TimeType > >  > >::const_iterator observationIterator =
          observationsToSimulate.begin( ); observationIterator != observationsToSimulate.end( ); observationIterator++ )
@@ -251,16 +296,38 @@ simulateObservations(
                 currentObservationViabilityCalculators = perLinkViabilityCalculators.at( linkEndIterator->first );
             }
 
-            int observationSize = observationSimulators.at( observationIterator->first )->getObservationSize(
-                        linkEndIterator->first );
+            observationSimulationTasks.push_back(
+                        std::make_tuple( observationIterator->first, linkEndIterator->first, linkEndIterator->second,
+                                         currentObservationViabilityCalculators ) );
+        }
+    }
 
-            switch( observationSize )
-            {
+    unsigned int numberOfThreadsToUse =
+            ( numberOfThreads == 0 ) ? utilities::getNumberOfAvailableThreads( ) : numberOfThreads;
+    numberOfThreadsToUse = std::max( std::min(
+                numberOfThreadsToUse, static_cast< unsigned int >( observationSimulationTasks.size( ) ) ), 1U );
+
+    // Simulate observations for single observable type/link end combination (the environment is shared by all threads)
+    std::vector< std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+            std::pair< std::vector< TimeType >, LinkEndType > > > simulatedObservationSets(
+                observationSimulationTasks.size( ) );
+    auto simulateObservationSet = [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        utilities::ConcurrentSharedObjectAccess sharedEnvironmentAccess( numberOfThreadsToUse > 1 );
+
+        const ObservationSimulationTask& currentTask = observationSimulationTasks.at( taskIndex );
+        std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > currentObservationSimulator =
+                observationSimulators.at( std::get< 0 >( currentTask ) );
+
+        int observationSize = currentObservationSimulator->getObservationSize( std::get< 1 >( currentTask ) );
+
+        switch( observationSize )
+        {
             case 1:
             {
                 std::shared_ptr< ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
                         std::dynamic_pointer_cast< ObservationSimulator< 1, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
+                            currentObservationSimulator );
 
                 if( derivedObservationSimulator == nullptr )
                 {
@@ -268,17 +335,16 @@ simulateObservations(
                 }
 
                 // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
+                simulatedObservationSets[ taskIndex ] = simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
+                            std::get< 2 >( currentTask ), derivedObservationSimulator, std::get< 1 >( currentTask ),
+                            std::get< 3 >( currentTask ) );
                 break;
             }
             case 2:
             {
                 std::shared_ptr< ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
                         std::dynamic_pointer_cast< ObservationSimulator< 2, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
+                            currentObservationSimulator );
 
                 if( derivedObservationSimulator == nullptr )
                 {
@@ -286,17 +352,16 @@ simulateObservations(
                 }
 
                 // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
+                simulatedObservationSets[ taskIndex ] = simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
+                            std::get< 2 >( currentTask ), derivedObservationSimulator, std::get< 1 >( currentTask ),
+                            std::get< 3 >( currentTask ) );
                 break;
             }
             case 3:
             {
                 std::shared_ptr< ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
                         std::dynamic_pointer_cast< ObservationSimulator< 3, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
+                            currentObservationSimulator );
 
                 if( derivedObservationSimulator == nullptr )
                 {
@@ -304,18 +369,28 @@ simulateObservations(
                 }
 
                 // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
+                simulatedObservationSets[ taskIndex ] = simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
+                            std::get< 2 >( currentTask ), derivedObservationSimulator, std::get< 1 >( currentTask ),
+                            std::get< 3 >( currentTask ) );
                 break;
             }
-            default:
-                throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
-                                          std::to_string( observationSize ) );
+        default:
+            throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                      std::to_string( observationSize ) );
 
-            }
         }
+    };
+
+    utilities::executeParallelTasks(
+                observationSimulationTasks.size( ), numberOfThreadsToUse, simulateObservationSet );
+
+    // Declare and fill return map.
+    std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+            std::pair< std::vector< TimeType >, LinkEndType > > > > observations;
+    for( unsigned int i = 0; i < observationSimulationTasks.size( ); i++ )
+    {
+        observations[ std::get< 0 >( observationSimulationTasks.at( i ) ) ][
+                std::get< 1 >( observationSimulationTasks.at( i ) ) ] = simulatedObservationSets.at( i );
     }
     return observations;
 }
@@ -331,6 +406,8 @@ simulateObservations(
  *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
  *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
  *  (default none).
+ *  \param numberOfThreads Number of threads used for simulating the noise-free observations (default 1; see
+ *  simulateObservations). Noise is added on a single thread.
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -343,7 +420,8 @@ simulateObservationsWithNoise(
         std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const std::map< ObservableType, std::map< LinkEnds, std::function< Eigen::VectorXd( const double ) > > >& noiseFunctions,
         const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+        PerObservableObservationViabilityCalculatorList( ),
+        const unsigned int numberOfThreads = 1 )
 {
     typedef std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
             std::pair< std::vector< TimeType >, LinkEndType > > > SingelTypeObservationsMap;
@@ -352,7 +430,7 @@ simulateObservationsWithNoise(
 
     // Simulate noise-free observations
     ObservationsMap noiseFreeObservationsList = simulateObservations(
-                observationsToSimulate, observationSimulators, viabilityCalculatorList );
+                observationsToSimulate, observationSimulators, viabilityCalculatorList, numberOfThreads );
 
     // Declare return map with noisy observations.
     ObservationsMap noisyObservationsList;
@@ -428,6 +506,8 @@ Eigen::VectorXd getIdenticallyAndIndependentlyDistributedNoise(
  *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
  *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
  *  (default none).
+ *  \param numberOfThreads Number of threads used for simulating the noise-free observations (default 1; see
+ *  simulateObservations). Noise is added on a single thread.
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -440,7 +520,8 @@ simulateObservationsWithNoise(
         std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const std::map< ObservableType, std::map< LinkEnds, std::function< double( const double ) > > >& noiseFunctions,
         const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+        PerObservableObservationViabilityCalculatorList( ),
+        const unsigned int numberOfThreads = 1 )
 {
     // Create noise map for input to simulation function
     std::map< ObservableType, std::map< LinkEnds, std::function< Eigen::VectorXd( const double ) > > > noiseVectorFunctions;
@@ -459,7 +540,8 @@ simulateObservationsWithNoise(
 
     // Simulate observations with noise
     return simulateObservationsWithNoise(
-                observationsToSimulate, observationSimulators, noiseVectorFunctions, viabilityCalculatorList );
+                observationsToSimulate, observationSimulators, noiseVectorFunctions, viabilityCalculatorList,
+                numberOfThreads );
 }
 
 //! Function to simulate observations with observation noise from set of observables and link and sets
@@ -473,6 +555,8 @@ simulateObservationsWithNoise(
  *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
  *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
  *  (default none).
+ *  \param numberOfThreads Number of threads used for simulating the noise-free observations (default 1; see
+ *  simulateObservations). Noise is added on a single thread.
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -485,7 +569,8 @@ simulateObservationsWithNoise(
         std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const std::map< ObservableType, std::function< Eigen::VectorXd( const double ) > >& noiseFunctions,
         const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+        PerObservableObservationViabilityCalculatorList( ),
+        const unsigned int numberOfThreads = 1 )
 {
     std::map< ObservableType, std::map< LinkEnds, std::function< Eigen::VectorXd( const double ) > > > fullNoiseFunctions;
 
@@ -511,7 +596,8 @@ simulateObservationsWithNoise(
 
     // Simulate observations with noise
     return simulateObservationsWithNoise(
-                observationsToSimulate, observationSimulators, fullNoiseFunctions, viabilityCalculatorList );
+                observationsToSimulate, observationSimulators, fullNoiseFunctions, viabilityCalculatorList,
+                numberOfThreads );
 }
 
 //! Function to simulate observations with observation noise from set of observables and link and sets
@@ -527,6 +613,8 @@ simulateObservationsWithNoise(
  *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
  *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
  *  (default none).
+ *  \param numberOfThreads Number of threads used for simulating the noise-free observations (default 1; see
+ *  simulateObservations). Noise is added on a single thread.
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -539,7 +627,8 @@ simulateObservationsWithNoise(
         std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const std::map< ObservableType, std::function< double( const double ) > >& noiseFunctions,
         const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+        PerObservableObservationViabilityCalculatorList( ),
+        const unsigned int numberOfThreads = 1 )
 {
     // Create noise map for input to simulation function
     std::map< ObservableType, std::function< Eigen::VectorXd( const double ) > > noiseVectorFunctions;
@@ -552,7 +641,8 @@ simulateObservationsWithNoise(
                     getObservableSize( noiseIterator->first ), std::placeholders::_1 );
     }
     return simulateObservationsWithNoise(
-                observationsToSimulate, observationSimulators, noiseVectorFunctions, viabilityCalculatorList );
+                observationsToSimulate, observationSimulators, noiseVectorFunctions, viabilityCalculatorList,
+                numberOfThreads );
 }
 
 //! Function to simulate observations with observation noise from set of observables and link and sets
@@ -566,6 +656,8 @@ simulateObservationsWithNoise(
  *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
  *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
  *  (default none).
+ *  \param numberOfThreads Number of threads used for simulating the noise-free observations (default 1; see
+ *  simulateObservations). Noise is added on a single thread.
  *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
@@ -578,7 +670,8 @@ simulateObservationsWithNoise(
         std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
         const std::function< double( const double ) >& noiseFunction,
         const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+        PerObservableObservationViabilityCalculatorList( ),
+        const unsigned int numberOfThreads = 1 )
 {
     // Create noise map for input to simulation function
     std::map< ObservableType, std::function< double( const double ) > > noiseFunctionList;
@@ -591,7 +684,8 @@ simulateObservationsWithNoise(
 
     // Simulate observations with noise
     return simulateObservationsWithNoise(
-                observationsToSimulate, observationSimulators, noiseFunctionList, viabilityCalculatorList );
+                observationsToSimulate, observationSimulators, noiseFunctionList, viabilityCalculatorList,
+                numberOfThreads );
 }
 
 //! Function to remove link id from the simulated observations
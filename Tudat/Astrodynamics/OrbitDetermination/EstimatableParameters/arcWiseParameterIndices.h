@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ARCWISEPARAMETERINDICES_H
+#define TUDAT_ARCWISEPARAMETERINDICES_H
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/empiricalAccelerationCoefficients.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/estimatableParameter.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/initialTranslationalState.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/observationBiasParameter.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/radiationPressureCoefficient.h"
+
+namespace tudat
+{
+
+namespace estimatable_parameters
+{
+
+//! Function to determine the state arc in which each of a list of parameter arcs is contained
+/*!
+ *  Function to determine the state arc in which each of a list of parameter arcs (e.g. of arc-wise observation biases or
+ *  empirical accelerations) is contained. Parameter arc i runs from parameterArcStartTimes[ i ] up to
+ *  parameterArcStartTimes[ i + 1 ] (last arc: no upper limit), and likewise for the state arcs.
+ *  \param parameterArcStartTimes Start times of the parameter arcs (in ascending order)
+ *  \param stateArcStartTimes Start times of the state arcs (in ascending order)
+ *  \return Index of the state arc in which each parameter arc is contained (empty vector if any of the parameter arcs is
+ *  not fully contained in a single state arc)
+ */
+inline std::vector< int > getStateArcIndicesOfParameterArcs(
+        const std::vector< double >& parameterArcStartTimes,
+        const std::vector< double >& stateArcStartTimes )
+{
+    std::vector< int > stateArcIndices;
+    for( unsigned int i = 0; i < parameterArcStartTimes.size( ); i++ )
+    {
+        // Find state arc in which parameter arc starts
+        int currentStateArc = static_cast< int >(
+                    std::upper_bound( stateArcStartTimes.begin( ), stateArcStartTimes.end( ),
+                                      parameterArcStartTimes.at( i ) ) - stateArcStartTimes.begin( ) ) - 1;
+        if( currentStateArc < 0 )
+        {
+            return std::vector< int >( );
+        }
+
+        // Check if parameter arc ends before next state arc starts
+        bool isLastStateArc = ( currentStateArc == static_cast< int >( stateArcStartTimes.size( ) ) - 1 );
+        bool isLastParameterArc = ( i == parameterArcStartTimes.size( ) - 1 );
+        if( !isLastStateArc && ( isLastParameterArc ||
+                                 parameterArcStartTimes.at( i + 1 ) > stateArcStartTimes.at( currentStateArc + 1 ) ) )
+        {
+            return std::vector< int >( );
+        }
+        stateArcIndices.push_back( currentStateArc );
+    }
+    return stateArcIndices;
+}
+
+//! Function to determine the arc to which each of the estimated parameters is local
+/*!
+ *  Function to determine the arc to which each of the estimated parameters is local, for use in the elimination of
+ *  arc-wise parameters from the normal equations (see linear_algebra::ArcWiseNormalEquationAccumulator). The arcs are
+ *  the arcs of the multi-arc initial state parameters. These initial states are local to their arc, as are arc-wise
+ *  radiation pressure coefficients, empirical accelerations and observation biases if each of their arcs is contained in
+ *  a single state arc. All other parameters are global.
+ *  \param estimatableParameters Set of estimated parameters
+ *  \return Index of the arc to which each parameter is local (-1 for global parameters), in the order of the estimated
+ *  parameter vector
+ */
+template< typename InitialStateParameterType >
+std::vector< int > getArcIndicesOfEstimatedParameters(
+        const std::shared_ptr< EstimatableParameterSet< InitialStateParameterType > > estimatableParameters )
+{
+    std::vector< int > parameterArcIndices( estimatableParameters->getEstimatedParameterSetSize( ), -1 );
+
+    std::vector< double > stateArcStartTimes = getMultiArcStateEstimationArcStartTimes( estimatableParameters, false );
+    const int numberOfStateArcs = stateArcStartTimes.size( );
+    if( numberOfStateArcs == 0 )
+    {
+        return parameterArcIndices;
+    }
+
+    // Set arc indices of multi-arc initial states (concatenated in arc order)
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > > > >
+            multiArcStateParameters = estimatableParameters->getInitialMultiArcStateParameters( );
+    for( auto parameterIterator : multiArcStateParameters )
+    {
+        const int singleArcParameterSize = parameterIterator.second->getParameterSize( ) / numberOfStateArcs;
+        for( int i = 0; i < parameterIterator.second->getParameterSize( ); i++ )
+        {
+            parameterArcIndices[ parameterIterator.first + i ] = i / singleArcParameterSize;
+        }
+    }
+
+    // Set arc indices of arc-wise vector parameters (concatenated in arc order), if each arc is contained in a state arc
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+            estimatableParameters->getVectorParameters( );
+    for( auto parameterIterator : vectorParameters )
+    {
+        std::vector< double > parameterArcStartTimes;
+        switch( parameterIterator.second->getParameterName( ).first )
+        {
+        case arc_wise_radiation_pressure_coefficient:
+        {
+            std::shared_ptr< ArcWiseRadiationPressureCoefficient > radiationPressureParameter =
+                    std::dynamic_pointer_cast< ArcWiseRadiationPressureCoefficient >( parameterIterator.second );
+            if( radiationPressureParameter != nullptr )
+            {
+                parameterArcStartTimes = radiationPressureParameter->getArcStartTimes( );
+            }
+            break;
+        }
+        case arc_wise_empirical_acceleration_coefficients:
+        {
+            std::shared_ptr< ArcWiseEmpiricalAccelerationCoefficientsParameter > empiricalAccelerationParameter =
+                    std::dynamic_pointer_cast< ArcWiseEmpiricalAccelerationCoefficientsParameter >(
+                        parameterIterator.second );
+            if( empiricalAccelerationParameter != nullptr )
+            {
+                parameterArcStartTimes = empiricalAccelerationParameter->getArcStartTimes( );
+            }
+            break;
+        }
+        case arcwise_constant_additive_observation_bias:
+        case arcwise_constant_relative_observation_bias:
+        {
+            std::shared_ptr< ArcWiseObservationBiasParameter > biasParameter =
+                    std::dynamic_pointer_cast< ArcWiseObservationBiasParameter >( parameterIterator.second );
+            if( biasParameter != nullptr )
+            {
+                parameterArcStartTimes = biasParameter->getArcStartTimes( );
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        std::vector< int > stateArcIndices = getStateArcIndicesOfParameterArcs(
+                    parameterArcStartTimes, stateArcStartTimes );
+        if( stateArcIndices.size( ) == 0 ||
+                ( parameterIterator.second->getParameterSize( ) % static_cast< int >( stateArcIndices.size( ) ) != 0 ) )
+        {
+            continue;
+        }
+
+        const int singleArcParameterSize = parameterIterator.second->getParameterSize( ) / stateArcIndices.size( );
+        for( int i = 0; i < parameterIterator.second->getParameterSize( ); i++ )
+        {
+            parameterArcIndices[ parameterIterator.first + i ] = stateArcIndices.at( i / singleArcParameterSize );
+        }
+    }
+
+    return parameterArcIndices;
+}
+
+} // namespace estimatable_parameters
+
+} // namespace tudat
+
+#endif // TUDAT_ARCWISEPARAMETERINDICES_H
@@ -403,6 +403,16 @@ public:
         return empiricalAccelerationInterpolator_->getLookUpScheme( );
     }
 
+    //! Function to retrieve the times at which the arcs over which empirical accelerations are constant start
+    /*!
+     *  Function to retrieve the times at which the arcs over which empirical accelerations are constant start
+     *  \return Times at which the arcs over which empirical accelerations are constant start
+     */
+    std::vector< double > getArcStartTimes( )
+    {
+        return std::vector< double >( arcStartTimeList_.begin( ), arcStartTimeList_.end( ) - 1 );
+    }
+
 protected:
 
 private:
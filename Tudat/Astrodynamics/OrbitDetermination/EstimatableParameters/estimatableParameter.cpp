@@ -271,6 +271,29 @@ bool isParameterTidalProperty( const EstimatebleParametersEnum parameterType )
     return flag;
 }
 
+//! Function to determine whether the given parameter can influence the propagated dynamics
+bool isParameterDynamicsProperty( const EstimatebleParametersEnum parameterType )
+{
+    bool flag;
+    if( isParameterObservationLinkProperty( parameterType ) )
+    {
+        flag = false;
+    }
+    else
+    {
+        switch( parameterType )
+        {
+        case ground_station_position:
+            flag = false;
+            break;
+        default:
+            flag = true;
+            break;
+        }
+    }
+    return flag;
+}
+
 //#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 //template class EstimatableParameter< Eigen::VectorXd >;
 //template class EstimatableParameter< Eigen::Matrix< long double, Eigen::Dynamic, 1 > >;
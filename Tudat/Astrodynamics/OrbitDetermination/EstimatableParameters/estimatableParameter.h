@@ -103,6 +103,16 @@ bool isParameterObservationLinkProperty( const EstimatebleParametersEnum paramet
  */
 bool isParameterTidalProperty( const EstimatebleParametersEnum parameterType );
 
+//! Function to determine whether the given parameter can influence the propagated dynamics
+/*!
+ * Function to determine whether the given parameter can influence the propagated dynamics (and variational equations). This
+ * is false for parameters that only influence the observation models, such as observation biases and ground station
+ * positions, for which a change in value does not require the dynamics to be re-propagated.
+ * \param parameterType Parameter identifier.
+ * \return True if parameter can influence the propagated dynamics
+ */
+bool isParameterDynamicsProperty( const EstimatebleParametersEnum parameterType );
+
 //! Typedef for full parameter identifier.
 typedef std::pair< EstimatebleParametersEnum, std::pair< std::string, std::string > > EstimatebleParameterIdentifier;
 
@@ -1084,6 +1094,54 @@ Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > getInitialStateVec
     return initialStateVector.block( 0, 0, vectorSize, 1 );
 }
 
+//! Function to get the indices of the entries of the parameter vector that can influence the propagated dynamics
+/*!
+ *  Function to get the indices of the entries of the full parameter vector (see EstimatableParameterSet::
+ *  getFullParameterValues) that can influence the propagated dynamics (see isParameterDynamicsProperty). When only the
+ *  other entries of the parameter vector change, the dynamics and variational equations need not be re-propagated.
+ *  \param estimatableParameters Object containing all parameters that are to be estimated.
+ *  \return Indices (in ascending order) of the parameter vector entries that can influence the propagated dynamics
+ */
+template< typename InitialStateParameterType = double >
+std::vector< int > getIndicesOfParametersInfluencingDynamics(
+        const std::shared_ptr< EstimatableParameterSet< InitialStateParameterType > > estimatableParameters )
+{
+    std::vector< bool > isEntryDynamicsProperty( estimatableParameters->getParameterSetSize( ), true );
+
+    std::map< int, std::shared_ptr< EstimatableParameter< double > > > doubleParameters =
+            estimatableParameters->getDoubleParameters( );
+    for( auto parameterIterator : doubleParameters )
+    {
+        if( !isParameterDynamicsProperty( parameterIterator.second->getParameterName( ).first ) )
+        {
+            isEntryDynamicsProperty[ parameterIterator.first ] = false;
+        }
+    }
+
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+            estimatableParameters->getVectorParameters( );
+    for( auto parameterIterator : vectorParameters )
+    {
+        if( !isParameterDynamicsProperty( parameterIterator.second->getParameterName( ).first ) )
+        {
+            for( int i = 0; i < parameterIterator.second->getParameterSize( ); i++ )
+            {
+                isEntryDynamicsProperty[ parameterIterator.first + i ] = false;
+            }
+        }
+    }
+
+    std::vector< int > dynamicsParameterIndices;
+    for( unsigned int i = 0; i < isEntryDynamicsProperty.size( ); i++ )
+    {
+        if( isEntryDynamicsProperty.at( i ) )
+        {
+            dynamicsParameterIndices.push_back( i );
+        }
+    }
+    return dynamicsParameterIndices;
+}
+
 } // namespace estimatable_parameters
 
 } // namespace tudat
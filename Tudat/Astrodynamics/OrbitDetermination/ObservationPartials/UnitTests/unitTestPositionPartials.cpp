@@ -263,6 +263,211 @@ BOOST_AUTO_TEST_CASE( testCartesianStatePartials )
     }
 }
 
+//! Class that computes a time-dependent dummy partial, and counts the number of times it is evaluated.
+class CountingCartesianStatePartial: public CartesianStatePartial
+{
+public:
+
+    CountingCartesianStatePartial( ):
+        partialScaling_( 1.0 ), numberOfEvaluations_( 0 ){ }
+
+    Eigen::Matrix< double, 3, Eigen::Dynamic > calculatePartialOfPosition(
+            const Eigen::Vector6d& state, const double time )
+    {
+        numberOfEvaluations_++;
+        return getPartial( state, time );
+    }
+
+    Eigen::Matrix< double, 3, Eigen::Dynamic > calculatePartialOfVelocity(
+            const Eigen::Vector6d& state, const double time )
+    {
+        numberOfEvaluations_++;
+        return -getPartial( state, time );
+    }
+
+    double partialScaling_;
+
+    int numberOfEvaluations_;
+
+private:
+
+    Eigen::Matrix< double, 3, 2 > getPartial( const Eigen::Vector6d& state, const double time )
+    {
+        return partialScaling_ * ( Eigen::Matrix< double, 3, 2 >( ) <<
+                                   time, 1.0, 2.0 * time, state( 0 ), 0.0, 3.0 ).finished( );
+    }
+};
+
+//! Test whether partials of link end states are correctly shared between observation partials of different observables.
+BOOST_AUTO_TEST_CASE( testCartesianStatePartialCache )
+{
+    // Define link ends of one-way and two-way observables from the same ground station
+    LinkEnds oneWayLinkEnds;
+    oneWayLinkEnds[ transmitter ] = std::make_pair( "Earth", "Graz" );
+    oneWayLinkEnds[ receiver ] = std::make_pair( "Spacecraft", "" );
+
+    LinkEnds twoWayLinkEnds;
+    twoWayLinkEnds[ transmitter ] = std::make_pair( "Earth", "Graz" );
+    twoWayLinkEnds[ reflector1 ] = std::make_pair( "Spacecraft", "" );
+    twoWayLinkEnds[ receiver ] = std::make_pair( "Earth", "Graz" );
+
+    // Check link ends of constituent one-way links of two-way observable
+    BOOST_CHECK( getNWayConstituentOneWayLinkEnds( twoWayLinkEnds, 0 ) == oneWayLinkEnds );
+    LinkEnds downlinkLinkEnds = getNWayConstituentOneWayLinkEnds( twoWayLinkEnds, 1 );
+    BOOST_CHECK( downlinkLinkEnds.at( transmitter ) == oneWayLinkEnds.at( receiver ) );
+    BOOST_CHECK( downlinkLinkEnds.at( receiver ) == oneWayLinkEnds.at( transmitter ) );
+
+    // Create separate position partials for range and Doppler observable (as created by observation partial creation)
+    EstimatebleParameterIdentifier parameterIdentifier =
+            std::make_pair( rotation_pole_position, std::make_pair( "Earth", "" ) );
+    std::shared_ptr< CountingCartesianStatePartial > rangeStationPartial =
+            std::make_shared< CountingCartesianStatePartial >( );
+    std::shared_ptr< CountingCartesianStatePartial > dopplerStationPartial =
+            std::make_shared< CountingCartesianStatePartial >( );
+    std::shared_ptr< CartesianStatePartial > spacecraftStatePartial =
+            std::make_shared< CartesianStatePartialWrtCartesianState >( );
+
+    std::map< LinkEndType, std::shared_ptr< CartesianStatePartial > > rangePartialList;
+    rangePartialList[ transmitter ] = rangeStationPartial;
+    rangePartialList[ receiver ] = spacecraftStatePartial;
+    std::map< LinkEndType, std::shared_ptr< CartesianStatePartial > > dopplerPartialList;
+    dopplerPartialList[ receiver ] = dopplerStationPartial;
+
+    // Share partials between observables
+    std::shared_ptr< CartesianStatePartialCache > partialCache = std::make_shared< CartesianStatePartialCache >( );
+    partialCache->setCachedCartesianStatePartials( rangePartialList, oneWayLinkEnds, parameterIdentifier );
+    partialCache->setCachedCartesianStatePartials( dopplerPartialList, downlinkLinkEnds, parameterIdentifier );
+
+    // Check that station partials are shared, and that constant partial is not cached.
+    BOOST_CHECK_EQUAL( partialCache->getNumberOfCachedPartials( ), 1 );
+    BOOST_CHECK( rangePartialList.at( transmitter ) == dopplerPartialList.at( receiver ) );
+    BOOST_CHECK( rangePartialList.at( transmitter ) != rangeStationPartial );
+    BOOST_CHECK( rangePartialList.at( receiver ) == spacecraftStatePartial );
+
+    std::vector< double > testTimes = { 1.0E6, 1.0E6 + 60.0, 1.0E6 + 120.0 };
+    Eigen::Vector6d testState = ( Eigen::Vector6d( ) << 6378.0E3, 0.0, 0.0, 0.0, 465.0, 0.0 ).finished( );
+
+    // Check that partials are not stored while cache is inactive
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        rangePartialList.at( transmitter )->calculatePartialOfPosition( testState, testTimes.at( i ) );
+        dopplerPartialList.at( receiver )->calculatePartialOfPosition( testState, testTimes.at( i ) );
+    }
+    BOOST_CHECK_EQUAL( rangeStationPartial->numberOfEvaluations_, 6 );
+    BOOST_CHECK_EQUAL( partialCache->getNumberOfCacheHits( ), 0 );
+
+    // Compute partials of range and Doppler observables at the same times, with active cache
+    partialCache->setIsCacheActive( true );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        Eigen::MatrixXd rangePositionPartial =
+                rangePartialList.at( transmitter )->calculatePartialOfPosition( testState, testTimes.at( i ) );
+        Eigen::MatrixXd rangeVelocityPartial =
+                rangePartialList.at( transmitter )->calculatePartialOfVelocity( testState, testTimes.at( i ) );
+        Eigen::MatrixXd dopplerPositionPartial =
+                dopplerPartialList.at( receiver )->calculatePartialOfPosition( testState, testTimes.at( i ) );
+        Eigen::MatrixXd dopplerVelocityPartial =
+                dopplerPartialList.at( receiver )->calculatePartialOfVelocity( testState, testTimes.at( i ) );
+
+        Eigen::MatrixXd expectedPositionPartial =
+                dopplerStationPartial->calculatePartialOfPosition( testState, testTimes.at( i ) );
+        for( int j = 0; j < 3; j++ )
+        {
+            for( int k = 0; k < 2; k++ )
+            {
+                BOOST_CHECK_EQUAL( rangePositionPartial( j, k ), expectedPositionPartial( j, k ) );
+                BOOST_CHECK_EQUAL( dopplerPositionPartial( j, k ), expectedPositionPartial( j, k ) );
+                BOOST_CHECK_EQUAL( rangeVelocityPartial( j, k ), -expectedPositionPartial( j, k ) );
+                BOOST_CHECK_EQUAL( dopplerVelocityPartial( j, k ), -expectedPositionPartial( j, k ) );
+            }
+        }
+    }
+
+    // Check that each partial was computed only once (one position and one velocity partial per time)
+    BOOST_CHECK_EQUAL( rangeStationPartial->numberOfEvaluations_, 6 + 2 * 3 );
+    BOOST_CHECK_EQUAL( partialCache->getNumberOfCacheMisses( ), 6 );
+    BOOST_CHECK_EQUAL( partialCache->getNumberOfCacheHits( ), 6 );
+
+    // Check that partial is recomputed for different state at same time
+    Eigen::Vector6d perturbedTestState = testState;
+    perturbedTestState( 0 ) += 1.0;
+    Eigen::MatrixXd perturbedPartial =
+            rangePartialList.at( transmitter )->calculatePartialOfPosition( perturbedTestState, testTimes.at( 0 ) );
+    BOOST_CHECK_EQUAL( perturbedPartial( 1, 1 ), perturbedTestState( 0 ) );
+    BOOST_CHECK_EQUAL( partialCache->getNumberOfCacheMisses( ), 7 );
+
+    // Check that stored partials are removed when cache is reactivated (e.g. after parameter update)
+    rangeStationPartial->partialScaling_ = 2.0;
+    partialCache->setIsCacheActive( false );
+    partialCache->setIsCacheActive( true );
+    Eigen::MatrixXd updatedPartial =
+            dopplerPartialList.at( receiver )->calculatePartialOfPosition( testState, testTimes.at( 0 ) );
+    BOOST_CHECK_EQUAL( updatedPartial( 0, 0 ), 2.0 * testTimes.at( 0 ) );
+    BOOST_CHECK_EQUAL( partialCache->getNumberOfCacheMisses( ), 8 );
+    partialCache->setIsCacheActive( false );
+
+    // Check that cache is active only during lifetime of scoped activation, also if an exception is thrown
+    try
+    {
+        ScopedCartesianStatePartialCacheActivation cacheActivation( partialCache );
+        BOOST_CHECK_EQUAL( partialCache->getIsCacheActive( ), true );
+        throw std::runtime_error( "Test exception" );
+    }
+    catch( std::runtime_error& )
+    {
+    }
+    BOOST_CHECK_EQUAL( partialCache->getIsCacheActive( ), false );
+}
+
+//! Test whether the number of epochs at which partials are stored is bounded.
+BOOST_AUTO_TEST_CASE( testCachedCartesianStatePartialBound )
+{
+    std::shared_ptr< CountingCartesianStatePartial > stationPartial =
+            std::make_shared< CountingCartesianStatePartial >( );
+    CachedCartesianStatePartial cachedPartial( stationPartial, true, 2 );
+    Eigen::Vector6d testState = ( Eigen::Vector6d( ) << 6378.0E3, 0.0, 0.0, 0.0, 465.0, 0.0 ).finished( );
+
+    // Compute partials at three epochs: partial at first epoch is removed
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        cachedPartial.calculatePartialOfPosition( testState, 60.0 * static_cast< double >( i ) );
+    }
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfStoredEpochs( ).first, 2 );
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfStoredEpochs( ).second, 0 );
+
+    // Check that partials at two most recent epochs are reused, and partial at first epoch is recomputed
+    cachedPartial.calculatePartialOfPosition( testState, 60.0 );
+    cachedPartial.calculatePartialOfPosition( testState, 120.0 );
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfCacheHits( ), 2 );
+    BOOST_CHECK_EQUAL( stationPartial->numberOfEvaluations_, 3 );
+
+    cachedPartial.calculatePartialOfPosition( testState, 0.0 );
+    BOOST_CHECK_EQUAL( stationPartial->numberOfEvaluations_, 4 );
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfStoredEpochs( ).first, 2 );
+
+    // Check that recomputing a partial for a different state at a stored epoch does not add an epoch
+    Eigen::Vector6d perturbedTestState = testState;
+    perturbedTestState( 0 ) += 1.0;
+    cachedPartial.calculatePartialOfPosition( perturbedTestState, 0.0 );
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfStoredEpochs( ).first, 2 );
+    cachedPartial.calculatePartialOfPosition( testState, 120.0 );
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfCacheHits( ), 3 );
+
+    cachedPartial.setIsCacheActive( true );
+    BOOST_CHECK_EQUAL( cachedPartial.getNumberOfStoredEpochs( ).first, 0 );
+
+    bool isExceptionCaught = false;
+    try
+    {
+        CachedCartesianStatePartial invalidCachedPartial( stationPartial, true, 0 );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -114,6 +114,21 @@ public:
             const observation_models::LinkEndType linkEndOfFixedTime,
             const Eigen::Vector1d& currentObservation = Eigen::Vector1d::Constant( TUDAT_NAN ) );
 
+    //! Function to set the object used to share the partials of the link end states between observation partials
+    /*!
+     *  Function to set the object used to share the partials of the link end states between observation partials, which is
+     *  set for the partials of the arc start and arc end range observations.
+     *  \param cartesianStatePartialCache Object used to share the partials of the link end states
+     *  \param linkEnds Link ends of the observable for which this object computes partials
+     */
+    void setCartesianStatePartialCache(
+            const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+            const observation_models::LinkEnds& linkEnds )
+    {
+        arcStartRangePartial_->setCartesianStatePartialCache( cartesianStatePartialCache, linkEnds );
+        arcEndRangePartial_->setCartesianStatePartialCache( cartesianStatePartialCache, linkEnds );
+    }
+
 protected:
 
     //! Partial object for arc start range observation
@@ -139,6 +139,20 @@ NWayRangePartial::NWayRangePartialReturnType NWayRangePartial::calculatePartial(
     return completePartialSet;
 }
 
+//! Function to set the object used to share the partials of the link end states between observation partials
+void NWayRangePartial::setCartesianStatePartialCache(
+        const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+        const observation_models::LinkEnds& linkEnds )
+{
+    for( rangePartialIterator_ = rangePartialList_.begin( ); rangePartialIterator_ != rangePartialList_.end( );
+         rangePartialIterator_++ )
+    {
+        rangePartialIterator_->second->setCartesianStatePartialCache(
+                    cartesianStatePartialCache, observation_models::getNWayConstituentOneWayLinkEnds(
+                        linkEnds, rangePartialIterator_->first ) );
+    }
+}
+
 }
 
 }
@@ -136,6 +136,17 @@ public:
             const observation_models::LinkEndType linkEndOfFixedTime,
             const Eigen::Vector1d& currentObservation = Eigen::Vector1d::Constant( TUDAT_NAN ) );
 
+    //! Function to set the object used to share the partials of the link end states between observation partials
+    /*!
+     *  Function to set the object used to share the partials of the link end states between observation partials, which is
+     *  set for each of the constituent one-way range partials.
+     *  \param cartesianStatePartialCache Object used to share the partials of the link end states
+     *  \param linkEnds Link ends of the observable for which this object computes partials
+     */
+    void setCartesianStatePartialCache(
+            const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+            const observation_models::LinkEnds& linkEnds );
+
 protected:
 
     //! Scaling object used for mapping partials of one-way ranges to partials of observable
@@ -32,6 +32,8 @@ namespace tudat
 namespace observation_partials
 {
 
+class CartesianStatePartialCache;
+
 //! Base class for scaling position partials to observable partials.
 /*!
  *  Base class for scaling position partials to observable partials. For observables computed from the three-dimensional
@@ -114,6 +116,19 @@ public:
         return parameterIdentifier_;
     }
 
+    //! Function to set the object used to share the partials of the link end states between observation partials
+    /*!
+     *  Function to set the object used to share the partials of the link end states w.r.t. the parameter between the
+     *  observation partials of different observables and links (see CartesianStatePartialCache). Derived classes that use
+     *  partials of link end states replace their partial objects by the shared objects for the same link end and parameter;
+     *  the default implementation does nothing.
+     *  \param cartesianStatePartialCache Object used to share the partials of the link end states
+     *  \param linkEnds Link ends of the observable for which this object computes partials
+     */
+    virtual void setCartesianStatePartialCache(
+            const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+            const observation_models::LinkEnds& linkEnds ){ }
+
 
 protected:
 
@@ -459,6 +459,21 @@ public:
         return lighTimeCorrectionPartialsFunctions_.size( );
     }
 
+    //! Function to set the object used to share the partials of the link end states between observation partials
+    /*!
+     *  Function to set the object used to share the partials of the link end states between observation partials, replacing
+     *  the position partial objects of this object by the shared objects.
+     *  \param cartesianStatePartialCache Object used to share the partials of the link end states
+     *  \param linkEnds Link ends of the observable for which this object computes partials
+     */
+    void setCartesianStatePartialCache(
+            const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+            const observation_models::LinkEnds& linkEnds )
+    {
+        cartesianStatePartialCache->setCachedCartesianStatePartials(
+                    positionPartialList_, linkEnds, parameterIdentifier_ );
+    }
+
 protected:
 
     //! Scaling object used for mapping partials of positions to partials of observable
@@ -32,6 +32,125 @@ Eigen::Matrix3d calculatePartialOfPointPositionWrtBodyFixedPointPosition(
     return rotationMatrixToInertialFrame;
 }
 
+//! Function to retrieve partial of position or velocity from stored partials, or compute (and store) it
+Eigen::Matrix< double, 3, Eigen::Dynamic > CachedCartesianStatePartial::getCachedPartial(
+        const Eigen::Vector6d& state, const double time, const bool isPositionPartial )
+{
+    if( !isCacheActive_ )
+    {
+        return isPositionPartial ? cartesianStatePartial_->calculatePartialOfPosition( state, time ) :
+                                   cartesianStatePartial_->calculatePartialOfVelocity( state, time );
+    }
+
+    PartialCache& partialCache = isPositionPartial ? positionPartialCache_ : velocityPartialCache_;
+    std::deque< double >& partialEpochs = isPositionPartial ? positionPartialEpochs_ : velocityPartialEpochs_;
+
+    // Retrieve stored partial, if computed for same time and state
+    PartialCache::iterator cacheIterator = partialCache.find( time );
+    if( cacheIterator != partialCache.end( ) && cacheIterator->second.first == state )
+    {
+        numberOfCacheHits_++;
+        return cacheIterator->second.second;
+    }
+
+    // Compute and store partial
+    numberOfCacheMisses_++;
+    Eigen::Matrix< double, 3, Eigen::Dynamic > currentPartial =
+            isPositionPartial ? cartesianStatePartial_->calculatePartialOfPosition( state, time ) :
+                                cartesianStatePartial_->calculatePartialOfVelocity( state, time );
+    if( cacheIterator != partialCache.end( ) )
+    {
+        cacheIterator->second = std::make_pair( state, currentPartial );
+    }
+    else
+    {
+        // Remove partial that was stored first, if maximum number of stored epochs is reached
+        if( partialEpochs.size( ) >= maximumNumberOfStoredEpochs_ )
+        {
+            partialCache.erase( partialEpochs.front( ) );
+            partialEpochs.pop_front( );
+        }
+        partialCache[ time ] = std::make_pair( state, currentPartial );
+        partialEpochs.push_back( time );
+    }
+    return currentPartial;
+}
+
+//! Function to retrieve the shared (caching) partial object for a given link end and parameter
+std::shared_ptr< CartesianStatePartial > CartesianStatePartialCache::getCachedCartesianStatePartial(
+        const observation_models::LinkEndId& linkEndId,
+        const estimatable_parameters::EstimatebleParameterIdentifier& parameterIdentifier,
+        const std::shared_ptr< CartesianStatePartial > cartesianStatePartial )
+{
+    // Partials w.r.t. the Cartesian state are constant, and are not cached; cached partials are not cached again.
+    if( std::dynamic_pointer_cast< CartesianStatePartialWrtCartesianState >( cartesianStatePartial ) != nullptr ||
+            std::dynamic_pointer_cast< CachedCartesianStatePartial >( cartesianStatePartial ) != nullptr )
+    {
+        return cartesianStatePartial;
+    }
+
+    // Create shared partial object, if not yet created for current link end and parameter.
+    std::shared_ptr< CachedCartesianStatePartial >& cachedPartial =
+            cachedPartials_[ std::make_pair( linkEndId, parameterIdentifier ) ];
+    if( cachedPartial == nullptr )
+    {
+        cachedPartial = std::make_shared< CachedCartesianStatePartial >(
+                    cartesianStatePartial, isCacheActive_, maximumNumberOfStoredEpochs_ );
+    }
+    return cachedPartial;
+}
+
+//! Function to replace the partial objects in a list of partials per link end by the shared (caching) objects
+void CartesianStatePartialCache::setCachedCartesianStatePartials(
+        std::map< observation_models::LinkEndType, std::shared_ptr< CartesianStatePartial > >& positionPartialList,
+        const observation_models::LinkEnds& linkEnds,
+        const estimatable_parameters::EstimatebleParameterIdentifier& parameterIdentifier )
+{
+    for( std::map< observation_models::LinkEndType, std::shared_ptr< CartesianStatePartial > >::iterator
+         partialIterator = positionPartialList.begin( ); partialIterator != positionPartialList.end( ); partialIterator++ )
+    {
+        if( linkEnds.count( partialIterator->first ) == 0 )
+        {
+            throw std::runtime_error( "Error when setting cached Cartesian state partials, link end type " +
+                                      std::to_string( partialIterator->first ) + " not found" );
+        }
+        partialIterator->second = getCachedCartesianStatePartial(
+                    linkEnds.at( partialIterator->first ), parameterIdentifier, partialIterator->second );
+    }
+}
+
+//! Function to set whether computed partials are to be stored and reused by all shared partial objects
+void CartesianStatePartialCache::setIsCacheActive( const bool isCacheActive )
+{
+    for( auto partialIterator : cachedPartials_ )
+    {
+        partialIterator.second->setIsCacheActive( isCacheActive );
+    }
+    isCacheActive_ = isCacheActive;
+}
+
+//! Function to retrieve the total number of partials that were retrieved from the stored partials
+int CartesianStatePartialCache::getNumberOfCacheHits( )
+{
+    int numberOfCacheHits = 0;
+    for( auto partialIterator : cachedPartials_ )
+    {
+        numberOfCacheHits += partialIterator.second->getNumberOfCacheHits( );
+    }
+    return numberOfCacheHits;
+}
+
+//! Function to retrieve the total number of partials that had to be computed
+int CartesianStatePartialCache::getNumberOfCacheMisses( )
+{
+    int numberOfCacheMisses = 0;
+    for( auto partialIterator : cachedPartials_ )
+    {
+        numberOfCacheMisses += partialIterator.second->getNumberOfCacheMisses( );
+    }
+    return numberOfCacheMisses;
+}
+
 }
 
 }
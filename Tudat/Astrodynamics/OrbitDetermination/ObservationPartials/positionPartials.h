@@ -11,6 +11,8 @@
 #ifndef TUDAT_POSITIONPARTIALS_H
 #define TUDAT_POSITIONPARTIALS_H
 
+#include <deque>
+#include <map>
 #include <vector>
 
 #include <Eigen/Core>
@@ -253,6 +255,338 @@ private:
     std::shared_ptr< ephemerides::RotationalEphemeris > bodyRotationModel_;
 };
 
+//! Class to compute the partial derivative of the Cartesian state of a point w.r.t. a parameter, storing the partials
+//! at each epoch at which they have been computed.
+/*!
+ *  Class to compute the partial derivative of the Cartesian state of a point w.r.t. a parameter, storing the partials at
+ *  each epoch at which they have been computed, so that they are not recomputed when they are requested again for the same
+ *  epoch and state (e.g. by the partials of a range and a Doppler observable from the same tracking pass). The partials are
+ *  computed by the CartesianStatePartial object provided to the constructor. Partials are only stored while the cache is
+ *  active (see setIsCacheActive), which may only be the case while the values of the parameters, and the states of the
+ *  link ends, are not modified. To bound the memory use, only the partials at the most recently added epochs are stored:
+ *  when the maximum number of stored epochs is reached, the partial that was stored first is removed.
+ */
+class CachedCartesianStatePartial: public CartesianStatePartial
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param cartesianStatePartial Object used to compute the partials that are not yet stored.
+     * \param isCacheActive Boolean denoting whether computed partials are to be stored and reused (if false, all
+     * partials are computed directly by cartesianStatePartial).
+     * \param maximumNumberOfStoredEpochs Maximum number of epochs for which the partials of position (and, separately,
+     * velocity) are stored.
+     */
+    CachedCartesianStatePartial( const std::shared_ptr< CartesianStatePartial > cartesianStatePartial,
+                                 const bool isCacheActive = true,
+                                 const unsigned int maximumNumberOfStoredEpochs = 1000 ):
+        cartesianStatePartial_( cartesianStatePartial ), isCacheActive_( isCacheActive ),
+        maximumNumberOfStoredEpochs_( maximumNumberOfStoredEpochs ),
+        numberOfCacheHits_( 0 ), numberOfCacheMisses_( 0 )
+    {
+        if( maximumNumberOfStoredEpochs_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating cached Cartesian state partial, maximum number of stored epochs "
+                                      "must be larger than zero" );
+        }
+    }
+
+    //! Destructor
+    ~CachedCartesianStatePartial( ){ }
+
+    //! Function for determining partial of position at current time and body state.
+    /*!
+     *  Function for determining partial of position at current time and body state, retrieved from the stored partials if
+     *  it has already been computed for this time and state.
+     *  \param state Current inertial state of point of which partial is to be calculated.
+     *  \param time Current time
+     *  \return Partial of point position wrt parameter.
+     */
+    Eigen::Matrix< double, 3, Eigen::Dynamic > calculatePartialOfPosition(
+            const Eigen::Vector6d& state,
+            const double time )
+    {
+        return getCachedPartial( state, time, true );
+    }
+
+    //! Function for determining partial of velocity at current time and body state.
+    /*!
+     *  Function for determining partial of velocity at current time and body state, retrieved from the stored partials if
+     *  it has already been computed for this time and state.
+     *  \param state Current inertial state of point of which partial is to be calculated.
+     *  \param time Current time
+     *  \return Partial of point velocity wrt parameter.
+     */
+    Eigen::Matrix< double, 3, Eigen::Dynamic > calculatePartialOfVelocity(
+            const Eigen::Vector6d& state,
+            const double time )
+    {
+        return getCachedPartial( state, time, false );
+    }
+
+    //! Function to set whether computed partials are to be stored and reused
+    /*!
+     * Function to set whether computed partials are to be stored and reused. All currently stored partials are removed.
+     * \param isCacheActive Boolean denoting whether computed partials are to be stored and reused
+     */
+    void setIsCacheActive( const bool isCacheActive )
+    {
+        positionPartialCache_.clear( );
+        velocityPartialCache_.clear( );
+        positionPartialEpochs_.clear( );
+        velocityPartialEpochs_.clear( );
+        isCacheActive_ = isCacheActive;
+    }
+
+    //! Function to retrieve the number of epochs at which partials of position and velocity are currently stored
+    /*!
+     * Function to retrieve the number of epochs at which partials of position and velocity are currently stored
+     * \return Number of epochs at which partials of position (first) and velocity (second) are currently stored
+     */
+    std::pair< unsigned int, unsigned int > getNumberOfStoredEpochs( )
+    {
+        return std::make_pair( static_cast< unsigned int >( positionPartialCache_.size( ) ),
+                               static_cast< unsigned int >( velocityPartialCache_.size( ) ) );
+    }
+
+    //! Function to retrieve the object used to compute the partials that are not yet stored.
+    /*!
+     * Function to retrieve the object used to compute the partials that are not yet stored.
+     * \return Object used to compute the partials that are not yet stored.
+     */
+    std::shared_ptr< CartesianStatePartial > getCartesianStatePartial( )
+    {
+        return cartesianStatePartial_;
+    }
+
+    //! Function to retrieve the number of partials that were retrieved from the stored partials
+    /*!
+     * Function to retrieve the number of partials that were retrieved from the stored partials
+     * \return Number of partials that were retrieved from the stored partials
+     */
+    int getNumberOfCacheHits( )
+    {
+        return numberOfCacheHits_;
+    }
+
+    //! Function to retrieve the number of partials that had to be computed
+    /*!
+     * Function to retrieve the number of partials that had to be computed (not found in the stored partials)
+     * \return Number of partials that had to be computed
+     */
+    int getNumberOfCacheMisses( )
+    {
+        return numberOfCacheMisses_;
+    }
+
+private:
+
+    //! Typedef for stored partials: per epoch, the state for which the partial was computed, and the partial.
+    typedef std::map< double, std::pair< Eigen::Vector6d, Eigen::Matrix< double, 3, Eigen::Dynamic > > > PartialCache;
+
+    //! Function to retrieve partial of position or velocity from stored partials, or compute (and store) it
+    /*!
+     *  Function to retrieve partial of position or velocity from stored partials, or compute (and store) it if no partial has
+     *  been stored for the current time and state.
+     *  \param state Current inertial state of point of which partial is to be calculated.
+     *  \param time Current time
+     *  \param isPositionPartial Boolean denoting whether the partial of the position (if true) or the velocity (if false) is
+     *  to be returned
+     *  \return Partial of point position or velocity wrt parameter.
+     */
+    Eigen::Matrix< double, 3, Eigen::Dynamic > getCachedPartial(
+            const Eigen::Vector6d& state, const double time, const bool isPositionPartial );
+
+    //! Object used to compute the partials that are not yet stored.
+    std::shared_ptr< CartesianStatePartial > cartesianStatePartial_;
+
+    //! Boolean denoting whether computed partials are to be stored and reused
+    bool isCacheActive_;
+
+    //! Maximum number of epochs for which the partials of position (and, separately, velocity) are stored.
+    unsigned int maximumNumberOfStoredEpochs_;
+
+    //! Stored partials of position.
+    PartialCache positionPartialCache_;
+
+    //! Stored partials of velocity.
+    PartialCache velocityPartialCache_;
+
+    //! Epochs in positionPartialCache_, in the order in which they were added
+    std::deque< double > positionPartialEpochs_;
+
+    //! Epochs in velocityPartialCache_, in the order in which they were added
+    std::deque< double > velocityPartialEpochs_;
+
+    //! Number of partials that were retrieved from the stored partials
+    int numberOfCacheHits_;
+
+    //! Number of partials that had to be computed
+    int numberOfCacheMisses_;
+};
+
+//! Class to share the partials of the Cartesian states of link ends w.r.t. parameters between observation partials.
+/*!
+ *  Class to share the partials of the Cartesian states of link ends w.r.t. parameters between observation partials. The
+ *  partial of the state of a given link end w.r.t. a given parameter does not depend on the observable, so that a single
+ *  CachedCartesianStatePartial object is used for each combination of link end and parameter by all observation partials
+ *  to which this object is provided (see ObservationPartial::setCartesianStatePartialCache). Partials for which caching
+ *  provides no benefit (partials w.r.t. the body's own Cartesian state, which are constant) are not cached. Note that this
+ *  means that the most common case of observables sharing link ends, the estimation of initial states only (e.g. from range
+ *  and Doppler observables), is NOT sped up by this object: only partials w.r.t. parameters that modify the link end state
+ *  (e.g. ground station positions and rotation model parameters) are reused. The observable-specific scaling of the
+ *  partials (see PositionPartialScaling) depends on the observable, and is not shared either. The cached
+ *  partials are only valid for a single set of parameter values and link end states, so that the cache may only be active
+ *  (see setIsCacheActive) while these are not modified; while inactive, all partials are computed directly. This object
+ *  is not thread-safe: it may only be shared between observation partials that are evaluated from a single thread.
+ */
+class CartesianStatePartialCache
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumNumberOfStoredEpochs Maximum number of epochs for which each shared partial object stores the partials
+     * (see CachedCartesianStatePartial).
+     */
+    CartesianStatePartialCache( const unsigned int maximumNumberOfStoredEpochs = 1000 ):
+        isCacheActive_( false ), maximumNumberOfStoredEpochs_( maximumNumberOfStoredEpochs ){ }
+
+    //! Destructor
+    ~CartesianStatePartialCache( ){ }
+
+    //! Function to retrieve the shared (caching) partial object for a given link end and parameter
+    /*!
+     *  Function to retrieve the shared (caching) partial object for a given link end and parameter. If no such object exists
+     *  yet, it is created from the cartesianStatePartial input.
+     *  \param linkEndId Link end for which the partial is to be computed
+     *  \param parameterIdentifier Parameter w.r.t. which the partial is to be computed
+     *  \param cartesianStatePartial Object computing the partial of the link end state w.r.t. the parameter.
+     *  \return Shared (caching) partial object, or the cartesianStatePartial input if partial is not to be cached.
+     */
+    std::shared_ptr< CartesianStatePartial > getCachedCartesianStatePartial(
+            const observation_models::LinkEndId& linkEndId,
+            const estimatable_parameters::EstimatebleParameterIdentifier& parameterIdentifier,
+            const std::shared_ptr< CartesianStatePartial > cartesianStatePartial );
+
+    //! Function to replace the partial objects in a list of partials per link end by the shared (caching) objects
+    /*!
+     *  Function to replace the partial objects in a list of partials per link end by the shared (caching) objects (see
+     *  getCachedCartesianStatePartial)
+     *  \param positionPartialList List of partial objects of link end states, per link end type (modified by this function)
+     *  \param linkEnds Link ends of the observable for which the partials are used.
+     *  \param parameterIdentifier Parameter w.r.t. which the partials are computed
+     */
+    void setCachedCartesianStatePartials(
+            std::map< observation_models::LinkEndType, std::shared_ptr< CartesianStatePartial > >& positionPartialList,
+            const observation_models::LinkEnds& linkEnds,
+            const estimatable_parameters::EstimatebleParameterIdentifier& parameterIdentifier );
+
+    //! Function to set whether computed partials are to be stored and reused by all shared partial objects
+    /*!
+     * Function to set whether computed partials are to be stored and reused by all shared partial objects. All currently
+     * stored partials are removed.
+     * \param isCacheActive Boolean denoting whether computed partials are to be stored and reused
+     */
+    void setIsCacheActive( const bool isCacheActive );
+
+    //! Function to retrieve whether computed partials are stored and reused
+    /*!
+     * Function to retrieve whether computed partials are stored and reused
+     * \return Boolean denoting whether computed partials are stored and reused
+     */
+    bool getIsCacheActive( )
+    {
+        return isCacheActive_;
+    }
+
+    //! Function to retrieve the number of shared partial objects
+    /*!
+     * Function to retrieve the number of shared partial objects (one per combination of link end and parameter)
+     * \return Number of shared partial objects
+     */
+    int getNumberOfCachedPartials( )
+    {
+        return static_cast< int >( cachedPartials_.size( ) );
+    }
+
+    //! Function to retrieve the total number of partials that were retrieved from the stored partials
+    /*!
+     * Function to retrieve the total number of partials that were retrieved from the stored partials, summed over all
+     * shared partial objects.
+     * \return Total number of partials that were retrieved from the stored partials
+     */
+    int getNumberOfCacheHits( );
+
+    //! Function to retrieve the total number of partials that had to be computed
+    /*!
+     * Function to retrieve the total number of partials that had to be computed, summed over all shared partial objects.
+     * \return Total number of partials that had to be computed
+     */
+    int getNumberOfCacheMisses( );
+
+private:
+
+    //! Shared partial objects, per link end and parameter.
+    std::map< std::pair< observation_models::LinkEndId, estimatable_parameters::EstimatebleParameterIdentifier >,
+    std::shared_ptr< CachedCartesianStatePartial > > cachedPartials_;
+
+    //! Boolean denoting whether computed partials are stored and reused
+    bool isCacheActive_;
+
+    //! Maximum number of epochs for which each shared partial object stores the partials
+    unsigned int maximumNumberOfStoredEpochs_;
+};
+
+//! Class to activate a CartesianStatePartialCache for the lifetime of this object
+/*!
+ *  Class to activate a CartesianStatePartialCache for the lifetime of this object: the cache is activated by the
+ *  constructor, and deactivated (removing all stored partials) by the destructor, also when an exception is thrown while
+ *  the cache is active.
+ */
+class ScopedCartesianStatePartialCacheActivation
+{
+public:
+
+    //! Constructor, activates the cache
+    /*!
+     * Constructor, activates the cache
+     * \param cartesianStatePartialCache Cache that is to be active during the lifetime of this object (no action if nullptr)
+     */
+    ScopedCartesianStatePartialCacheActivation(
+            const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache ):
+        cartesianStatePartialCache_( cartesianStatePartialCache )
+    {
+        if( cartesianStatePartialCache_ != nullptr )
+        {
+            cartesianStatePartialCache_->setIsCacheActive( true );
+        }
+    }
+
+    //! Destructor, deactivates the cache
+    ~ScopedCartesianStatePartialCacheActivation( )
+    {
+        if( cartesianStatePartialCache_ != nullptr )
+        {
+            cartesianStatePartialCache_->setIsCacheActive( false );
+        }
+    }
+
+private:
+
+    //! Copy constructor (not allowed, cache is deactivated only once)
+    ScopedCartesianStatePartialCacheActivation( const ScopedCartesianStatePartialCacheActivation& );
+
+    //! Assignment operator (not allowed, cache is deactivated only once)
+    ScopedCartesianStatePartialCacheActivation& operator=( const ScopedCartesianStatePartialCacheActivation& );
+
+    //! Cache that is active during the lifetime of this object
+    std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache_;
+};
+
 //! Derived class for scaling three-dimensional position partial to position observable partial
 /*!
  *  Derived class for scaling three-dimensional position partial to position observable partial. Although the implementation
@@ -373,6 +707,21 @@ public:
         return returnPartial;
     }
 
+    //! Function to set the object used to share the partials of the link end states between observation partials
+    /*!
+     *  Function to set the object used to share the partials of the link end states between observation partials, replacing
+     *  the position partial objects of this object by the shared objects.
+     *  \param cartesianStatePartialCache Object used to share the partials of the link end states
+     *  \param linkEnds Link ends of the observable for which this object computes partials
+     */
+    void setCartesianStatePartialCache(
+            const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+            const observation_models::LinkEnds& linkEnds )
+    {
+        cartesianStatePartialCache->setCachedCartesianStatePartials(
+                    positionPartialList_, linkEnds, parameterIdentifier_ );
+    }
+
 protected:
 
     //!  Scaling object used for mapping partials of positions to partials of observable
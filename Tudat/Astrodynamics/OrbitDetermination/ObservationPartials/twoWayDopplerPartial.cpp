@@ -174,6 +174,28 @@ TwoWayDopplerPartial::TwoWayDopplerPartialReturnType TwoWayDopplerPartial::calcu
     return completePartialSet;
 }
 
+//! Function to set the object used to share the partials of the link end states between observation partials
+void TwoWayDopplerPartial::setCartesianStatePartialCache(
+        const std::shared_ptr< CartesianStatePartialCache > cartesianStatePartialCache,
+        const observation_models::LinkEnds& linkEnds )
+{
+    for( dopplerPartialIterator_ = dopplerPartialList_.begin( ); dopplerPartialIterator_ != dopplerPartialList_.end( );
+         dopplerPartialIterator_++ )
+    {
+        dopplerPartialIterator_->second->setCartesianStatePartialCache(
+                    cartesianStatePartialCache, observation_models::getNWayConstituentOneWayLinkEnds(
+                        linkEnds, dopplerPartialIterator_->first ) );
+    }
+
+    for( rangePartialIterator_ = rangePartialList_.begin( ); rangePartialIterator_ != rangePartialList_.end( );
+         rangePartialIterator_++ )
+    {
+        rangePartialIterator_->second->setCartesianStatePartialCache(
+                    cartesianStatePartialCache, observation_models::getNWayConstituentOneWayLinkEnds(
+                        linkEnds, rangePartialIterator_->first ) );
+    }
+}
+
 }
 
 }
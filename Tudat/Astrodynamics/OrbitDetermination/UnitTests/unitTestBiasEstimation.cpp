@@ -85,6 +85,30 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
     BOOST_CHECK_EQUAL( executeEarthOrbiterBiasEstimation( true, false, true, true, true ).second, true );
 }
 
+//! This test checks whether the dynamics are not reintegrated when only observation biases are changed, and whether the
+//! biases are then correctly estimated
+BOOST_AUTO_TEST_CASE( test_BiasEstimationWithoutReintegration )
+{
+    for( int estimateMultiArcBiases = 0; estimateMultiArcBiases < 2; estimateMultiArcBiases++ )
+    {
+        std::pair< Eigen::VectorXd, bool > estimationOutput = executeEarthOrbiterBiasEstimation< double, double >(
+                    true, false, true, true, false, estimateMultiArcBiases, true );
+        Eigen::VectorXd totalError = estimationOutput.first;
+
+        BOOST_CHECK_EQUAL( estimationOutput.second, false );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( totalError( j ) ), 1.0E-5 );
+            BOOST_CHECK_SMALL( std::fabs( totalError( j + 3 ) ), 1.0E-8 );
+        }
+
+        for( unsigned int j = 6; j < totalError.rows( ); j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( totalError( j ) ), 1.0E-7 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -85,6 +85,136 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
 
 }
 
+//! This test checks whether the estimation with block-wise accumulation of the normal equations produces the same results as
+//! the estimation using the full matrix of observation partials
+BOOST_AUTO_TEST_CASE( test_EstimationWithAccumulatedNormalEquations )
+{
+    std::pair< std::shared_ptr< simulation_setup::PodOutput< double > >,
+    std::shared_ptr< simulation_setup::PodInput< double, double > > > fullMatrixPodData, accumulatedPodData;
+
+    Eigen::VectorXd fullMatrixEstimationError = executeEarthOrbiterParameterEstimation< double, double >(
+                fullMatrixPodData, 1.0E7, 1, 3, true, full_partials_matrix_accumulation );
+    Eigen::VectorXd accumulatedEstimationError = executeEarthOrbiterParameterEstimation< double, double >(
+                accumulatedPodData, 1.0E7, 1, 3, true, normal_equations_accumulation );
+
+    // Check that partials matrix is not stored when accumulating normal equations
+    BOOST_CHECK_EQUAL( accumulatedPodData.first->normalizedInformationMatrix_.size( ), 0 );
+    BOOST_CHECK_EQUAL( fullMatrixPodData.first->normalizedInformationMatrix_.rows( ),
+                       accumulatedPodData.first->residuals_.rows( ) );
+
+    // Check consistency of estimation results
+    for( int i = 0; i < fullMatrixEstimationError.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( fullMatrixEstimationError( i ) - accumulatedEstimationError( i ) ),
+                           1.0E-6 * std::max( 1.0, std::fabs( fullMatrixEstimationError( i ) ) ) );
+    }
+
+    Eigen::MatrixXd fullMatrixCovariance = fullMatrixPodData.first->getUnnormalizedCovarianceMatrix( );
+    Eigen::MatrixXd accumulatedCovariance = accumulatedPodData.first->getUnnormalizedCovarianceMatrix( );
+    for( int i = 0; i < fullMatrixCovariance.rows( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( fullMatrixCovariance( i, i ), accumulatedCovariance( i, i ), 1.0E-6 );
+    }
+
+    BOOST_CHECK_CLOSE_FRACTION( fullMatrixPodData.first->residualStandardDeviation_,
+                                accumulatedPodData.first->residualStandardDeviation_, 1.0E-6 );
+}
+
+//! This test checks whether the estimation with block-wise accumulation of the square-root information produces the same
+//! results as the estimation using the full matrix of observation partials
+BOOST_AUTO_TEST_CASE( test_EstimationWithSquareRootInformationFilter )
+{
+    std::pair< std::shared_ptr< simulation_setup::PodOutput< double > >,
+    std::shared_ptr< simulation_setup::PodInput< double, double > > > fullMatrixPodData, squareRootPodData;
+
+    Eigen::VectorXd fullMatrixEstimationError = executeEarthOrbiterParameterEstimation< double, double >(
+                fullMatrixPodData, 1.0E7, 1, 3, true, full_partials_matrix_accumulation );
+    Eigen::VectorXd squareRootEstimationError = executeEarthOrbiterParameterEstimation< double, double >(
+                squareRootPodData, 1.0E7, 1, 3, true, square_root_information_accumulation );
+
+    // Check that partials matrix is not stored when accumulating square-root information
+    BOOST_CHECK_EQUAL( squareRootPodData.first->normalizedInformationMatrix_.size( ), 0 );
+    BOOST_CHECK_EQUAL( fullMatrixPodData.first->normalizedInformationMatrix_.rows( ),
+                       squareRootPodData.first->residuals_.rows( ) );
+
+    // Check consistency of estimation results
+    for( int i = 0; i < fullMatrixEstimationError.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( fullMatrixEstimationError( i ) - squareRootEstimationError( i ) ),
+                           1.0E-6 * std::max( 1.0, std::fabs( fullMatrixEstimationError( i ) ) ) );
+    }
+
+    Eigen::MatrixXd fullMatrixCovariance = fullMatrixPodData.first->getUnnormalizedCovarianceMatrix( );
+    Eigen::MatrixXd squareRootCovariance = squareRootPodData.first->getUnnormalizedCovarianceMatrix( );
+    for( int i = 0; i < fullMatrixCovariance.rows( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( fullMatrixCovariance( i, i ), squareRootCovariance( i, i ), 1.0E-6 );
+    }
+
+    BOOST_CHECK_CLOSE_FRACTION( fullMatrixPodData.first->residualStandardDeviation_,
+                                squareRootPodData.first->residualStandardDeviation_, 1.0E-6 );
+}
+
+//! This test checks whether the estimation with a block-sparse matrix of observation partials produces the same results as
+//! the estimation using the full matrix of observation partials
+BOOST_AUTO_TEST_CASE( test_EstimationWithSparseDesignMatrix )
+{
+    std::pair< std::shared_ptr< simulation_setup::PodOutput< double > >,
+    std::shared_ptr< simulation_setup::PodInput< double, double > > > fullMatrixPodData, sparsePodData;
+
+    Eigen::VectorXd fullMatrixEstimationError = executeEarthOrbiterParameterEstimation< double, double >(
+                fullMatrixPodData, 1.0E7, 1, 3, true, full_partials_matrix_accumulation );
+    Eigen::VectorXd sparseEstimationError = executeEarthOrbiterParameterEstimation< double, double >(
+                sparsePodData, 1.0E7, 1, 3, true, sparse_partials_matrix_accumulation );
+
+    // Check that partials matrix retrieved from block-sparse storage is equal to full partials matrix
+    BOOST_CHECK_EQUAL( fullMatrixPodData.first->normalizedInformationMatrix_.cols( ),
+                       sparsePodData.first->normalizedInformationMatrix_.cols( ) );
+    BOOST_CHECK_EQUAL( fullMatrixPodData.first->normalizedInformationMatrix_.rows( ),
+                       sparsePodData.first->normalizedInformationMatrix_.rows( ) );
+    BOOST_CHECK_SMALL( ( fullMatrixPodData.first->normalizedInformationMatrix_ -
+                         sparsePodData.first->normalizedInformationMatrix_ ).cwiseAbs( ).maxCoeff( ), 1.0E-6 );
+
+    // Check consistency of estimation results
+    for( int i = 0; i < fullMatrixEstimationError.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( fullMatrixEstimationError( i ) - sparseEstimationError( i ) ),
+                           1.0E-6 * std::max( 1.0, std::fabs( fullMatrixEstimationError( i ) ) ) );
+    }
+
+    Eigen::MatrixXd fullMatrixCovariance = fullMatrixPodData.first->getUnnormalizedCovarianceMatrix( );
+    Eigen::MatrixXd sparseCovariance = sparsePodData.first->getUnnormalizedCovarianceMatrix( );
+    for( int i = 0; i < fullMatrixCovariance.rows( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( fullMatrixCovariance( i, i ), sparseCovariance( i, i ), 1.0E-6 );
+    }
+
+    BOOST_CHECK_CLOSE_FRACTION( fullMatrixPodData.first->residualStandardDeviation_,
+                                sparsePodData.first->residualStandardDeviation_, 1.0E-6 );
+}
+
+//! This test checks whether the estimation with observations and partials computed on multiple threads produces the same
+//! results as the estimation with observations and partials computed serially
+BOOST_AUTO_TEST_CASE( test_EstimationWithParallelObservations )
+{
+    std::pair< std::shared_ptr< simulation_setup::PodOutput< double > >, Eigen::VectorXd > serialOutput =
+            executePlanetaryParameterEstimation< double, double >( 4 );
+    std::pair< std::shared_ptr< simulation_setup::PodOutput< double > >, Eigen::VectorXd > parallelOutput =
+            executePlanetaryParameterEstimation< double, double >(
+                4, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0, 4 );
+
+    // Observations and partials are computed identically, independent of the number of threads
+    BOOST_CHECK_EQUAL( serialOutput.first->residuals_.rows( ), parallelOutput.first->residuals_.rows( ) );
+    BOOST_CHECK_EQUAL( ( serialOutput.first->residuals_ - parallelOutput.first->residuals_ ).cwiseAbs( ).maxCoeff( ),
+                       0.0 );
+    BOOST_CHECK_EQUAL( ( serialOutput.first->normalizedInformationMatrix_ -
+                         parallelOutput.first->normalizedInformationMatrix_ ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    for( int i = 0; i < serialOutput.second.rows( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( serialOutput.second( i ), parallelOutput.second( i ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
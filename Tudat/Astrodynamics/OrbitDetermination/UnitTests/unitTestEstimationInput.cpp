@@ -13,12 +13,14 @@
 
 #include <limits>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Basics/testMacros.h"
 
 #include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationTestCases.h"
 #include "Tudat/SimulationSetup/EstimationSetup/podProcessing.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/estimationCheckpoint.h"
 
 
 namespace tudat
@@ -169,6 +171,163 @@ BOOST_AUTO_TEST_CASE( test_CovarianceAsFunctionOfTime )
     }
 }
 
+//! Test whether the estimation checkpoint and iteration history are correctly written to, and read from, binary files
+BOOST_AUTO_TEST_CASE( test_EstimationCheckpointFileInputOutput )
+{
+    const std::string checkpointDirectory =
+            ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( ) ).string( );
+
+    // Create checkpoint with arbitrary contents
+    EstimationCheckpoint< double > checkpoint;
+    checkpoint.numberOfIterations_ = 3;
+    checkpoint.parameterEstimate_ = Eigen::VectorXd::Random( 7 );
+    checkpoint.rmsResidualHistory_ = { 1.0E3, 2.0, 1.0E-3 };
+    checkpoint.bestResidual_ = 1.0E-3;
+    checkpoint.bestParameterEstimate_ = Eigen::VectorXd::Random( 7 );
+    checkpoint.bestResiduals_ = Eigen::VectorXd::Random( 20 );
+    checkpoint.bestInformationMatrix_ = Eigen::MatrixXd::Random( 20, 7 );
+    checkpoint.bestTransformationData_ = Eigen::VectorXd::Random( 7 );
+    checkpoint.bestInverseNormalizedCovarianceMatrix_ = Eigen::MatrixXd::Random( 7, 7 );
+    checkpoint.bestInverseNormalizedCovarianceMatrix_ += checkpoint.bestInverseNormalizedCovarianceMatrix_.transpose( ).eval( );
+
+    // Write and read checkpoint
+    writeEstimationCheckpointToFile( checkpoint, getEstimationCheckpointFileName( checkpointDirectory ) );
+    std::shared_ptr< EstimationCheckpoint< double > > readCheckpoint = readEstimationCheckpointFromFile< double >(
+                getEstimationCheckpointFileName( checkpointDirectory ) );
+
+    BOOST_CHECK_EQUAL( readCheckpoint->numberOfIterations_, checkpoint.numberOfIterations_ );
+    BOOST_CHECK( readCheckpoint->parameterEstimate_ == checkpoint.parameterEstimate_ );
+    BOOST_CHECK( readCheckpoint->rmsResidualHistory_ == checkpoint.rmsResidualHistory_ );
+    BOOST_CHECK_EQUAL( readCheckpoint->bestResidual_, checkpoint.bestResidual_ );
+    BOOST_CHECK( readCheckpoint->bestParameterEstimate_ == checkpoint.bestParameterEstimate_ );
+    BOOST_CHECK( readCheckpoint->bestResiduals_ == checkpoint.bestResiduals_ );
+    BOOST_CHECK( readCheckpoint->bestInformationMatrix_ == checkpoint.bestInformationMatrix_ );
+    BOOST_CHECK( readCheckpoint->bestTransformationData_ == checkpoint.bestTransformationData_ );
+    BOOST_CHECK( readCheckpoint->bestInverseNormalizedCovarianceMatrix_ ==
+                 checkpoint.bestInverseNormalizedCovarianceMatrix_ );
+
+    // Write and read iteration history, with time keys in extended precision
+    EstimationIterationHistory< double, Time > iterationHistory( 2 );
+    iterationHistory.parameterEstimate_ = Eigen::VectorXd::Random( 7 );
+    iterationHistory.updatedParameterEstimate_ = Eigen::VectorXd::Random( 7 );
+    iterationHistory.residuals_ = Eigen::VectorXd::Random( 20 );
+    iterationHistory.dynamicsHistory_.resize( 1 );
+    iterationHistory.dependentVariableHistory_.resize( 1 );
+    for( unsigned int j = 0; j < 5; j++ )
+    {
+        iterationHistory.dynamicsHistory_[ 0 ][ Time( j, 0.1L * j ) ] = Eigen::VectorXd::Random( 6 );
+        iterationHistory.dependentVariableHistory_[ 0 ][ Time( j, 0.1L * j ) ] = Eigen::VectorXd::Random( 3 );
+    }
+
+    writeEstimationIterationHistoryToFile(
+                iterationHistory, getEstimationIterationHistoryFileName( checkpointDirectory, 2 ) );
+    std::shared_ptr< EstimationIterationHistory< double, Time > > readIterationHistory =
+            readEstimationIterationHistoryFromFile< double, Time >(
+                getEstimationIterationHistoryFileName( checkpointDirectory, 2 ) );
+
+    BOOST_CHECK_EQUAL( readIterationHistory->iterationNumber_, 2 );
+    BOOST_CHECK( readIterationHistory->parameterEstimate_ == iterationHistory.parameterEstimate_ );
+    BOOST_CHECK( readIterationHistory->updatedParameterEstimate_ == iterationHistory.updatedParameterEstimate_ );
+    BOOST_CHECK( readIterationHistory->residuals_ == iterationHistory.residuals_ );
+    BOOST_CHECK( readIterationHistory->dynamicsHistory_ == iterationHistory.dynamicsHistory_ );
+    BOOST_CHECK( readIterationHistory->dependentVariableHistory_ == iterationHistory.dependentVariableHistory_ );
+
+    // Check that reading a file with incompatible scalar types fails
+    bool isExceptionCaught = false;
+    try
+    {
+        readEstimationIterationHistoryFromFile< double, double >(
+                    getEstimationIterationHistoryFileName( checkpointDirectory, 2 ) );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    boost::filesystem::remove_all( checkpointDirectory );
+}
+
+//! Test whether an estimation that is resumed from a checkpoint gives the same result as an uninterrupted estimation
+BOOST_AUTO_TEST_CASE( test_EstimationResumedFromCheckpoint )
+{
+    const std::string checkpointDirectory =
+            ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( ) ).string( );
+
+    // Run uninterrupted estimation with 4 iterations
+    std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > uninterruptedEstimationOutput =
+            executePlanetaryParameterEstimation< double, double >(
+                0, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0, 1, nullptr,
+                std::make_shared< EstimationConvergenceChecker >( 4 ) );
+
+    // Define settings to save checkpoints and iteration histories to (and resume from) checkpoint directory
+    std::function< void( const std::shared_ptr< PodInput< double, double > > ) > checkpointSettingsFunction =
+            [ & ]( const std::shared_ptr< PodInput< double, double > > podInput )
+    {
+        podInput->defineEstimationSettings( true, true, true, false, true, true );
+        podInput->defineCheckpointSettings( checkpointDirectory );
+    };
+
+    // Run estimation that is terminated after 2 iterations
+    std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > interruptedEstimationOutput =
+            executePlanetaryParameterEstimation< double, double >(
+                0, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0, 1,
+                checkpointSettingsFunction, std::make_shared< EstimationConvergenceChecker >( 2 ) );
+    std::shared_ptr< EstimationCheckpoint< double > > checkpoint = readEstimationCheckpointFromFile< double >(
+                getEstimationCheckpointFileName( checkpointDirectory ) );
+    BOOST_CHECK_EQUAL( checkpoint->numberOfIterations_, 2 );
+
+    // Resume estimation without performing any further iterations, and check that the output of the best iteration
+    // (including its partials and covariance) is fully restored from the checkpoint
+    std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > restoredEstimationOutput =
+            executePlanetaryParameterEstimation< double, double >(
+                0, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0, 1,
+                checkpointSettingsFunction, std::make_shared< EstimationConvergenceChecker >( 2 ) );
+    BOOST_CHECK( restoredEstimationOutput.first->parameterEstimate_ ==
+                 interruptedEstimationOutput.first->parameterEstimate_ );
+    BOOST_CHECK( interruptedEstimationOutput.first->normalizedInformationMatrix_.allFinite( ) );
+    BOOST_CHECK( restoredEstimationOutput.first->normalizedInformationMatrix_ ==
+                 interruptedEstimationOutput.first->normalizedInformationMatrix_ );
+    BOOST_CHECK( restoredEstimationOutput.first->getUnnormalizedCovarianceMatrix( ) ==
+                 interruptedEstimationOutput.first->getUnnormalizedCovarianceMatrix( ) );
+
+    // Resume estimation up to 4 iterations
+
+    std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > resumedEstimationOutput =
+            executePlanetaryParameterEstimation< double, double >(
+                0, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0, 1,
+                checkpointSettingsFunction, std::make_shared< EstimationConvergenceChecker >( 4 ) );
+
+    // Check that results are equal
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( resumedEstimationOutput.first->parameterEstimate_,
+                                       uninterruptedEstimationOutput.first->parameterEstimate_, 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( resumedEstimationOutput.first->residualStandardDeviation_,
+                                uninterruptedEstimationOutput.first->residualStandardDeviation_, 1.0E-6 );
+
+    // Check that iteration histories are written to file, instead of being stored in output
+    BOOST_CHECK_EQUAL( resumedEstimationOutput.first->residualHistory_.size( ), 0 );
+    BOOST_CHECK_EQUAL( resumedEstimationOutput.first->dynamicsHistoryPerIteration_.size( ), 0 );
+    checkpoint = readEstimationCheckpointFromFile< double >( getEstimationCheckpointFileName( checkpointDirectory ) );
+    for( int i = 0; i < checkpoint->numberOfIterations_; i++ )
+    {
+        std::shared_ptr< EstimationIterationHistory< double, double > > iterationHistory =
+                readEstimationIterationHistoryFromFile< double, double >(
+                    getEstimationIterationHistoryFileName( checkpointDirectory, i ) );
+        BOOST_CHECK_EQUAL( iterationHistory->iterationNumber_, i );
+        BOOST_CHECK_EQUAL( iterationHistory->parameterEstimate_.rows( ), 7 );
+        BOOST_CHECK_EQUAL( iterationHistory->dynamicsHistory_.size( ), 1 );
+        if( i > 0 )
+        {
+            std::shared_ptr< EstimationIterationHistory< double, double > > previousIterationHistory =
+                    readEstimationIterationHistoryFromFile< double, double >(
+                        getEstimationIterationHistoryFileName( checkpointDirectory, i - 1 ) );
+            BOOST_CHECK( iterationHistory->parameterEstimate_ == previousIterationHistory->updatedParameterEstimate_ );
+        }
+    }
+
+    boost::filesystem::remove_all( checkpointDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
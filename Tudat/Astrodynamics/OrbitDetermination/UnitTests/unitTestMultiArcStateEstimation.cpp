@@ -48,7 +48,9 @@ using namespace tudat::basic_astrodynamics;
 
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeParameterEstimation(
-        const int linkArcs )
+        const int linkArcs,
+        const bool eliminateArcParameters = false,
+        Eigen::VectorXd* formalErrors = nullptr )
 {
     //Load spice kernels.f
     std::string kernelsPath = input_output::getSpiceKernelPath( );
@@ -263,10 +265,19 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< PodInput< ObservationScalarType, TimeType > > podInput =
             std::make_shared< PodInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes, ( initialParameterEstimate ).rows( ) );
+    if( eliminateArcParameters )
+    {
+        podInput->defineArcParameterEliminationSettings( true, 100 );
+    }
 
     std::shared_ptr< PodOutput< StateScalarType, TimeType > > podOutput = orbitDeterminationManager.estimateParameters(
                 podInput );
 
+    if( formalErrors != nullptr )
+    {
+        *formalErrors = podOutput->getFormalErrorVector( );
+    }
+
     return ( podOutput->parameterEstimate_ - truthParameters ).template cast< double >( );
 }
 
@@ -317,6 +328,49 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
 
 }
 
+//! Test whether elimination of arc-wise initial states from the normal equations reproduces the full estimation
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationWithArcParameterElimination )
+{
+    Eigen::VectorXd fullFormalErrors, eliminatedFormalErrors;
+    Eigen::VectorXd fullParameterError = executeParameterEstimation< double, double, double >(
+                0, false, &fullFormalErrors );
+    Eigen::VectorXd eliminatedParameterError = executeParameterEstimation< double, double, double >(
+                0, true, &eliminatedFormalErrors );
+
+    BOOST_CHECK_EQUAL( fullParameterError.rows( ), eliminatedParameterError.rows( ) );
+
+    // Both estimations use the same observations, so that the estimated Earth states (heliocentric distance of about
+    // 1 AU, velocity of about 2 pi AU/yr) may only differ at the level of the numerical round-off in the solution.
+    const double positionScale = physical_constants::ASTRONOMICAL_UNIT;
+    const double velocityScale =
+            2.0 * mathematical_constants::PI * physical_constants::ASTRONOMICAL_UNIT / physical_constants::JULIAN_YEAR;
+    const double relativeTolerance = 1.0E-13;
+
+    int numberOfEstimatedArcs = ( fullParameterError.rows( ) - 3 ) / 6;
+    for( int i = 0; i < numberOfEstimatedArcs; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( fullParameterError( i * 6 + j ) - eliminatedParameterError( i * 6 + j ) ),
+                               relativeTolerance * positionScale );
+            BOOST_CHECK_SMALL( std::fabs( fullParameterError( i * 6 + j + 3 ) -
+                                          eliminatedParameterError( i * 6 + j + 3 ) ),
+                               relativeTolerance * velocityScale );
+        }
+    }
+
+    BOOST_CHECK_SMALL( std::fabs( eliminatedParameterError( eliminatedParameterError.rows( ) - 3 ) ), 1.0E-17 );
+    BOOST_CHECK_SMALL( std::fabs( eliminatedParameterError( eliminatedParameterError.rows( ) - 2 ) ), 1.0E-9 );
+    BOOST_CHECK_SMALL( std::fabs( eliminatedParameterError( eliminatedParameterError.rows( ) - 1 ) ), 1.0E-9 );
+
+    // Check covariance, which is only assembled (once) from the arc-wise normal equations after the final iteration
+    BOOST_CHECK_EQUAL( fullFormalErrors.rows( ), eliminatedFormalErrors.rows( ) );
+    for( int i = 0; i < fullFormalErrors.rows( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( fullFormalErrors( i ), eliminatedFormalErrors( i ), 1.0E-8 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,174 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <boost/filesystem.hpp>
+
+#include "Tudat/Astrodynamics/OrbitDetermination/estimationCheckpoint.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Function to write a time to a binary stream, as number of full periods and seconds into the period
+void writeBinaryValue( std::ostream& stream, const Time& value )
+{
+    writeBinaryValue( stream, static_cast< int32_t >( value.getFullPeriods( ) ) );
+    writeBinaryValue( stream, value.getSecondsIntoFullPeriod( ) );
+}
+
+//! Function to read a time from a binary stream, as number of full periods and seconds into the period
+void readBinaryValue( std::istream& stream, Time& value )
+{
+    int32_t fullPeriods;
+    long double secondsIntoFullPeriod;
+    readBinaryValue( stream, fullPeriods );
+    readBinaryValue( stream, secondsIntoFullPeriod );
+    value = Time( fullPeriods, secondsIntoFullPeriod );
+}
+
+//! Function to write a symmetric matrix to a binary stream (size, followed by the entries of the lower triangle)
+void writeBinarySymmetricMatrix( std::ostream& stream, const Eigen::MatrixXd& matrix )
+{
+    if( matrix.rows( ) != matrix.cols( ) )
+    {
+        throw std::runtime_error( "Error when writing symmetric matrix to binary estimation file, matrix is not square" );
+    }
+
+    writeBinaryValue( stream, static_cast< int64_t >( matrix.rows( ) ) );
+    for( int j = 0; j < matrix.cols( ); j++ )
+    {
+        stream.write( reinterpret_cast< const char* >( matrix.data( ) + j * matrix.rows( ) + j ),
+                      ( matrix.rows( ) - j ) * sizeof( double ) );
+    }
+}
+
+//! Function to read a symmetric matrix from a binary stream, as written by writeBinarySymmetricMatrix
+void readBinarySymmetricMatrix( std::istream& stream, Eigen::MatrixXd& matrix )
+{
+    int64_t matrixSize;
+    readBinaryValue( stream, matrixSize );
+    if( matrixSize < 0 )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, matrix size is inconsistent" );
+    }
+
+    matrix.resize( matrixSize, matrixSize );
+    for( int j = 0; j < matrix.cols( ); j++ )
+    {
+        stream.read( reinterpret_cast< char* >( matrix.data( ) + j * matrix.rows( ) + j ),
+                     ( matrix.rows( ) - j ) * sizeof( double ) );
+    }
+    if( !stream )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, unexpected end of file" );
+    }
+    matrix.triangularView< Eigen::StrictlyUpper >( ) = matrix.transpose( );
+}
+
+//! Function to write the header of a binary estimation file
+void writeBinaryEstimationFileHeader( std::ostream& stream, const std::string& fileIdentifier,
+                                      const unsigned int observationScalarSize, const unsigned int timeSize )
+{
+    stream.write( fileIdentifier.c_str( ), 8 );
+    writeBinaryValue( stream, static_cast< uint32_t >( 1 ) );
+    writeBinaryValue( stream, static_cast< uint32_t >( observationScalarSize ) );
+    writeBinaryValue( stream, static_cast< uint32_t >( timeSize ) );
+}
+
+//! Function to read and check the header of a binary estimation file, as written by writeBinaryEstimationFileHeader
+void readBinaryEstimationFileHeader( std::istream& stream, const std::string& fileIdentifier,
+                                     const unsigned int observationScalarSize, const unsigned int timeSize )
+{
+    char identifier[ 8 ];
+    stream.read( identifier, 8 );
+    if( !stream || ( std::string( identifier, 8 ) != fileIdentifier ) )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, file type is not " + fileIdentifier );
+    }
+
+    uint32_t formatVersion, fileObservationScalarSize, fileTimeSize;
+    readBinaryValue( stream, formatVersion );
+    readBinaryValue( stream, fileObservationScalarSize );
+    readBinaryValue( stream, fileTimeSize );
+    if( formatVersion != 1 )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, format version is not supported" );
+    }
+    if( ( fileObservationScalarSize != observationScalarSize ) || ( fileTimeSize != timeSize ) )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, scalar types are inconsistent" );
+    }
+}
+
+//! Function to write the contents of a binary estimation file to a temporary file, and rename it to the required name.
+void writeBinaryEstimationFile( const std::string& fileName,
+                                const std::function< void( std::ostream& ) > writeFunction )
+{
+    boost::filesystem::path filePath( fileName );
+    if( filePath.has_parent_path( ) )
+    {
+        boost::filesystem::create_directories( filePath.parent_path( ) );
+    }
+
+    const std::string temporaryFileName = fileName + ".tmp";
+    {
+        std::ofstream stream( temporaryFileName.c_str( ), std::ios::binary | std::ios::trunc );
+        if( !stream.is_open( ) )
+        {
+            throw std::runtime_error( "Error when writing binary estimation file, could not open " + temporaryFileName );
+        }
+        writeFunction( stream );
+        stream.close( );
+        if( stream.fail( ) )
+        {
+            throw std::runtime_error( "Error when writing binary estimation file " + temporaryFileName );
+        }
+    }
+    boost::filesystem::rename( temporaryFileName, filePath );
+}
+
+//! Function to open a binary estimation file for reading
+void openBinaryEstimationFile( const std::string& fileName, std::ifstream& stream )
+{
+    stream.open( fileName.c_str( ), std::ios::binary );
+    if( !stream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, could not open " + fileName );
+    }
+}
+
+//! Function to retrieve the name of the checkpoint file in a checkpoint directory
+std::string getEstimationCheckpointFileName( const std::string& checkpointDirectory )
+{
+    return ( boost::filesystem::path( checkpointDirectory ) / "estimationCheckpoint.dat" ).string( );
+}
+
+//! Function to retrieve the name of the history file of a single iteration in a checkpoint directory
+std::string getEstimationIterationHistoryFileName( const std::string& checkpointDirectory, const int iterationNumber )
+{
+    return ( boost::filesystem::path( checkpointDirectory ) /
+             ( "estimationIteration" + std::to_string( iterationNumber ) + ".dat" ) ).string( );
+}
+
+template struct EstimationCheckpoint< double >;
+template struct EstimationIterationHistory< double, double >;
+
+#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template struct EstimationCheckpoint< long double >;
+template struct EstimationIterationHistory< long double, double >;
+template struct EstimationIterationHistory< double, Time >;
+template struct EstimationIterationHistory< long double, Time >;
+#endif
+
+} // namespace simulation_setup
+
+} // namespace tudat
@@ -0,0 +1,489 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ESTIMATIONCHECKPOINT_H
+#define TUDAT_ESTIMATIONCHECKPOINT_H
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/timeType.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Data structure containing the state of an estimation after a completed iteration, from which it can be resumed.
+/*!
+ *  Data structure containing the state of an estimation after a completed iteration, from which it can be resumed (see
+ *  PodInput::defineCheckpointSettings): the parameter estimate for the next iteration, the residual history and the data
+ *  of the best iteration so far. The dynamics and variational equations are re-integrated when resuming, so their
+ *  numerical solutions are not stored.
+ */
+template< typename ObservationScalarType = double >
+struct EstimationCheckpoint
+{
+    //! Constructor, creates an empty checkpoint.
+    EstimationCheckpoint( ):
+        numberOfIterations_( 0 ), bestResidual_( TUDAT_NAN ){ }
+
+    //! Number of completed iterations
+    int numberOfIterations_;
+
+    //! Parameter estimate with which the next iteration is to be started
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > parameterEstimate_;
+
+    //! Rms residuals of all completed iterations
+    std::vector< double > rmsResidualHistory_;
+
+    //! Rms residual of best iteration
+    double bestResidual_;
+
+    //! Parameter estimate of best iteration
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > bestParameterEstimate_;
+
+    //! Observation residuals of best iteration
+    Eigen::VectorXd bestResiduals_;
+
+    //! Normalized information matrix (partials matrix) of best iteration (only set if saved in estimation output)
+    Eigen::MatrixXd bestInformationMatrix_;
+
+    //! Normalization terms of the partials of best iteration
+    Eigen::VectorXd bestTransformationData_;
+
+    //! Inverse of normalized covariance matrix (normal matrix) of best iteration
+    Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix_;
+};
+
+//! Data structure containing the results of a single iteration of an estimation, as written to file.
+/*!
+ *  Data structure containing the results of a single iteration of an estimation, as written to file when the iteration
+ *  histories are not to be kept in memory (see PodInput::defineCheckpointSettings). The residuals and parameters are only
+ *  set if PodInput::getSaveResidualsAndParametersFromEachIteration is true, the dynamics and dependent variables only if
+ *  PodInput::getSaveStateHistoryForEachIteration is true.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+struct EstimationIterationHistory
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param iterationNumber Index of the iteration (starting at 0)
+     */
+    EstimationIterationHistory( const int iterationNumber = 0 ):
+        iterationNumber_( iterationNumber ){ }
+
+    //! Index of the iteration (starting at 0)
+    int iterationNumber_;
+
+    //! Parameter estimate used in the iteration
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > parameterEstimate_;
+
+    //! Parameter estimate resulting from the iteration
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > updatedParameterEstimate_;
+
+    //! Observation residuals of the iteration
+    Eigen::VectorXd residuals_;
+
+    //! Numerical solution of dynamics of the iteration (per arc)
+    std::vector< std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > > dynamicsHistory_;
+
+    //! Numerical solution of dependent variables of the iteration (per arc)
+    std::vector< std::map< TimeType, Eigen::VectorXd > > dependentVariableHistory_;
+};
+
+//! Function to write a single value to a binary stream (in native byte order)
+/*!
+ *  Function to write a single value to a binary stream (in native byte order)
+ *  \param stream Stream to which the value is to be written
+ *  \param value Value that is to be written
+ */
+template< typename ValueType >
+void writeBinaryValue( std::ostream& stream, const ValueType& value )
+{
+    stream.write( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+}
+
+//! Function to write a time to a binary stream, as number of full periods and seconds into the period
+/*!
+ *  Function to write a time to a binary stream, as number of full periods and seconds into the period
+ *  \param stream Stream to which the time is to be written
+ *  \param value Time that is to be written
+ */
+void writeBinaryValue( std::ostream& stream, const Time& value );
+
+//! Function to read a single value from a binary stream (in native byte order)
+/*!
+ *  Function to read a single value from a binary stream (in native byte order)
+ *  \param stream Stream from which the value is to be read
+ *  \param value Value that is read (returned by reference)
+ */
+template< typename ValueType >
+void readBinaryValue( std::istream& stream, ValueType& value )
+{
+    stream.read( reinterpret_cast< char* >( &value ), sizeof( ValueType ) );
+    if( !stream )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, unexpected end of file" );
+    }
+}
+
+//! Function to read a time from a binary stream, as number of full periods and seconds into the period
+/*!
+ *  Function to read a time from a binary stream, as number of full periods and seconds into the period
+ *  \param stream Stream from which the time is to be read
+ *  \param value Time that is read (returned by reference)
+ */
+void readBinaryValue( std::istream& stream, Time& value );
+
+//! Function to write a matrix to a binary stream (number of rows and columns, followed by the column-major entries)
+/*!
+ *  Function to write a matrix to a binary stream (number of rows and columns, followed by the column-major entries)
+ *  \param stream Stream to which the matrix is to be written
+ *  \param matrix Matrix that is to be written
+ */
+template< typename ScalarType, int NumberOfRows, int NumberOfColumns >
+void writeBinaryMatrix( std::ostream& stream, const Eigen::Matrix< ScalarType, NumberOfRows, NumberOfColumns >& matrix )
+{
+    writeBinaryValue( stream, static_cast< int64_t >( matrix.rows( ) ) );
+    writeBinaryValue( stream, static_cast< int64_t >( matrix.cols( ) ) );
+    stream.write( reinterpret_cast< const char* >( matrix.data( ) ), matrix.size( ) * sizeof( ScalarType ) );
+}
+
+//! Function to read a matrix from a binary stream, as written by writeBinaryMatrix
+/*!
+ *  Function to read a matrix from a binary stream, as written by writeBinaryMatrix
+ *  \param stream Stream from which the matrix is to be read
+ *  \param matrix Matrix that is read (returned by reference)
+ */
+template< typename ScalarType, int NumberOfRows, int NumberOfColumns >
+void readBinaryMatrix( std::istream& stream, Eigen::Matrix< ScalarType, NumberOfRows, NumberOfColumns >& matrix )
+{
+    int64_t numberOfRows, numberOfColumns;
+    readBinaryValue( stream, numberOfRows );
+    readBinaryValue( stream, numberOfColumns );
+    if( ( numberOfRows < 0 ) || ( numberOfColumns < 0 ) ||
+            ( NumberOfRows != Eigen::Dynamic && numberOfRows != NumberOfRows ) ||
+            ( NumberOfColumns != Eigen::Dynamic && numberOfColumns != NumberOfColumns ) )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, matrix size is inconsistent" );
+    }
+
+    matrix.resize( numberOfRows, numberOfColumns );
+    stream.read( reinterpret_cast< char* >( matrix.data( ) ), matrix.size( ) * sizeof( ScalarType ) );
+    if( !stream )
+    {
+        throw std::runtime_error( "Error when reading binary estimation file, unexpected end of file" );
+    }
+}
+
+//! Function to write a symmetric matrix to a binary stream (size, followed by the entries of the lower triangle)
+/*!
+ *  Function to write a symmetric matrix to a binary stream (size, followed by the column-wise entries of the lower
+ *  triangle), so that only the independent entries are stored.
+ *  \param stream Stream to which the matrix is to be written
+ *  \param matrix Matrix that is to be written (must be square, only lower triangle is used)
+ */
+void writeBinarySymmetricMatrix( std::ostream& stream, const Eigen::MatrixXd& matrix );
+
+//! Function to read a symmetric matrix from a binary stream, as written by writeBinarySymmetricMatrix
+/*!
+ *  Function to read a symmetric matrix from a binary stream, as written by writeBinarySymmetricMatrix
+ *  \param stream Stream from which the matrix is to be read
+ *  \param matrix Matrix that is read (returned by reference; full symmetric matrix)
+ */
+void readBinarySymmetricMatrix( std::istream& stream, Eigen::MatrixXd& matrix );
+
+//! Function to write a history of matrices (e.g. states at integration epochs) to a binary stream
+/*!
+ *  Function to write a history of matrices (e.g. states at integration epochs) to a binary stream (number of entries,
+ *  followed by the time and matrix of each entry).
+ *  \param stream Stream to which the history is to be written
+ *  \param history History that is to be written
+ */
+template< typename TimeType, typename MatrixType >
+void writeBinaryMatrixHistory( std::ostream& stream, const std::map< TimeType, MatrixType >& history )
+{
+    writeBinaryValue( stream, static_cast< uint64_t >( history.size( ) ) );
+    for( auto historyIterator : history )
+    {
+        writeBinaryValue( stream, historyIterator.first );
+        writeBinaryMatrix( stream, historyIterator.second );
+    }
+}
+
+//! Function to read a history of matrices from a binary stream, as written by writeBinaryMatrixHistory
+/*!
+ *  Function to read a history of matrices from a binary stream, as written by writeBinaryMatrixHistory
+ *  \param stream Stream from which the history is to be read
+ *  \param history History that is read (returned by reference)
+ */
+template< typename TimeType, typename MatrixType >
+void readBinaryMatrixHistory( std::istream& stream, std::map< TimeType, MatrixType >& history )
+{
+    uint64_t numberOfEntries;
+    readBinaryValue( stream, numberOfEntries );
+
+    history.clear( );
+    TimeType currentTime;
+    for( uint64_t i = 0; i < numberOfEntries; i++ )
+    {
+        readBinaryValue( stream, currentTime );
+        readBinaryMatrix( stream, history[ currentTime ] );
+    }
+}
+
+//! Function to write a list of (per-arc) histories of matrices to a binary stream
+/*!
+ *  Function to write a list of (per-arc) histories of matrices to a binary stream
+ *  \param stream Stream to which the histories are to be written
+ *  \param histories Histories that are to be written
+ */
+template< typename TimeType, typename MatrixType >
+void writeBinaryMatrixHistories( std::ostream& stream, const std::vector< std::map< TimeType, MatrixType > >& histories )
+{
+    writeBinaryValue( stream, static_cast< uint64_t >( histories.size( ) ) );
+    for( unsigned int i = 0; i < histories.size( ); i++ )
+    {
+        writeBinaryMatrixHistory( stream, histories.at( i ) );
+    }
+}
+
+//! Function to read a list of (per-arc) histories of matrices from a binary stream, as written by writeBinaryMatrixHistories
+/*!
+ *  Function to read a list of (per-arc) histories of matrices from a binary stream, as written by
+ *  writeBinaryMatrixHistories
+ *  \param stream Stream from which the histories are to be read
+ *  \param histories Histories that are read (returned by reference)
+ */
+template< typename TimeType, typename MatrixType >
+void readBinaryMatrixHistories( std::istream& stream, std::vector< std::map< TimeType, MatrixType > >& histories )
+{
+    uint64_t numberOfHistories;
+    readBinaryValue( stream, numberOfHistories );
+
+    histories.clear( );
+    histories.resize( numberOfHistories );
+    for( uint64_t i = 0; i < numberOfHistories; i++ )
+    {
+        readBinaryMatrixHistory( stream, histories[ i ] );
+    }
+}
+
+//! Function to write the header of a binary estimation file
+/*!
+ *  Function to write the header of a binary estimation file, consisting of:
+ *  - 8 bytes: identifier of the file type
+ *  - uint32: format version (currently 1)
+ *  - uint32: size of the observation (and parameter) scalar type in bytes
+ *  - uint32: size of the time type in bytes (0 if no time type is used)
+ *  \param stream Stream to which the header is to be written
+ *  \param fileIdentifier Identifier of the file type (8 characters)
+ *  \param observationScalarSize Size of the observation (and parameter) scalar type in bytes
+ *  \param timeSize Size of the time type in bytes (0 if no time type is used)
+ */
+void writeBinaryEstimationFileHeader( std::ostream& stream, const std::string& fileIdentifier,
+                                      const unsigned int observationScalarSize, const unsigned int timeSize );
+
+//! Function to read and check the header of a binary estimation file, as written by writeBinaryEstimationFileHeader
+/*!
+ *  Function to read and check the header of a binary estimation file, as written by writeBinaryEstimationFileHeader. An
+ *  exception is thrown if the file type, format version or sizes of the scalar types are not as expected.
+ *  \param stream Stream from which the header is to be read
+ *  \param fileIdentifier Expected identifier of the file type (8 characters)
+ *  \param observationScalarSize Expected size of the observation (and parameter) scalar type in bytes
+ *  \param timeSize Expected size of the time type in bytes (0 if no time type is used)
+ */
+void readBinaryEstimationFileHeader( std::istream& stream, const std::string& fileIdentifier,
+                                     const unsigned int observationScalarSize, const unsigned int timeSize );
+
+//! Function to write the contents of a binary estimation file to a temporary file, and rename it to the required name.
+/*!
+ *  Function to write the contents of a binary estimation file to a temporary file, and rename it to the required name
+ *  once it is complete, so that an existing file with the same name is only replaced by a complete file (e.g. if the
+ *  program is terminated while writing a checkpoint). The directory of the file is created if it does not exist.
+ *  \param fileName Name of the file that is to be written
+ *  \param writeFunction Function that writes the contents of the file to a stream
+ */
+void writeBinaryEstimationFile( const std::string& fileName,
+                                const std::function< void( std::ostream& ) > writeFunction );
+
+//! Function to open a binary estimation file for reading
+/*!
+ *  Function to open a binary estimation file for reading, an exception is thrown if the file can not be opened.
+ *  \param fileName Name of the file that is to be read
+ *  \param stream Stream from which the file is to be read (returned by reference)
+ */
+void openBinaryEstimationFile( const std::string& fileName, std::ifstream& stream );
+
+//! Function to retrieve the name of the checkpoint file in a checkpoint directory
+/*!
+ *  Function to retrieve the name of the checkpoint file in a checkpoint directory
+ *  \param checkpointDirectory Directory in which the checkpoint and iteration history files are written
+ *  \return Name of the checkpoint file
+ */
+std::string getEstimationCheckpointFileName( const std::string& checkpointDirectory );
+
+//! Function to retrieve the name of the history file of a single iteration in a checkpoint directory
+/*!
+ *  Function to retrieve the name of the history file of a single iteration in a checkpoint directory
+ *  \param checkpointDirectory Directory in which the checkpoint and iteration history files are written
+ *  \param iterationNumber Index of the iteration (starting at 0)
+ *  \return Name of the iteration history file
+ */
+std::string getEstimationIterationHistoryFileName( const std::string& checkpointDirectory, const int iterationNumber );
+
+//! Function to write an estimation checkpoint to a binary file
+/*!
+ *  Function to write an estimation checkpoint to a binary file. The file starts with the header described in
+ *  writeBinaryEstimationFileHeader (identifier "TUDATCKP"), followed by the members of the checkpoint, in the order in
+ *  which they are declared. The (symmetric) normal matrix is stored by its lower triangle only. An existing file is
+ *  replaced only once the new file is complete.
+ *  \param checkpoint Checkpoint that is to be written
+ *  \param fileName Name of the file to which the checkpoint is to be written
+ */
+template< typename ObservationScalarType >
+void writeEstimationCheckpointToFile( const EstimationCheckpoint< ObservationScalarType >& checkpoint,
+                                      const std::string& fileName )
+{
+    writeBinaryEstimationFile( fileName, [ & ]( std::ostream& stream )
+    {
+        writeBinaryEstimationFileHeader( stream, "TUDATCKP", sizeof( ObservationScalarType ), 0 );
+        writeBinaryValue( stream, static_cast< int32_t >( checkpoint.numberOfIterations_ ) );
+        writeBinaryMatrix( stream, checkpoint.parameterEstimate_ );
+        writeBinaryMatrix( stream, Eigen::Map< const Eigen::VectorXd >(
+                               checkpoint.rmsResidualHistory_.data( ), checkpoint.rmsResidualHistory_.size( ) ).eval( ) );
+        writeBinaryValue( stream, checkpoint.bestResidual_ );
+        writeBinaryMatrix( stream, checkpoint.bestParameterEstimate_ );
+        writeBinaryMatrix( stream, checkpoint.bestResiduals_ );
+        writeBinaryMatrix( stream, checkpoint.bestInformationMatrix_ );
+        writeBinaryMatrix( stream, checkpoint.bestTransformationData_ );
+        writeBinarySymmetricMatrix( stream, checkpoint.bestInverseNormalizedCovarianceMatrix_ );
+    } );
+}
+
+//! Function to read an estimation checkpoint from a binary file, as written by writeEstimationCheckpointToFile
+/*!
+ *  Function to read an estimation checkpoint from a binary file, as written by writeEstimationCheckpointToFile
+ *  \param fileName Name of the file from which the checkpoint is to be read
+ *  \return Checkpoint read from the file
+ */
+template< typename ObservationScalarType >
+std::shared_ptr< EstimationCheckpoint< ObservationScalarType > > readEstimationCheckpointFromFile(
+        const std::string& fileName )
+{
+    std::ifstream stream;
+    openBinaryEstimationFile( fileName, stream );
+    readBinaryEstimationFileHeader( stream, "TUDATCKP", sizeof( ObservationScalarType ), 0 );
+
+    std::shared_ptr< EstimationCheckpoint< ObservationScalarType > > checkpoint =
+            std::make_shared< EstimationCheckpoint< ObservationScalarType > >( );
+
+    int32_t numberOfIterations;
+    readBinaryValue( stream, numberOfIterations );
+    checkpoint->numberOfIterations_ = numberOfIterations;
+    readBinaryMatrix( stream, checkpoint->parameterEstimate_ );
+
+    Eigen::VectorXd rmsResidualHistory;
+    readBinaryMatrix( stream, rmsResidualHistory );
+    checkpoint->rmsResidualHistory_ = std::vector< double >(
+                rmsResidualHistory.data( ), rmsResidualHistory.data( ) + rmsResidualHistory.rows( ) );
+
+    readBinaryValue( stream, checkpoint->bestResidual_ );
+    readBinaryMatrix( stream, checkpoint->bestParameterEstimate_ );
+    readBinaryMatrix( stream, checkpoint->bestResiduals_ );
+    readBinaryMatrix( stream, checkpoint->bestInformationMatrix_ );
+    readBinaryMatrix( stream, checkpoint->bestTransformationData_ );
+    readBinarySymmetricMatrix( stream, checkpoint->bestInverseNormalizedCovarianceMatrix_ );
+
+    return checkpoint;
+}
+
+//! Function to write the results of a single estimation iteration to a binary file
+/*!
+ *  Function to write the results of a single estimation iteration to a binary file. The file starts with the header
+ *  described in writeBinaryEstimationFileHeader (identifier "TUDATITR"), followed by the members of the iteration
+ *  history, in the order in which they are declared.
+ *  \param iterationHistory Results of the iteration that are to be written
+ *  \param fileName Name of the file to which the results are to be written
+ */
+template< typename ObservationScalarType, typename TimeType >
+void writeEstimationIterationHistoryToFile(
+        const EstimationIterationHistory< ObservationScalarType, TimeType >& iterationHistory,
+        const std::string& fileName )
+{
+    writeBinaryEstimationFile( fileName, [ & ]( std::ostream& stream )
+    {
+        writeBinaryEstimationFileHeader( stream, "TUDATITR", sizeof( ObservationScalarType ), sizeof( TimeType ) );
+        writeBinaryValue( stream, static_cast< int32_t >( iterationHistory.iterationNumber_ ) );
+        writeBinaryMatrix( stream, iterationHistory.parameterEstimate_ );
+        writeBinaryMatrix( stream, iterationHistory.updatedParameterEstimate_ );
+        writeBinaryMatrix( stream, iterationHistory.residuals_ );
+        writeBinaryMatrixHistories( stream, iterationHistory.dynamicsHistory_ );
+        writeBinaryMatrixHistories( stream, iterationHistory.dependentVariableHistory_ );
+    } );
+}
+
+//! Function to read the results of a single estimation iteration from a binary file
+/*!
+ *  Function to read the results of a single estimation iteration from a binary file, as written by
+ *  writeEstimationIterationHistoryToFile
+ *  \param fileName Name of the file from which the results are to be read
+ *  \return Results of the iteration read from the file
+ */
+template< typename ObservationScalarType, typename TimeType >
+std::shared_ptr< EstimationIterationHistory< ObservationScalarType, TimeType > > readEstimationIterationHistoryFromFile(
+        const std::string& fileName )
+{
+    std::ifstream stream;
+    openBinaryEstimationFile( fileName, stream );
+    readBinaryEstimationFileHeader( stream, "TUDATITR", sizeof( ObservationScalarType ), sizeof( TimeType ) );
+
+    std::shared_ptr< EstimationIterationHistory< ObservationScalarType, TimeType > > iterationHistory =
+            std::make_shared< EstimationIterationHistory< ObservationScalarType, TimeType > >( );
+
+    int32_t iterationNumber;
+    readBinaryValue( stream, iterationNumber );
+    iterationHistory->iterationNumber_ = iterationNumber;
+    readBinaryMatrix( stream, iterationHistory->parameterEstimate_ );
+    readBinaryMatrix( stream, iterationHistory->updatedParameterEstimate_ );
+    readBinaryMatrix( stream, iterationHistory->residuals_ );
+    readBinaryMatrixHistories( stream, iterationHistory->dynamicsHistory_ );
+    readBinaryMatrixHistories( stream, iterationHistory->dependentVariableHistory_ );
+
+    return iterationHistory;
+}
+
+extern template struct EstimationCheckpoint< double >;
+extern template struct EstimationIterationHistory< double, double >;
+
+#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template struct EstimationCheckpoint< long double >;
+extern template struct EstimationIterationHistory< long double, double >;
+extern template struct EstimationIterationHistory< double, Time >;
+extern template struct EstimationIterationHistory< long double, Time >;
+#endif
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_ESTIMATIONCHECKPOINT_H
@@ -12,6 +12,7 @@
 #define TUDAT_PODINPUTOUTPUTTYPES_H
 
 #include <map>
+#include <string>
 #include <vector>
 #include <iostream>
 #include <memory>
@@ -68,7 +69,16 @@ public:
         saveInformationMatrix_( true ),
         printOutput_( true ),
         saveResidualsAndParametersFromEachIteration_( true ),
-        saveStateHistoryForEachIteration_( false )
+        saveStateHistoryForEachIteration_( false ),
+        accumulateNormalEquations_( false ),
+        maximumNumberOfObservationTimesPerBlock_( 1000 ),
+        numberOfNormalEquationThreads_( 1 ),
+        useSquareRootInformationFilter_( false ),
+        eliminateArcParameters_( false ),
+        useSparseDesignMatrix_( false ),
+        checkpointDirectory_( "" ),
+        resumeFromCheckpoint_( false ),
+        saveIterationHistoriesToFile_( false )
     {
         if( inverseOfAprioriCovariance_.rows( ) == 0 )
         {
@@ -217,6 +227,134 @@ public:
         saveStateHistoryForEachIteration_ = saveStateHistoryForEachIteration;
     }
 
+    //! Function to define settings for the block-wise accumulation of the normal equations
+    /*!
+     *  Function to define settings for the block-wise accumulation of the normal equations. When using this option, the
+     *  observations and partials are computed for blocks of observation times, and directly added to the normal equations,
+     *  so that the full matrix of partials (of size number of observations times number of parameters) is never stored. In
+     *  this case, the partials matrix is not saved in the output, regardless of the settings in defineEstimationSettings.
+     *  \param accumulateNormalEquations Boolean denoting whether the normal equations are to be accumulated block-wise
+     *  \param maximumNumberOfObservationTimesPerBlock Maximum number of observation times (per observable type and link
+     *  ends) for which the observations and partials are computed at once.
+     *  \param numberOfThreads Number of threads over which the update of the normal equations is distributed (if 0, the
+     *  number of threads that can be executed concurrently on the current hardware is used).
+     */
+    void defineNormalEquationAccumulationSettings( const bool accumulateNormalEquations = 1,
+                                                   const int maximumNumberOfObservationTimesPerBlock = 1000,
+                                                   const unsigned int numberOfThreads = 1 )
+    {
+        if( maximumNumberOfObservationTimesPerBlock <= 0 )
+        {
+            throw std::runtime_error( "Error when defining normal equation settings, block size must be positive" );
+        }
+
+        accumulateNormalEquations_ = accumulateNormalEquations;
+        maximumNumberOfObservationTimesPerBlock_ = maximumNumberOfObservationTimesPerBlock;
+        numberOfNormalEquationThreads_ = numberOfThreads;
+        useSquareRootInformationFilter_ = false;
+        eliminateArcParameters_ = false;
+        useSparseDesignMatrix_ = false;
+    }
+
+    //! Function to define settings for the block-wise accumulation of the square-root information (SRIF)
+    /*!
+     *  Function to define settings for the block-wise accumulation of the square-root information, as is done in a
+     *  square-root information filter (SRIF). As for defineNormalEquationAccumulationSettings, the observations and partials
+     *  are computed for blocks of observation times, so that the full matrix of partials is never stored. Instead of being
+     *  added to the normal equations, each block is added to an upper triangular square-root information matrix by a
+     *  Householder QR update, so that the normal matrix (which has the square of the condition number of the partials matrix)
+     *  is not used to compute the parameter adjustment (unless constraints are defined for the estimated parameters).
+     *  \param useSquareRootInformationFilter Boolean denoting whether the square-root information is to be accumulated
+     *  block-wise
+     *  \param maximumNumberOfObservationTimesPerBlock Maximum number of observation times (per observable type and link
+     *  ends) for which the observations and partials are computed at once.
+     */
+    void defineSquareRootInformationFilterSettings( const bool useSquareRootInformationFilter = 1,
+                                                    const int maximumNumberOfObservationTimesPerBlock = 1000 )
+    {
+        defineNormalEquationAccumulationSettings(
+                    useSquareRootInformationFilter, maximumNumberOfObservationTimesPerBlock );
+        useSquareRootInformationFilter_ = useSquareRootInformationFilter;
+    }
+
+    //! Function to define settings for the elimination of arc-wise parameters from the normal equations
+    /*!
+     *  Function to define settings for the elimination of arc-wise parameters from the normal equations, for multi-arc
+     *  estimations in which most parameters are local to a single arc (initial states, and arc-wise radiation pressure
+     *  coefficients, empirical accelerations and observation biases with arcs contained in a single state arc). As for
+     *  defineNormalEquationAccumulationSettings, the observations and partials are computed for blocks of observation
+     *  times. The normal equations are stored per arc (local parameters and their coupling to the global parameters) and
+     *  for the global parameters only. The local parameters are eliminated arc by arc (Schur complement), so that only the
+     *  reduced system of the global parameters is solved as a whole (unless constraints are defined for the estimated
+     *  parameters). The a priori covariance may not contain correlations between local parameters of different arcs.
+     *  The full (dense) normal matrix is not assembled in the iterations. It is only assembled once, for the covariance of
+     *  the best iteration in the estimation output (and when writing a checkpoint after an improved iteration).
+     *  \param eliminateArcParameters Boolean denoting whether the arc-wise parameters are to be eliminated
+     *  \param maximumNumberOfObservationTimesPerBlock Maximum number of observation times (per observable type and link
+     *  ends) for which the observations and partials are computed at once.
+     */
+    void defineArcParameterEliminationSettings( const bool eliminateArcParameters = 1,
+                                                const int maximumNumberOfObservationTimesPerBlock = 1000 )
+    {
+        defineNormalEquationAccumulationSettings( eliminateArcParameters, maximumNumberOfObservationTimesPerBlock );
+        eliminateArcParameters_ = eliminateArcParameters;
+    }
+
+    //! Function to define settings for the storage of the partials matrix in block-sparse form
+    /*!
+     *  Function to define settings for the storage of the partials matrix in block-sparse form. As for
+     *  defineNormalEquationAccumulationSettings, the observations and partials are computed for blocks of observation times.
+     *  Of each block, only the non-zero ranges of partials of each observation are stored (partials w.r.t. e.g. the initial
+     *  states of other arcs, other ground stations and biases of other links are not), from which the normal equations are
+     *  computed. The memory use and the number of operations to compute the normal equations then scale with the number of
+     *  non-zero partials, instead of with the product of the number of observations and parameters. If the partials matrix
+     *  is to be saved in the output (see defineEstimationSettings), it is converted to a full matrix when the output is
+     *  created.
+     *  \param useSparseDesignMatrix Boolean denoting whether the partials matrix is to be stored in block-sparse form
+     *  \param maximumNumberOfObservationTimesPerBlock Maximum number of observation times (per observable type and link
+     *  ends) for which the observations and partials are computed at once.
+     */
+    void defineSparseDesignMatrixSettings( const bool useSparseDesignMatrix = 1,
+                                           const int maximumNumberOfObservationTimesPerBlock = 1000 )
+    {
+        defineNormalEquationAccumulationSettings( useSparseDesignMatrix, maximumNumberOfObservationTimesPerBlock );
+        useSparseDesignMatrix_ = useSparseDesignMatrix;
+    }
+
+    //! Function to define settings for the checkpointing of the estimation, and the output of the iteration histories to file
+    /*!
+     *  Function to define settings for the checkpointing of the estimation, and the output of the iteration histories to
+     *  file. After each iteration, a binary checkpoint (see EstimationCheckpoint) is written to the checkpoint directory,
+     *  containing the parameter estimate for the next iteration, the residual history, and the data of the best iteration so
+     *  far (including its partials matrix, if it is saved in the output). If the estimation is to be resumed from the
+     *  checkpoint, and a checkpoint file exists in the directory, the estimation continues from the first iteration that was
+     *  not completed (re-integrating the dynamics and variational equations with the checkpointed parameter estimate). The
+     *  checkpoint must have been created with the same observations and estimated parameters.
+     *  If the iteration histories are saved to file, the residuals and parameters (if
+     *  getSaveResidualsAndParametersFromEachIteration is true) and the state histories (if
+     *  getSaveStateHistoryForEachIteration is true) of each iteration are written to a separate binary file in the
+     *  checkpoint directory (see getEstimationIterationHistoryFileName and readEstimationIterationHistoryFromFile), instead
+     *  of being stored in the output.
+     *  \param checkpointDirectory Directory to which the checkpoint and iteration histories are written (checkpointing is
+     *  switched off if empty)
+     *  \param resumeFromCheckpoint Boolean denoting whether the estimation is to be resumed from an existing checkpoint
+     *  \param saveIterationHistoriesToFile Boolean denoting whether the iteration histories are to be written to file,
+     *  instead of being stored in the output
+     */
+    void defineCheckpointSettings( const std::string& checkpointDirectory,
+                                   const bool resumeFromCheckpoint = 1,
+                                   const bool saveIterationHistoriesToFile = 1 )
+    {
+        if( checkpointDirectory == "" && saveIterationHistoriesToFile )
+        {
+            throw std::runtime_error( "Error when defining checkpoint settings, no directory for iteration histories given" );
+        }
+
+        checkpointDirectory_ = checkpointDirectory;
+        resumeFromCheckpoint_ = resumeFromCheckpoint;
+        saveIterationHistoriesToFile_ = saveIterationHistoriesToFile;
+    }
+
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
      * Function to return the total data structure of observations and associated times/link ends/type (by reference)
@@ -320,6 +458,99 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return the boolean denoting whether the normal equations are to be accumulated block-wise
+    /*!
+     * Function to return the boolean denoting whether the normal equations are to be accumulated block-wise
+     * \return Boolean denoting whether the normal equations are to be accumulated block-wise
+     */
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
+
+    //! Function to return the maximum number of observation times for which observations and partials are computed at once
+    /*!
+     * Function to return the maximum number of observation times for which observations and partials are computed at once
+     * (only used if normal equations are accumulated block-wise).
+     * \return Maximum number of observation times for which observations and partials are computed at once
+     */
+    int getMaximumNumberOfObservationTimesPerBlock( )
+    {
+        return maximumNumberOfObservationTimesPerBlock_;
+    }
+
+    //! Function to return the number of threads over which the update of the normal equations is distributed
+    /*!
+     * Function to return the number of threads over which the update of the normal equations is distributed
+     * \return Number of threads over which the update of the normal equations is distributed
+     */
+    unsigned int getNumberOfNormalEquationThreads( )
+    {
+        return numberOfNormalEquationThreads_;
+    }
+
+    //! Function to return the boolean denoting whether the square-root information is to be accumulated block-wise
+    /*!
+     * Function to return the boolean denoting whether the square-root information is to be accumulated block-wise (instead
+     * of the normal equations)
+     * \return Boolean denoting whether the square-root information is to be accumulated block-wise
+     */
+    bool getUseSquareRootInformationFilter( )
+    {
+        return useSquareRootInformationFilter_;
+    }
+
+    //! Function to return the boolean denoting whether the arc-wise parameters are eliminated from the normal equations
+    /*!
+     * Function to return the boolean denoting whether the arc-wise parameters are eliminated from the normal equations
+     * \return Boolean denoting whether the arc-wise parameters are eliminated from the normal equations
+     */
+    bool getEliminateArcParameters( )
+    {
+        return eliminateArcParameters_;
+    }
+
+    //! Function to return the boolean denoting whether the partials matrix is stored in block-sparse form
+    /*!
+     * Function to return the boolean denoting whether the partials matrix is stored in block-sparse form
+     * \return Boolean denoting whether the partials matrix is stored in block-sparse form
+     */
+    bool getUseSparseDesignMatrix( )
+    {
+        return useSparseDesignMatrix_;
+    }
+
+    //! Function to return the directory to which the checkpoint and iteration histories are written
+    /*!
+     * Function to return the directory to which the checkpoint and iteration histories are written
+     * \return Directory to which the checkpoint and iteration histories are written (empty if no checkpoint is written)
+     */
+    std::string getCheckpointDirectory( )
+    {
+        return checkpointDirectory_;
+    }
+
+    //! Function to return the boolean denoting whether the estimation is to be resumed from an existing checkpoint
+    /*!
+     * Function to return the boolean denoting whether the estimation is to be resumed from an existing checkpoint
+     * \return Boolean denoting whether the estimation is to be resumed from an existing checkpoint
+     */
+    bool getResumeFromCheckpoint( )
+    {
+        return resumeFromCheckpoint_;
+    }
+
+    //! Function to return the boolean denoting whether the iteration histories are written to file
+    /*!
+     * Function to return the boolean denoting whether the iteration histories are written to file (instead of being stored
+     * in the output)
+     * \return Boolean denoting whether the iteration histories are written to file
+     */
+    bool getSaveIterationHistoriesToFile( )
+    {
+        return saveIterationHistoriesToFile_;
+    }
+
 private:
     //! Total data structure of observations and associated times/link ends/type
     PodInputDataType observationsAndTimes_;
@@ -352,6 +583,33 @@ private:
     //! Boolean denoting whether the state history is to be saved on each iteration.
     bool saveStateHistoryForEachIteration_;
 
+    //! Boolean denoting whether the normal equations are to be accumulated block-wise
+    bool accumulateNormalEquations_;
+
+    //! Maximum number of observation times for which observations and partials are computed at once
+    int maximumNumberOfObservationTimesPerBlock_;
+
+    //! Number of threads over which the update of the normal equations is distributed
+    unsigned int numberOfNormalEquationThreads_;
+
+    //! Boolean denoting whether the square-root information is to be accumulated block-wise (instead of normal equations)
+    bool useSquareRootInformationFilter_;
+
+    //! Boolean denoting whether the arc-wise parameters are eliminated from the normal equations
+    bool eliminateArcParameters_;
+
+    //! Boolean denoting whether the partials matrix is stored in block-sparse form
+    bool useSparseDesignMatrix_;
+
+    //! Directory to which the checkpoint and iteration histories are written (empty if no checkpoint is written)
+    std::string checkpointDirectory_;
+
+    //! Boolean denoting whether the estimation is to be resumed from an existing checkpoint
+    bool resumeFromCheckpoint_;
+
+    //! Boolean denoting whether the iteration histories are written to file (instead of being stored in the output)
+    bool saveIterationHistoriesToFile_;
+
 };
 
 //! Class that is used during the orbit determination/parameter estimation to determine whether the estimation is converged.
@@ -18,6 +18,8 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
 #include "Tudat/SimulationSetup/PropagationSetup//propagationSettings.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
 #include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
 
 
@@ -148,6 +150,84 @@ BOOST_AUTO_TEST_CASE( testTwoBodyMassPropagation )
     }
 }
 
+// Test whether the in-place state derivative function (used by the single-arc dynamics simulator for variable step-size
+// integrators) sets the same state derivative as the by-value function, directly in the vector that is passed to it, for
+// coupled translational and mass dynamics.
+BOOST_AUTO_TEST_CASE( testInPlaceStateDerivativeOfCoupledDynamics )
+{
+    for( unsigned int propagatorCase = 0; propagatorCase < 2; propagatorCase++ )
+    {
+        // Crate bodyMap
+        NamedBodyMap bodyMap;
+        bodyMap[ "Earth" ] = std::make_shared< Body >( );
+        bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                              [ ]( ){ return Eigen::Vector6d::Zero( ); } ) );
+        bodyMap[ "Earth" ]->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+        bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+        setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+        // Create acceleration and mass rate models.
+        SelectedAccelerationMap accelerationSettings;
+        accelerationSettings[ "Vehicle" ][ "Earth" ].push_back(
+                    std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+        basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                    bodyMap, accelerationSettings, { "Vehicle" }, { "Earth" } );
+        std::map< std::string, std::shared_ptr< basic_astrodynamics::MassRateModel > > massRateModels;
+        massRateModels[ "Vehicle" ] = std::make_shared< basic_astrodynamics::CustomMassRateModel >(
+                    [ ]( const double ){ return -0.01; } );
+
+        // Create settings for propagation
+        std::shared_ptr< PropagationTimeTerminationSettings > terminationSettings =
+                std::make_shared< PropagationTimeTerminationSettings >( 3600.0 );
+        Eigen::VectorXd initialTranslationalState = ( Eigen::VectorXd( 6 ) <<
+                                                      7.0E6, 0.0, 1.0E5, 0.0, 7.5E3, 1.0E2 ).finished( );
+        Eigen::VectorXd initialMass = Eigen::VectorXd::Constant( 1, 500.0 );
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+        propagatorSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        std::vector< std::string >{ "Earth" }, accelerationModelMap, std::vector< std::string >{ "Vehicle" },
+                        initialTranslationalState, terminationSettings, ( propagatorCase == 0 ) ? cowell : encke ) );
+        propagatorSettingsList.push_back(
+                    std::make_shared< MassPropagatorSettings< double > >(
+                        std::vector< std::string >{ "Vehicle" }, massRateModels, initialMass, terminationSettings ) );
+        std::shared_ptr< PropagatorSettings< double > > propagatorSettings =
+                std::make_shared< MultiTypePropagatorSettings< double > >( propagatorSettingsList, terminationSettings );
+
+        // Define numerical integrator settings.
+        std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                    0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 1.0E3, 1.0E-12, 1.0E-12 );
+
+        // Create dynamics simulation object.
+        SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                    bodyMap, integratorSettings, propagatorSettings, true, false, false );
+        std::shared_ptr< DynamicsStateDerivativeModel< double, double > > stateDerivativeModel =
+                dynamicsSimulator.getDynamicsStateDerivative( );
+
+        // Compare state derivatives at propagated states, computed in place and by value.
+        std::map< double, Eigen::VectorXd > integratedState = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK( integratedState.size( ) > 5 );
+        Eigen::VectorXd inPlaceStateDerivative = Eigen::VectorXd::Zero( 7 );
+        const double* inPlaceStateDerivativeData = inPlaceStateDerivative.data( );
+        for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = integratedState.begin( );
+             stateIterator != integratedState.end( ); stateIterator++ )
+        {
+            stateDerivativeModel->computeStateDerivativeInPlace(
+                        stateIterator->first, stateIterator->second, inPlaceStateDerivative );
+            Eigen::VectorXd stateDerivative = stateDerivativeModel->computeStateDerivative(
+                        stateIterator->first, stateIterator->second );
+
+            BOOST_CHECK( inPlaceStateDerivative.data( ) == inPlaceStateDerivativeData );
+            BOOST_CHECK_EQUAL( stateDerivative.rows( ), 7 );
+            for( int i = 0; i < 7; i++ )
+            {
+                BOOST_CHECK_EQUAL( inPlaceStateDerivative( i ), stateDerivative( i ) );
+            }
+            BOOST_CHECK_EQUAL( inPlaceStateDerivative( 6 ), -0.01 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
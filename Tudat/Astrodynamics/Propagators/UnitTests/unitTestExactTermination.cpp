@@ -10,6 +10,7 @@
 
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
 #include <limits>
 #include <string>
 #include <thread>
@@ -21,6 +22,7 @@
 #include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
 
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
@@ -348,6 +350,190 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
     }
 }
 
+//! Test exact termination using the dense output of the integrator, to locate the termination without re-taking the last
+//! integration step. A harmonic oscillator x'' = -x, with x(0) = 1 and x'(0) = 0, is propagated until x = 0.5
+//! (i.e. t = pi/3), or until a fixed time, using both the dense output and the (default) re-stepping approach. The
+//! results of the two approaches are compared to the analytical solution, and the number of state derivative
+//! evaluations is compared.
+BOOST_AUTO_TEST_CASE( testDenseOutputExactTermination )
+{
+    using namespace propagators;
+    using namespace numerical_integrators;
+
+    for( unsigned int coefficientCase = 0; coefficientCase < 2; coefficientCase++ )
+    {
+        // For DOPRI5, the dedicated interpolant is used, for RKF7(8), the Hermite interpolation
+        RungeKuttaCoefficients::CoefficientSets coefficientSet =
+                ( coefficientCase == 0 ) ? RungeKuttaCoefficients::rungeKutta54DormandPrince :
+                                           RungeKuttaCoefficients::rungeKuttaFehlberg78;
+
+        for( unsigned int terminationCase = 0; terminationCase < 2; terminationCase++ )
+        {
+            std::vector< int > numberOfEvaluations( 2 );
+            std::vector< double > finalTimes( 2 );
+            std::vector< Eigen::VectorXd > finalStates( 2 );
+
+            for( unsigned int useDenseOutput = 0; useDenseOutput < 2; useDenseOutput++ )
+            {
+                // Define state derivative function, and dependent variable (position) computed from last evaluation
+                int evaluationCounter = 0;
+                double currentPosition = TUDAT_NAN;
+                std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+                        [ & ]( const double, const Eigen::VectorXd& state )
+                {
+                    evaluationCounter++;
+                    currentPosition = state( 0 );
+                    return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+                };
+                std::function< Eigen::VectorXd( ) > dependentVariableFunction = [ & ]( )
+                {
+                    return ( Eigen::VectorXd( 1 ) << currentPosition ).finished( );
+                };
+
+                // Create termination condition
+                std::shared_ptr< PropagationTerminationCondition > terminationCondition;
+                if( terminationCase == 0 )
+                {
+                    terminationCondition = std::make_shared< SingleVariableLimitPropagationTerminationCondition >(
+                                nullptr, [ & ]( ){ return currentPosition; }, 0.5, true, true,
+                                std::make_shared< root_finders::RootFinderSettings >(
+                                    root_finders::bisection_root_finder, 1.0E-13, 100 ),
+                                static_cast< bool >( useDenseOutput ) );
+                }
+                else
+                {
+                    terminationCondition = std::make_shared< FixedTimePropagationTerminationCondition >(
+                                1.0, true, true, static_cast< bool >( useDenseOutput ) );
+                }
+
+                // Propagate
+                std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                        std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                            0.0, 0.01, coefficientSet, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+                std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+                        createIntegrator< double, Eigen::VectorXd >(
+                            stateDerivativeFunction, ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( ), integratorSettings );
+
+                std::map< double, Eigen::VectorXd > stateHistory;
+                std::map< double, Eigen::VectorXd > dependentVariableHistory;
+                std::map< double, double > cpuTimeHistory;
+                std::shared_ptr< PropagationTerminationDetails > terminationDetails =
+                        integrateEquationsFromIntegrator< Eigen::VectorXd, double >(
+                            integrator, integratorSettings->initialTimeStep_, terminationCondition, stateHistory,
+                            dependentVariableHistory, cpuTimeHistory, dependentVariableFunction,
+                            std::function< void( Eigen::VectorXd& ) >( ), 1 );
+
+                BOOST_CHECK_EQUAL( terminationDetails->getPropagationTerminationReason( ),
+                                   termination_condition_reached );
+                BOOST_CHECK_EQUAL( terminationDetails->getTerminationOnExactCondition( ), true );
+
+                numberOfEvaluations[ useDenseOutput ] = evaluationCounter;
+                finalTimes[ useDenseOutput ] = stateHistory.rbegin( )->first;
+                finalStates[ useDenseOutput ] = stateHistory.rbegin( )->second;
+
+                // Check final time and state against analytical solution
+                double expectedFinalTime = ( terminationCase == 0 ) ?
+                            mathematical_constants::PI / 3.0 : 1.0;
+                // Hermite interpolation used for RKF7(8) is of lower order than the integrator
+                double tolerance = ( useDenseOutput && ( coefficientCase == 1 ) ) ? 1.0E-5 : 1.0E-10;
+                BOOST_CHECK_SMALL( finalTimes[ useDenseOutput ] - expectedFinalTime, tolerance );
+                BOOST_CHECK_SMALL( finalStates[ useDenseOutput ]( 0 ) - std::cos( expectedFinalTime ), tolerance );
+                BOOST_CHECK_SMALL( finalStates[ useDenseOutput ]( 1 ) + std::sin( expectedFinalTime ), tolerance );
+                if( terminationCase == 0 )
+                {
+                    BOOST_CHECK_SMALL( dependentVariableHistory.rbegin( )->second( 0 ) - 0.5, tolerance );
+                }
+            }
+
+            // Check that locating the termination from the dense output requires fewer evaluations
+            BOOST_CHECK( numberOfEvaluations.at( 1 ) < numberOfEvaluations.at( 0 ) );
+        }
+    }
+}
+
+//! Test exact termination using the dense output of the integrator when propagating with a SingleArcDynamicsSimulator, for
+//! which the state is post-processed (and reset in the integrator) after each step. A Kepler orbit is propagated with the
+//! DOPRI5 integrator to a final time that is not a multiple of the step size, using both the dense output and the
+//! (default) re-stepping approach. Checks that the dense output and first-same-as-last stage of each step are retained
+//! (i.e. that the unchanged post-processed state does not reset the step history of the integrator).
+BOOST_AUTO_TEST_CASE( testDenseOutputExactTerminationInDynamicsSimulator )
+{
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Create central body with point mass gravity field, and vehicle
+    double earthGravitationalParameter = 3.986004418E14;
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >(
+                earthGravitationalParameter );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.05, 0.3, 0.5, 1.0, 0.2;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    // Propagate to final time that is not a multiple of the step size. The tolerances are such that all steps are
+    // accepted, and equal to the maximum step size.
+    double stepSize = 10.0;
+    double finalTime = 1005.0;
+    std::vector< unsigned int > numberOfEvaluations( 2 );
+    std::vector< Eigen::VectorXd > finalStates( 2 );
+    for( unsigned int useDenseOutput = 0; useDenseOutput < 2; useDenseOutput++ )
+    {
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, initialState,
+                    std::make_shared< PropagationTimeTerminationSettings >(
+                        finalTime, true, static_cast< bool >( useDenseOutput ) ) );
+        std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                    0.0, stepSize, RungeKuttaCoefficients::rungeKutta54DormandPrince, 1.0E-3, stepSize, 1.0, 1.0 );
+
+        SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+        std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+        // Check final time and state against analytical solution
+        BOOST_CHECK_SMALL( stateHistory.rbegin( )->first - finalTime, 1.0E-10 );
+        finalStates[ useDenseOutput ] = stateHistory.rbegin( )->second;
+        Eigen::Vector6d expectedFinalState = convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( initialKeplerElements, finalTime, earthGravitationalParameter ),
+                    earthGravitationalParameter );
+        BOOST_CHECK_SMALL( ( finalStates[ useDenseOutput ].segment( 0, 3 ) - expectedFinalState.segment( 0, 3 ) ).norm( ),
+                           1.0E-2 );
+
+        // Check that the first stage of each step is reused from the previous step: 6 evaluations per step (plus the
+        // initial and final evaluations), instead of 7.
+        numberOfEvaluations[ useDenseOutput ] = 0;
+        for( auto evaluationIterator : dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ) )
+        {
+            numberOfEvaluations[ useDenseOutput ] =
+                    std::max( numberOfEvaluations[ useDenseOutput ], evaluationIterator.second );
+        }
+        unsigned int numberOfSteps = static_cast< unsigned int >( finalTime / stepSize );
+        BOOST_CHECK( numberOfEvaluations[ useDenseOutput ] < 6 * numberOfSteps + 20 );
+    }
+
+    // Check that dense output was used to locate the final state, and that it is consistent with the re-stepped state
+    BOOST_CHECK( numberOfEvaluations.at( 1 ) < numberOfEvaluations.at( 0 ) );
+    BOOST_CHECK_SMALL( ( finalStates.at( 1 ) - finalStates.at( 0 ) ).segment( 0, 3 ).norm( ), 1.0E-2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,104 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_gauss_jackson_propagation )
+
+//! Test propagation of a Kepler orbit with the Gauss-Jackson integrator, using a SingleArcDynamicsSimulator. Since the
+//! simulator post-processes the state after each step (leaving a Cartesian state unchanged), this checks that the
+//! integrator is not restarted after each step, i.e. that the predictor-corrector steps are used after the startup.
+BOOST_AUTO_TEST_CASE( testGaussJacksonPropagationInDynamicsSimulator )
+{
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Create central body with point mass gravity field, and vehicle
+    double earthGravitationalParameter = 3.986004418E14;
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >(
+                earthGravitationalParameter );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    Eigen::Vector6d initialKeplerElements;
+    initialKeplerElements << 7000.0E3, 0.05, 0.3, 0.5, 1.0, 0.2;
+    Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                initialKeplerElements, earthGravitationalParameter );
+
+    // Propagate for 2000 steps
+    double stepSize = 30.0;
+    unsigned int numberOfSteps = 2000;
+    double finalTime = stepSize * static_cast< double >( numberOfSteps );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, finalTime );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< GaussJacksonSettings< > >(
+                0.0, stepSize, getCartesianSecondOrderStateIndices( 1 ) );
+
+    SingleArcDynamicsSimulator< > dynamicsSimulator( bodyMap, integratorSettings, propagatorSettings );
+    std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Check final time and state against analytical solution
+    BOOST_CHECK_SMALL( stateHistory.rbegin( )->first - finalTime, 1.0E-8 );
+    Eigen::Vector6d expectedFinalState = convertKeplerianToCartesianElements(
+                propagateKeplerOrbit( initialKeplerElements, stateHistory.rbegin( )->first, earthGravitationalParameter ),
+                earthGravitationalParameter );
+    BOOST_CHECK_SMALL( ( stateHistory.rbegin( )->second.segment( 0, 3 ) - expectedFinalState.segment( 0, 3 ) ).norm( ),
+                       1.0E-3 );
+
+    // Check that the number of state derivative evaluations is consistent with the predictor-corrector steps (a few per
+    // step), rather than with a restart through the Runge-Kutta startup integrator at each step (at least 14 per step).
+    unsigned int numberOfEvaluations = 0;
+    for( auto evaluationIterator : dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ) )
+    {
+        numberOfEvaluations = std::max( numberOfEvaluations, evaluationIterator.second );
+    }
+    BOOST_CHECK( numberOfEvaluations < 3 * numberOfSteps );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
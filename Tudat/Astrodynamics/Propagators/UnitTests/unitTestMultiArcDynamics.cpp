@@ -242,6 +242,138 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     }
 }
 
+//! Function to create the environment and multi-arc propagator settings for the parallel multi-arc test
+std::pair< NamedBodyMap, std::shared_ptr< MultiArcPropagatorSettings< double > > > createParallelMultiArcTestSetup(
+        const std::vector< double >& integrationArcStarts,
+        const std::vector< double >& integrationArcEnds )
+{
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    // Create bodies needed in simulation
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, integrationArcStarts.front( ) - 1.0E4, integrationArcEnds.back( ) + 1.0E4 );
+    std::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( bodySettings[ "Moon" ]->ephemerisSettings )->
+            resetFrameOrigin( "Earth" );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< FromFileSphericalHarmonicsGravityFieldSettings >( ggm02s );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations between bodies that are to be taken into account.
+    SelectedAccelerationMap accelerationMap;
+    std::map< std::string, std::vector< std::shared_ptr< AccelerationSettings > > > accelerationsOfMoon;
+    accelerationsOfMoon[ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 4, 4 ) );
+    accelerationMap[ "Moon" ] = accelerationsOfMoon;
+
+    std::vector< std::string > bodiesToIntegrate, centralBodies;
+    bodiesToIntegrate.push_back( "Moon" );
+    centralBodies.push_back( "Earth" );
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+    for( unsigned int i = 0; i < integrationArcStarts.size( ); i++ )
+    {
+        arcPropagationSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >
+                    ( centralBodies, accelerationModelMap, bodiesToIntegrate,
+                      spice_interface::getBodyCartesianStateAtEpoch(
+                          "Moon", "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) ),
+                      integrationArcEnds.at( i ) ) );
+    }
+
+    return std::make_pair( bodyMap, std::make_shared< MultiArcPropagatorSettings< double > >(
+                               arcPropagationSettingsList ) );
+}
+
+//! Test whether parallel propagation of arcs produces results identical to serial propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcDynamics )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define arcs
+    std::vector< double > integrationArcStarts, integrationArcEnds;
+    double arcDuration = 2.0E5;
+    for( unsigned int i = 0; i < 7; i++ )
+    {
+        integrationArcStarts.push_back( 1.0E7 + static_cast< double >( i ) * arcDuration );
+        integrationArcEnds.push_back( 1.0E7 + static_cast< double >( i + 1 ) * arcDuration );
+    }
+
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettings< > >
+            ( integrationArcStarts.at( 0 ), 60.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0, 3600.0, 1.0E-12, 1.0E-12 );
+
+    // Propagate arcs serially
+    std::pair< NamedBodyMap, std::shared_ptr< MultiArcPropagatorSettings< double > > > serialSetup =
+            createParallelMultiArcTestSetup( integrationArcStarts, integrationArcEnds );
+    MultiArcDynamicsSimulator< > serialDynamicsSimulator(
+                serialSetup.first, integratorSettings, serialSetup.second, integrationArcStarts, true, false );
+    BOOST_CHECK_EQUAL( serialDynamicsSimulator.getNumberOfThreads( ), 1 );
+
+    // Propagate arcs in parallel, for various numbers of threads
+    for( unsigned int numberOfThreads = 2; numberOfThreads < 5; numberOfThreads++ )
+    {
+        std::vector< NamedBodyMap > threadBodyMaps;
+        std::vector< std::shared_ptr< PropagatorSettings< double > > > threadPropagatorSettings;
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            std::pair< NamedBodyMap, std::shared_ptr< MultiArcPropagatorSettings< double > > > threadSetup =
+                    createParallelMultiArcTestSetup( integrationArcStarts, integrationArcEnds );
+            threadBodyMaps.push_back( threadSetup.first );
+            threadPropagatorSettings.push_back( threadSetup.second );
+        }
+
+        MultiArcDynamicsSimulator< > parallelDynamicsSimulator(
+                    threadBodyMaps, integratorSettings, threadPropagatorSettings, integrationArcStarts, true, false );
+        BOOST_CHECK_EQUAL( parallelDynamicsSimulator.getNumberOfThreads( ), numberOfThreads );
+
+        // Check whether results are identical
+        std::vector< std::map< double, Eigen::VectorXd > > serialSolution =
+                serialDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        std::vector< std::map< double, Eigen::VectorXd > > parallelSolution =
+                parallelDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+        BOOST_CHECK_EQUAL( serialSolution.size( ), parallelSolution.size( ) );
+
+        for( unsigned int i = 0; i < serialSolution.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( serialSolution.at( i ).size( ), parallelSolution.at( i ).size( ) );
+
+            std::map< double, Eigen::VectorXd >::const_iterator parallelIterator = parallelSolution.at( i ).begin( );
+            for( std::map< double, Eigen::VectorXd >::const_iterator serialIterator = serialSolution.at( i ).begin( );
+                 serialIterator != serialSolution.at( i ).end( ); serialIterator++ )
+            {
+                BOOST_CHECK_EQUAL( serialIterator->first, parallelIterator->first );
+                for( int j = 0; j < 6; j++ )
+                {
+                    BOOST_CHECK_EQUAL( serialIterator->second( j ), parallelIterator->second( j ) );
+                }
+                parallelIterator++;
+            }
+        }
+
+        // Check whether environment of each thread is updated with the results
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            double testTime = integrationArcStarts.at( 3 ) + 0.5 * arcDuration;
+            Eigen::Vector6d stateDifference =
+                    threadBodyMaps.at( i ).at( "Moon" )->getEphemeris( )->getCartesianState( testTime ) -
+                    serialSetup.first.at( "Moon" )->getEphemeris( )->getCartesianState( testTime );
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_SMALL( stateDifference( j ), 1.0E-12 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -411,6 +411,176 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
     }
 }
 
+//! Function to create the environment, propagator settings and estimated parameters for the parallel multi-arc test.
+/*!
+ *  Function to create the environment, propagator settings and estimated parameters for the parallel multi-arc test. All
+ *  ephemerides that are not propagated are interpolated, so that no (non-thread-safe) SPICE calls are made during
+ *  the propagation.
+ */
+void createParallelMultiArcVariationalEquationsTestSetup(
+        const std::vector< double >& arcStartTimes,
+        const std::vector< double >& arcEndTimes,
+        NamedBodyMap& bodyMap,
+        std::shared_ptr< MultiArcPropagatorSettings< double > >& multiArcPropagatorSettings,
+        std::shared_ptr< EstimatableParameterSet< double > >& parametersToEstimate )
+{
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+
+    // Create bodies needed in simulation
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, arcStartTimes.front( ) - 3.6E4, arcEndTimes.back( ) + 3.6E4 );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings[ "Earth" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+
+    bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations between bodies that are to be taken into account.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate, centralBodies;
+    bodiesToIntegrate.push_back( "Moon" );
+    bodiesToIntegrate.push_back( "Earth" );
+    centralBodies.push_back( "Earth" );
+    centralBodies.push_back( "Sun" );
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Create propagator settings
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+    for( unsigned int i = 0; i < arcStartTimes.size( ); i++ )
+    {
+        propagatorSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >
+                    ( centralBodies, accelerationModelMap, bodiesToIntegrate,
+                      getInitialStatesOfBodies( bodiesToIntegrate, centralBodies, bodyMap, arcStartTimes.at( i ) ),
+                      arcEndTimes.at( i ) ) );
+    }
+    multiArcPropagatorSettings = std::make_shared< MultiArcPropagatorSettings< double > >( propagatorSettingsList );
+
+    // Create parameters
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Moon", arcStartTimes, "Earth" ) );
+    parameterNames.push_back(
+                std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Earth", arcStartTimes, "Sun" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parametersToEstimate = createParametersToEstimate( parameterNames, bodyMap );
+}
+
+//! Test whether the parallel propagation of arcs (and their variational equations) reproduces the serial propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcVariationalEquationCalculation )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define arc times.
+    std::vector< double > arcStartTimes, arcEndTimes;
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        arcStartTimes.push_back( 1.0E7 + static_cast< double >( i ) * 3.0E5 );
+        arcEndTimes.push_back( arcStartTimes.back( ) + 2.5E5 );
+    }
+
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< IntegratorSettings< double > >( rungeKutta4, arcStartTimes.front( ), 1800.0 );
+
+    // Propagate serially
+    NamedBodyMap serialBodyMap;
+    std::shared_ptr< MultiArcPropagatorSettings< double > > serialPropagatorSettings;
+    std::shared_ptr< EstimatableParameterSet< double > > serialParametersToEstimate;
+    createParallelMultiArcVariationalEquationsTestSetup(
+                arcStartTimes, arcEndTimes, serialBodyMap, serialPropagatorSettings, serialParametersToEstimate );
+
+    MultiArcVariationalEquationsSolver< double, double > serialVariationalEquationsSolver(
+                serialBodyMap, integratorSettings, serialPropagatorSettings, serialParametersToEstimate, arcStartTimes,
+                true, std::shared_ptr< IntegratorSettings< double > >( ), false, false, true );
+    BOOST_CHECK_EQUAL( serialVariationalEquationsSolver.getNumberOfThreads( ), 1 );
+
+    // Perturb the parameters, and check the results of the re-propagation as well
+    Eigen::VectorXd parameterPerturbation =
+            Eigen::VectorXd::Zero( serialParametersToEstimate->getParameterSetSize( ) );
+    parameterPerturbation( 0 ) = 1.0E3;
+    parameterPerturbation( 16 ) = 0.1;
+    parameterPerturbation( parameterPerturbation.rows( ) - 1 ) = 1.0E9;
+
+    for( unsigned int numberOfThreads = 2; numberOfThreads < 4; numberOfThreads++ )
+    {
+        std::vector< NamedBodyMap > threadBodyMaps( numberOfThreads );
+        std::vector< std::shared_ptr< PropagatorSettings< double > > > threadPropagatorSettings;
+        std::vector< std::shared_ptr< EstimatableParameterSet< double > > > threadParametersToEstimate;
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            std::shared_ptr< MultiArcPropagatorSettings< double > > currentPropagatorSettings;
+            std::shared_ptr< EstimatableParameterSet< double > > currentParametersToEstimate;
+            createParallelMultiArcVariationalEquationsTestSetup(
+                        arcStartTimes, arcEndTimes, threadBodyMaps[ i ], currentPropagatorSettings,
+                        currentParametersToEstimate );
+            threadPropagatorSettings.push_back( currentPropagatorSettings );
+            threadParametersToEstimate.push_back( currentParametersToEstimate );
+        }
+
+        MultiArcVariationalEquationsSolver< double, double > parallelVariationalEquationsSolver(
+                    threadBodyMaps, integratorSettings, threadPropagatorSettings, threadParametersToEstimate,
+                    arcStartTimes, true, true );
+        BOOST_CHECK_EQUAL( parallelVariationalEquationsSolver.getNumberOfThreads( ), numberOfThreads );
+
+        for( unsigned int iteration = 0; iteration < 2; iteration++ )
+        {
+            Eigen::VectorXd currentParameters =
+                    serialParametersToEstimate->template getFullParameterValues< double >( );
+            if( iteration == 0 )
+            {
+                serialVariationalEquationsSolver.integrateVariationalAndDynamicalEquations(
+                            serialPropagatorSettings->getInitialStateList( ), 1 );
+            }
+            else
+            {
+                Eigen::VectorXd perturbedParameters = currentParameters + parameterPerturbation;
+                serialVariationalEquationsSolver.resetParameterEstimate( perturbedParameters );
+                parallelVariationalEquationsSolver.resetParameterEstimate( perturbedParameters );
+            }
+
+            // Compare state transition/sensitivity matrices and states (which are set in the thread's environment)
+            for( unsigned int arc = 0; arc < arcStartTimes.size( ); arc++ )
+            {
+                for( double testTime = arcStartTimes.at( arc ) + 1.0E4; testTime < arcEndTimes.at( arc ) - 1.0E4;
+                     testTime += 4.0E4 )
+                {
+                    Eigen::MatrixXd serialMatrix = serialVariationalEquationsSolver.getStateTransitionMatrixInterface( )->
+                            getCombinedStateTransitionAndSensitivityMatrix( testTime );
+                    Eigen::MatrixXd parallelMatrix = parallelVariationalEquationsSolver.getStateTransitionMatrixInterface( )->
+                            getCombinedStateTransitionAndSensitivityMatrix( testTime );
+                    BOOST_CHECK_EQUAL( ( serialMatrix - parallelMatrix ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+                    for( unsigned int i = 0; i < numberOfThreads; i++ )
+                    {
+                        Eigen::Vector6d stateDifference =
+                                serialBodyMap.at( "Moon" )->getStateInBaseFrameFromEphemeris( testTime ) -
+                                threadBodyMaps.at( i ).at( "Moon" )->getStateInBaseFrameFromEphemeris( testTime );
+                        BOOST_CHECK_EQUAL( stateDifference.cwiseAbs( ).maxCoeff( ), 0.0 );
+                    }
+                }
+            }
+
+            // Reset serial solver to nominal parameters
+            if( iteration == 1 )
+            {
+                serialVariationalEquationsSolver.resetParameterEstimate( currentParameters, false );
+            }
+        }
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
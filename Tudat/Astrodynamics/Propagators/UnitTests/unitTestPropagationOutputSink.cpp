@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_output_sink )
+
+//! State derivative of harmonic oscillator, used to test streaming of propagation output.
+Eigen::VectorXd getHarmonicOscillatorStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 2 );
+    stateDerivative( 0 ) = state( 1 );
+    stateDerivative( 1 ) = -state( 0 );
+    return stateDerivative;
+}
+
+//! Test whether chunks written to a binary file are read back correctly
+BOOST_AUTO_TEST_CASE( testBinaryFileOutputSink )
+{
+    std::string fileName = "propagationOutputSinkTest.dat";
+    std::map< int, std::string > dependentVariableIds;
+    dependentVariableIds[ 0 ] = "Test variable A";
+    dependentVariableIds[ 2 ] = "Test variable B";
+
+    std::vector< double > expectedTimes;
+    Eigen::MatrixXd expectedStates = Eigen::MatrixXd::Random( 6, 25 );
+    Eigen::MatrixXd expectedDependentVariables = Eigen::MatrixXd::Random( 3, 25 );
+    for( int i = 0; i < 25; i++ )
+    {
+        expectedTimes.push_back( 10.0 * static_cast< double >( i ) );
+    }
+
+    {
+        BinaryFileOutputSink outputSink( fileName, 10 );
+        outputSink.setDependentVariableIds( dependentVariableIds );
+
+        // Write results in three unequal chunks
+        outputSink.writeChunk( std::vector< double >( expectedTimes.begin( ), expectedTimes.begin( ) + 10 ),
+                               expectedStates.leftCols( 10 ), expectedDependentVariables.leftCols( 10 ) );
+        outputSink.writeChunk( std::vector< double >( expectedTimes.begin( ) + 10, expectedTimes.begin( ) + 20 ),
+                               expectedStates.middleCols( 10, 10 ), expectedDependentVariables.middleCols( 10, 10 ) );
+        BOOST_CHECK_THROW( outputSink.writeChunk( std::vector< double >( 2, 0.0 ), Eigen::MatrixXd::Zero( 5, 2 ),
+                                                  Eigen::MatrixXd::Zero( 3, 2 ) ), std::runtime_error );
+        outputSink.writeChunk( std::vector< double >( expectedTimes.begin( ) + 20, expectedTimes.end( ) ),
+                               expectedStates.rightCols( 5 ), expectedDependentVariables.rightCols( 5 ) );
+        outputSink.finishOutput( );
+        BOOST_CHECK_EQUAL( outputSink.getNumberOfWrittenEntries( ), 25 );
+    }
+
+    std::vector< double > times;
+    Eigen::MatrixXd states, dependentVariables;
+    std::string columnDescriptions = readBinaryPropagationOutputFile(
+                fileName, times, states, dependentVariables );
+    std::remove( fileName.c_str( ) );
+
+    BOOST_CHECK_EQUAL( times.size( ), 25 );
+    BOOST_CHECK_EQUAL( states.rows( ), 6 );
+    BOOST_CHECK_EQUAL( dependentVariables.rows( ), 3 );
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( times.at( i ), expectedTimes.at( i ) );
+    }
+    BOOST_CHECK_EQUAL( ( states - expectedStates ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( dependentVariables - expectedDependentVariables ).norm( ), 0.0 );
+    BOOST_CHECK( columnDescriptions.find( "7 2 Test variable A" ) != std::string::npos );
+    BOOST_CHECK( columnDescriptions.find( "9 1 Test variable B" ) != std::string::npos );
+}
+
+//! Test whether output streamed during the propagation is identical to the output stored in memory
+BOOST_AUTO_TEST_CASE( testStreamedPropagationOutput )
+{
+    for( double direction : { 1.0, -1.0 } )
+    {
+        Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 2 );
+        initialState( 0 ) = 1.0;
+
+        std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                    0.0, direction * 0.1, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                    1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+        std::function< Eigen::VectorXd( ) > dependentVariableFunction = [ ]( ){ return Eigen::VectorXd::Constant( 1, 3.0 ); };
+
+        // Propagate without output sink
+        std::map< double, Eigen::VectorXd > expectedSolution, expectedDependentVariables;
+        std::map< double, double > computationTimes;
+        EquationIntegrationInterface< Eigen::VectorXd, double >::integrateEquations(
+                    &getHarmonicOscillatorStateDerivative, expectedSolution, initialState, integratorSettings,
+                    std::make_shared< FixedTimePropagationTerminationCondition >(
+                        direction * 100.0, direction > 0.0, true ),
+                    expectedDependentVariables, computationTimes, dependentVariableFunction );
+
+        // Propagate with output sink, storing the streamed output
+        unsigned int chunkSize = 50;
+        std::map< double, Eigen::VectorXd > streamedSolution, streamedDependentVariables;
+        unsigned int maximumChunkSize = 0;
+        bool isOutputFinished = false;
+        std::shared_ptr< CallbackOutputSink > outputSink = std::make_shared< CallbackOutputSink >(
+                    [ & ]( const std::vector< double >& times, const Eigen::MatrixXd& states,
+                           const Eigen::MatrixXd& dependentVariables )
+        {
+            maximumChunkSize = std::max< unsigned int >( maximumChunkSize, times.size( ) );
+            for( unsigned int i = 0; i < times.size( ); i++ )
+            {
+                streamedSolution[ times.at( i ) ] = states.col( i );
+                streamedDependentVariables[ times.at( i ) ] = dependentVariables.col( i );
+            }
+        }, chunkSize, [ & ]( ){ isOutputFinished = true; } );
+
+        utilities::ColumnarStateHistory< double, double > solutionHistory, dependentVariableHistory,
+                computationTimeHistory;
+        EquationIntegrationInterface< Eigen::VectorXd, double >::integrateEquations(
+                    &getHarmonicOscillatorStateDerivative, solutionHistory, initialState, integratorSettings,
+                    std::make_shared< FixedTimePropagationTerminationCondition >(
+                        direction * 100.0, direction > 0.0, true ),
+                    dependentVariableHistory, computationTimeHistory, dependentVariableFunction,
+                    std::function< void( Eigen::VectorXd& ) >( ), TUDAT_NAN, std::chrono::steady_clock::now( ),
+                    outputSink );
+
+        // Check that memory use was bounded, and that the full output was streamed
+        BOOST_CHECK( expectedSolution.size( ) > 5 * chunkSize );
+        BOOST_CHECK( solutionHistory.size( ) <= chunkSize + 1 );
+        BOOST_CHECK( dependentVariableHistory.size( ) <= chunkSize + 1 );
+        BOOST_CHECK( computationTimeHistory.size( ) <= chunkSize + 1 );
+        BOOST_CHECK( maximumChunkSize <= chunkSize + 1 );
+        BOOST_CHECK_EQUAL( isOutputFinished, true );
+        BOOST_CHECK_EQUAL( outputSink->getNumberOfWrittenEntries( ), expectedSolution.size( ) );
+
+        BOOST_CHECK_EQUAL( streamedSolution.size( ), expectedSolution.size( ) );
+        BOOST_CHECK_EQUAL( streamedDependentVariables.size( ), expectedDependentVariables.size( ) );
+        for( auto solutionIterator : expectedSolution )
+        {
+            BOOST_CHECK_EQUAL( streamedSolution.count( solutionIterator.first ), 1 );
+            if( streamedSolution.count( solutionIterator.first ) > 0 )
+            {
+                BOOST_CHECK_EQUAL(
+                            ( streamedSolution.at( solutionIterator.first ) - solutionIterator.second ).norm( ), 0.0 );
+            }
+        }
+
+        // Check exact termination on final entry
+        double finalTime = ( direction > 0.0 ) ? streamedSolution.rbegin( )->first : streamedSolution.begin( )->first;
+        BOOST_CHECK_SMALL( std::fabs( finalTime - direction * 100.0 ), std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_EQUAL( solutionHistory.getLastTime( ), finalTime );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -51,7 +51,7 @@ public:
     void calculateSystemStateDerivative(
             const TimeType time,
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& stateOfSystemToBeIntegrated,
-            Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative )
+            Eigen::Ref< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative )
     {
         stateDerivative = stateDerivativeModel_( time, stateOfSystemToBeIntegrated );
 
@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/columnarStateHistory.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
@@ -145,76 +146,13 @@ public:
      */
     StateType computeStateDerivative( const TimeType time, const StateType& state )
     {
-//        std::cout << "Computing state derivative: " <<time<<" "<<state.transpose( ) << std::endl;
-
         // Initialize state derivative
         if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
         {
             stateDerivative_.resize( state.rows( ), state.cols( ) );
         }
 
-        // If dynamical equations are integrated, update the environment with the current state.
-        if( evaluateDynamicsEquations_ )
-        {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-            {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
-                }
-            }
-
-            convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
-            environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
-                                        integratedStatesFromEnvironment_ );
-        }
-        else
-        {
-            environmentUpdateFunction_(
-                        time, std::unordered_map<
-                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
-                        integratedStatesFromEnvironment_ );
-        }
-
-        if( evaluateVariationalEquations_ )
-        {
-            variationalEquations_->clearPartials( );
-        }
-
-        // If dynamical equations are integrated, evaluate dynamics state derivatives.
-        std::pair< int, int > currentIndices;
-        if( evaluateDynamicsEquations_ )
-        {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-            {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Update state derivative models
-                    stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
-                }
-            }
-
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-            {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Evaluate and set current dynamical state derivative
-                    currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
-                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
-                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
-                }
-            }
-        }
+        computeDynamicsStateDerivative( time, state, stateDerivative_ );
 
         // If variational equations are to be integrated: evaluate and set.
         if( evaluateVariationalEquations_ )
@@ -226,12 +164,37 @@ public:
                         stateDerivative_.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ) );
         }
 
-        // Update counters
-        functionEvaluationCounter_++;
-        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
-
         return stateDerivative_;
+    }
 
+    //! Function to calculate the system state derivative, writing it into an existing vector
+    /*!
+     *  Function to calculate the system state derivative, writing it into an existing vector (see computeStateDerivative).
+     *  The state derivative models read from the given state and write directly into the given state derivative, so that
+     *  (once the state derivative has the correct size) no state derivative vector is created or copied for each call. This
+     *  function is passed to the numerical integrator as its in-place state derivative function
+     *  (see NumericalIntegrator::setStateDerivativeInPlaceFunction). It can only be used when propagating the dynamics
+     *  without the variational equations.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \param stateDerivative Calculated state derivative (returned by reference).
+     */
+    void computeStateDerivativeInPlace( const TimeType time,
+                                        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& state,
+                                        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& stateDerivative )
+    {
+        if( evaluateVariationalEquations_ )
+        {
+            throw std::runtime_error(
+                        "Error when computing state derivative in place, variational equations are not supported" );
+        }
+
+        if( stateDerivative.rows( ) != state.rows( ) )
+        {
+            stateDerivative.resize( state.rows( ) );
+        }
+
+        computeDynamicsStateDerivative( time, state, stateDerivative );
     }
 
     //! Function to calculate the system state derivative with double precision, regardless of template arguments.
@@ -355,6 +318,31 @@ public:
         }
     }
 
+    //! Function to convert a columnar state history from propagator-specific form to the conventional form.
+    /*!
+     * Function to convert a columnar state history from propagator-specific form to the conventional form
+     * (not necessarily in inertial frame).
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     *        numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            utilities::ColumnarStateHistory< TimeType, StateScalarType >& convertedSolution,
+            const utilities::ColumnarStateHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( );
+        for( unsigned int i = 0; i < rawSolution.size( ); i++ )
+        {
+            convertedSolution.addEntry(
+                        rawSolution.getTime( i ), convertToOutputSolution( rawSolution.getEntry( i ), rawSolution.getTime( i ) ) );
+            if( i == 0 )
+            {
+                convertedSolution.reserve( rawSolution.size( ) );
+            }
+        }
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
@@ -577,6 +565,88 @@ public:
 
 private:
 
+    //! Function to update the environment and calculate the dynamical part of the system state derivative
+    /*!
+     *  Function to update the environment to the current state, and calculate the dynamical part of the system state
+     *  derivative (see computeStateDerivative). The variational equations are not evaluated by this function, but
+     *  partials are cleared if they are to be evaluated.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \param stateDerivative State derivative, of the same size as the state, in which the dynamical part is set
+     *  (returned by reference).
+     */
+    void computeDynamicsStateDerivative( const TimeType time, const Eigen::Ref< const StateType >& state,
+                                         Eigen::Ref< StateType > stateDerivative )
+    {
+        // If dynamical equations are integrated, update the environment with the current state.
+        if( evaluateDynamicsEquations_ )
+        {
+            // Iterate over all types of equations.
+            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+                 stateDerivativeModelsIterator_++ )
+            {
+                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                {
+                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
+                }
+            }
+
+            convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
+            environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
+                                        integratedStatesFromEnvironment_ );
+        }
+        else
+        {
+            environmentUpdateFunction_(
+                        time, std::unordered_map<
+                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
+                        integratedStatesFromEnvironment_ );
+        }
+
+        if( evaluateVariationalEquations_ )
+        {
+            variationalEquations_->clearPartials( );
+        }
+
+        // If dynamical equations are integrated, evaluate dynamics state derivatives.
+        std::pair< int, int > currentIndices;
+        if( evaluateDynamicsEquations_ )
+        {
+            // Iterate over all types of equations.
+            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+                 stateDerivativeModelsIterator_++ )
+            {
+                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                {
+                    // Update state derivative models
+                    stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
+                }
+            }
+
+            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+                 stateDerivativeModelsIterator_++ )
+            {
+                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                {
+                    // Evaluate and set current dynamical state derivative
+                    currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
+
+                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
+                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
+                                stateDerivative.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
+                }
+            }
+        }
+
+        // Update counters
+        functionEvaluationCounter_++;
+        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
+    }
+
+
     //! Function to convert the to the conventional form in the global frame per dynamics type.
     /*!
      * Function to convert the propagator-specific form of the state to the conventional form in the global frame, split
@@ -592,7 +662,7 @@ private:
      * matrices
      */
     void convertCurrentStateToGlobalRepresentationPerType(
-            const StateType& state, const TimeType& time, const bool stateIncludesVariationalState )
+            const Eigen::Ref< const StateType >& state, const TimeType& time, const bool stateIncludesVariationalState )
     {
         int startColumn = 0;
         if( stateIncludesVariationalState )
@@ -34,6 +34,38 @@ Eigen::VectorXd, double, double >(
         const double printInterval,
         const std::chrono::steady_clock::time_point initialClockTime );
 
+template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::MatrixXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::ColumnarStateHistory< double, double >& solutionHistory,
+        utilities::ColumnarStateHistory< double, double >& dependentVariableHistory,
+        utilities::ColumnarStateHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd&, const double ) > stateOutputConversionFunction );
+
+template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::VectorXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::ColumnarStateHistory< double, double >& solutionHistory,
+        utilities::ColumnarStateHistory< double, double >& dependentVariableHistory,
+        utilities::ColumnarStateHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd&, const double ) > stateOutputConversionFunction );
+
 } // namespace propagators
 
 } // namespace tudat
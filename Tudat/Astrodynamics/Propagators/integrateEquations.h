@@ -21,7 +21,9 @@
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Basics/columnarStateHistory.h"
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
@@ -66,13 +68,66 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
     return dependentVariableError;
 }
 
+//! Function to determine, for a given time step, the error in termination dependent variable from the integrator's dense output
+/*!
+ *  Function to determine, for a given time step w.r.t. the start of the last integration step, the error in termination
+ *  dependent variable, using the continuous extension (dense output) of the last integration step. No integration step is
+ *  performed: the state is interpolated, after which the state derivative function is called once to update the
+ *  environment from which the dependent variable is retrieved. This function is used as input for the root finder when the
+ *  propagation must terminate exactly on a dependent variable value, and dense output is used to locate the termination.
+ *  \param timeStep Time step w.r.t. the start of the last integration step at which the error is to be computed
+ *  \param integrator Numerical integrator used for propagation, for which dense output of the last step must be available
+ *  \param dependentVariableTerminationCondition Settings used to determine value/type of dependent variable at which propagation
+ *  is to terminate
+ *  \param stepStartTime Independent variable value at the start of the last integration step
+ *  \return The difference between the interpolated and required value of the termination dependent variable
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+TimeStepType getTerminationDependentVariableErrorFromDenseOutput(
+        TimeStepType timeStep,
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > >
+        integrator,
+        const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition,
+        const TimeType stepStartTime )
+{
+    // Interpolate state, and update environment to retrieve value of dependent variable
+    TimeType interpolationTime = stepStartTime + timeStep;
+    integrator->getStateDerivativeFunction( )(
+                interpolationTime, integrator->getDenseOutputState( interpolationTime ) );
+
+    return static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+}
+
+//! Function to check whether the dense output of the integrator can be used to locate the exact final condition
+/*!
+ * Function to check whether the dense output of the integrator can be used to locate the exact final condition, which
+ * requires the dense output to be available, and the last integration step to be the one in which the termination condition
+ * was first exceeded (which may not be the case if the integrator has been rolled back and re-stepped when evaluating
+ * another constituent of a hybrid condition).
+ * \param integrator Numerical integrator that is used for propagation.
+ * \param secondToLastTime Second to last time (e.g. last time at which integration did not exceed termination condition)
+ * \param lastTime Time at which integration first exceeded termination condition
+ * \return True if the dense output of the last step can be used to locate the termination condition
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+bool canDenseOutputBeUsedForExactTermination(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > >
+        integrator,
+        const TimeType secondToLastTime,
+        const TimeType lastTime )
+{
+    return integrator->isDenseOutputAvailable( ) &&
+            ( integrator->getPreviousIndependentVariable( ) == secondToLastTime ) &&
+            ( integrator->getCurrentIndependentVariable( ) == lastTime );
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition.
  * Determines the time step that is to be taken by using a root finder, and returns (by reference) the converged final time
  * and state.
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is rolled
- * back to the secondToLastTime/secondToLastState
+ * back to the secondToLastTime/secondToLastState, unless dense output is used (see useDenseOutput).
  * \param dependentVariableTerminationCondition Termination condition that is to be used
  * \param secondToLastTime Second to last time (e.g. last time at which integration did not exceed termination condition)
  * \param lastTime Time at which integration first exceeded termination condition
@@ -80,6 +135,10 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
  * \param lastState State at time where integration first exceeded termination condition
  * \param endTime Time at which exact termination condition is met (returned by reference).
  * \param endState State at time where exact termination condition is met (returned by reference).
+ * \param useDenseOutput Boolean denoting whether the dependent variable is evaluated on the dense output of the last
+ * integration step (if true), in which case the integrator is not rolled back on input, and no integration steps are taken.
+ * If false, the integrator is rolled back to the secondToLastTime/secondToLastState on input, and the last step is re-taken
+ * for each root finder iteration.
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
 void getFinalStateForExactDependentVariableTerminationCondition(
@@ -91,14 +150,25 @@ void getFinalStateForExactDependentVariableTerminationCondition(
         const StateType& secondToLastState,
         const StateType& lastState,
         TimeType& endTime,
-        StateType& endState )
+        StateType& endState,
+        const bool useDenseOutput = false )
 {
     TUDAT_UNUSED_PARAMETER( secondToLastState );
 
     // Function for which the root (zero value) occurs at the required end time/state
-    std::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction =
-            std::bind( &getTerminationDependentVariableErrorForGivenTimeStep< StateType, TimeType, TimeStepType >, std::placeholders::_1,
-                       integrator, dependentVariableTerminationCondition );
+    std::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction;
+    if( useDenseOutput )
+    {
+        dependentVariableErrorFunction =
+                std::bind( &getTerminationDependentVariableErrorFromDenseOutput< StateType, TimeType, TimeStepType >,
+                           std::placeholders::_1, integrator, dependentVariableTerminationCondition, secondToLastTime );
+    }
+    else
+    {
+        dependentVariableErrorFunction =
+                std::bind( &getTerminationDependentVariableErrorForGivenTimeStep< StateType, TimeType, TimeStepType >,
+                           std::placeholders::_1, integrator, dependentVariableTerminationCondition );
+    }
 
     // Create root finder.
     bool increasingTime = static_cast< double >( lastTime - secondToLastTime ) > 0.0;
@@ -129,8 +199,16 @@ void getFinalStateForExactDependentVariableTerminationCondition(
                     std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
                         dependentVariableErrorFunction ), ( lastTime - secondToLastTime ) / 2.0 );
 
-        endState = integrator->performIntegrationStep( finalTimeStep );
-        endTime = integrator->getCurrentIndependentVariable( );
+        if( useDenseOutput )
+        {
+            endTime = secondToLastTime + finalTimeStep;
+            endState = integrator->getDenseOutputState( endTime );
+        }
+        else
+        {
+            endState = integrator->performIntegrationStep( finalTimeStep );
+            endTime = integrator->getCurrentIndependentVariable( );
+        }
     }
     // If dependent variable has no root in given interval, set end time and state at NaN
     catch( std::runtime_error& caughtException )
@@ -281,12 +359,22 @@ void getFinalStateForExactTerminationCondition(
         std::shared_ptr< FixedTimePropagationTerminationCondition > timeTerminationCondition =
                 std::dynamic_pointer_cast< FixedTimePropagationTerminationCondition >( terminationCondition );
 
-        // Determine final time step and propagate
-        TimeStepType finalTimeStep = timeTerminationCondition->getStopTime( ) - secondToLastTime;
+        if( timeTerminationCondition->getUseDenseOutputForExactTermination( ) &&
+                canDenseOutputBeUsedForExactTermination( integrator, secondToLastTime, lastTime ) )
+        {
+            // Interpolate state at final time
+            endTime = static_cast< TimeType >( timeTerminationCondition->getStopTime( ) );
+            endState = integrator->getDenseOutputState( endTime );
+        }
+        else
+        {
+            // Determine final time step and propagate
+            TimeStepType finalTimeStep = timeTerminationCondition->getStopTime( ) - secondToLastTime;
 
-        integrator->rollbackToPreviousState( );
-        endState = integrator->performIntegrationStep( finalTimeStep );
-        endTime = integrator->getCurrentIndependentVariable( );
+            integrator->rollbackToPreviousState( );
+            endState = integrator->performIntegrationStep( finalTimeStep );
+            endTime = integrator->getCurrentIndependentVariable( );
+        }
 
         break;
     }
@@ -301,13 +389,18 @@ void getFinalStateForExactTerminationCondition(
     }
     case dependent_variable_stopping_condition:
     {
-        integrator->rollbackToPreviousState( );
+        bool useDenseOutput = terminationCondition->getUseDenseOutputForExactTermination( ) &&
+                canDenseOutputBeUsedForExactTermination( integrator, secondToLastTime, lastTime );
+        if( !useDenseOutput )
+        {
+            integrator->rollbackToPreviousState( );
+        }
 
         std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition =
                 std::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >( terminationCondition );
         getFinalStateForExactDependentVariableTerminationCondition(
                     integrator, dependentVariableTerminationCondition, secondToLastTime, lastTime,
-                    secondToLastState, lastState, endTime, endState );
+                    secondToLastState, lastState, endTime, endState, useDenseOutput );
 
         break;
     }
@@ -341,23 +434,21 @@ void getFinalStateForExactTerminationCondition(
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is at
  * the final time/state encountered by the propagation
  * \param propagationTerminationCondition Termination condition that is to be used
- * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
- * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
- * (time as key; returned by reference)
+ * \param solutionHistory History of state variables that are to be saved, in the order in which they were computed
+ * (returned by reference)
+ * \param dependentVariableHistory History of dependent variables that are to be saved, in the order in which they were
+ * computed (returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
 void propagateToExactTerminationCondition(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-        const TimeStepType timeStep,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        utilities::ColumnarStateHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        utilities::ColumnarStateHistory< TimeType, double >& dependentVariableHistory,
         const double currentCpuTime )
 {
     // Turn off step size control
@@ -374,41 +465,27 @@ void propagateToExactTerminationCondition(
                 integrator->getCurrentState( ),
                 endTime, endState );
 
-    // Check if any dependent variables are saved. If so, remove last entry
+    // Check if any dependent variables are saved. If so, remove last entry (entries are stored in order of computation,
+    // so the last entry is the one last added, for both forward and backward propagation)
     bool recomputeDependentVariables = false;
     if( dependentVariableHistory.size( ) > 0 )
     {
-        if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+        if( dependentVariableHistory.getLastTime( ) == solutionHistory.getLastTime( ) )
         {
-            if( timeStep > 0 )
-            {
-                dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-            }
-            else
-            {
-                dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-            }
+            dependentVariableHistory.removeLastEntry( );
             recomputeDependentVariables = true;
         }
     }
 
     // Remove state entry last added, and enter converged final state
-    if( timeStep > 0 )
-    {
-        solutionHistory.erase( std::prev( solutionHistory.end() ) );
-        solutionHistory[ endTime ] = endState;
-    }
-    else
-    {
-        solutionHistory.erase( solutionHistory.begin( ) );
-        solutionHistory[ endTime ] = endState;
-    }
+    solutionHistory.removeLastEntry( );
+    solutionHistory.addEntry( endTime, endState );
 
     // Recompute final dependent variables, if required
     if( recomputeDependentVariables )
     {
         integrator->getStateDerivativeFunction( )( endTime, endState );
-        dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+        dependentVariableHistory.addEntry( endTime, dependentVariableFunction( ) );
 
         // Check stopping conditions to be able to save details
         propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -418,6 +495,79 @@ void propagateToExactTerminationCondition(
     integrator->setStepSizeControl( true );
 }
 
+//! Function to write the first entries of the saved propagation results to an output sink
+/*!
+ *  Function to write the first entries of the saved propagation results to an output sink, converting the states to
+ *  double precision (and, optionally, to another representation), and removing the written entries from memory if
+ *  required.
+ *  \param outputSink Output sink to which the entries are to be written
+ *  \param solutionHistory History of saved states (entries removed if removeWrittenEntries is true)
+ *  \param dependentVariableHistory History of saved dependent variables, empty if none are saved (entries removed if
+ *  removeWrittenEntries is true)
+ *  \param numberOfEntries Number of entries (from the start of the histories) that are to be written
+ *  \param stateOutputConversionFunction Function to convert a saved state to the output representation (if empty, the
+ *  saved state is written directly)
+ *  \param removeWrittenEntries Boolean denoting whether the written entries are to be removed from the histories
+ */
+template< typename TimeType, typename StateScalarType >
+void writeSavedEntriesToOutputSink(
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        utilities::ColumnarStateHistory< TimeType, StateScalarType >& solutionHistory,
+        utilities::ColumnarStateHistory< TimeType, double >& dependentVariableHistory,
+        const unsigned int numberOfEntries,
+        const std::function< Eigen::VectorXd( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&, const TimeType ) >
+        stateOutputConversionFunction,
+        const bool removeWrittenEntries )
+{
+    if( dependentVariableHistory.size( ) > 0 && dependentVariableHistory.size( ) < numberOfEntries )
+    {
+        throw std::runtime_error( "Error when writing propagation results to output sink, dependent variable history "
+                                  "is inconsistent with state history" );
+    }
+
+    // Retrieve times and (converted) states
+    std::vector< double > times( numberOfEntries );
+    Eigen::MatrixXd states;
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        times[ i ] = static_cast< double >( solutionHistory.getTime( i ) );
+        if( stateOutputConversionFunction != nullptr )
+        {
+            Eigen::VectorXd convertedState = stateOutputConversionFunction(
+                        solutionHistory.getStateBlock( ).col( i ), solutionHistory.getTime( i ) );
+            if( i == 0 )
+            {
+                states.resize( convertedState.rows( ), numberOfEntries );
+            }
+            states.col( i ) = convertedState;
+        }
+    }
+    if( stateOutputConversionFunction == nullptr )
+    {
+        states = solutionHistory.getStateBlock( ).leftCols( numberOfEntries ).template cast< double >( );
+    }
+
+    // Write entries to sink
+    if( dependentVariableHistory.size( ) > 0 )
+    {
+        outputSink->writeChunk( times, states, dependentVariableHistory.getStateBlock( ).leftCols( numberOfEntries ) );
+    }
+    else
+    {
+        outputSink->writeChunk( times, states, Eigen::MatrixXd::Zero( 0, numberOfEntries ) );
+    }
+
+    // Remove written entries
+    if( removeWrittenEntries )
+    {
+        solutionHistory.removeFirstEntries( numberOfEntries );
+        if( dependentVariableHistory.size( ) > 0 )
+        {
+            dependentVariableHistory.removeFirstEntries( numberOfEntries );
+        }
+    }
+}
+
 //! Function to numerically integrate a given first order differential equation
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
@@ -425,12 +575,12 @@ void propagateToExactTerminationCondition(
  *  \param integrator Numerical integrator used for propagation
  *  \param initialTimeStep Time step to use for first step of numerical integration
  *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
- *  \param solutionHistory History of state variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
- *  as map (time as key; returned by reference)
+ *  \param solutionHistory History of state variables that are to be saved, stored contiguously in the order in which they
+ *  are computed (returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved, stored contiguously in the order in
+ *  which they are computed (returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved, stored
+ *  contiguously in the order in which they are computed (returned by reference)
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  *  derivative model).
  *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
@@ -439,6 +589,12 @@ void propagateToExactTerminationCondition(
  *  \param printInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param outputSink Output sink to which the saved results are streamed during the propagation (default none). If
+ *  provided, the saved entries are written to the sink (and removed from memory) whenever more than the sink's chunk
+ *  size are stored, and the remaining entries are written upon termination. In that case, the histories only contain
+ *  the entries of the last chunk upon return (and the computation time history only its last entries).
+ *  \param stateOutputConversionFunction Function to convert a saved state to the representation that is written to the
+ *  output sink (default none, in which case the saved state is written directly).
  *  \return Event that triggered the termination of the propagation
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -446,14 +602,17 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const TimeStepType initialTimeStep,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-        std::map< TimeType, double >& cumulativeComputationTimeHistory,
+        utilities::ColumnarStateHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        utilities::ColumnarStateHistory< TimeType, double >& dependentVariableHistory,
+        utilities::ColumnarStateHistory< TimeType, double >& cumulativeComputationTimeHistory,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
         const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
         const int saveFrequency = TUDAT_NAN,
         const TimeType printInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const std::shared_ptr< PropagationOutputSink > outputSink = nullptr,
+        const std::function< Eigen::VectorXd( const Eigen::Matrix< typename StateType::Scalar, Eigen::Dynamic, 1 >&,
+                                              const TimeType ) > stateOutputConversionFunction = nullptr )
 {
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason;
 
@@ -464,20 +623,20 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
     // Initialization of numerical solutions for variational equations
     solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    solutionHistory.addEntry( currentTime, newState );
 
     dependentVariableHistory.clear( );
     if( !( dependentVariableFunction == nullptr ) )
     {
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        dependentVariableHistory.addEntry( currentTime, dependentVariableFunction( ) );
     }
 
     // CPU time
     cumulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-    cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    cumulativeComputationTimeHistory.addEntry( currentTime, currentCPUTime );
 
     // Set initial time step and total integration time.
     TimeStepType timeStep = initialTimeStep;
@@ -523,17 +682,28 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
-                // Save integration result in map
+                // Save integration result
                 saveIndex++;
                 saveIndex = saveIndex % saveFrequency;
                 if( saveIndex == 0 )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    solutionHistory.addEntry( currentTime, newState );
 
                     if( !( dependentVariableFunction == nullptr ) )
                     {
                         integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        dependentVariableHistory.addEntry( currentTime, dependentVariableFunction( ) );
+                    }
+
+                    // Write saved entries to output sink, retaining the last entry (which may be modified when
+                    // terminating exactly on the final condition)
+                    if( outputSink != nullptr && solutionHistory.size( ) > outputSink->getChunkSize( ) )
+                    {
+                        writeSavedEntriesToOutputSink< TimeType, typename StateType::Scalar >(
+                                    outputSink, solutionHistory, dependentVariableHistory, solutionHistory.size( ) - 1,
+                                    stateOutputConversionFunction, true );
+                        cumulativeComputationTimeHistory.removeFirstEntries(
+                                    cumulativeComputationTimeHistory.size( ) - 1 );
                     }
                 }
             }
@@ -548,7 +718,7 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-            cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            cumulativeComputationTimeHistory.addEntry( currentTime, currentCPUTime );
 
             // Print solutions
             if( printInterval == printInterval )
@@ -568,8 +738,7 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 if( propagationTerminationCondition->getTerminateExactlyOnFinalCondition( ) )
                 {
                     propagateToExactTerminationCondition(
-                                integrator, propagationTerminationCondition,
-                                timeStep, dependentVariableFunction,
+                                integrator, propagationTerminationCondition, dependentVariableFunction,
                                 solutionHistory, dependentVariableHistory, currentCPUTime );
                 }
 
@@ -607,6 +776,71 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     }
     while( !breakPropagation );
 
+    // Write remaining entries to output sink
+    if( outputSink != nullptr )
+    {
+        writeSavedEntriesToOutputSink< TimeType, typename StateType::Scalar >(
+                    outputSink, solutionHistory, dependentVariableHistory, solutionHistory.size( ),
+                    stateOutputConversionFunction, false );
+        outputSink->finishOutput( );
+    }
+
+    return propagationTerminationReason;
+}
+
+//! Function to numerically integrate a given first order differential equation, with results saved in maps
+/*!
+ *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+ *  a single independent variable and the current state. The results are stored contiguously during the propagation, and
+ *  are converted to maps upon completion.
+ *  \param integrator Numerical integrator used for propagation
+ *  \param initialTimeStep Time step to use for first step of numerical integration
+ *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+ *  \param solutionHistory History of state variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
+ *  as map (time as key; returned by reference)
+ *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+ *  derivative model).
+ *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
+ *  steps, with n = saveFrequency).
+ *  \param printInterval Frequency with which to print progress to console (nan = never).
+ *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+ *  By default now(), i.e. the moment at which this function is called.
+ *  \return Event that triggered the termination of the propagation
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const TimeStepType initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        std::map< TimeType, StateType >& solutionHistory,
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        std::map< TimeType, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+        const int saveFrequency = TUDAT_NAN,
+        const TimeType printInterval = TUDAT_NAN,
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+{
+    utilities::ColumnarStateHistory< TimeType, typename StateType::Scalar > columnarSolutionHistory;
+    utilities::ColumnarStateHistory< TimeType, double > columnarDependentVariableHistory;
+    utilities::ColumnarStateHistory< TimeType, double > columnarComputationTimeHistory;
+
+    std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason =
+            integrateEquationsFromIntegrator< StateType, TimeType, TimeStepType >(
+                integrator, initialTimeStep, propagationTerminationCondition, columnarSolutionHistory,
+                columnarDependentVariableHistory, columnarComputationTimeHistory, dependentVariableFunction,
+                statePostProcessingFunction, saveFrequency, printInterval, initialClockTime );
+
+    columnarSolutionHistory.fillMap( solutionHistory );
+    columnarSolutionHistory.clear( );
+    columnarDependentVariableHistory.fillMap( dependentVariableHistory );
+    columnarComputationTimeHistory.fillMap( cumulativeComputationTimeHistory );
+
     return propagationTerminationReason;
 }
 
@@ -639,6 +873,38 @@ Eigen::VectorXd, double, double >(
         const double printInterval,
         const std::chrono::steady_clock::time_point initialClockTime );
 
+extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::MatrixXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::ColumnarStateHistory< double, double >& solutionHistory,
+        utilities::ColumnarStateHistory< double, double >& dependentVariableHistory,
+        utilities::ColumnarStateHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd&, const double ) > stateOutputConversionFunction );
+
+extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::VectorXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::ColumnarStateHistory< double, double >& solutionHistory,
+        utilities::ColumnarStateHistory< double, double >& dependentVariableHistory,
+        utilities::ColumnarStateHistory< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::shared_ptr< PropagationOutputSink > outputSink,
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd&, const double ) > stateOutputConversionFunction );
+
 
 //! Interface class for integrating some state derivative function.
 /*!
@@ -686,6 +952,52 @@ public:
             const TimeType printInterval = TUDAT_NAN,
             const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) );
 
+    //! Function to numerically integrate a given first order differential equation, with results in columnar storage
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. The results are stored in contiguous (columnar) histories,
+     *  instead of maps.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states, stored contiguously in order of computation (returned by
+     *  reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved, stored contiguously in order of
+     *  computation (returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved, stored
+     *  contiguously in order of computation (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param outputSink Output sink to which the saved results are streamed during the propagation (default none).
+     *  \param stateOutputConversionFunction Function to convert a saved state to the representation that is written to
+     *  the output sink (default none).
+     *  \param stateDerivativeInPlaceFunction Function computing the same state derivative as stateDerivativeFunction,
+     *  writing it into an existing object, used by integrators that support it (default none, see
+     *  NumericalIntegrator::setStateDerivativeInPlaceFunction).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
+            utilities::ColumnarStateHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            utilities::ColumnarStateHistory< TimeType, double >& dependentVariableHistory,
+            utilities::ColumnarStateHistory< TimeType, double >& cumulativeComputationTimeHistory,
+            const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const TimeType printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationOutputSink > outputSink = nullptr,
+            const std::function< Eigen::VectorXd( const Eigen::Matrix< typename StateType::Scalar, Eigen::Dynamic, 1 >&,
+                                                  const TimeType ) > stateOutputConversionFunction = nullptr,
+            const std::function< void( const TimeType, const StateType&, StateType& ) > stateDerivativeInPlaceFunction = nullptr );
+
 };
 
 //! Interface class for integrating some state derivative function.
@@ -752,6 +1064,79 @@ public:
                     initialClockTime );
     }
 
+    //! Function to numerically integrate a given first order differential equation, with results in columnar storage
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. The results are stored in contiguous (columnar) histories,
+     *  instead of maps.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states, stored contiguously in order of computation (returned by
+     *  reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved, stored contiguously in order of
+     *  computation (returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved, stored
+     *  contiguously in order of computation (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param outputSink Output sink to which the saved results are streamed during the propagation (default none).
+     *  \param stateOutputConversionFunction Function to convert a saved state to the representation that is written to
+     *  the output sink (default none).
+     *  \param stateDerivativeInPlaceFunction Function computing the same state derivative as stateDerivativeFunction,
+     *  writing it into an existing object, used by integrators that support it (default none, see
+     *  NumericalIntegrator::setStateDerivativeInPlaceFunction).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const double, const StateType& ) > stateDerivativeFunction,
+            utilities::ColumnarStateHistory< double, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            utilities::ColumnarStateHistory< double, double >& dependentVariableHistory,
+            utilities::ColumnarStateHistory< double, double >& cumulativeComputationTimeHistory,
+            const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const double printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationOutputSink > outputSink = nullptr,
+            const std::function< Eigen::VectorXd( const Eigen::Matrix< typename StateType::Scalar, Eigen::Dynamic, 1 >&,
+                                                  const double ) > stateOutputConversionFunction = nullptr,
+            const std::function< void( const double, const StateType&, StateType& ) > stateDerivativeInPlaceFunction = nullptr )
+    {
+        std::function< bool( const double, const double ) > stopPropagationFunction =
+                std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
+
+        // Create numerical integrator.
+        std::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType, StateType > > integrator =
+                numerical_integrators::createIntegrator< double, StateType >(
+                    stateDerivativeFunction, initialState, integratorSettings );
+        integrator->setStateDerivativeInPlaceFunction( stateDerivativeInPlaceFunction );
+
+        if( integratorSettings->assessPropagationTerminationConditionDuringIntegrationSubsteps_ )
+        {
+            integrator->setPropagationTerminationFunction( stopPropagationFunction );
+        }
+
+        return integrateEquationsFromIntegrator< StateType, double >(
+                    integrator, integratorSettings->initialTimeStep_, propagationTerminationCondition, solutionHistory,
+                    dependentVariableHistory,
+                    cumulativeComputationTimeHistory,
+                    dependentVariableFunction,
+                    statePostProcessingFunction,
+                    integratorSettings->saveFrequency_,
+                    printInterval,
+                    initialClockTime,
+                    outputSink,
+                    stateOutputConversionFunction );
+    }
+
 };
 
 //! Interface class for integrating some state derivative function.
@@ -818,6 +1203,79 @@ public:
                     initialClockTime );
     }
 
+    //! Function to numerically integrate a given first order differential equation, with results in columnar storage
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. The results are stored in contiguous (columnar) histories,
+     *  instead of maps.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states, stored contiguously in order of computation (returned by
+     *  reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved, stored contiguously in order of
+     *  computation (returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved, stored
+     *  contiguously in order of computation (returned by reference)
+     *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+     *  derivative model).
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param printInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \param outputSink Output sink to which the saved results are streamed during the propagation (default none).
+     *  \param stateOutputConversionFunction Function to convert a saved state to the representation that is written to
+     *  the output sink (default none).
+     *  \param stateDerivativeInPlaceFunction Function computing the same state derivative as stateDerivativeFunction,
+     *  writing it into an existing object, used by integrators that support it (default none, see
+     *  NumericalIntegrator::setStateDerivativeInPlaceFunction).
+     *  \return Event that triggered the termination of the propagation
+     */
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const Time, const StateType& ) > stateDerivativeFunction,
+            utilities::ColumnarStateHistory< Time, typename StateType::Scalar >& solutionHistory,
+            const StateType initialState,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< Time > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            utilities::ColumnarStateHistory< Time, double >& dependentVariableHistory,
+            utilities::ColumnarStateHistory< Time, double >& cumulativeComputationTimeHistory,
+            const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const Time printInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationOutputSink > outputSink = nullptr,
+            const std::function< Eigen::VectorXd( const Eigen::Matrix< typename StateType::Scalar, Eigen::Dynamic, 1 >&,
+                                                  const Time ) > stateOutputConversionFunction = nullptr,
+            const std::function< void( const Time, const StateType&, StateType& ) > stateDerivativeInPlaceFunction = nullptr )
+    {
+        std::function< bool( const double, const double ) > stopPropagationFunction =
+                std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
+
+        // Create numerical integrator.
+        std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, StateType, StateType, long double > > integrator =
+                numerical_integrators::createIntegrator< Time, StateType, long double  >(
+                    stateDerivativeFunction, initialState, integratorSettings );
+        integrator->setStateDerivativeInPlaceFunction( stateDerivativeInPlaceFunction );
+
+        if( integratorSettings->assessPropagationTerminationConditionDuringIntegrationSubsteps_ )
+        {
+            integrator->setPropagationTerminationFunction( stopPropagationFunction );
+        }
+
+        return integrateEquationsFromIntegrator< StateType, Time, long double >(
+                    integrator, integratorSettings->initialTimeStep_, propagationTerminationCondition, solutionHistory,
+                    dependentVariableHistory,
+                    cumulativeComputationTimeHistory,
+                    dependentVariableFunction,
+                    statePostProcessingFunction,
+                    integratorSettings->saveFrequency_,
+                    printInterval,
+                    initialClockTime,
+                    outputSink,
+                    stateOutputConversionFunction );
+    }
+
 };
 
 } // namespace propagators
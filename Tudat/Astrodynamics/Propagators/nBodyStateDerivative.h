@@ -363,7 +363,7 @@ protected:
      */
     void sumStateDerivativeContributions(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& stateOfSystemToBeIntegrated,
-            Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative,
+            Eigen::Ref< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative,
             const bool addPositionDerivatives = true )
     {
         using namespace basic_astrodynamics;
@@ -0,0 +1,283 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Identifier at start of binary propagation output file
+static const char binaryOutputFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'O', 'U', 'T' };
+
+//! Format version of binary propagation output file
+static const std::uint32_t binaryOutputFileVersion = 1;
+
+//! Offset (in bytes) of number of rows in header of binary propagation output file
+static const std::streamoff binaryOutputFileRowCountOffset = 16;
+
+//! Size (in bytes) of fixed part of header of binary propagation output file
+static const std::uint32_t binaryOutputFileFixedHeaderSize = 40;
+
+//! Constructor
+PropagationOutputSink::PropagationOutputSink( const unsigned int chunkSize ):
+    chunkSize_( chunkSize ), numberOfStateEntries_( 0 ), numberOfDependentVariableEntries_( 0 ),
+    numberOfWrittenEntries_( 0 ), isOutputActive_( false )
+{
+    if( chunkSize_ == 0 )
+    {
+        throw std::runtime_error( "Error when creating propagation output sink, chunk size must be larger than 0" );
+    }
+}
+
+//! Function to write a chunk of saved propagation results to the sink.
+void PropagationOutputSink::writeChunk( const std::vector< double >& times,
+                                        const Eigen::MatrixXd& states,
+                                        const Eigen::MatrixXd& dependentVariables )
+{
+    if( static_cast< int >( times.size( ) ) != states.cols( ) ||
+            ( dependentVariables.rows( ) > 0 && static_cast< int >( times.size( ) ) != dependentVariables.cols( ) ) )
+    {
+        throw std::runtime_error( "Error when writing chunk to propagation output sink, inconsistent number of entries" );
+    }
+
+    // Start new output if required
+    if( !isOutputActive_ )
+    {
+        numberOfStateEntries_ = states.rows( );
+        numberOfDependentVariableEntries_ = dependentVariables.rows( );
+        numberOfWrittenEntries_ = 0;
+        startOutput( );
+        isOutputActive_ = true;
+    }
+    else if( states.rows( ) != numberOfStateEntries_ || dependentVariables.rows( ) != numberOfDependentVariableEntries_ )
+    {
+        throw std::runtime_error( "Error when writing chunk to propagation output sink, inconsistent entry size" );
+    }
+
+    if( times.size( ) > 0 )
+    {
+        if( dependentVariables.rows( ) > 0 )
+        {
+            processChunk( times, states, dependentVariables );
+        }
+        else
+        {
+            processChunk( times, states, Eigen::MatrixXd::Zero( 0, times.size( ) ) );
+        }
+        numberOfWrittenEntries_ += times.size( );
+    }
+}
+
+//! Function to finalize the output of the current propagation.
+void PropagationOutputSink::finishOutput( )
+{
+    if( isOutputActive_ )
+    {
+        endOutput( );
+        isOutputActive_ = false;
+    }
+}
+
+//! Function to create the descriptions of the columns of an output entry (time, state, dependent variables).
+std::vector< std::pair< std::pair< int, int >, std::string > > PropagationOutputSink::getColumnDescriptions( ) const
+{
+    std::vector< std::pair< std::pair< int, int >, std::string > > columnDescriptions;
+    columnDescriptions.push_back( std::make_pair( std::make_pair( 0, 1 ), "Time" ) );
+    columnDescriptions.push_back( std::make_pair( std::make_pair( 1, numberOfStateEntries_ ), "Propagated state" ) );
+
+    // Determine size of each dependent variable from start index of next dependent variable
+    for( std::map< int, std::string >::const_iterator variableIterator = dependentVariableIds_.begin( );
+         variableIterator != dependentVariableIds_.end( ); variableIterator++ )
+    {
+        std::map< int, std::string >::const_iterator nextVariableIterator = std::next( variableIterator );
+        int variableSize = ( ( nextVariableIterator == dependentVariableIds_.end( ) ) ?
+                                 numberOfDependentVariableEntries_ : nextVariableIterator->first ) - variableIterator->first;
+        columnDescriptions.push_back(
+                    std::make_pair( std::make_pair( 1 + numberOfStateEntries_ + variableIterator->first, variableSize ),
+                                    variableIterator->second ) );
+    }
+    return columnDescriptions;
+}
+
+//! Destructor, finalizes the file if the output is still active.
+BinaryFileOutputSink::~BinaryFileOutputSink( )
+{
+    try
+    {
+        finishOutput( );
+    }
+    catch( const std::exception& caughtException )
+    {
+        std::cerr << "Error when closing propagation output file " << fileName_ << ": "
+                  << caughtException.what( ) << std::endl;
+    }
+}
+
+//! Function to open the file and write the header.
+void BinaryFileOutputSink::startOutput( )
+{
+    outputFile_.open( fileName_.c_str( ), std::ios::binary | std::ios::out | std::ios::trunc );
+    if( !outputFile_.good( ) )
+    {
+        throw std::runtime_error( "Error when opening propagation output file " + fileName_ );
+    }
+
+    // Create column description text
+    std::stringstream descriptionStream;
+    std::vector< std::pair< std::pair< int, int >, std::string > > columnDescriptions = getColumnDescriptions( );
+    for( unsigned int i = 0; i < columnDescriptions.size( ); i++ )
+    {
+        descriptionStream << columnDescriptions.at( i ).first.first << " " << columnDescriptions.at( i ).first.second
+                          << " " << columnDescriptions.at( i ).second << "\n";
+    }
+    std::string descriptionText = descriptionStream.str( );
+
+    // Determine header size, padded to multiple of 8 bytes, so that rows are aligned when memory-mapped
+    std::uint32_t descriptionSize = static_cast< std::uint32_t >( descriptionText.size( ) );
+    std::uint32_t headerSize = binaryOutputFileFixedHeaderSize + descriptionSize;
+    headerSize = 8 * ( ( headerSize + 7 ) / 8 );
+
+    std::uint64_t numberOfRows = 0;
+    std::uint32_t numberOfColumns = 1 + numberOfStateEntries_ + numberOfDependentVariableEntries_;
+    std::uint32_t numberOfStateColumns = numberOfStateEntries_;
+    std::uint32_t numberOfDependentVariableColumns = numberOfDependentVariableEntries_;
+
+    outputFile_.write( binaryOutputFileIdentifier, 8 );
+    outputFile_.write( reinterpret_cast< const char* >( &binaryOutputFileVersion ), sizeof( std::uint32_t ) );
+    outputFile_.write( reinterpret_cast< const char* >( &headerSize ), sizeof( std::uint32_t ) );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfRows ), sizeof( std::uint64_t ) );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfColumns ), sizeof( std::uint32_t ) );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfStateColumns ), sizeof( std::uint32_t ) );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfDependentVariableColumns ), sizeof( std::uint32_t ) );
+    outputFile_.write( reinterpret_cast< const char* >( &descriptionSize ), sizeof( std::uint32_t ) );
+    outputFile_.write( descriptionText.c_str( ), descriptionSize );
+
+    std::vector< char > padding( headerSize - binaryOutputFileFixedHeaderSize - descriptionSize, 0 );
+    if( padding.size( ) > 0 )
+    {
+        outputFile_.write( &padding[ 0 ], padding.size( ) );
+    }
+
+    if( !outputFile_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing header of propagation output file " + fileName_ );
+    }
+}
+
+//! Function to write a chunk of saved propagation results to the file.
+void BinaryFileOutputSink::processChunk( const std::vector< double >& times,
+                                         const Eigen::MatrixXd& states,
+                                         const Eigen::MatrixXd& dependentVariables )
+{
+    // Assemble rows (as columns of column-major buffer, so that rows are contiguous in memory)
+    int numberOfEntries = static_cast< int >( times.size( ) );
+    rowBuffer_.resize( 1 + numberOfStateEntries_ + numberOfDependentVariableEntries_, numberOfEntries );
+    rowBuffer_.row( 0 ) = Eigen::Map< const Eigen::RowVectorXd >( &times[ 0 ], numberOfEntries );
+    rowBuffer_.block( 1, 0, numberOfStateEntries_, numberOfEntries ) = states;
+    rowBuffer_.block( 1 + numberOfStateEntries_, 0, numberOfDependentVariableEntries_, numberOfEntries ) =
+            dependentVariables;
+
+    outputFile_.write( reinterpret_cast< const char* >( rowBuffer_.data( ) ), sizeof( double ) * rowBuffer_.size( ) );
+    if( !outputFile_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing to propagation output file " + fileName_ );
+    }
+}
+
+//! Function to write the number of rows to the header, and close the file.
+void BinaryFileOutputSink::endOutput( )
+{
+    std::uint64_t numberOfRows = numberOfWrittenEntries_;
+    outputFile_.seekp( binaryOutputFileRowCountOffset );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfRows ), sizeof( std::uint64_t ) );
+    outputFile_.close( );
+    if( outputFile_.fail( ) )
+    {
+        throw std::runtime_error( "Error when finalizing propagation output file " + fileName_ );
+    }
+}
+
+//! Function to read a file written by a BinaryFileOutputSink
+std::string readBinaryPropagationOutputFile( const std::string& fileName,
+                                             std::vector< double >& times,
+                                             Eigen::MatrixXd& states,
+                                             Eigen::MatrixXd& dependentVariables )
+{
+    std::ifstream inputFile( fileName.c_str( ), std::ios::binary );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when opening propagation output file " + fileName );
+    }
+
+    // Read and check header
+    char fileIdentifier[ 8 ];
+    std::uint32_t fileVersion, headerSize, numberOfColumns, numberOfStateColumns, numberOfDependentVariableColumns,
+            descriptionSize;
+    std::uint64_t numberOfRows;
+
+    inputFile.read( fileIdentifier, 8 );
+    inputFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &headerSize ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfRows ), sizeof( std::uint64_t ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfColumns ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfStateColumns ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfDependentVariableColumns ), sizeof( std::uint32_t ) );
+    inputFile.read( reinterpret_cast< char* >( &descriptionSize ), sizeof( std::uint32_t ) );
+
+    if( !inputFile.good( ) || std::memcmp( fileIdentifier, binaryOutputFileIdentifier, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading propagation output file " + fileName + ", header not recognized" );
+    }
+    if( fileVersion != binaryOutputFileVersion )
+    {
+        throw std::runtime_error( "Error when reading propagation output file " + fileName + ", format version " +
+                                  std::to_string( fileVersion ) + " not supported" );
+    }
+    if( numberOfColumns != 1 + numberOfStateColumns + numberOfDependentVariableColumns )
+    {
+        throw std::runtime_error( "Error when reading propagation output file " + fileName +
+                                  ", inconsistent number of columns" );
+    }
+
+    std::string descriptionText( descriptionSize, ' ' );
+    if( descriptionSize > 0 )
+    {
+        inputFile.read( &descriptionText[ 0 ], descriptionSize );
+    }
+
+    // Read rows
+    inputFile.seekg( headerSize );
+    Eigen::MatrixXd rowBuffer = Eigen::MatrixXd( numberOfColumns, numberOfRows );
+    inputFile.read( reinterpret_cast< char* >( rowBuffer.data( ) ), sizeof( double ) * rowBuffer.size( ) );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when reading propagation output file " + fileName + ", file is incomplete" );
+    }
+
+    times.resize( numberOfRows );
+    Eigen::Map< Eigen::RowVectorXd >( times.data( ), numberOfRows ) = rowBuffer.row( 0 );
+    states = rowBuffer.block( 1, 0, numberOfStateColumns, numberOfRows );
+    dependentVariables = rowBuffer.block( 1 + numberOfStateColumns, 0, numberOfDependentVariableColumns, numberOfRows );
+
+    return descriptionText;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,298 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONOUTPUTSINK_H
+#define TUDAT_PROPAGATIONOUTPUTSINK_H
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Base class for objects to which the saved propagation results are streamed in chunks during the propagation.
+/*!
+ *  Base class for objects to which the saved propagation results (states and dependent variables) are streamed in chunks
+ *  during the propagation, so that the memory used for storing the results remains bounded, regardless of the length of
+ *  the propagation. The propagation loop passes the saved entries to the sink once the number of entries in memory
+ *  exceeds the chunk size, and passes the remaining entries upon termination. The results are passed in double
+ *  precision, with the states in the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution).
+ *  Derived classes implement the actual output (e.g. to file or to a user-defined function).
+ */
+class PropagationOutputSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param chunkSize Number of saved entries that is kept in memory before they are passed to the sink.
+     */
+    PropagationOutputSink( const unsigned int chunkSize = 1000 );
+
+    //! Destructor
+    virtual ~PropagationOutputSink( ){ }
+
+    //! Function to retrieve the number of saved entries that is kept in memory before they are passed to the sink.
+    /*!
+     *  Function to retrieve the number of saved entries that is kept in memory before they are passed to the sink.
+     *  \return Number of saved entries that is kept in memory before they are passed to the sink.
+     */
+    unsigned int getChunkSize( ) const
+    {
+        return chunkSize_;
+    }
+
+    //! Function to set the descriptions of the dependent variables that are written to the sink.
+    /*!
+     *  Function to set the descriptions of the dependent variables that are written to the sink. Set by the dynamics
+     *  simulator before the propagation.
+     *  \param dependentVariableIds Map listing starting entry of dependent variables in output vector, along with
+     *  associated ID.
+     */
+    void setDependentVariableIds( const std::map< int, std::string >& dependentVariableIds )
+    {
+        dependentVariableIds_ = dependentVariableIds;
+    }
+
+    //! Function to write a chunk of saved propagation results to the sink.
+    /*!
+     *  Function to write a chunk of saved propagation results to the sink. The first call after construction (or after
+     *  a call to finishOutput) starts a new output, with the number of state and dependent variable entries set from the
+     *  size of the chunk.
+     *  \param times Times of the entries in the chunk.
+     *  \param states States of the entries in the chunk, one column per entry.
+     *  \param dependentVariables Dependent variables of the entries in the chunk, one column per entry (zero rows if no
+     *  dependent variables are saved).
+     */
+    void writeChunk( const std::vector< double >& times,
+                     const Eigen::MatrixXd& states,
+                     const Eigen::MatrixXd& dependentVariables );
+
+    //! Function to finalize the output of the current propagation.
+    void finishOutput( );
+
+    //! Function to retrieve the number of entries written to the current (or last) output.
+    /*!
+     *  Function to retrieve the number of entries written to the current (or last) output.
+     *  \return Number of entries written to the current (or last) output.
+     */
+    unsigned int getNumberOfWrittenEntries( ) const
+    {
+        return numberOfWrittenEntries_;
+    }
+
+protected:
+
+    //! Function to start a new output, called before the first chunk of a propagation is processed.
+    virtual void startOutput( ) = 0;
+
+    //! Function to process a chunk of saved propagation results.
+    /*!
+     *  Function to process a chunk of saved propagation results.
+     *  \param times Times of the entries in the chunk.
+     *  \param states States of the entries in the chunk, one column per entry.
+     *  \param dependentVariables Dependent variables of the entries in the chunk, one column per entry.
+     */
+    virtual void processChunk( const std::vector< double >& times,
+                               const Eigen::MatrixXd& states,
+                               const Eigen::MatrixXd& dependentVariables ) = 0;
+
+    //! Function to finalize the output, called after the last chunk of a propagation has been processed.
+    virtual void endOutput( ) = 0;
+
+    //! Function to create the descriptions of the columns of an output entry (time, state, dependent variables).
+    /*!
+     *  Function to create the descriptions of the column blocks of an output entry, consisting of the time, the state
+     *  and the dependent variables (in that order).
+     *  \return List of column blocks, with the first column index and number of columns as key, and the description of
+     *  the block as value.
+     */
+    std::vector< std::pair< std::pair< int, int >, std::string > > getColumnDescriptions( ) const;
+
+    //! Number of saved entries that is kept in memory before they are passed to the sink.
+    unsigned int chunkSize_;
+
+    //! Map listing starting entry of dependent variables in output vector, along with associated ID.
+    std::map< int, std::string > dependentVariableIds_;
+
+    //! Number of state entries per output entry
+    int numberOfStateEntries_;
+
+    //! Number of dependent variable entries per output entry
+    int numberOfDependentVariableEntries_;
+
+    //! Number of entries written to the current (or last) output.
+    unsigned int numberOfWrittenEntries_;
+
+    //! Boolean denoting whether an output is currently active (i.e. started, but not finished)
+    bool isOutputActive_;
+};
+
+//! Output sink that writes the propagation results to a binary file.
+/*!
+ *  Output sink that writes the propagation results to a binary file, with a layout that can be memory-mapped as a
+ *  row-major array of doubles. The file consists of a header, followed by one row per saved entry. The header is:
+ *  - 8 bytes: identifier "TUDATOUT"
+ *  - uint32: format version (currently 1)
+ *  - uint32: size of header in bytes (i.e. offset of first row; always a multiple of 8)
+ *  - uint64: number of rows (written when the output is finished; 0 while the propagation is running)
+ *  - uint32: number of columns per row (1 + number of state entries + number of dependent variable entries)
+ *  - uint32: number of state entries
+ *  - uint32: number of dependent variable entries
+ *  - uint32: length of column description text, in bytes
+ *  - column description text, with one line per column block: "<first column> <number of columns> <description>"
+ *  - zero padding up to the header size
+ *  Each row consists of the time, the state and the dependent variables, as native-endian 64-bit doubles. Each
+ *  propagation overwrites the file.
+ */
+class BinaryFileOutputSink: public PropagationOutputSink
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param fileName Name of the file to which the results are to be written.
+     *  \param chunkSize Number of saved entries that is kept in memory before they are written to the file.
+     */
+    BinaryFileOutputSink( const std::string& fileName, const unsigned int chunkSize = 1000 ):
+        PropagationOutputSink( chunkSize ), fileName_( fileName ){ }
+
+    //! Destructor, finalizes the file if the output is still active.
+    ~BinaryFileOutputSink( );
+
+    //! Function to retrieve the name of the file to which the results are written.
+    /*!
+     *  Function to retrieve the name of the file to which the results are written.
+     *  \return Name of the file to which the results are written.
+     */
+    std::string getFileName( ) const
+    {
+        return fileName_;
+    }
+
+protected:
+
+    //! Function to open the file and write the header.
+    void startOutput( );
+
+    //! Function to write a chunk of saved propagation results to the file.
+    /*!
+     *  Function to write a chunk of saved propagation results to the file.
+     *  \param times Times of the entries in the chunk.
+     *  \param states States of the entries in the chunk, one column per entry.
+     *  \param dependentVariables Dependent variables of the entries in the chunk, one column per entry.
+     */
+    void processChunk( const std::vector< double >& times,
+                       const Eigen::MatrixXd& states,
+                       const Eigen::MatrixXd& dependentVariables );
+
+    //! Function to write the number of rows to the header, and close the file.
+    void endOutput( );
+
+    //! Name of the file to which the results are written.
+    std::string fileName_;
+
+    //! Stream to the file to which the results are written.
+    std::ofstream outputFile_;
+
+    //! Row buffer, reused for each chunk.
+    Eigen::MatrixXd rowBuffer_;
+};
+
+//! Function to read a file written by a BinaryFileOutputSink
+/*!
+ *  Function to read a file written by a BinaryFileOutputSink (e.g. for post-processing or testing).
+ *  \param fileName Name of the file that is to be read.
+ *  \param times Times of the entries in the file (returned by reference).
+ *  \param states States of the entries in the file, one column per entry (returned by reference).
+ *  \param dependentVariables Dependent variables of the entries in the file, one column per entry (returned by
+ *  reference).
+ *  \return Column description text in the file header.
+ */
+std::string readBinaryPropagationOutputFile( const std::string& fileName,
+                                             std::vector< double >& times,
+                                             Eigen::MatrixXd& states,
+                                             Eigen::MatrixXd& dependentVariables );
+
+//! Output sink that passes the propagation results to a user-defined function.
+class CallbackOutputSink: public PropagationOutputSink
+{
+public:
+
+    //! Typedef for the function to which the chunks of propagation results are passed.
+    typedef std::function< void( const std::vector< double >&, const Eigen::MatrixXd&, const Eigen::MatrixXd& ) >
+    ChunkProcessingFunction;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param chunkProcessingFunction Function to which each chunk of propagation results is passed, with the times, the
+     *  states (one column per entry) and the dependent variables (one column per entry) as input.
+     *  \param chunkSize Number of saved entries that is kept in memory before they are passed to the function.
+     *  \param endOfOutputFunction Function that is called once the propagation is finished (default none).
+     */
+    CallbackOutputSink( const ChunkProcessingFunction chunkProcessingFunction,
+                        const unsigned int chunkSize = 1000,
+                        const std::function< void( ) > endOfOutputFunction = nullptr ):
+        PropagationOutputSink( chunkSize ), chunkProcessingFunction_( chunkProcessingFunction ),
+        endOfOutputFunction_( endOfOutputFunction ){ }
+
+protected:
+
+    //! Function to start a new output (no action required).
+    void startOutput( ){ }
+
+    //! Function to pass a chunk of saved propagation results to the user-defined function.
+    /*!
+     *  Function to pass a chunk of saved propagation results to the user-defined function.
+     *  \param times Times of the entries in the chunk.
+     *  \param states States of the entries in the chunk, one column per entry.
+     *  \param dependentVariables Dependent variables of the entries in the chunk, one column per entry.
+     */
+    void processChunk( const std::vector< double >& times,
+                       const Eigen::MatrixXd& states,
+                       const Eigen::MatrixXd& dependentVariables )
+    {
+        chunkProcessingFunction_( times, states, dependentVariables );
+    }
+
+    //! Function to finalize the output, calls the endOfOutputFunction_ (if any).
+    void endOutput( )
+    {
+        if( endOfOutputFunction_ != nullptr )
+        {
+            endOfOutputFunction_( );
+        }
+    }
+
+    //! Function to which each chunk of propagation results is passed.
+    ChunkProcessingFunction chunkProcessingFunction_;
+
+    //! Function that is called once the propagation is finished.
+    std::function< void( ) > endOfOutputFunction_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONOUTPUTSINK_H
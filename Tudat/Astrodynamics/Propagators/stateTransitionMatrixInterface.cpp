@@ -33,19 +33,43 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
         const double evaluationTime )
 {
-    combinedStateTransitionMatrix_.setZero( );
+    // Matrix is created locally (not stored as member), so that function may be called concurrently.
+    Eigen::MatrixXd combinedStateTransitionMatrix = Eigen::MatrixXd::Zero(
+                stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
 
     // Set Phi and S matrices.
-    combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+    combinedStateTransitionMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
             stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
 
     if( sensitivityMatrixSize_ > 0 )
     {
-        combinedStateTransitionMatrix_.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
+        combinedStateTransitionMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
                 sensitivityMatrixInterpolator_->interpolate( evaluationTime );
     }
 
-    return combinedStateTransitionMatrix_;
+    return combinedStateTransitionMatrix;
+}
+
+//! Function to get the concatenated state transition and sensitivity matrix at a given time, using a caller-owned hint
+//! for the interpolator lookup.
+Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::
+getFullCombinedStateTransitionAndSensitivityMatrixWithLookUpHint(
+        const double evaluationTime, int& interpolatorLookUpHint )
+{
+    Eigen::MatrixXd combinedStateTransitionMatrix = Eigen::MatrixXd::Zero(
+                stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+
+    // Set Phi and S matrices (both interpolators are defined at the same times, so the hint is valid for both).
+    combinedStateTransitionMatrix.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+            stateTransitionMatrixInterpolator_->interpolateWithLookUpHint( evaluationTime, interpolatorLookUpHint );
+
+    if( sensitivityMatrixSize_ > 0 )
+    {
+        combinedStateTransitionMatrix.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
+                sensitivityMatrixInterpolator_->interpolateWithLookUpHint( evaluationTime, interpolatorLookUpHint );
+    }
+
+    return combinedStateTransitionMatrix;
 }
 
 //! Constructor
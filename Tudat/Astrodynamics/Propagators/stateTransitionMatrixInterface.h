@@ -72,6 +72,26 @@ public:
      */
     virtual Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime ) = 0;
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+    //! zero values for parameters not active in current arc, using a caller-owned hint for the interpolator lookup.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+     *  zero values for parameters not active in current arc (see getFullCombinedStateTransitionAndSensitivityMatrix).
+     *  The interval of the matrix interpolators is found from a caller-owned hint (see
+     *  OneDimensionalInterpolator::interpolateWithLookUpHint), so that callers on different threads, each with their own
+     *  hint, do not reset each other's lookups. This base class implementation ignores the hint.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param interpolatorLookUpHint Interval of matrix interpolators found during previous call, or -1 if no previous
+     *  call has been made (updated by this function).
+     *  \return Concatenated state transition and sensitivity matrices, including inactive parameters at
+     *  evaluationTime.
+     */
+    virtual Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrixWithLookUpHint(
+            const double evaluationTime, int& interpolatorLookUpHint )
+    {
+        return getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+    }
+
     //! Function to get the size of state transition matrix
     /*!
      * Function to get the size of state transition matrix
@@ -134,10 +154,7 @@ public:
         CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters ),
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
         sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator )
-    {
-        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
-                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
-    }
+    { }
 
     //! Destructor.
     ~SingleArcCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
@@ -196,6 +213,19 @@ public:
         return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
     }
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, using a caller-owned
+    //! hint for the interpolator lookup.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, using a caller-owned
+     *  hint for the interpolator lookup (see base class function).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param interpolatorLookUpHint Interval of matrix interpolators found during previous call, or -1 if no previous
+     *  call has been made (updated by this function).
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrixWithLookUpHint(
+            const double evaluationTime, int& interpolatorLookUpHint );
+
     //! Function to get the size of the total parameter vector.
     /*!
      * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
@@ -209,9 +239,6 @@ public:
 
 private:
 
-    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
-    Eigen::MatrixXd combinedStateTransitionMatrix_;
-
     //! Interpolator returning the state transition matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     stateTransitionMatrixInterpolator_;
@@ -0,0 +1,154 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/columnarStateHistory.h"
+#include "Tudat/Basics/timeType.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_columnar_state_history )
+
+//! Test whether vector-valued entries are stored, retrieved and converted to/from maps correctly
+BOOST_AUTO_TEST_CASE( testColumnarVectorHistory )
+{
+    utilities::ColumnarStateHistory< double, double > history;
+    BOOST_CHECK_EQUAL( history.empty( ), true );
+
+    // Add entries with descending times (as for backwards propagation), such that storage is reallocated several times
+    unsigned int numberOfEntries = 100;
+    std::map< double, Eigen::VectorXd > expectedHistory;
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        double currentTime = 10.0 - 0.5 * static_cast< double >( i );
+        Eigen::VectorXd currentState = Eigen::VectorXd::LinSpaced( 4, currentTime, 2.0 * currentTime + 1.0 );
+        history.addEntry( currentTime, currentState );
+        expectedHistory[ currentTime ] = currentState;
+    }
+    BOOST_CHECK_EQUAL( history.size( ), numberOfEntries );
+    BOOST_CHECK_EQUAL( history.getNumberOfEntryRows( ), 4 );
+    BOOST_CHECK_EQUAL( history.getNumberOfEntryColumns( ), 1 );
+    BOOST_CHECK_EQUAL( history.getStateBlock( ).cols( ), numberOfEntries );
+
+    // Check entries, which are stored in order of insertion
+    for( unsigned int i = 0; i < numberOfEntries; i++ )
+    {
+        double currentTime = 10.0 - 0.5 * static_cast< double >( i );
+        BOOST_CHECK_EQUAL( history.getTime( i ), currentTime );
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( history.getEntry( i )( j, 0 ), expectedHistory.at( currentTime )( j ) );
+            BOOST_CHECK_EQUAL( history.getStateBlock( )( j, i ), expectedHistory.at( currentTime )( j ) );
+        }
+    }
+
+    // Check conversion to map
+    std::map< double, Eigen::VectorXd > mapHistory = history.createMap< Eigen::VectorXd >( );
+    BOOST_CHECK_EQUAL( mapHistory.size( ), numberOfEntries );
+    for( auto mapIterator : expectedHistory )
+    {
+        BOOST_CHECK_EQUAL( ( mapHistory.at( mapIterator.first ) - mapIterator.second ).norm( ), 0.0 );
+    }
+
+    // Check overwriting and removal of last entry
+    history.addEntry( history.getLastTime( ), Eigen::VectorXd::Zero( 4 ) );
+    BOOST_CHECK_EQUAL( history.size( ), numberOfEntries );
+    BOOST_CHECK_EQUAL( history.getLastEntry( ).norm( ), 0.0 );
+
+    history.removeLastEntry( );
+    BOOST_CHECK_EQUAL( history.size( ), numberOfEntries - 1 );
+    BOOST_CHECK_EQUAL( history.getLastTime( ), 10.0 - 0.5 * static_cast< double >( numberOfEntries - 2 ) );
+
+    // Check removal of first entries
+    history.removeFirstEntries( 10 );
+    BOOST_CHECK_EQUAL( history.size( ), numberOfEntries - 11 );
+    BOOST_CHECK_EQUAL( history.getTime( 0 ), 5.0 );
+    BOOST_CHECK_EQUAL( ( history.getEntry( 0 ) - expectedHistory.at( 5.0 ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( history.getLastEntry( ) -
+                         expectedHistory.at( history.getLastTime( ) ) ).norm( ), 0.0 );
+
+    // Check memory release
+    history.shrinkToFit( );
+    BOOST_CHECK_EQUAL( history.getStateBlock( ).cols( ), numberOfEntries - 11 );
+    BOOST_CHECK_EQUAL( history.getTime( 0 ), 5.0 );
+
+    // Check reset from map
+    history.setFromMap( expectedHistory );
+    BOOST_CHECK_EQUAL( history.size( ), numberOfEntries );
+    BOOST_CHECK_EQUAL( history.getTime( 0 ), expectedHistory.begin( )->first );
+    BOOST_CHECK_EQUAL( ( history.getEntry( 0 ) - expectedHistory.begin( )->second ).norm( ), 0.0 );
+
+    // Check inconsistent entry size and index errors
+    BOOST_CHECK_THROW( history.addEntry( 100.0, Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( history.getEntry( numberOfEntries ), std::runtime_error );
+
+    history.clear( );
+    BOOST_CHECK_EQUAL( history.empty( ), true );
+    BOOST_CHECK_THROW( history.removeLastEntry( ), std::runtime_error );
+}
+
+//! Test whether matrix-valued and scalar entries, and Time/long double types are handled correctly
+BOOST_AUTO_TEST_CASE( testColumnarMatrixAndScalarHistory )
+{
+    // Check matrix-valued entries (as used for variational equations)
+    utilities::ColumnarStateHistory< Time, long double > matrixHistory;
+    std::map< Time, Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > > expectedHistory;
+    for( int i = 0; i < 20; i++ )
+    {
+        Time currentTime = Time( i, 0.25L );
+        Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > currentState =
+                Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >::Random( 3, 5 );
+        matrixHistory.addEntry( currentTime, currentState );
+        expectedHistory[ currentTime ] = currentState;
+    }
+    BOOST_CHECK_EQUAL( matrixHistory.getNumberOfEntryRows( ), 3 );
+    BOOST_CHECK_EQUAL( matrixHistory.getNumberOfEntryColumns( ), 5 );
+    BOOST_CHECK_EQUAL( matrixHistory.getStateBlock( ).rows( ), 15 );
+
+    std::map< Time, Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > > mapHistory;
+    matrixHistory.fillMap( mapHistory );
+    BOOST_CHECK_EQUAL( mapHistory.size( ), expectedHistory.size( ) );
+    for( auto mapIterator : expectedHistory )
+    {
+        BOOST_CHECK_EQUAL( mapHistory.at( mapIterator.first ).rows( ), 3 );
+        BOOST_CHECK_EQUAL( mapHistory.at( mapIterator.first ).cols( ), 5 );
+        BOOST_CHECK_EQUAL( ( mapHistory.at( mapIterator.first ) - mapIterator.second ).norm( ), 0.0L );
+    }
+
+    // Check scalar entries (as used for computation times)
+    utilities::ColumnarStateHistory< double, double > scalarHistory;
+    scalarHistory.reserve( 10 );
+    for( int i = 0; i < 10; i++ )
+    {
+        scalarHistory.addEntry( static_cast< double >( i ), static_cast< double >( i * i ) );
+    }
+    std::map< double, double > scalarMap = scalarHistory.createMap< double >( );
+    BOOST_CHECK_EQUAL( scalarMap.size( ), 10 );
+    for( int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( scalarMap.at( static_cast< double >( i ) ), static_cast< double >( i * i ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
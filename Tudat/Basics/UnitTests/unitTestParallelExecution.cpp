@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/parallelExecution.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_parallel_execution )
+
+//! Test whether all tasks are executed exactly once, by the statically assigned worker
+BOOST_AUTO_TEST_CASE( testParallelTaskDistribution )
+{
+    BOOST_CHECK( utilities::getNumberOfAvailableThreads( ) >= 1 );
+
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 6; numberOfThreads++ )
+    {
+        unsigned int numberOfTasks = 23;
+        std::vector< int > numberOfExecutions( numberOfTasks, 0 );
+        std::vector< unsigned int > executingWorker( numberOfTasks, 0 );
+        std::vector< double > taskResults( numberOfTasks, 0.0 );
+
+        utilities::executeParallelTasks(
+                    numberOfTasks, numberOfThreads,
+                    [ & ]( const unsigned int taskIndex, const unsigned int workerIndex )
+        {
+            numberOfExecutions[ taskIndex ]++;
+            executingWorker[ taskIndex ] = workerIndex;
+
+            double sum = 0.0;
+            for( unsigned int i = 0; i <= 1000 * taskIndex; i++ )
+            {
+                sum += static_cast< double >( i );
+            }
+            taskResults[ taskIndex ] = sum;
+        } );
+
+        for( unsigned int i = 0; i < numberOfTasks; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfExecutions.at( i ), 1 );
+            BOOST_CHECK_EQUAL( executingWorker.at( i ), i % numberOfThreads );
+            BOOST_CHECK_EQUAL( taskResults.at( i ), 0.5 * static_cast< double >( 1000 * i ) *
+                               static_cast< double >( 1000 * i + 1 ) );
+        }
+    }
+
+    // Check case where more threads than tasks are requested
+    std::vector< int > numberOfExecutions( 2, 0 );
+    utilities::executeParallelTasks(
+                2, 8, [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        numberOfExecutions[ taskIndex ]++;
+    } );
+    BOOST_CHECK_EQUAL( numberOfExecutions.at( 0 ), 1 );
+    BOOST_CHECK_EQUAL( numberOfExecutions.at( 1 ), 1 );
+}
+
+//! Test whether concurrent task execution is correctly flagged on each worker
+BOOST_AUTO_TEST_CASE( testParallelTaskFlag )
+{
+    BOOST_CHECK_EQUAL( utilities::isExecutingParallelTasks( ), false );
+
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 4; numberOfThreads++ )
+    {
+        std::vector< int > isTaskExecutedInParallel( 6, -1 );
+        utilities::executeParallelTasks(
+                    6, numberOfThreads, [ & ]( const unsigned int taskIndex, const unsigned int )
+        {
+            isTaskExecutedInParallel[ taskIndex ] = utilities::isExecutingParallelTasks( );
+        } );
+
+        for( unsigned int i = 0; i < isTaskExecutedInParallel.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( isTaskExecutedInParallel.at( i ), ( numberOfThreads > 1 ) ? 1 : 0 );
+        }
+
+        // Flag must be reset on calling thread
+        BOOST_CHECK_EQUAL( utilities::isExecutingParallelTasks( ), false );
+    }
+}
+
+//! Test whether concurrent access to shared objects is only flagged on workers that explicitly mark it
+BOOST_AUTO_TEST_CASE( testConcurrentSharedObjectAccessFlag )
+{
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 4; numberOfThreads++ )
+    {
+        // Parallel tasks that do not mark shared access (e.g. each operating on their own objects) are not flagged
+        std::vector< int > isSharedAccessFlagged( 6, -1 );
+        utilities::executeParallelTasks(
+                    6, numberOfThreads, [ & ]( const unsigned int taskIndex, const unsigned int )
+        {
+            isSharedAccessFlagged[ taskIndex ] = utilities::isAccessingSharedObjectsConcurrently( );
+        } );
+        for( unsigned int i = 0; i < isSharedAccessFlagged.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( isSharedAccessFlagged.at( i ), 0 );
+        }
+
+        // Tasks marking shared access are flagged if more than one worker is used
+        utilities::executeParallelTasks(
+                    6, numberOfThreads, [ & ]( const unsigned int taskIndex, const unsigned int )
+        {
+            utilities::ConcurrentSharedObjectAccess sharedObjectAccess( numberOfThreads > 1 );
+            isSharedAccessFlagged[ taskIndex ] = utilities::isAccessingSharedObjectsConcurrently( );
+        } );
+        for( unsigned int i = 0; i < isSharedAccessFlagged.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( isSharedAccessFlagged.at( i ), ( numberOfThreads > 1 ) ? 1 : 0 );
+        }
+
+        // Flag must be reset on calling thread
+        BOOST_CHECK_EQUAL( utilities::isAccessingSharedObjectsConcurrently( ), false );
+    }
+
+    // Check nested marking
+    {
+        utilities::ConcurrentSharedObjectAccess outerAccess;
+        {
+            utilities::ConcurrentSharedObjectAccess innerAccess( false );
+            BOOST_CHECK_EQUAL( utilities::isAccessingSharedObjectsConcurrently( ), true );
+        }
+        BOOST_CHECK_EQUAL( utilities::isAccessingSharedObjectsConcurrently( ), true );
+    }
+    BOOST_CHECK_EQUAL( utilities::isAccessingSharedObjectsConcurrently( ), false );
+}
+
+//! Test whether exceptions in tasks are passed on to the calling thread
+BOOST_AUTO_TEST_CASE( testParallelTaskExceptions )
+{
+    bool exceptionCaught = false;
+    try
+    {
+        utilities::executeParallelTasks(
+                    10, 3, [ & ]( const unsigned int taskIndex, const unsigned int )
+        {
+            if( taskIndex == 7 )
+            {
+                throw std::runtime_error( "Test error" );
+            }
+        } );
+    }
+    catch( std::runtime_error& )
+    {
+        exceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionCaught, true );
+
+    exceptionCaught = false;
+    try
+    {
+        utilities::executeParallelTasks( 10, 0, [ & ]( const unsigned int, const unsigned int ){ } );
+    }
+    catch( std::runtime_error& )
+    {
+        exceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( exceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
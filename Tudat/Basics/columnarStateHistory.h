@@ -0,0 +1,399 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COLUMNARSTATEHISTORY_H
+#define TUDAT_COLUMNARSTATEHISTORY_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Class to store a time history of equally sized states in contiguous (columnar) memory.
+/*!
+ *  Class to store a time history of equally sized (vector or matrix) states in contiguous memory, as an alternative to a
+ *  std::map< TimeType, StateType >, which requires a separate heap allocation for each map node and each state. The times
+ *  are stored in a single vector, and the states in a single matrix block, in which each column contains one state (for
+ *  matrix-valued states, the column-major concatenation of the columns of the state). Entries are stored in the order in
+ *  which they are added (e.g. with descending times for backwards propagation). Storage grows geometrically, so that
+ *  adding an entry has amortized constant cost. Functions to convert from/to a std::map are provided for compatibility
+ *  with interfaces that take a map as input.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class ColumnarStateHistory
+{
+public:
+
+    //! Typedef for the matrix block in which the states are stored
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateBlockType;
+
+    //! Typedef for the read-only view of a single entry
+    typedef Eigen::Map< const StateBlockType > ConstEntryType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfEntryRows Number of rows of each state that is to be stored. If 0, the size is set from the first
+     *  entry that is added.
+     *  \param numberOfEntryColumns Number of columns of each state that is to be stored.
+     */
+    ColumnarStateHistory( const int numberOfEntryRows = 0, const int numberOfEntryColumns = 1 ):
+        numberOfEntryRows_( numberOfEntryRows ), numberOfEntryColumns_( numberOfEntryColumns ),
+        numberOfEntries_( 0 ){ }
+
+    //! Function to reserve memory for a given number of entries
+    /*!
+     *  Function to reserve memory for a given number of entries, to prevent reallocations while adding entries. Can only be
+     *  called once the state size is known (i.e. after adding the first entry, or when it was set in the constructor).
+     *  \param numberOfEntries Number of entries for which memory is to be reserved.
+     */
+    void reserve( const unsigned int numberOfEntries )
+    {
+        times_.reserve( numberOfEntries );
+        if( numberOfEntries > getCapacity( ) && getEntrySize( ) > 0 )
+        {
+            states_.conservativeResize( getEntrySize( ), numberOfEntries );
+        }
+    }
+
+    //! Function to add an entry at the end of the history
+    /*!
+     *  Function to add an entry at the end of the history. If the time is equal to that of the last entry, the last entry
+     *  is overwritten (consistent with inserting an existing key in a map).
+     *  \param time Time of entry that is to be added
+     *  \param state State that is to be added. Its size must be equal to that of the entries already in the history.
+     */
+    template< typename Derived >
+    void addEntry( const TimeType& time, const Eigen::MatrixBase< Derived >& state )
+    {
+        if( numberOfEntryRows_ == 0 )
+        {
+            numberOfEntryRows_ = static_cast< int >( state.rows( ) );
+            numberOfEntryColumns_ = static_cast< int >( state.cols( ) );
+        }
+        else if( state.rows( ) != numberOfEntryRows_ || state.cols( ) != numberOfEntryColumns_ )
+        {
+            throw std::runtime_error(
+                        "Error when adding entry to columnar state history, size is inconsistent: " +
+                        std::to_string( state.rows( ) ) + "x" + std::to_string( state.cols( ) ) + ", expected " +
+                        std::to_string( numberOfEntryRows_ ) + "x" + std::to_string( numberOfEntryColumns_ ) );
+        }
+
+        unsigned int entryIndex = numberOfEntries_;
+        if( numberOfEntries_ > 0 && times_.back( ) == time )
+        {
+            entryIndex--;
+        }
+        else
+        {
+            if( numberOfEntries_ == getCapacity( ) )
+            {
+                states_.conservativeResize( getEntrySize( ), ( getCapacity( ) < 8 ) ? 16 : 2 * getCapacity( ) );
+            }
+            times_.push_back( time );
+            numberOfEntries_++;
+        }
+
+        for( int j = 0; j < numberOfEntryColumns_; j++ )
+        {
+            states_.block( j * numberOfEntryRows_, entryIndex, numberOfEntryRows_, 1 ) =
+                    state.col( j ).template cast< StateScalarType >( );
+        }
+    }
+
+    //! Function to add a scalar entry at the end of the history
+    /*!
+     *  Function to add a scalar entry at the end of the history, for histories with 1x1 entries.
+     *  \param time Time of entry that is to be added
+     *  \param value Value that is to be added.
+     */
+    void addEntry( const TimeType& time, const StateScalarType value )
+    {
+        addEntry( time, Eigen::Matrix< StateScalarType, 1, 1 >::Constant( value ) );
+    }
+
+    //! Function to remove the last entry from the history
+    void removeLastEntry( )
+    {
+        if( numberOfEntries_ == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from columnar state history, history is empty" );
+        }
+        times_.pop_back( );
+        numberOfEntries_--;
+    }
+
+    //! Function to remove a given number of entries from the start of the history
+    /*!
+     *  Function to remove a given number of entries from the start of the history (e.g. once they have been written to
+     *  file), moving the remaining entries to the start of the storage. The allocated memory is retained.
+     *  \param numberOfEntriesToRemove Number of entries that are to be removed
+     */
+    void removeFirstEntries( const unsigned int numberOfEntriesToRemove )
+    {
+        if( numberOfEntriesToRemove > numberOfEntries_ )
+        {
+            throw std::runtime_error( "Error when removing " + std::to_string( numberOfEntriesToRemove ) +
+                                      " entries from columnar state history, history has " +
+                                      std::to_string( numberOfEntries_ ) + " entries" );
+        }
+
+        // Move remaining entries to start of storage (destination precedes source, so forward copy is safe)
+        std::copy( states_.data( ) + static_cast< long >( numberOfEntriesToRemove ) * getEntrySize( ),
+                   states_.data( ) + static_cast< long >( numberOfEntries_ ) * getEntrySize( ),
+                   states_.data( ) );
+        times_.erase( times_.begin( ), times_.begin( ) + numberOfEntriesToRemove );
+        numberOfEntries_ -= numberOfEntriesToRemove;
+    }
+
+    //! Function to remove all entries, and release the associated memory
+    /*!
+     *  Function to remove all entries, and release the associated memory. The size of the states is reset, and is set
+     *  again from the first entry that is subsequently added.
+     */
+    void clear( )
+    {
+        times_.clear( );
+        times_.shrink_to_fit( );
+        states_.resize( 0, 0 );
+        numberOfEntries_ = 0;
+        numberOfEntryRows_ = 0;
+        numberOfEntryColumns_ = 1;
+    }
+
+    //! Function to release the memory that was reserved, but is not used to store entries
+    void shrinkToFit( )
+    {
+        times_.shrink_to_fit( );
+        states_.conservativeResize( getEntrySize( ), numberOfEntries_ );
+    }
+
+    //! Function to retrieve the number of entries in the history
+    /*!
+     *  Function to retrieve the number of entries in the history
+     *  \return Number of entries in the history
+     */
+    unsigned int size( ) const
+    {
+        return numberOfEntries_;
+    }
+
+    //! Function to check whether the history is empty
+    /*!
+     *  Function to check whether the history is empty
+     *  \return True if the history contains no entries
+     */
+    bool empty( ) const
+    {
+        return ( numberOfEntries_ == 0 );
+    }
+
+    //! Function to retrieve the number of rows of each state
+    /*!
+     *  Function to retrieve the number of rows of each state
+     *  \return Number of rows of each state
+     */
+    int getNumberOfEntryRows( ) const
+    {
+        return numberOfEntryRows_;
+    }
+
+    //! Function to retrieve the number of columns of each state
+    /*!
+     *  Function to retrieve the number of columns of each state
+     *  \return Number of columns of each state
+     */
+    int getNumberOfEntryColumns( ) const
+    {
+        return numberOfEntryColumns_;
+    }
+
+    //! Function to retrieve the times of all entries, in the order in which they were added
+    /*!
+     *  Function to retrieve the times of all entries, in the order in which they were added
+     *  \return Times of all entries
+     */
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the time of a given entry
+    /*!
+     *  Function to retrieve the time of a given entry
+     *  \param entryIndex Index of entry
+     *  \return Time of requested entry
+     */
+    const TimeType& getTime( const unsigned int entryIndex ) const
+    {
+        return times_.at( entryIndex );
+    }
+
+    //! Function to retrieve a given entry
+    /*!
+     *  Function to retrieve a given entry, as a read-only view (without copying) on the stored data. The view is
+     *  invalidated when entries are added to the history.
+     *  \param entryIndex Index of entry
+     *  \return View on requested entry
+     */
+    ConstEntryType getEntry( const unsigned int entryIndex ) const
+    {
+        if( entryIndex >= numberOfEntries_ )
+        {
+            throw std::runtime_error( "Error when retrieving entry " + std::to_string( entryIndex ) +
+                                      " from columnar state history, history has " +
+                                      std::to_string( numberOfEntries_ ) + " entries" );
+        }
+        return ConstEntryType( states_.data( ) + static_cast< long >( entryIndex ) * getEntrySize( ),
+                               numberOfEntryRows_, numberOfEntryColumns_ );
+    }
+
+    //! Function to retrieve the time of the last entry
+    /*!
+     *  Function to retrieve the time of the last entry
+     *  \return Time of the last entry
+     */
+    const TimeType& getLastTime( ) const
+    {
+        return getTime( numberOfEntries_ - 1 );
+    }
+
+    //! Function to retrieve the last entry
+    /*!
+     *  Function to retrieve the last entry
+     *  \return View on the last entry
+     */
+    ConstEntryType getLastEntry( ) const
+    {
+        return getEntry( numberOfEntries_ - 1 );
+    }
+
+    //! Function to retrieve the block containing all states
+    /*!
+     *  Function to retrieve the block containing all states, with each column containing one (column-major flattened)
+     *  state, in the order in which they were added.
+     *  \return Block containing all states
+     */
+    Eigen::Block< const StateBlockType, Eigen::Dynamic, Eigen::Dynamic, true > getStateBlock( ) const
+    {
+        return states_.leftCols( numberOfEntries_ );
+    }
+
+    //! Function to create a map with the contents of the history
+    /*!
+     *  Function to create a map with the contents of the history, with the time as key
+     *  \return Map with the contents of the history
+     */
+    template< typename StateType = Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
+    std::map< TimeType, StateType > createMap( ) const
+    {
+        std::map< TimeType, StateType > stateMap;
+        fillMap( stateMap );
+        return stateMap;
+    }
+
+    //! Function to fill a map with the contents of the history
+    /*!
+     *  Function to fill a map with the contents of the history, with the time as key. Existing contents of the map are
+     *  removed.
+     *  \param stateMap Map with the contents of the history (returned by reference)
+     */
+    template< typename StateType >
+    void fillMap( std::map< TimeType, StateType >& stateMap ) const
+    {
+        stateMap.clear( );
+
+        // Use end of map as insertion hint for ascending, and beginning for descending times
+        bool isDescending = ( numberOfEntries_ > 1 ) && ( times_.back( ) < times_.front( ) );
+        for( unsigned int i = 0; i < numberOfEntries_; i++ )
+        {
+            StateType currentState;
+            convertEntry( getEntry( i ), currentState );
+            stateMap.emplace_hint( isDescending ? stateMap.begin( ) : stateMap.end( ), times_[ i ], currentState );
+        }
+    }
+
+    //! Function to reset the contents of the history from a map
+    /*!
+     *  Function to reset the contents of the history from a map, with the time as key. Existing contents of the history
+     *  are removed.
+     *  \param stateMap Map from which the history is to be set
+     */
+    template< typename StateType >
+    void setFromMap( const std::map< TimeType, StateType >& stateMap )
+    {
+        clear( );
+        for( const auto& mapEntry : stateMap )
+        {
+            addEntry( mapEntry.first, mapEntry.second );
+            if( numberOfEntries_ == 1 )
+            {
+                reserve( stateMap.size( ) );
+            }
+        }
+    }
+
+private:
+
+    //! Function to retrieve the number of entries for which memory is allocated
+    unsigned int getCapacity( ) const
+    {
+        return static_cast< unsigned int >( states_.cols( ) );
+    }
+
+    //! Function to retrieve the number of scalar entries per state
+    long getEntrySize( ) const
+    {
+        return static_cast< long >( numberOfEntryRows_ ) * static_cast< long >( numberOfEntryColumns_ );
+    }
+
+    //! Function to convert an entry to an Eigen object
+    template< typename Derived >
+    static void convertEntry( const ConstEntryType& entry, Eigen::PlainObjectBase< Derived >& convertedEntry )
+    {
+        convertedEntry = entry.template cast< typename Derived::Scalar >( );
+    }
+
+    //! Function to convert a 1x1 entry to a scalar
+    static void convertEntry( const ConstEntryType& entry, StateScalarType& convertedEntry )
+    {
+        convertedEntry = entry( 0, 0 );
+    }
+
+    //! Number of rows of each state
+    int numberOfEntryRows_;
+
+    //! Number of columns of each state
+    int numberOfEntryColumns_;
+
+    //! Number of entries in the history
+    unsigned int numberOfEntries_;
+
+    //! Times of the entries, in the order in which they were added
+    std::vector< TimeType > times_;
+
+    //! Block with states, one (column-major flattened) state per column. Number of columns is the allocated capacity.
+    StateBlockType states_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_COLUMNARSTATEHISTORY_H
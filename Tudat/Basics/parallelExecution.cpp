@@ -0,0 +1,132 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Tudat/Basics/parallelExecution.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Boolean denoting whether the current thread is executing tasks concurrently with other threads.
+static thread_local bool isCurrentThreadExecutingParallelTasks = false;
+
+//! Function to check whether the calling thread is executing tasks concurrently with other threads.
+bool isExecutingParallelTasks( )
+{
+    return isCurrentThreadExecutingParallelTasks;
+}
+
+//! Boolean denoting whether the current thread accesses objects that are concurrently accessed by other threads.
+static thread_local bool isCurrentThreadAccessingSharedObjectsConcurrently = false;
+
+//! Function to check whether the calling thread accesses objects that are concurrently accessed by other threads.
+bool isAccessingSharedObjectsConcurrently( )
+{
+    return isCurrentThreadAccessingSharedObjectsConcurrently;
+}
+
+//! Constructor
+ConcurrentSharedObjectAccess::ConcurrentSharedObjectAccess( const bool isAccessConcurrent ):
+    wasAccessingSharedObjectsConcurrently_( isCurrentThreadAccessingSharedObjectsConcurrently )
+{
+    if( isAccessConcurrent )
+    {
+        isCurrentThreadAccessingSharedObjectsConcurrently = true;
+    }
+}
+
+//! Destructor, restores the marking of the calling thread to that before the constructor was called.
+ConcurrentSharedObjectAccess::~ConcurrentSharedObjectAccess( )
+{
+    isCurrentThreadAccessingSharedObjectsConcurrently = wasAccessingSharedObjectsConcurrently_;
+}
+
+//! Function to retrieve the number of threads that can be executed concurrently on the current hardware.
+unsigned int getNumberOfAvailableThreads( )
+{
+    unsigned int numberOfThreads = std::thread::hardware_concurrency( );
+    return ( numberOfThreads > 0 ) ? numberOfThreads : 1;
+}
+
+//! Function to execute a list of independent tasks on a fixed set of worker threads.
+void executeParallelTasks( const unsigned int numberOfTasks,
+                           const unsigned int numberOfThreads,
+                           const std::function< void( const unsigned int, const unsigned int ) >& taskFunction )
+{
+    if( numberOfThreads == 0 )
+    {
+        throw std::runtime_error( "Error when executing parallel tasks, number of threads must be at least 1." );
+    }
+
+    // No need to start more workers than there are tasks
+    unsigned int numberOfWorkers = ( numberOfTasks < numberOfThreads ) ? numberOfTasks : numberOfThreads;
+    std::vector< std::exception_ptr > workerExceptions( numberOfWorkers );
+
+    // Function executing all tasks assigned to a single worker
+    auto workerFunction = [ & ]( const unsigned int workerIndex )
+    {
+        bool wasExecutingParallelTasks = isCurrentThreadExecutingParallelTasks;
+        if( numberOfWorkers > 1 )
+        {
+            isCurrentThreadExecutingParallelTasks = true;
+        }
+
+        try
+        {
+            for( unsigned int taskIndex = workerIndex; taskIndex < numberOfTasks; taskIndex += numberOfWorkers )
+            {
+                taskFunction( taskIndex, workerIndex );
+            }
+        }
+        catch( ... )
+        {
+            workerExceptions[ workerIndex ] = std::current_exception( );
+        }
+
+        isCurrentThreadExecutingParallelTasks = wasExecutingParallelTasks;
+    };
+
+    // Start additional workers, and use the calling thread as worker 0
+    std::vector< std::thread > workerThreads;
+    for( unsigned int i = 1; i < numberOfWorkers; i++ )
+    {
+        workerThreads.push_back( std::thread( workerFunction, i ) );
+    }
+
+    if( numberOfWorkers > 0 )
+    {
+        workerFunction( 0 );
+    }
+
+    for( unsigned int i = 0; i < workerThreads.size( ); i++ )
+    {
+        workerThreads.at( i ).join( );
+    }
+
+    // Rethrow first exception that was encountered (if any)
+    for( unsigned int i = 0; i < workerExceptions.size( ); i++ )
+    {
+        if( workerExceptions.at( i ) != nullptr )
+        {
+            std::rethrow_exception( workerExceptions.at( i ) );
+        }
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
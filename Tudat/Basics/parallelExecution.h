@@ -0,0 +1,103 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLELEXECUTION_H
+#define TUDAT_PARALLELEXECUTION_H
+
+#include <functional>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads that can be executed concurrently on the current hardware.
+/*!
+ *  Function to retrieve the number of threads that can be executed concurrently on the current hardware. If this number
+ *  cannot be determined, 1 is returned.
+ *  \return Number of threads that can be executed concurrently on the current hardware.
+ */
+unsigned int getNumberOfAvailableThreads( );
+
+//! Function to execute a list of independent tasks on a fixed set of worker threads.
+/*!
+ *  Function to execute a list of independent tasks on a fixed set of worker threads. The tasks are distributed statically
+ *  over the workers: task i is always executed by worker ( i % numberOfThreads ), and each worker executes its tasks in
+ *  increasing order. Worker 0 is the calling thread. Since the distribution does not depend on timing, a worker can safely
+ *  operate on its own (non-thread-safe) set of objects, which it selects using the worker index passed to the task
+ *  function. If a task throws an exception, the remaining tasks of that worker are skipped, and the exception of the
+ *  lowest worker index is rethrown once all workers have finished.
+ *  \param numberOfTasks Number of tasks that are to be executed.
+ *  \param numberOfThreads Number of worker threads to use. If equal to 1, all tasks are executed on the calling thread.
+ *  \param taskFunction Function executing a single task, with the task index as first, and the worker index as second
+ *  argument.
+ */
+void executeParallelTasks( const unsigned int numberOfTasks,
+                           const unsigned int numberOfThreads,
+                           const std::function< void( const unsigned int, const unsigned int ) >& taskFunction );
+
+//! Function to check whether the calling thread is executing tasks concurrently with other threads.
+/*!
+ *  Function to check whether the calling thread is executing tasks of executeParallelTasks, while more than one worker
+ *  thread is active. Can be used to prevent nested parallel execution.
+ *  \return True if the calling thread is executing tasks concurrently with other threads, false otherwise.
+ */
+bool isExecutingParallelTasks( );
+
+//! Function to check whether the calling thread accesses objects that are concurrently accessed by other threads.
+/*!
+ *  Function to check whether the calling thread accesses objects that are concurrently accessed by other threads, as marked
+ *  by a ConcurrentSharedObjectAccess object that exists on the calling thread. Objects that store results of previous
+ *  evaluations in member variables (and are therefore not safe for concurrent use) can use this function to bypass such
+ *  storage when called concurrently.
+ *  \return True if the calling thread accesses objects concurrently with other threads, false otherwise.
+ */
+bool isAccessingSharedObjectsConcurrently( );
+
+//! Class to mark the calling thread as accessing objects that are concurrently accessed by other threads.
+/*!
+ *  Class to mark the calling thread as accessing objects that are concurrently accessed by other threads (see
+ *  isAccessingSharedObjectsConcurrently), for the lifetime of the object. To be created in the task function of
+ *  executeParallelTasks if the tasks share (part of) their environment, as opposed to tasks that each operate on their own
+ *  objects, for which no such marking is needed.
+ */
+class ConcurrentSharedObjectAccess
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, marks the calling thread as accessing objects concurrently with other threads (if requested)
+     *  \param isAccessConcurrent Boolean denoting whether the objects are in fact accessed concurrently (e.g. false if only
+     *  a single worker thread is used).
+     */
+    ConcurrentSharedObjectAccess( const bool isAccessConcurrent = true );
+
+    //! Destructor, restores the marking of the calling thread to that before the constructor was called.
+    ~ConcurrentSharedObjectAccess( );
+
+private:
+
+    //! Copy constructor (deleted, since the object is bound to the thread and scope in which it is created)
+    ConcurrentSharedObjectAccess( const ConcurrentSharedObjectAccess& ) = delete;
+
+    //! Assignment operator (deleted, since the object is bound to the thread and scope in which it is created)
+    ConcurrentSharedObjectAccess& operator=( const ConcurrentSharedObjectAccess& ) = delete;
+
+    //! Boolean denoting whether the calling thread was marked as accessing shared objects before construction.
+    bool wasAccessingSharedObjectsConcurrently_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELEXECUTION_H
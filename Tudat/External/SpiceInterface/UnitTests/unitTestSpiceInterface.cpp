@@ -34,6 +34,7 @@
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
@@ -479,6 +480,169 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 0 );
 }
 
+// Test 8: Concurrent use of Spice ephemerides and pre-sampled Spice ephemerides.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_8 )
+{
+    using namespace spice_interface;
+    using namespace ephemerides;
+
+    // Load Spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Retrieve states of Moon and Mars serially.
+    std::vector< std::string > targetBodyNames = { "Moon", "Mars" };
+    const int numberOfTimes = 400;
+    const double initialTime = 1.0E7;
+    const double timeStep = 1800.0;
+    std::vector< std::vector< Eigen::Vector6d > > serialStates( targetBodyNames.size( ) );
+    for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfTimes; j++ )
+        {
+            serialStates[ i ].push_back( getBodyCartesianStateAtEpoch(
+                                             targetBodyNames.at( i ), "Earth", "J2000", "NONE",
+                                             initialTime + static_cast< double >( j ) * timeStep ) );
+        }
+    }
+
+    // Retrieve same states concurrently from shared Spice ephemerides, requesting each state twice (second request
+    // retrieved from thread-local storage).
+    std::vector< std::shared_ptr< Ephemeris > > spiceEphemerides;
+    for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+    {
+        spiceEphemerides.push_back( std::make_shared< SpiceEphemeris >(
+                                        targetBodyNames.at( i ), "Earth", false, false, false, "J2000" ) );
+    }
+
+    std::vector< std::vector< Eigen::Vector6d > > parallelStates(
+                targetBodyNames.size( ), std::vector< Eigen::Vector6d >( numberOfTimes ) );
+    utilities::executeParallelTasks(
+                numberOfTimes, 4, [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+        {
+            const double currentTime = initialTime + static_cast< double >( taskIndex ) * timeStep;
+            parallelStates[ i ][ taskIndex ] = spiceEphemerides.at( i )->getCartesianState( currentTime );
+            if( spiceEphemerides.at( i )->getCartesianState( currentTime ) != parallelStates[ i ][ taskIndex ] )
+            {
+                throw std::runtime_error( "Error, repeated state from Spice ephemeris is inconsistent" );
+            }
+        }
+    } );
+
+    for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfTimes; j++ )
+        {
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( parallelStates[ i ][ j ]( k ), serialStates[ i ][ j ]( k ) );
+            }
+        }
+    }
+
+    // Check that modification of kernel pool is registered (invalidating stored states), and states are consistent
+    // after reloading kernels.
+    const unsigned int kernelPoolVersion = getSpiceKernelPoolVersion( );
+    clearSpiceKernels( );
+    spice_interface::loadStandardSpiceKernels( );
+    BOOST_CHECK( getSpiceKernelPoolVersion( ) > kernelPoolVersion );
+    for( int k = 0; k < 6; k++ )
+    {
+        BOOST_CHECK_EQUAL( spiceEphemerides.at( 0 )->getCartesianState( initialTime )( k ), serialStates[ 0 ][ 0 ]( k ) );
+    }
+
+    // Create more Spice ephemerides than there are thread-local storage slots (so that slots are shared), and check
+    // that alternating requests from objects sharing a slot return the state of the requesting object.
+    std::vector< std::shared_ptr< Ephemeris > > additionalSpiceEphemerides;
+    for( int i = 0; i < 65; i++ )
+    {
+        additionalSpiceEphemerides.push_back( std::make_shared< SpiceEphemeris >(
+                                                  targetBodyNames.at( i % 2 ), "Earth", false, false, false, "J2000" ) );
+    }
+    for( int i = 0; i < 65; i++ )
+    {
+        for( int k = 0; k < 6; k++ )
+        {
+            BOOST_CHECK_EQUAL( additionalSpiceEphemerides.at( i )->getCartesianState( initialTime )( k ),
+                               serialStates[ i % 2 ][ 0 ]( k ) );
+            BOOST_CHECK_EQUAL( additionalSpiceEphemerides.at( 64 - i )->getCartesianState( initialTime )( k ),
+                               serialStates[ ( 64 - i ) % 2 ][ 0 ]( k ) );
+        }
+    }
+
+    // Create pre-sampled ephemerides, and evaluate them concurrently.
+    std::map< std::string, std::shared_ptr< ChebyshevEphemeris > > presampledEphemerides =
+            createPresampledSpiceEphemerides(
+                targetBodyNames, "Earth", "J2000", initialTime,
+                initialTime + static_cast< double >( numberOfTimes - 1 ) * timeStep );
+
+    utilities::executeParallelTasks(
+                numberOfTimes, 4, [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+        {
+            parallelStates[ i ][ taskIndex ] = presampledEphemerides.at( targetBodyNames.at( i ) )->getCartesianState(
+                        initialTime + static_cast< double >( taskIndex ) * timeStep );
+        }
+    } );
+
+    for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( presampledEphemerides.at( targetBodyNames.at( i ) )->getReferenceFrameOrigin( ), "Earth" );
+        for( int j = 0; j < numberOfTimes; j++ )
+        {
+            BOOST_CHECK_SMALL( ( parallelStates[ i ][ j ] - serialStates[ i ][ j ] ).segment( 0, 3 ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( ( parallelStates[ i ][ j ] - serialStates[ i ][ j ] ).segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+    }
+
+    // Create pre-sampled rotational ephemeris of Earth, and evaluate it concurrently.
+    std::shared_ptr< TabulatedRotationalEphemeris< double, double > > presampledRotationalEphemeris =
+            createPresampledSpiceRotationalEphemeris(
+                "J2000", "IAU_Earth", initialTime,
+                initialTime + static_cast< double >( numberOfTimes - 1 ) * timeStep, timeStep / 4.0 );
+
+    std::vector< Eigen::Matrix3d > parallelRotationMatrices( numberOfTimes );
+    std::vector< Eigen::Vector3d > parallelAngularVelocities( numberOfTimes );
+    utilities::executeParallelTasks(
+                numberOfTimes, 4, [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        // Evaluate halfway between sampled times
+        const double currentTime = initialTime + ( static_cast< double >( taskIndex ) + 0.125 ) * timeStep;
+        parallelRotationMatrices[ taskIndex ] =
+                Eigen::Matrix3d( presampledRotationalEphemeris->getRotationToBaseFrame( currentTime ) );
+        parallelAngularVelocities[ taskIndex ] =
+                presampledRotationalEphemeris->getRotationalVelocityVectorInBaseFrame( currentTime );
+    } );
+
+    // Compare pre-sampled rotation to rotation retrieved directly from Spice
+    SpiceRotationalEphemeris spiceRotationalEphemeris( "J2000", "IAU_Earth" );
+    BOOST_CHECK_EQUAL( presampledRotationalEphemeris->getBaseFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( presampledRotationalEphemeris->getTargetFrameOrientation( ), "IAU_Earth" );
+    for( int j = 0; j < numberOfTimes; j++ )
+    {
+        const double currentTime = initialTime + ( static_cast< double >( j ) + 0.125 ) * timeStep;
+        BOOST_CHECK_SMALL( ( parallelRotationMatrices[ j ] - Eigen::Matrix3d(
+                                 spiceRotationalEphemeris.getRotationToBaseFrame( currentTime ) ) ).norm( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( ( parallelAngularVelocities[ j ] -
+                             spiceRotationalEphemeris.getRotationalVelocityVectorInBaseFrame( currentTime ) ).norm( ),
+                           1.0E-14 );
+    }
+
+    // Check that invalid sampling settings are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        createPresampledSpiceRotationalEphemeris( "J2000", "IAU_Earth", initialTime, initialTime + 3600.0, 60.0, 5 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
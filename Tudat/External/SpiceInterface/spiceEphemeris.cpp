@@ -9,6 +9,9 @@
  *
  */
 
+#include <array>
+#include <atomic>
+#include <limits>
 #include <stdexcept>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
@@ -21,6 +24,32 @@ namespace tudat
 namespace ephemerides
 {
 
+//! Function to retrieve a new unique identifier for a Spice ephemeris object.
+unsigned int getNewSpiceEphemerisIdentifier( )
+{
+    static std::atomic< unsigned int > numberOfCreatedSpiceEphemerides( 0 );
+    return numberOfCreatedSpiceEphemerides++;
+}
+
+//! Most recent state retrieved by a Spice ephemeris object (stored per thread).
+struct SpiceEphemerisStateCacheEntry
+{
+    //! Identifier of Spice ephemeris object by which state was retrieved (see SpiceEphemeris::ephemerisIdentifier_)
+    unsigned int ephemerisIdentifier = std::numeric_limits< unsigned int >::max( );
+
+    //! Time at which state was retrieved (NaN if no state has been retrieved yet)
+    double time = std::numeric_limits< double >::quiet_NaN( );
+
+    //! Version of kernel pool (see spice_interface::getSpiceKernelPoolVersion) from which state was retrieved
+    unsigned int kernelPoolVersion = 0;
+
+    //! State retrieved from Spice (unaligned, so that it can be stored in standard containers)
+    Eigen::Matrix< double, 6, 1, Eigen::DontAlign > state;
+};
+
+//! Number of slots in which states retrieved from Spice are stored per thread (see SpiceEphemeris::getCartesianState).
+static const unsigned int NUMBER_OF_SPICE_EPHEMERIS_STATE_CACHE_SLOTS = 64;
+
 //! Constructor
 SpiceEphemeris::SpiceEphemeris( const std::string& targetBodyName,
                                 const std::string& observerBodyName,
@@ -30,7 +59,8 @@ SpiceEphemeris::SpiceEphemeris( const std::string& targetBodyName,
                                 const std::string& referenceFrameName,
                                 const double referenceJulianDay )
     : Ephemeris( observerBodyName, referenceFrameName ),
-      targetBodyName_( targetBodyName )
+      targetBodyName_( targetBodyName ),
+      ephemerisIdentifier_( getNewSpiceEphemerisIdentifier( ) )
 {
     referenceDayOffSet_ = ( referenceJulianDay - basic_astrodynamics::JULIAN_DAY_ON_J2000 ) * physical_constants::JULIAN_DAY;
 
@@ -83,13 +113,48 @@ Eigen::Vector6d SpiceEphemeris::getCartesianState(
     // Calculate ephemeris time at which cartesian state is to be determind.
     const double ephemerisTime = secondsSinceEpoch;
 
-    // Retrieve Cartesian state from spice.
-    const Eigen::Vector6d cartesianStateAtEpoch =
-            spice_interface::getBodyCartesianStateAtEpoch(
-                targetBodyName_, referenceFrameOrigin_, referenceFrameOrientation_,
-                aberrationCorrections_, ephemerisTime + referenceDayOffSet_ );
+    // Check if state at this time was retrieved most recently by this thread (from the current kernels). The states are
+    // stored in a fixed number of slots per thread, so that the storage does not grow with the number of objects. An
+    // object shares its slot with those objects whose identifiers are equal modulo the number of slots.
+    thread_local std::array< SpiceEphemerisStateCacheEntry, NUMBER_OF_SPICE_EPHEMERIS_STATE_CACHE_SLOTS > stateCache;
+    const unsigned int kernelPoolVersion = spice_interface::getSpiceKernelPoolVersion( );
 
-    return cartesianStateAtEpoch;
+    SpiceEphemerisStateCacheEntry& cacheEntry =
+            stateCache[ ephemerisIdentifier_ % NUMBER_OF_SPICE_EPHEMERIS_STATE_CACHE_SLOTS ];
+    if( !( cacheEntry.ephemerisIdentifier == ephemerisIdentifier_ && cacheEntry.time == ephemerisTime &&
+           cacheEntry.kernelPoolVersion == kernelPoolVersion ) )
+    {
+        // Retrieve Cartesian state from spice.
+        cacheEntry.state = spice_interface::getBodyCartesianStateAtEpoch(
+                    targetBodyName_, referenceFrameOrigin_, referenceFrameOrientation_,
+                    aberrationCorrections_, ephemerisTime + referenceDayOffSet_ );
+        cacheEntry.ephemerisIdentifier = ephemerisIdentifier_;
+        cacheEntry.time = ephemerisTime;
+        cacheEntry.kernelPoolVersion = kernelPoolVersion;
+    }
+
+    return cacheEntry.state;
+}
+
+//! Function to create ephemerides that are pre-sampled from Spice, for use by multiple threads.
+std::map< std::string, std::shared_ptr< ChebyshevEphemeris > > createPresampledSpiceEphemerides(
+        const std::vector< std::string >& targetBodyNames,
+        const std::string& observerBodyName,
+        const std::string& referenceFrameName,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance,
+        const double velocityTolerance )
+{
+    std::map< std::string, std::shared_ptr< ChebyshevEphemeris > > presampledEphemerides;
+    for( unsigned int i = 0; i < targetBodyNames.size( ); i++ )
+    {
+        presampledEphemerides[ targetBodyNames.at( i ) ] = createChebyshevEphemeris(
+                    std::make_shared< SpiceEphemeris >(
+                        targetBodyNames.at( i ), observerBodyName, false, false, false, referenceFrameName ),
+                    initialTime, finalTime, positionTolerance, velocityTolerance );
+    }
+    return presampledEphemerides;
 }
 
 } // namespace ephemerides
@@ -17,6 +17,10 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
 
+#include <map>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 
 #include "Tudat/Basics/basicTypedefs.h"
@@ -31,7 +35,11 @@ namespace ephemerides
  *  Ephemeris derived class which retrieves the state of a body directly from the SPICE library.
  *  The body of which the ephemeris is to be retrieved, as well as the origin and orientation
  *  of the reference frame in which the states are returned, and any corrections that are
- *  applied, are defined once during object construction.
+ *  applied, are defined once during object construction. Calls to Spice are serialized (see
+ *  spice_interface::getSpiceMutex). The most recently retrieved state is stored per thread, so
+ *  that repeated requests for the same time (e.g. by several acceleration models) from a thread do
+ *  not call Spice, nor interfere with requests from other threads. A fixed number of such states is
+ *  stored per thread, so objects may share a slot (in which case a state may be retrieved again).
  */
 class SpiceEphemeris : public Ephemeris
 {
@@ -107,8 +115,35 @@ private:
 
     //! Offset of reference julian day (from J2000) w.r.t. which ephemeris is evaluated.
     double referenceDayOffSet_;
+
+    //! Unique identifier of this object, used to select and verify the thread-local slot storing the most recent state.
+    unsigned int ephemerisIdentifier_;
 };
 
+//! Function to create ephemerides that are pre-sampled from Spice, for use by multiple threads.
+/*!
+ *  Function to create ephemerides that are pre-sampled from Spice (as Chebyshev ephemerides, see
+ *  createChebyshevEphemeris), for a list of bodies in a single frame. The Spice kernels are only accessed when creating
+ *  the ephemerides. The resulting objects are not modified when evaluated, so that any number of threads can use them
+ *  concurrently without locking, instead of each call being serialized by the Spice interface.
+ *  \param targetBodyNames Names of bodies for which ephemerides are to be created.
+ *  \param observerBodyName Name of body relative to which the ephemerides are to be calculated.
+ *  \param referenceFrameName Name of the reference frame in which the ephemerides are to be calculated.
+ *  \param initialTime Start time of the interval on which the ephemerides are to be valid.
+ *  \param finalTime End time of the interval on which the ephemerides are to be valid.
+ *  \param positionTolerance Maximum permitted difference in position w.r.t. Spice.
+ *  \param velocityTolerance Maximum permitted difference in velocity w.r.t. Spice.
+ *  \return Pre-sampled ephemerides (values), with the names of the bodies as keys.
+ */
+std::map< std::string, std::shared_ptr< ChebyshevEphemeris > > createPresampledSpiceEphemerides(
+        const std::vector< std::string >& targetBodyNames,
+        const std::string& observerBodyName,
+        const std::string& referenceFrameName,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance = 1.0E-3,
+        const double velocityTolerance = 1.0E-6 );
+
 } // namespace ephemerides
 } // namespace tudat
 
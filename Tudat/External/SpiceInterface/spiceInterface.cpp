@@ -9,6 +9,7 @@
  *
  */
 
+#include <atomic>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
@@ -21,6 +22,22 @@ namespace spice_interface
 
 using Eigen::Vector6d;
 
+//! Number of times the Spice kernel pool has been modified (by loading or clearing kernels) through the Tudat interface.
+static std::atomic< unsigned int > spiceKernelPoolVersion( 0 );
+
+//! Function to retrieve the mutex with which all calls to the Spice library in the Tudat interface are serialized.
+std::recursive_mutex& getSpiceMutex( )
+{
+    static std::recursive_mutex spiceMutex;
+    return spiceMutex;
+}
+
+//! Function to retrieve the number of times the Spice kernel pool has been modified through the Tudat interface.
+unsigned int getSpiceKernelPoolVersion( )
+{
+    return spiceKernelPoolVersion.load( );
+}
+
 //! Convert a Julian date to ephemeris time (equivalent to TDB in Spice).
 double convertJulianDateToEphemerisTime( const double julianDate )
 {
@@ -36,6 +53,9 @@ double convertEphemerisTimeToJulianDate( const double ephemerisTime )
 //! Converts a date string to ephemeris time.
 double convertDateStringToEphemerisTime( const std::string& dateString )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double ephemerisTime = 0.0;
     str2et_c( dateString.c_str( ), &ephemerisTime );
     return ephemerisTime;
@@ -47,6 +67,8 @@ Vector6d getBodyCartesianStateAtEpoch(
         const std::string& referenceFrameName, const std::string& aberrationCorrections,
         const double ephemerisTime )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
 
     // Declare variables for cartesian state and light-time to be determined by Spice.
     double stateAtEpoch[ 6 ];
@@ -76,6 +98,9 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch( const std::string& targetBodyNa
                                                  const std::string& aberrationCorrections,
                                                  const double ephemerisTime )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Declare variables for cartesian position and light-time to be determined by Spice.
     double positionAtEpoch[ 3 ];
     double lightTime;
@@ -102,6 +127,9 @@ Eigen::Quaterniond computeRotationQuaternionBetweenFrames( const std::string& or
                                                            const std::string& newFrame,
                                                            const double ephemerisTime )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Declare rotation matrix.
     double rotationArray[ 3 ][ 3 ];
 
@@ -127,6 +155,9 @@ Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames( const std::string&
                                                               const std::string& newFrame,
                                                               const double ephemerisTime )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double stateTransition[ 6 ][ 6 ];
 
     // Calculate state transition matrix.
@@ -150,6 +181,9 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame( const std::strin
                                                                 const std::string& newFrame,
                                                                 const double ephemerisTime )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double stateTransition[ 6 ][ 6 ];
 
     // Calculate state transition matrix.
@@ -168,6 +202,9 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame( const std::strin
 std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
         const std::string& originalFrame, const std::string& newFrame, const double ephemerisTime )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double stateTransition[ 6 ][ 6 ];
 
     sxform_c( originalFrame.c_str( ), newFrame.c_str( ), ephemerisTime, stateTransition );
@@ -190,6 +227,9 @@ std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRot
 std::vector< double > getBodyProperties( const std::string& body, const std::string& property,
                                          const int maximumNumberOfValues )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Delcare variable in which raw result is to be put by Spice function.
     double propertyArray[ maximumNumberOfValues ];
 
@@ -211,6 +251,9 @@ std::vector< double > getBodyProperties( const std::string& body, const std::str
 //! Get gravitational parameter of a body.
 double getBodyGravitationalParameter( const std::string& body )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Delcare variable in which raw result is to be put by Spice function.
     double gravitationalParameter[ 1 ];
 
@@ -228,6 +271,9 @@ double getBodyGravitationalParameter( const std::string& body )
 //! Get the (arithmetic) mean of the three principal axes of the tri-axial ellipsoid shape.
 double getAverageRadius( const std::string& body )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Delcare variable in which raw result is to be put by Spice function.
     double radii[ 3 ];
 
@@ -243,6 +289,9 @@ double getAverageRadius( const std::string& body )
 //! Convert a body name to its NAIF identification number.
 int convertBodyNameToNaifId( const std::string& bodyName )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Convert body name to NAIF ID number.
     SpiceInt bodyNaifId;
     SpiceBoolean isIdFound;
@@ -255,6 +304,9 @@ int convertBodyNameToNaifId( const std::string& bodyName )
 //! Check if a certain property of a body is in the kernel pool.
 bool checkBodyPropertyInKernelPool( const std::string& bodyName, const std::string& bodyProperty )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Convert body name to NAIF ID.
     const int naifId = convertBodyNameToNaifId( bodyName );
 
@@ -266,19 +318,29 @@ bool checkBodyPropertyInKernelPool( const std::string& bodyName, const std::stri
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat( const std::string& fileName )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
     furnsh_c(  fileName.c_str( ) );
+    spiceKernelPoolVersion++;
 }
 
 //! Get the amount of loaded Spice kernels.
 int getTotalCountOfKernelsLoaded( )
 {
+    // Serialize access to Spice library.
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     SpiceInt count;
     ktotal_c( "ALL", &count );
     return count;
 }
 
 //! Clear all Spice kernels.
-void clearSpiceKernels( ) { kclear_c( ); }
+void clearSpiceKernels( )
+{
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+    kclear_c( );
+    spiceKernelPoolVersion++;
+}
 
 void loadStandardSpiceKernels( const std::vector< std::string > alternativeEphemerisKernels  )
 {
@@ -24,6 +24,7 @@
 #ifndef TUDAT_SPICE_INTERFACE_H
 #define TUDAT_SPICE_INTERFACE_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,27 @@ namespace tudat
 namespace spice_interface
 {
 
+//! Function to retrieve the mutex with which all calls to the Spice library in the Tudat interface are serialized.
+/*!
+ *  Function to retrieve the mutex with which all calls to the Spice library in the Tudat interface are serialized. The
+ *  Spice library uses global state (kernel pool, internal buffers and error status) and is not thread-safe, so each of the
+ *  wrapper functions in this file locks this (recursive) mutex for the duration of its call(s) to Spice. Code calling
+ *  Spice functions directly, while other threads may use the Tudat interface, must lock this mutex as well. Note that
+ *  Spice is not called concurrently as a result, so that for parallel applications, ephemerides pre-sampled from Spice
+ *  (see createPresampledSpiceEphemerides) should be preferred.
+ *  \return Mutex with which all calls to the Spice library in the Tudat interface are serialized.
+ */
+std::recursive_mutex& getSpiceMutex( );
+
+//! Function to retrieve the number of times the Spice kernel pool has been modified through the Tudat interface.
+/*!
+ *  Function to retrieve the number of times the Spice kernel pool has been modified (by loading or clearing kernels)
+ *  through the Tudat interface. Objects that store results retrieved from Spice can use this number to detect that
+ *  these results may have become invalid.
+ *  \return Number of times the Spice kernel pool has been modified through the Tudat interface.
+ */
+unsigned int getSpiceKernelPoolVersion( );
+
 //! Convert a Julian date to ephemeris time (equivalent to TDB in Spice).
 /*!
  * Function to convert a Julian date to ephemeris time, which is equivalent to barycentric
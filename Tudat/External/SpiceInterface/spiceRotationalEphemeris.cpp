@@ -7,12 +7,16 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  */
+#include <cmath>
+#include <map>
 #include <stdexcept>
+#include <string>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
 {
@@ -59,6 +63,55 @@ void SpiceRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
                 Eigen::Matrix3d( currentRotationToLocalFrame ), currentRotationToLocalFrameDerivative.transpose( ) );
 }
 
+//! Function to create a rotational ephemeris that is pre-sampled from Spice, for use by multiple threads.
+std::shared_ptr< TabulatedRotationalEphemeris< double, double > > createPresampledSpiceRotationalEphemeris(
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation,
+        const double initialTime,
+        const double finalTime,
+        const double timeStep,
+        const int numberOfInterpolationPoints )
+{
+    if( !( finalTime > initialTime ) || !( timeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when pre-sampling Spice rotation, interval or time step is invalid" );
+    }
+
+    if( numberOfInterpolationPoints < 2 || numberOfInterpolationPoints % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when pre-sampling Spice rotation, number of interpolation points must be "
+                                  "even and positive, is " + std::to_string( numberOfInterpolationPoints ) );
+    }
+
+    // Sample rotational state from Spice, including margin at both ends of interval
+    SpiceRotationalEphemeris spiceRotationalEphemeris( baseFrameOrientation, targetFrameOrientation );
+    const int numberOfMarginPoints = numberOfInterpolationPoints / 2;
+    const int numberOfIntervalPoints = static_cast< int >( std::ceil( ( finalTime - initialTime ) / timeStep ) ) + 1;
+
+    std::map< double, Eigen::Matrix< double, 7, 1 > > rotationalStates;
+    Eigen::Matrix< double, 7, 1 > previousRotationalState;
+    for( int i = -numberOfMarginPoints; i < numberOfIntervalPoints + numberOfMarginPoints; i++ )
+    {
+        const double currentTime = initialTime + static_cast< double >( i ) * timeStep;
+        Eigen::Matrix< double, 7, 1 > currentRotationalState =
+                spiceRotationalEphemeris.getRotationStateVector( currentTime );
+
+        // Select sign of quaternion (q and -q represent the same rotation) such that it is continuous in time
+        if( i > -numberOfMarginPoints &&
+                currentRotationalState.segment( 0, 4 ).dot( previousRotationalState.segment( 0, 4 ) ) < 0.0 )
+        {
+            currentRotationalState.segment( 0, 4 ) *= -1.0;
+        }
+        rotationalStates[ currentTime ] = currentRotationalState;
+        previousRotationalState = currentRotationalState;
+    }
+
+    return std::make_shared< TabulatedRotationalEphemeris< double, double > >(
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Matrix< double, 7, 1 > > >(
+                    rotationalStates, numberOfInterpolationPoints ),
+                baseFrameOrientation, targetFrameOrientation );
+}
+
 
 } // namespace ephemerides
 
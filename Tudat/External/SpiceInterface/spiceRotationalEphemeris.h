@@ -1,21 +1,23 @@
-/*    Copyright (c) 2010-2018, Delft University of Technology
- *    All rigths reserved
- *
- *    This file is part of the Tudat. Redistribution and use in source and
- *    binary forms, with or without modification, are permitted exclusively
- *    under the terms of the Modified BSD license. You should have received
- *    a copy of the license with this file. If not, please or visit:
- *    http://tudat.tudelft.nl/LICENSE.
- */
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
 #ifndef TUDAT_SPICEROTATIONALEPHEMERIS_H
 #define TUDAT_SPICEROTATIONALEPHEMERIS_H
 
+#include <memory>
 #include <string>
 
 #include <Eigen/Geometry>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
 
 namespace tudat
 {
@@ -28,7 +30,8 @@ namespace ephemerides
  *  Class to directly calculate rotational state of body from spice kernel(s).
  *  Note that if an object of this class is called often, it may become a performance bottleneck,
  *  using the an interpolated rotation will generally be more efficient, but at the expense of
- *  interpolation errors.
+ *  interpolation errors (see createPresampledSpiceRotationalEphemeris). Contrary to SpiceEphemeris,
+ *  no retrieved rotations are stored, so that each call is serialized by the Spice interface.
  */
 class SpiceRotationalEphemeris : public RotationalEphemeris
 {
@@ -134,6 +137,28 @@ private:
 
 };
 
+//! Function to create a rotational ephemeris that is pre-sampled from Spice, for use by multiple threads.
+/*!
+ *  Function to create a rotational ephemeris that is pre-sampled from Spice (as a tabulated rotational ephemeris with a
+ *  Lagrange interpolator of the quaternion and body-fixed angular velocity vector). The Spice kernels are only accessed
+ *  when creating the ephemeris. Sampling starts (ends) half the number of interpolation points before (after) the
+ *  initial (final) time, so that the interpolator is not evaluated near its boundaries within the requested interval.
+ *  \param baseFrameOrientation Base frame identifier.
+ *  \param targetFrameOrientation Target frame identifier.
+ *  \param initialTime Start time of the interval on which the ephemeris is to be valid.
+ *  \param finalTime End time of the interval on which the ephemeris is to be valid.
+ *  \param timeStep Time step with which the rotation is sampled.
+ *  \param numberOfInterpolationPoints Number of points used by Lagrange interpolator (must be even).
+ *  \return Pre-sampled rotational ephemeris.
+ */
+std::shared_ptr< TabulatedRotationalEphemeris< double, double > > createPresampledSpiceRotationalEphemeris(
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation,
+        const double initialTime,
+        const double finalTime,
+        const double timeStep,
+        const int numberOfInterpolationPoints = 8 );
+
 } // namespace ephemerides
 
 } // namespace tudat
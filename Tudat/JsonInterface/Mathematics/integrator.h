@@ -29,6 +29,7 @@ static std::map< AvailableIntegrators, std::string > integratorTypes =
     { rungeKuttaVariableStepSize, "rungeKuttaVariableStepSize" },
     { adamsBashforthMoulton, "adamsBashforthMoulton" },
     { bulirschStoer, "bulirschStoer" },
+    { gaussJackson, "gaussJackson" },
 };
 
 //! `AvailableIntegrators` not supported by `json_interface`.
@@ -53,7 +54,9 @@ static std::map< RungeKuttaCoefficients::CoefficientSets, std::string > rungeKut
     { RungeKuttaCoefficients::rungeKuttaFehlberg45, "rungeKuttaFehlberg45" },
     { RungeKuttaCoefficients::rungeKuttaFehlberg56, "rungeKuttaFehlberg56" },
     { RungeKuttaCoefficients::rungeKuttaFehlberg78, "rungeKuttaFehlberg78" },
-    { RungeKuttaCoefficients::rungeKutta87DormandPrince, "rungeKutta87DormandPrince" }
+    { RungeKuttaCoefficients::rungeKutta87DormandPrince, "rungeKutta87DormandPrince" },
+    { RungeKuttaCoefficients::rungeKutta54DormandPrince, "rungeKutta54DormandPrince" },
+    { RungeKuttaCoefficients::rungeKutta65Verner, "rungeKutta65Verner" }
 };
 
 //! `RungeKuttaCoefficients::CoefficientSets` not supported by `json_interface`.
@@ -169,6 +172,22 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< IntegratorSetti
 
         return;
     }
+    case gaussJackson:
+    {
+        std::shared_ptr< GaussJacksonSettings< TimeType > > gaussJacksonSettings =
+                std::dynamic_pointer_cast< GaussJacksonSettings< TimeType > >( integratorSettings );
+        assertNonnullptrPointer( gaussJacksonSettings );
+        jsonObject[ K::stepSize ] = gaussJacksonSettings->initialTimeStep_;
+        jsonObject[ K::secondOrderStateIndices ] = gaussJacksonSettings->secondOrderStateIndices_;
+        jsonObject[ K::rungeKuttaCoefficientSet ] =
+                stringFromEnum( gaussJacksonSettings->startupCoefficientSet_, rungeKuttaCoefficientSets );
+        jsonObject[ K::relativeErrorTolerance ] = gaussJacksonSettings->startupRelativeErrorTolerance_;
+        jsonObject[ K::absoluteErrorTolerance ] = gaussJacksonSettings->startupAbsoluteErrorTolerance_;
+        jsonObject[ K::correctorRelativeErrorTolerance ] = gaussJacksonSettings->correctorRelativeErrorTolerance_;
+        jsonObject[ K::correctorAbsoluteErrorTolerance ] = gaussJacksonSettings->correctorAbsoluteErrorTolerance_;
+        jsonObject[ K::maximumNumberOfCorrectorIterations ] = gaussJacksonSettings->maximumNumberOfCorrectorIterations_;
+        return;
+    }
     default:
         handleUnimplementedEnumValue( integratorType, integratorTypes, unsupportedIntegratorTypes );
     }
@@ -284,6 +303,28 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< IntegratorSet
                               defaults.minimumFactorDecreaseForNextStepSize_ ) );
         return;
     }
+    case gaussJackson:
+    {
+        GaussJacksonSettings< TimeType > defaults( 0.0, 0.0 );
+
+        integratorSettings = std::make_shared< GaussJacksonSettings< TimeType > >(
+                    initialTime,
+                    getValue< TimeType >( jsonObject, K::stepSize ),
+                    getValue( jsonObject, K::secondOrderStateIndices, defaults.secondOrderStateIndices_ ),
+                    getValue( jsonObject, K::rungeKuttaCoefficientSet, defaults.startupCoefficientSet_ ),
+                    getValue( jsonObject, K::relativeErrorTolerance, defaults.startupRelativeErrorTolerance_ ),
+                    getValue( jsonObject, K::absoluteErrorTolerance, defaults.startupAbsoluteErrorTolerance_ ),
+                    getValue( jsonObject, K::correctorRelativeErrorTolerance,
+                              defaults.correctorRelativeErrorTolerance_ ),
+                    getValue( jsonObject, K::correctorAbsoluteErrorTolerance,
+                              defaults.correctorAbsoluteErrorTolerance_ ),
+                    getValue( jsonObject, K::maximumNumberOfCorrectorIterations,
+                              defaults.maximumNumberOfCorrectorIterations_ ),
+                    getValue( jsonObject, K::saveFrequency, defaults.saveFrequency_ ),
+                    getValue( jsonObject, K::assessPropagationTerminationConditionDuringIntegrationSubsteps,
+                              defaults.assessPropagationTerminationConditionDuringIntegrationSubsteps_ ) );
+        return;
+    }
     default:
         handleUnimplementedEnumValue( integratorType, integratorTypes, unsupportedIntegratorTypes );
     }
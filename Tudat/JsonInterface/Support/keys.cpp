@@ -440,6 +440,10 @@ const std::string Keys::Integrator::extrapolationSequence = "extrapolationSequen
 const std::string Keys::Integrator::maximumNumberOfSteps = "maximumNumberOfSteps";
 const std::string Keys::Integrator::maximumOrder = "maximumOrder";
 const std::string Keys::Integrator::minimumOrder = "minimumOrder";
+const std::string Keys::Integrator::secondOrderStateIndices = "secondOrderStateIndices";
+const std::string Keys::Integrator::correctorRelativeErrorTolerance = "correctorRelativeErrorTolerance";
+const std::string Keys::Integrator::correctorAbsoluteErrorTolerance = "correctorAbsoluteErrorTolerance";
+const std::string Keys::Integrator::maximumNumberOfCorrectorIterations = "maximumNumberOfCorrectorIterations";
 
 //  Interpolation
 
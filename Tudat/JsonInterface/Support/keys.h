@@ -469,6 +469,10 @@ struct Keys
         static const std::string maximumNumberOfSteps;
         static const std::string minimumOrder;
         static const std::string maximumOrder;
+        static const std::string secondOrderStateIndices;
+        static const std::string correctorRelativeErrorTolerance;
+        static const std::string correctorAbsoluteErrorTolerance;
+        static const std::string maximumNumberOfCorrectorIterations;
     };
 
     struct Interpolation
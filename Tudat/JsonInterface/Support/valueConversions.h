@@ -146,6 +146,15 @@ void from_json( const nlohmann::json& jsonObject, vector< ValueType >& myVector
 
 // STD::PAIR
 
+//! Create a `json` object from a `std::pair`.
+template< typename V, typename W >
+void to_json( nlohmann::json& jsonObject, const pair< V, W >& myPair )
+{
+    jsonObject = nlohmann::json::array( );
+    jsonObject.push_back( myPair.first );
+    jsonObject.push_back( myPair.second );
+}
+
 //! Create a `std::pair` from a `json` object.
 template< typename V, typename W >
 void from_json( const nlohmann::json& jsonObject, pair< V, W >& myPair )
@@ -200,6 +200,33 @@ BOOST_AUTO_TEST_CASE( test_json_integrator_bulirschStoer )
     BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
 }
 
+// Test 7: gaussJackson
+BOOST_AUTO_TEST_CASE( test_json_integrator_gaussJackson )
+{
+    using namespace tudat::numerical_integrators;
+    using namespace tudat::json_interface;
+
+    // Create IntegratorSettings from JSON file
+    const std::shared_ptr< IntegratorSettings< double > > fromFileSettings =
+            parseJSONFile< std::shared_ptr< IntegratorSettings< double > > >( INPUT( "gaussJackson" ) );
+
+    // Create IntegratorSettings manually
+    const double initialTime = -0.3;
+    const double stepSize = 1.4;
+    const RungeKuttaCoefficients::CoefficientSets startupCoefficientSet = RungeKuttaCoefficients::rungeKutta87DormandPrince;
+    const double startupRelativeErrorTolerance = 1.0E-12;
+    const double correctorRelativeErrorTolerance = 1.0E-11;
+    const unsigned int maximumNumberOfCorrectorIterations = 4;
+    const std::shared_ptr< IntegratorSettings< double > > manualSettings =
+            std::make_shared< GaussJacksonSettings< double > >(
+                initialTime, stepSize, getCartesianSecondOrderStateIndices( 1 ), startupCoefficientSet,
+                startupRelativeErrorTolerance, 1.0E-13, correctorRelativeErrorTolerance, 1.0E-12,
+                maximumNumberOfCorrectorIterations );
+
+    // Compare
+    BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,163 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/blockedSphericalHarmonics.h"
+#include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::basic_mathematics;
+
+//! Function to generate coefficients with a Kaula-like decay in magnitude
+void getTestCoefficients( const int maximumDegree, const int maximumOrder,
+                          Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    cosineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumOrder + 1 );
+    sineCoefficients = Eigen::MatrixXd::Random( maximumDegree + 1, maximumOrder + 1 );
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= maximumOrder; order++ )
+        {
+            if( order > degree )
+            {
+                cosineCoefficients( degree, order ) = 0.0;
+                sineCoefficients( degree, order ) = 0.0;
+            }
+            else
+            {
+                double scaling = ( degree == 0 ) ? 1.0 : 1.0E-5 / static_cast< double >( degree * degree );
+                cosineCoefficients( degree, order ) *= scaling;
+                sineCoefficients( degree, order ) *= ( order == 0 ) ? 0.0 : scaling;
+            }
+        }
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+}
+
+//! Function to compute spherical potential gradient by term-by-term summation, using SphericalHarmonicsCache.
+Eigen::Vector3d computeTermByTermPotentialGradient(
+        const Eigen::Vector3d& sphericalPosition, const double referenceRadius, const double preMultiplier,
+        const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+        const std::shared_ptr< SphericalHarmonicsCache > sphericalHarmonicsCache )
+{
+    sphericalHarmonicsCache->update( sphericalPosition( 0 ), std::sin( sphericalPosition( 1 ) ),
+                                     sphericalPosition( 2 ), referenceRadius );
+
+    Eigen::Vector3d gradient = Eigen::Vector3d::Zero( );
+    for( int degree = 0; degree < cosineCoefficients.rows( ); degree++ )
+    {
+        for( int order = 0; ( order <= degree ) && ( order < cosineCoefficients.cols( ) ); order++ )
+        {
+            gradient += computePotentialGradient(
+                        sphericalPosition, preMultiplier, degree, order,
+                        cosineCoefficients( degree, order ), sineCoefficients( degree, order ),
+                        sphericalHarmonicsCache->getLegendreCache( )->getLegendrePolynomial( degree, order ),
+                        sphericalHarmonicsCache->getLegendreCache( )->getLegendrePolynomialDerivative( degree, order ),
+                        sphericalHarmonicsCache );
+        }
+    }
+    return gradient;
+}
+
+BOOST_AUTO_TEST_SUITE( test_BlockedSphericalHarmonics )
+
+//! Test whether Legendre polynomials in order-major blocks are identical to those of LegendreCache.
+BOOST_AUTO_TEST_CASE( testBlockedLegendrePolynomials )
+{
+    int maximumDegree = 50;
+    int maximumOrder = 30;
+
+    BlockedSphericalHarmonicsKernel sphericalHarmonicsKernel( maximumDegree, maximumOrder );
+    LegendreCache legendreCache( maximumDegree, maximumOrder + 1, true );
+
+    std::vector< double > polynomialParameters = { -0.9, -0.3, 0.0, 0.45, 0.99 };
+    for( unsigned int i = 0; i < polynomialParameters.size( ); i++ )
+    {
+        sphericalHarmonicsKernel.update( 7.0E6, polynomialParameters.at( i ), 0.3, 6.0E6 );
+        legendreCache.update( polynomialParameters.at( i ) );
+
+        for( int degree = 0; degree <= maximumDegree; degree++ )
+        {
+            for( int order = 0; order <= std::min( degree, maximumOrder + 1 ); order++ )
+            {
+                BOOST_CHECK_SMALL( sphericalHarmonicsKernel.getLegendrePolynomial( degree, order ) -
+                                   legendreCache.getLegendrePolynomial( degree, order ), 1.0E-12 );
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW( sphericalHarmonicsKernel.getLegendrePolynomial( maximumDegree + 1, 0 ), std::runtime_error );
+}
+
+//! Test whether the potential gradient is identical to term-by-term summation, and compare computation times.
+BOOST_AUTO_TEST_CASE( testBlockedPotentialGradient )
+{
+    const double referenceRadius = 6378137.0;
+    const double preMultiplier = 3.986004418E14 / referenceRadius;
+
+    std::vector< Eigen::Vector3d > sphericalPositions;
+    sphericalPositions.push_back( ( Eigen::Vector3d( ) << 6.8E6, 0.3, -2.1 ).finished( ) );
+    sphericalPositions.push_back( ( Eigen::Vector3d( ) << 7.2E6, -1.2, 0.8 ).finished( ) );
+    sphericalPositions.push_back( ( Eigen::Vector3d( ) << 4.2E7, 1.4, 3.0 ).finished( ) );
+
+    std::vector< std::pair< int, int > > testDegreesAndOrders =
+    { { 5, 5 }, { 20, 10 }, { 50, 50 }, { 100, 100 }, { 200, 200 }, { 360, 360 } };
+
+    for( unsigned int i = 0; i < testDegreesAndOrders.size( ); i++ )
+    {
+        int maximumDegree = testDegreesAndOrders.at( i ).first;
+        int maximumOrder = testDegreesAndOrders.at( i ).second;
+
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getTestCoefficients( maximumDegree, maximumOrder, cosineCoefficients, sineCoefficients );
+
+        std::shared_ptr< SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< SphericalHarmonicsCache >( maximumDegree, maximumOrder + 1 );
+        BlockedSphericalHarmonicsKernel sphericalHarmonicsKernel( maximumDegree, maximumOrder );
+
+        // Check equality of results
+        for( unsigned int j = 0; j < sphericalPositions.size( ); j++ )
+        {
+            Eigen::Vector3d expectedGradient = computeTermByTermPotentialGradient(
+                        sphericalPositions.at( j ), referenceRadius, preMultiplier,
+                        cosineCoefficients, sineCoefficients, sphericalHarmonicsCache );
+
+            sphericalHarmonicsKernel.update(
+                        sphericalPositions.at( j )( 0 ), std::sin( sphericalPositions.at( j )( 1 ) ),
+                        sphericalPositions.at( j )( 2 ), referenceRadius );
+            Eigen::Vector3d computedGradient = sphericalHarmonicsKernel.computePotentialGradient(
+                        preMultiplier, cosineCoefficients, sineCoefficients );
+
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( ( computedGradient( k ) - expectedGradient( k ) ) / expectedGradient.norm( ),
+                                   1.0E-13 );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
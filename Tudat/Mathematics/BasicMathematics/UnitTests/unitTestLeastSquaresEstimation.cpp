@@ -0,0 +1,591 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+//! Test whether block-wise accumulation of normal equations reproduces estimation from full information matrix
+BOOST_AUTO_TEST_CASE( testNormalEquationAccumulation )
+{
+    // Use number of parameters that is not a multiple of the panel width of the accumulator
+    const int numberOfParameters = 150;
+    const int numberOfObservations = 1000;
+
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+    Eigen::MatrixXd inverseAPrioriCovariance = 0.1 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+
+    // Set one column to zero, and one column to negative values only
+    informationMatrix.col( 3 ).setZero( );
+    informationMatrix.col( 7 ) = -informationMatrix.col( 7 ).cwiseAbs( );
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedOutput = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights, inverseAPrioriCovariance );
+
+    std::vector< unsigned int > numberOfThreads = { 1, 3 };
+    std::vector< Eigen::MatrixXd > normalMatrices;
+    for( unsigned int i = 0; i < numberOfThreads.size( ); i++ )
+    {
+        // Accumulate normal equations in blocks of unequal size
+        NormalEquationAccumulator normalEquationAccumulator( numberOfParameters, numberOfThreads.at( i ) );
+        int currentRow = 0;
+        int currentBlockSize = 1;
+        while( currentRow < numberOfObservations )
+        {
+            int blockSize = std::min( currentBlockSize, numberOfObservations - currentRow );
+            normalEquationAccumulator.addObservationBlock(
+                        informationMatrix.middleRows( currentRow, blockSize ),
+                        residuals.segment( currentRow, blockSize ), weights.segment( currentRow, blockSize ) );
+            currentRow += blockSize;
+            currentBlockSize = 2 * currentBlockSize + 1;
+        }
+        BOOST_CHECK_EQUAL( normalEquationAccumulator.getNumberOfObservations( ), numberOfObservations );
+
+        normalMatrices.push_back( normalEquationAccumulator.getNormalMatrix( ) );
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > computedOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                    normalMatrices.back( ) + inverseAPrioriCovariance, normalEquationAccumulator.getRightHandSide( ) );
+
+        // Compare with results from full information matrix
+        double matrixNorm = expectedOutput.second.norm( );
+        BOOST_CHECK_SMALL( ( computedOutput.second - expectedOutput.second ).norm( ) / matrixNorm, 1.0E-14 );
+        BOOST_CHECK_SMALL( ( computedOutput.first - expectedOutput.first ).norm( ) / expectedOutput.first.norm( ),
+                           1.0E-12 );
+
+        // Check symmetry of normal matrix
+        BOOST_CHECK_EQUAL( ( normalMatrices.back( ) - normalMatrices.back( ).transpose( ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+        // Check normalization terms
+        Eigen::VectorXd normalizationTerms = normalEquationAccumulator.getNormalizationTerms( );
+        BOOST_CHECK_EQUAL( normalizationTerms( 3 ), 1.0 );
+        BOOST_CHECK( normalizationTerms( 7 ) < 0.0 );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            Eigen::VectorXd normalizedColumn = informationMatrix.col( j ) / normalizationTerms( j );
+            BOOST_CHECK_CLOSE_FRACTION( normalizedColumn.cwiseAbs( ).maxCoeff( ), ( j == 3 ) ? 0.0 : 1.0, 1.0E-15 );
+            BOOST_CHECK( normalizedColumn.maxCoeff( ) <= 1.0 );
+        }
+
+        // Check reset
+        normalEquationAccumulator.reset( );
+        BOOST_CHECK_EQUAL( normalEquationAccumulator.getNumberOfObservations( ), 0 );
+        BOOST_CHECK_EQUAL( normalEquationAccumulator.getNormalMatrix( ).cwiseAbs( ).maxCoeff( ), 0.0 );
+        BOOST_CHECK_EQUAL( normalEquationAccumulator.getRightHandSide( ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+
+    // Results must be independent of the number of threads
+    BOOST_CHECK_EQUAL( ( normalMatrices.at( 0 ) - normalMatrices.at( 1 ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    // Check inconsistent input
+    NormalEquationAccumulator normalEquationAccumulator( numberOfParameters );
+    BOOST_CHECK_THROW( normalEquationAccumulator.addObservationBlock(
+                           informationMatrix.leftCols( numberOfParameters - 1 ), residuals, weights ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( normalEquationAccumulator.addObservationBlock(
+                           informationMatrix, residuals.segment( 0, 10 ), weights ),
+                       std::runtime_error );
+}
+
+//! Test whether constraints are handled identically when estimating from information matrix or normal equations
+BOOST_AUTO_TEST_CASE( testConstrainedNormalEquations )
+{
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( 50, 4 );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( 50 );
+    Eigen::VectorXd weights = Eigen::VectorXd::Ones( 50 );
+
+    Eigen::MatrixXd constraintMultiplier = ( Eigen::MatrixXd( 1, 4 ) << 1.0, -1.0, 0.0, 0.0 ).finished( );
+    Eigen::VectorXd constraintRightHandSide = Eigen::VectorXd::Zero( 1 );
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedOutput = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights, Eigen::MatrixXd::Zero( 4, 4 ), 1, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+
+    NormalEquationAccumulator normalEquationAccumulator( 4 );
+    normalEquationAccumulator.addObservationBlock( informationMatrix, residuals, weights );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > computedOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalEquationAccumulator.getNormalMatrix( ), normalEquationAccumulator.getRightHandSide( ), 1, 1.0E8,
+                constraintMultiplier, constraintRightHandSide );
+
+    BOOST_CHECK_EQUAL( computedOutput.first.rows( ), 5 );
+    BOOST_CHECK_SMALL( ( computedOutput.first - expectedOutput.first ).norm( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( computedOutput.first( 0 ) - computedOutput.first( 1 ), 1.0E-12 );
+
+    BOOST_CHECK_THROW( performLeastSquaresAdjustmentFromNormalEquations(
+                           normalEquationAccumulator.getNormalMatrix( ), Eigen::VectorXd::Zero( 3 ) ),
+                       std::runtime_error );
+}
+
+//! Test whether sequential square-root information accumulation reproduces estimation from full information matrix
+BOOST_AUTO_TEST_CASE( testSquareRootInformationAccumulation )
+{
+    const int numberOfParameters = 40;
+    const int numberOfObservations = 600;
+
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+    Eigen::MatrixXd inverseAPrioriCovariance = 0.1 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    inverseAPrioriCovariance( 0, 1 ) = inverseAPrioriCovariance( 1, 0 ) = 0.05;
+
+    // Accumulate square-root information in blocks of unequal size
+    SquareRootInformationAccumulator squareRootInformationAccumulator( numberOfParameters );
+    int currentRow = 0;
+    int currentBlockSize = 1;
+    while( currentRow < numberOfObservations )
+    {
+        int blockSize = std::min( currentBlockSize, numberOfObservations - currentRow );
+        squareRootInformationAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( currentRow, blockSize ),
+                    residuals.segment( currentRow, blockSize ), weights.segment( currentRow, blockSize ) );
+        currentRow += blockSize;
+        currentBlockSize = 2 * currentBlockSize + 1;
+    }
+    BOOST_CHECK_EQUAL( squareRootInformationAccumulator.getNumberOfObservations( ), numberOfObservations );
+
+    // Check that square-root information matrix is upper triangular, and consistent with normal equations
+    Eigen::MatrixXd squareRootInformationMatrix = squareRootInformationAccumulator.getSquareRootInformationMatrix( );
+    Eigen::VectorXd transformedResiduals = squareRootInformationAccumulator.getTransformedResiduals( );
+    Eigen::MatrixXd strictlyLowerPart = squareRootInformationMatrix.triangularView< Eigen::StrictlyLower >( );
+    BOOST_CHECK_EQUAL( strictlyLowerPart.cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    Eigen::MatrixXd normalMatrix = informationMatrix.transpose( ) * weights.asDiagonal( ) * informationMatrix;
+    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) * weights.cwiseProduct( residuals );
+    BOOST_CHECK_SMALL( ( squareRootInformationAccumulator.getNormalMatrix( ) - normalMatrix ).norm( ) /
+                       normalMatrix.norm( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( squareRootInformationMatrix.transpose( ) * transformedResiduals - rightHandSide ).norm( ) /
+                       rightHandSide.norm( ), 1.0E-14 );
+
+    // Compare estimation with and without a priori information with results from full information matrix
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedOutput = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights, inverseAPrioriCovariance );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > computedOutput =
+            performLeastSquaresAdjustmentFromSquareRootInformation(
+                squareRootInformationMatrix, transformedResiduals, inverseAPrioriCovariance );
+    BOOST_CHECK_SMALL( ( computedOutput.second - expectedOutput.second ).norm( ) / expectedOutput.second.norm( ),
+                       1.0E-14 );
+    BOOST_CHECK_SMALL( ( computedOutput.first - expectedOutput.first ).norm( ) / expectedOutput.first.norm( ),
+                       1.0E-12 );
+
+    expectedOutput = performLeastSquaresAdjustmentFromInformationMatrix( informationMatrix, residuals, weights );
+    computedOutput = performLeastSquaresAdjustmentFromSquareRootInformation(
+                squareRootInformationMatrix, transformedResiduals );
+    BOOST_CHECK_SMALL( ( computedOutput.first - expectedOutput.first ).norm( ) / expectedOutput.first.norm( ),
+                       1.0E-12 );
+
+    // Check post-fit residual norm
+    Eigen::VectorXd postFitResiduals = residuals - informationMatrix * computedOutput.first;
+    BOOST_CHECK_CLOSE_FRACTION( squareRootInformationAccumulator.getSquaredResidualNorm( ),
+                                postFitResiduals.dot( weights.cwiseProduct( postFitResiduals ) ), 1.0E-12 );
+
+    // Check reset
+    squareRootInformationAccumulator.reset( );
+    BOOST_CHECK_EQUAL( squareRootInformationAccumulator.getNumberOfObservations( ), 0 );
+    BOOST_CHECK_EQUAL( squareRootInformationAccumulator.getSquareRootInformationMatrix( ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    BOOST_CHECK_EQUAL( squareRootInformationAccumulator.getTransformedResiduals( ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    BOOST_CHECK_EQUAL( squareRootInformationAccumulator.getSquaredResidualNorm( ), 0.0 );
+
+    // Check inconsistent input
+    BOOST_CHECK_THROW( squareRootInformationAccumulator.addObservationBlock(
+                           informationMatrix.leftCols( numberOfParameters - 1 ), residuals, weights ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( squareRootInformationAccumulator.addObservationBlock(
+                           informationMatrix, residuals, -weights ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( performLeastSquaresAdjustmentFromSquareRootInformation(
+                           squareRootInformationMatrix, transformedResiduals.segment( 0, 10 ) ),
+                       std::runtime_error );
+}
+
+//! Test whether update of square-root information reproduces a QR decomposition of the full stacked system
+BOOST_AUTO_TEST_CASE( testSquareRootInformationUpdate )
+{
+    const int numberOfParameters = 12;
+    const int numberOfRows = 30;
+
+    // Create initial square-root information, with a zero diagonal entry, and new rows, with a zero column
+    Eigen::MatrixXd squareRootInformationMatrix = Eigen::MatrixXd::Random( numberOfParameters, numberOfParameters ).
+            triangularView< Eigen::Upper >( );
+    squareRootInformationMatrix( 3, 3 ) = 0.0;
+    Eigen::VectorXd transformedResiduals = Eigen::VectorXd::Random( numberOfParameters );
+    Eigen::MatrixXd informationMatrixRows = Eigen::MatrixXd::Random( numberOfRows, numberOfParameters );
+    informationMatrixRows.col( 5 ).setZero( );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfRows );
+
+    // Compute QR decomposition of stacked system [ R z; A r ]
+    Eigen::MatrixXd stackedSystem( numberOfParameters + numberOfRows, numberOfParameters + 1 );
+    stackedSystem << squareRootInformationMatrix, transformedResiduals, informationMatrixRows, residuals;
+    Eigen::HouseholderQR< Eigen::MatrixXd > qrDecomposition( stackedSystem );
+    Eigen::MatrixXd expectedTriangularFactor = qrDecomposition.matrixQR( ).topRows( numberOfParameters + 1 ).
+            triangularView< Eigen::Upper >( );
+
+    double squaredResidualNorm = updateSquareRootInformation(
+                squareRootInformationMatrix, transformedResiduals, informationMatrixRows, residuals );
+
+    // Triangular factors are unique up to the sign of each row
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        double rowSign = ( ( squareRootInformationMatrix( i, i ) >= 0.0 ) ==
+                           ( expectedTriangularFactor( i, i ) >= 0.0 ) ) ? 1.0 : -1.0;
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( squareRootInformationMatrix( i, j ) - rowSign * expectedTriangularFactor( i, j ), 1.0E-13 );
+        }
+        BOOST_CHECK_SMALL( transformedResiduals( i ) - rowSign * expectedTriangularFactor( i, numberOfParameters ),
+                           1.0E-13 );
+    }
+    BOOST_CHECK_CLOSE_FRACTION(
+                squaredResidualNorm, std::pow( expectedTriangularFactor( numberOfParameters, numberOfParameters ), 2 ),
+                1.0E-13 );
+
+    // Check that adding no rows leaves square-root information unchanged
+    Eigen::MatrixXd updatedSquareRootInformationMatrix = squareRootInformationMatrix;
+    BOOST_CHECK_EQUAL( updateSquareRootInformation(
+                           squareRootInformationMatrix, transformedResiduals,
+                           Eigen::MatrixXd::Zero( 0, numberOfParameters ), Eigen::VectorXd::Zero( 0 ) ), 0.0 );
+    BOOST_CHECK_EQUAL( ( squareRootInformationMatrix - updatedSquareRootInformationMatrix ).cwiseAbs( ).maxCoeff( ), 0.0 );
+}
+
+//! Test whether square-root information is more accurate than normal equations for an ill-conditioned problem
+BOOST_AUTO_TEST_CASE( testSquareRootInformationConditioning )
+{
+    const int numberOfParameters = 10;
+    const int numberOfObservations = 200;
+
+    // Create information matrix with condition number 1.0E7 (i.e. normal matrix with condition number 1.0E14)
+    Eigen::HouseholderQR< Eigen::MatrixXd > leftDecomposition(
+                Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters ) );
+    Eigen::HouseholderQR< Eigen::MatrixXd > rightDecomposition(
+                Eigen::MatrixXd::Random( numberOfParameters, numberOfParameters ) );
+    Eigen::VectorXd singularValues( numberOfParameters );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        singularValues( i ) = std::pow( 10.0, -7.0 * static_cast< double >( i ) / ( numberOfParameters - 1 ) );
+    }
+    Eigen::MatrixXd informationMatrix =
+            ( leftDecomposition.householderQ( ) * Eigen::MatrixXd::Identity( numberOfObservations, numberOfParameters ) ) *
+            singularValues.asDiagonal( ) * Eigen::MatrixXd( rightDecomposition.householderQ( ) );
+
+    Eigen::VectorXd trueAdjustment = Eigen::VectorXd::Random( numberOfParameters );
+    Eigen::VectorXd residuals = informationMatrix * trueAdjustment;
+    Eigen::VectorXd weights = Eigen::VectorXd::Ones( numberOfObservations );
+
+    SquareRootInformationAccumulator squareRootInformationAccumulator( numberOfParameters );
+    NormalEquationAccumulator normalEquationAccumulator( numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i += 25 )
+    {
+        squareRootInformationAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( i, 25 ), residuals.segment( i, 25 ), weights.segment( i, 25 ) );
+        normalEquationAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( i, 25 ), residuals.segment( i, 25 ), weights.segment( i, 25 ) );
+    }
+
+    Eigen::VectorXd squareRootInformationAdjustment = performLeastSquaresAdjustmentFromSquareRootInformation(
+                squareRootInformationAccumulator.getSquareRootInformationMatrix( ),
+                squareRootInformationAccumulator.getTransformedResiduals( ), false ).first;
+    Eigen::VectorXd normalEquationAdjustment = performLeastSquaresAdjustmentFromNormalEquations(
+                normalEquationAccumulator.getNormalMatrix( ), normalEquationAccumulator.getRightHandSide( ), false ).first;
+
+    double squareRootInformationError =
+            ( squareRootInformationAdjustment - trueAdjustment ).norm( ) / trueAdjustment.norm( );
+    double normalEquationError = ( normalEquationAdjustment - trueAdjustment ).norm( ) / trueAdjustment.norm( );
+    BOOST_CHECK_SMALL( squareRootInformationError, 1.0E-6 );
+    BOOST_CHECK( squareRootInformationError < normalEquationError );
+}
+
+//! Test whether parameters (e.g. of a new arc) can be added between blocks of observations
+BOOST_AUTO_TEST_CASE( testIncrementalParameterAddition )
+{
+    // Two arcs, each with 50 observations, 2 global and 3 arc-wise parameters (order: global, arc 1, arc 2)
+    const int numberOfArcObservations = 50;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( 2 * numberOfArcObservations, 8 );
+    informationMatrix.leftCols( 2 ) = Eigen::MatrixXd::Random( 2 * numberOfArcObservations, 2 );
+    informationMatrix.block( 0, 2, numberOfArcObservations, 3 ) = Eigen::MatrixXd::Random( numberOfArcObservations, 3 );
+    informationMatrix.block( numberOfArcObservations, 5, numberOfArcObservations, 3 ) =
+            Eigen::MatrixXd::Random( numberOfArcObservations, 3 );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( 2 * numberOfArcObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( 2 * numberOfArcObservations, 4.0 );
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > expectedOutput = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights );
+
+    SquareRootInformationAccumulator squareRootInformationAccumulator( 5 );
+    NormalEquationAccumulator normalEquationAccumulator( 5 );
+    for( int arc = 0; arc < 2; arc++ )
+    {
+        if( arc > 0 )
+        {
+            squareRootInformationAccumulator.addParameters( 3 );
+            normalEquationAccumulator.addParameters( 3 );
+        }
+
+        const int numberOfParameters = 5 + 3 * arc;
+        BOOST_CHECK_EQUAL( squareRootInformationAccumulator.getNumberOfParameters( ), numberOfParameters );
+        squareRootInformationAccumulator.addObservationBlock(
+                    informationMatrix.block( arc * numberOfArcObservations, 0, numberOfArcObservations, numberOfParameters ),
+                    residuals.segment( arc * numberOfArcObservations, numberOfArcObservations ),
+                    weights.segment( arc * numberOfArcObservations, numberOfArcObservations ) );
+        normalEquationAccumulator.addObservationBlock(
+                    informationMatrix.block( arc * numberOfArcObservations, 0, numberOfArcObservations, numberOfParameters ),
+                    residuals.segment( arc * numberOfArcObservations, numberOfArcObservations ),
+                    weights.segment( arc * numberOfArcObservations, numberOfArcObservations ) );
+    }
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > squareRootInformationOutput =
+            performLeastSquaresAdjustmentFromSquareRootInformation(
+                squareRootInformationAccumulator.getSquareRootInformationMatrix( ),
+                squareRootInformationAccumulator.getTransformedResiduals( ) );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > normalEquationOutput = performLeastSquaresAdjustmentFromNormalEquations(
+                normalEquationAccumulator.getNormalMatrix( ), normalEquationAccumulator.getRightHandSide( ) );
+
+    BOOST_CHECK_SMALL( ( squareRootInformationOutput.first - expectedOutput.first ).norm( ) /
+                       expectedOutput.first.norm( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( normalEquationOutput.first - expectedOutput.first ).norm( ) /
+                       expectedOutput.first.norm( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( squareRootInformationOutput.second - expectedOutput.second ).norm( ) /
+                       expectedOutput.second.norm( ), 1.0E-14 );
+
+    // Normalization terms must be identical to those of the full information matrix
+    Eigen::VectorXd squareRootInformationNormalization = squareRootInformationAccumulator.getNormalizationTerms( );
+    Eigen::VectorXd normalEquationNormalization = normalEquationAccumulator.getNormalizationTerms( );
+    for( int j = 0; j < informationMatrix.cols( ); j++ )
+    {
+        Eigen::VectorXd normalizedColumn = informationMatrix.col( j ) / squareRootInformationNormalization( j );
+        BOOST_CHECK_EQUAL( normalizedColumn.cwiseAbs( ).maxCoeff( ), 1.0 );
+        BOOST_CHECK_EQUAL( squareRootInformationNormalization( j ), normalEquationNormalization( j ) );
+    }
+}
+
+//! Test whether elimination of arc-wise parameters reproduces estimation from full normal equations
+BOOST_AUTO_TEST_CASE( testArcWiseParameterElimination )
+{
+    // Set parameter layout: arc-wise states (arc-major), global parameters, arc-wise biases
+    const int numberOfArcs = 12;
+    const int numberOfGlobalParameters = 5;
+    const int numberOfArcObservations = 40;
+    std::vector< int > parameterArcIndices;
+    for( int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        for( int i = 0; i < 6; i++ )
+        {
+            parameterArcIndices.push_back( arc );
+        }
+    }
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        parameterArcIndices.push_back( -1 );
+    }
+    for( int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        parameterArcIndices.push_back( arc );
+    }
+    const int numberOfParameters = parameterArcIndices.size( );
+
+    // Create information matrix, with each observation depending on global parameters and on local parameters of one arc
+    // (or on global parameters only)
+    const int numberOfObservations = numberOfArcs * numberOfArcObservations + 10;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        const int currentArc = i / numberOfArcObservations;
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            if( parameterArcIndices.at( j ) == -1 || parameterArcIndices.at( j ) == currentArc )
+            {
+                informationMatrix( i, j ) = Eigen::VectorXd::Random( 1 )( 0 );
+            }
+        }
+    }
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+
+    // Set a priori information without correlations between different arcs
+    Eigen::MatrixXd inverseAPrioriCovariance = 0.1 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    inverseAPrioriCovariance( 0, 1 ) = inverseAPrioriCovariance( 1, 0 ) = 0.02;
+    inverseAPrioriCovariance( 0, 6 * numberOfArcs ) = inverseAPrioriCovariance( 6 * numberOfArcs, 0 ) = 0.01;
+
+    ArcWiseNormalEquationAccumulator arcWiseAccumulator( parameterArcIndices );
+    NormalEquationAccumulator normalEquationAccumulator( numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i += 30 )
+    {
+        int blockSize = std::min( 30, numberOfObservations - i );
+        arcWiseAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( i, blockSize ), residuals.segment( i, blockSize ),
+                    weights.segment( i, blockSize ) );
+        normalEquationAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( i, blockSize ), residuals.segment( i, blockSize ),
+                    weights.segment( i, blockSize ) );
+    }
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNumberOfArcs( ), numberOfArcs );
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNumberOfGlobalParameters( ), numberOfGlobalParameters );
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNumberOfObservations( ), numberOfObservations );
+
+    // Compare assembled normal equations
+    Eigen::MatrixXd normalMatrix = normalEquationAccumulator.getNormalMatrix( );
+    BOOST_CHECK_SMALL( ( arcWiseAccumulator.getNormalMatrix( ) - normalMatrix ).norm( ) / normalMatrix.norm( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( arcWiseAccumulator.getRightHandSide( ) - normalEquationAccumulator.getRightHandSide( ) ).norm( ) /
+                       normalEquationAccumulator.getRightHandSide( ).norm( ), 1.0E-14 );
+
+    // Compare normalized estimation with a priori information with solution of full normal equations
+    Eigen::VectorXd normalizationTerms = normalEquationAccumulator.getNormalizationTerms( );
+    Eigen::VectorXd expectedAdjustment = performLeastSquaresAdjustmentFromNormalEquations(
+                normalMatrix.cwiseQuotient( normalizationTerms * normalizationTerms.transpose( ) ) +
+                inverseAPrioriCovariance,
+                normalEquationAccumulator.getRightHandSide( ).cwiseQuotient( normalizationTerms ) ).first;
+    Eigen::VectorXd computedAdjustment = arcWiseAccumulator.getParameterAdjustment(
+                inverseAPrioriCovariance, arcWiseAccumulator.getNormalizationTerms( ) );
+    BOOST_CHECK_SMALL( ( computedAdjustment - expectedAdjustment ).norm( ) / expectedAdjustment.norm( ), 1.0E-12 );
+
+    // Compare unnormalized estimation without a priori information
+    expectedAdjustment = performLeastSquaresAdjustmentFromInformationMatrix( informationMatrix, residuals, weights ).first;
+    computedAdjustment = arcWiseAccumulator.getParameterAdjustment( );
+    BOOST_CHECK_SMALL( ( computedAdjustment - expectedAdjustment ).norm( ) / expectedAdjustment.norm( ), 1.0E-12 );
+
+    // Add new arc, and check that its parameters are estimated from its observations only
+    arcWiseAccumulator.addParameters( 2 );
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNumberOfArcs( ), numberOfArcs + 1 );
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNumberOfParameters( ), numberOfParameters + 2 );
+    Eigen::MatrixXd newArcInformationMatrix = Eigen::MatrixXd::Zero( 20, numberOfParameters + 2 );
+    newArcInformationMatrix.rightCols( 2 ) = Eigen::MatrixXd::Random( 20, 2 );
+    Eigen::VectorXd newArcResiduals = newArcInformationMatrix.rightCols( 2 ) * Eigen::Vector2d( 1.0, -2.0 );
+    arcWiseAccumulator.addObservationBlock( newArcInformationMatrix, newArcResiduals, Eigen::VectorXd::Ones( 20 ) );
+    computedAdjustment = arcWiseAccumulator.getParameterAdjustment( );
+    BOOST_CHECK_SMALL( ( computedAdjustment.head( numberOfParameters ) - expectedAdjustment ).norm( ) /
+                       expectedAdjustment.norm( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( computedAdjustment( numberOfParameters ) - 1.0, 1.0E-12 );
+    BOOST_CHECK_SMALL( computedAdjustment( numberOfParameters + 1 ) + 2.0, 1.0E-12 );
+
+    // Check reset
+    arcWiseAccumulator.reset( );
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNumberOfObservations( ), 0 );
+    BOOST_CHECK_EQUAL( arcWiseAccumulator.getNormalMatrix( ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    // Check that observations and a priori information coupling different arcs are rejected
+    ArcWiseNormalEquationAccumulator invalidAccumulator( parameterArcIndices );
+    Eigen::MatrixXd couplingInformationMatrix = Eigen::MatrixXd::Zero( 1, numberOfParameters );
+    couplingInformationMatrix( 0, 0 ) = 1.0;
+    couplingInformationMatrix( 0, 6 ) = 1.0;
+    BOOST_CHECK_THROW( invalidAccumulator.addObservationBlock(
+                           couplingInformationMatrix, Eigen::VectorXd::Ones( 1 ), Eigen::VectorXd::Ones( 1 ) ),
+                       std::runtime_error );
+
+    inverseAPrioriCovariance( 0, 6 ) = inverseAPrioriCovariance( 6, 0 ) = 0.01;
+    BOOST_CHECK_THROW( invalidAccumulator.getParameterAdjustment( inverseAPrioriCovariance ), std::runtime_error );
+}
+
+//! Test whether block-sparse information matrix reproduces the dense normal equations and products
+BOOST_AUTO_TEST_CASE( testBlockSparseDesignMatrix )
+{
+    // Create information matrix in which each observation depends on the 6 parameters of one arc and on 2 global
+    // parameters, and some observations contain zero partials inside a block
+    const int numberOfArcs = 20;
+    const int numberOfArcObservations = 25;
+    const int numberOfParameters = 6 * numberOfArcs + 2;
+    const int numberOfObservations = numberOfArcs * numberOfArcObservations;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        const int currentArc = i / numberOfArcObservations;
+        informationMatrix.block( i, 6 * currentArc, 1, 6 ) = Eigen::RowVectorXd::Random( 6 );
+        informationMatrix.block( i, 6 * numberOfArcs, 1, 2 ) = Eigen::RowVectorXd::Random( 2 );
+        if( i % 7 == 0 )
+        {
+            informationMatrix( i, 6 * currentArc + 2 ) = 0.0;
+        }
+    }
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+
+    SparseDesignMatrixAccumulator sparseAccumulator( numberOfParameters );
+    NormalEquationAccumulator normalEquationAccumulator( numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i += 64 )
+    {
+        int blockSize = std::min( 64, numberOfObservations - i );
+        sparseAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( i, blockSize ), residuals.segment( i, blockSize ),
+                    weights.segment( i, blockSize ) );
+        normalEquationAccumulator.addObservationBlock(
+                    informationMatrix.middleRows( i, blockSize ), residuals.segment( i, blockSize ),
+                    weights.segment( i, blockSize ) );
+    }
+
+    // Check that only non-zero entries are stored
+    const BlockSparseDesignMatrix& designMatrix = sparseAccumulator.getDesignMatrix( );
+    BOOST_CHECK_EQUAL( designMatrix.getNumberOfRows( ), numberOfObservations );
+    BOOST_CHECK_EQUAL( designMatrix.getNumberOfStoredEntries( ), 8 * numberOfObservations - ( numberOfObservations + 6 ) / 7 );
+    // (parameters of last arc are adjacent to global parameters, so these form a single block)
+    BOOST_CHECK_EQUAL( designMatrix.getNumberOfBlocks( ),
+                       2 * numberOfObservations - numberOfArcObservations + ( numberOfObservations + 6 ) / 7 );
+    BOOST_CHECK_EQUAL( ( designMatrix.getDenseMatrix( ) - informationMatrix ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    // Compare normal equations and products with dense computations
+    Eigen::MatrixXd denseNormalMatrix = informationMatrix.transpose( ) * weights.asDiagonal( ) * informationMatrix;
+    Eigen::VectorXd denseRightHandSide = informationMatrix.transpose( ) * weights.cwiseProduct( residuals );
+    BOOST_CHECK_SMALL( ( sparseAccumulator.getNormalMatrix( ) - denseNormalMatrix ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( sparseAccumulator.getRightHandSide( ) - denseRightHandSide ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( sparseAccumulator.getNormalMatrix( ) - normalEquationAccumulator.getNormalMatrix( ) ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( sparseAccumulator.getObservationResiduals( ) - residuals ).cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+
+    Eigen::VectorXd parameterAdjustment = Eigen::VectorXd::Random( numberOfParameters );
+    BOOST_CHECK_SMALL( ( designMatrix.multiply( parameterAdjustment ) - informationMatrix * parameterAdjustment ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( designMatrix.multiplyTransposed( residuals ) - informationMatrix.transpose( ) * residuals ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+
+    // Check normalization, consistent with dense information matrix
+    Eigen::VectorXd normalizationTerms = sparseAccumulator.getNormalizationTerms( );
+    BlockSparseDesignMatrix normalizedDesignMatrix = designMatrix;
+    normalizedDesignMatrix.divideColumns( normalizationTerms );
+    Eigen::MatrixXd normalizedInformationMatrix = informationMatrix * normalizationTerms.cwiseInverse( ).asDiagonal( );
+    BOOST_CHECK_SMALL( ( normalizedDesignMatrix.getDenseMatrix( ) - normalizedInformationMatrix ).cwiseAbs( ).maxCoeff( ),
+                       1.0E-15 );
+    BOOST_CHECK_SMALL( normalizedDesignMatrix.getDenseMatrix( ).cwiseAbs( ).maxCoeff( ) - 1.0, 1.0E-15 );
+
+    // Check addition of parameters, and reset
+    sparseAccumulator.addParameters( 3 );
+    BOOST_CHECK_EQUAL( sparseAccumulator.getNormalMatrix( ).rows( ), numberOfParameters + 3 );
+    BOOST_CHECK_EQUAL( sparseAccumulator.getNormalMatrix( ).bottomRows( 3 ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    sparseAccumulator.reset( );
+    BOOST_CHECK_EQUAL( sparseAccumulator.getDesignMatrix( ).getNumberOfRows( ), 0 );
+    BOOST_CHECK_EQUAL( sparseAccumulator.getRightHandSide( ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    // Check inconsistent input
+    BOOST_CHECK_THROW( sparseAccumulator.addObservationBlock(
+                           informationMatrix.topRows( 2 ), residuals.head( 2 ), weights.head( 2 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( designMatrix.multiply( residuals ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,209 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Mathematics/BasicMathematics/blockSparseDesignMatrix.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor
+BlockSparseDesignMatrix::BlockSparseDesignMatrix( const int numberOfColumns ):
+    numberOfColumns_( numberOfColumns )
+{
+    if( numberOfColumns_ < 0 )
+    {
+        throw std::runtime_error( "Error when creating block-sparse design matrix, number of columns is negative" );
+    }
+    clear( );
+}
+
+//! Function to remove all rows from the matrix
+void BlockSparseDesignMatrix::clear( )
+{
+    rowBlockStartIndices_.assign( 1, 0 );
+    blockStartColumns_.clear( );
+    blockValueStartIndices_.assign( 1, 0 );
+    values_.clear( );
+}
+
+//! Function to append a set of rows to the matrix
+void BlockSparseDesignMatrix::addRows( const Eigen::MatrixXd& denseRows )
+{
+    if( denseRows.cols( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when adding rows to block-sparse design matrix, number of columns is incompatible" );
+    }
+
+    for( int i = 0; i < denseRows.rows( ); i++ )
+    {
+        // Store each contiguous range of non-zero entries in current row as a block
+        int currentColumn = 0;
+        while( currentColumn < numberOfColumns_ )
+        {
+            if( denseRows( i, currentColumn ) == 0.0 )
+            {
+                currentColumn++;
+                continue;
+            }
+
+            blockStartColumns_.push_back( currentColumn );
+            while( ( currentColumn < numberOfColumns_ ) && ( denseRows( i, currentColumn ) != 0.0 ) )
+            {
+                values_.push_back( denseRows( i, currentColumn ) );
+                currentColumn++;
+            }
+            blockValueStartIndices_.push_back( static_cast< int >( values_.size( ) ) );
+        }
+        rowBlockStartIndices_.push_back( static_cast< int >( blockStartColumns_.size( ) ) );
+    }
+}
+
+//! Function to append columns to the matrix
+void BlockSparseDesignMatrix::addColumns( const int numberOfNewColumns )
+{
+    if( numberOfNewColumns < 0 )
+    {
+        throw std::runtime_error( "Error when adding columns to block-sparse design matrix, number of columns is negative" );
+    }
+    numberOfColumns_ += numberOfNewColumns;
+}
+
+//! Function to compute the product of the matrix with a vector A*x
+Eigen::VectorXd BlockSparseDesignMatrix::multiply( const Eigen::VectorXd& vector ) const
+{
+    if( vector.rows( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when multiplying block-sparse design matrix, vector size is incompatible" );
+    }
+
+    const int numberOfRows = getNumberOfRows( );
+    Eigen::VectorXd product = Eigen::VectorXd::Zero( numberOfRows );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = rowBlockStartIndices_[ i ]; j < rowBlockStartIndices_[ i + 1 ]; j++ )
+        {
+            const int blockSize = blockValueStartIndices_[ j + 1 ] - blockValueStartIndices_[ j ];
+            product( i ) += Eigen::Map< const Eigen::VectorXd >(
+                        values_.data( ) + blockValueStartIndices_[ j ], blockSize ).dot(
+                        vector.segment( blockStartColumns_[ j ], blockSize ) );
+        }
+    }
+    return product;
+}
+
+//! Function to compute the product of the transpose of the matrix with a vector A^T*y
+Eigen::VectorXd BlockSparseDesignMatrix::multiplyTransposed( const Eigen::VectorXd& vector ) const
+{
+    checkRowVectorSize( vector, "multiplying transposed block-sparse design matrix" );
+
+    Eigen::VectorXd product = Eigen::VectorXd::Zero( numberOfColumns_ );
+    for( int i = 0; i < getNumberOfRows( ); i++ )
+    {
+        for( int j = rowBlockStartIndices_[ i ]; j < rowBlockStartIndices_[ i + 1 ]; j++ )
+        {
+            const int blockSize = blockValueStartIndices_[ j + 1 ] - blockValueStartIndices_[ j ];
+            product.segment( blockStartColumns_[ j ], blockSize ) += vector( i ) * Eigen::Map< const Eigen::VectorXd >(
+                        values_.data( ) + blockValueStartIndices_[ j ], blockSize );
+        }
+    }
+    return product;
+}
+
+//! Function to compute the weighted normal matrix A^T*W*A
+Eigen::MatrixXd BlockSparseDesignMatrix::computeWeightedNormalMatrix( const Eigen::VectorXd& diagonalOfWeightMatrix ) const
+{
+    checkRowVectorSize( diagonalOfWeightMatrix, "computing normal matrix from block-sparse design matrix" );
+
+    // Add outer products of blocks of each row to lower triangular part of normal matrix (blocks in a row are sorted by
+    // column and do not overlap).
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfColumns_, numberOfColumns_ );
+    for( int i = 0; i < getNumberOfRows( ); i++ )
+    {
+        for( int j = rowBlockStartIndices_[ i ]; j < rowBlockStartIndices_[ i + 1 ]; j++ )
+        {
+            const int firstBlockSize = blockValueStartIndices_[ j + 1 ] - blockValueStartIndices_[ j ];
+            const Eigen::VectorXd weightedFirstBlock = diagonalOfWeightMatrix( i ) * Eigen::Map< const Eigen::VectorXd >(
+                        values_.data( ) + blockValueStartIndices_[ j ], firstBlockSize );
+
+            for( int k = rowBlockStartIndices_[ i ]; k <= j; k++ )
+            {
+                const int secondBlockSize = blockValueStartIndices_[ k + 1 ] - blockValueStartIndices_[ k ];
+                normalMatrix.block( blockStartColumns_[ j ], blockStartColumns_[ k ], firstBlockSize, secondBlockSize ).
+                        noalias( ) += weightedFirstBlock * Eigen::Map< const Eigen::RowVectorXd >(
+                            values_.data( ) + blockValueStartIndices_[ k ], secondBlockSize );
+            }
+        }
+    }
+
+    normalMatrix.triangularView< Eigen::StrictlyUpper >( ) = normalMatrix.transpose( );
+    return normalMatrix;
+}
+
+//! Function to compute the weighted right-hand side of the normal equations A^T*W*r
+Eigen::VectorXd BlockSparseDesignMatrix::computeWeightedRightHandSide(
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix ) const
+{
+    checkRowVectorSize( observationResiduals, "computing right-hand side from block-sparse design matrix" );
+    checkRowVectorSize( diagonalOfWeightMatrix, "computing right-hand side from block-sparse design matrix" );
+    return multiplyTransposed( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
+}
+
+//! Function to divide each of the columns of the matrix by a (non-zero) value
+void BlockSparseDesignMatrix::divideColumns( const Eigen::VectorXd& columnDivisors )
+{
+    if( columnDivisors.rows( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when scaling columns of block-sparse design matrix, vector size is incompatible" );
+    }
+
+    for( unsigned int j = 0; j < blockStartColumns_.size( ); j++ )
+    {
+        for( int k = blockValueStartIndices_[ j ]; k < blockValueStartIndices_[ j + 1 ]; k++ )
+        {
+            values_[ k ] /= columnDivisors( blockStartColumns_[ j ] + k - blockValueStartIndices_[ j ] );
+        }
+    }
+}
+
+//! Function to retrieve the matrix as a dense matrix
+Eigen::MatrixXd BlockSparseDesignMatrix::getDenseMatrix( ) const
+{
+    Eigen::MatrixXd denseMatrix = Eigen::MatrixXd::Zero( getNumberOfRows( ), numberOfColumns_ );
+    for( int i = 0; i < getNumberOfRows( ); i++ )
+    {
+        for( int j = rowBlockStartIndices_[ i ]; j < rowBlockStartIndices_[ i + 1 ]; j++ )
+        {
+            const int blockSize = blockValueStartIndices_[ j + 1 ] - blockValueStartIndices_[ j ];
+            denseMatrix.block( i, blockStartColumns_[ j ], 1, blockSize ) = Eigen::Map< const Eigen::RowVectorXd >(
+                        values_.data( ) + blockValueStartIndices_[ j ], blockSize );
+        }
+    }
+    return denseMatrix;
+}
+
+//! Function to check whether the size of a vector is equal to the number of rows of the matrix
+void BlockSparseDesignMatrix::checkRowVectorSize( const Eigen::VectorXd& vector, const std::string& operation ) const
+{
+    if( vector.rows( ) != getNumberOfRows( ) )
+    {
+        throw std::runtime_error( "Error when " + operation + ", vector size is incompatible" );
+    }
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
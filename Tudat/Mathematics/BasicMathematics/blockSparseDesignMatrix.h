@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BLOCKSPARSEDESIGNMATRIX_H
+#define TUDAT_BLOCKSPARSEDESIGNMATRIX_H
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Class to store a design (information) matrix of a least squares problem by its non-zero blocks only.
+/*!
+ *  Class to store a design (information) matrix of a least squares problem by its non-zero blocks only. For each row
+ *  (observation), only the contiguous ranges of non-zero columns (parameter blocks) are stored, together with the index of
+ *  their first column. In orbit determination, the partials of most observations w.r.t. most parameters (e.g. initial
+ *  states of other arcs, other ground stations, biases of other links) are zero, so that the storage and the number of
+ *  operations for the products below scale with the number of non-zero entries, instead of with the product of the number
+ *  of observations and parameters.
+ */
+class BlockSparseDesignMatrix
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, creates a matrix without any rows.
+     *  \param numberOfColumns Number of columns (parameters) of the matrix
+     */
+    BlockSparseDesignMatrix( const int numberOfColumns );
+
+    //! Function to remove all rows from the matrix
+    void clear( );
+
+    //! Function to append a set of rows to the matrix
+    /*!
+     *  Function to append a set of rows to the matrix, provided as a dense matrix, of which only the non-zero blocks are
+     *  stored.
+     *  \param denseRows Rows that are to be appended (number of columns must be equal to that of this matrix)
+     */
+    void addRows( const Eigen::MatrixXd& denseRows );
+
+    //! Function to append columns to the matrix
+    /*!
+     *  Function to append columns to the matrix, which are zero for all existing rows (no data is modified).
+     *  \param numberOfNewColumns Number of columns that are to be appended
+     */
+    void addColumns( const int numberOfNewColumns );
+
+    //! Function to compute the product of the matrix with a vector A*x
+    /*!
+     *  Function to compute the product of the matrix with a vector A*x (e.g. to compute the change in residuals due to
+     *  a parameter adjustment x)
+     *  \param vector Vector x with which the matrix is to be multiplied
+     *  \return Product A*x
+     */
+    Eigen::VectorXd multiply( const Eigen::VectorXd& vector ) const;
+
+    //! Function to compute the product of the transpose of the matrix with a vector A^T*y
+    /*!
+     *  Function to compute the product of the transpose of the matrix with a vector A^T*y
+     *  \param vector Vector y with which the transpose of the matrix is to be multiplied
+     *  \return Product A^T*y
+     */
+    Eigen::VectorXd multiplyTransposed( const Eigen::VectorXd& vector ) const;
+
+    //! Function to compute the weighted normal matrix A^T*W*A
+    /*!
+     *  Function to compute the weighted normal matrix A^T*W*A, for diagonal weight matrix W. The contribution of each row
+     *  is computed from the outer products of its non-zero blocks only.
+     *  \param diagonalOfWeightMatrix Diagonal of the weight matrix W
+     *  \return Weighted normal matrix (full, symmetric)
+     */
+    Eigen::MatrixXd computeWeightedNormalMatrix( const Eigen::VectorXd& diagonalOfWeightMatrix ) const;
+
+    //! Function to compute the weighted right-hand side of the normal equations A^T*W*r
+    /*!
+     *  Function to compute the weighted right-hand side of the normal equations A^T*W*r, for diagonal weight matrix W.
+     *  \param observationResiduals Observation residuals r
+     *  \param diagonalOfWeightMatrix Diagonal of the weight matrix W
+     *  \return Weighted right-hand side of normal equations
+     */
+    Eigen::VectorXd computeWeightedRightHandSide( const Eigen::VectorXd& observationResiduals,
+                                                  const Eigen::VectorXd& diagonalOfWeightMatrix ) const;
+
+    //! Function to divide each of the columns of the matrix by a (non-zero) value
+    /*!
+     *  Function to divide each of the columns of the matrix by a (non-zero) value, e.g. to normalize the matrix
+     *  \param columnDivisors Values by which the columns are to be divided
+     */
+    void divideColumns( const Eigen::VectorXd& columnDivisors );
+
+    //! Function to retrieve the matrix as a dense matrix
+    /*!
+     *  Function to retrieve the matrix as a dense matrix
+     *  \return Dense matrix, with all entries that are not stored set to zero
+     */
+    Eigen::MatrixXd getDenseMatrix( ) const;
+
+    //! Function to retrieve the number of rows of the matrix
+    /*!
+     *  Function to retrieve the number of rows of the matrix
+     *  \return Number of rows of the matrix
+     */
+    int getNumberOfRows( ) const
+    {
+        return static_cast< int >( rowBlockStartIndices_.size( ) ) - 1;
+    }
+
+    //! Function to retrieve the number of columns of the matrix
+    /*!
+     *  Function to retrieve the number of columns of the matrix
+     *  \return Number of columns of the matrix
+     */
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the number of stored non-zero blocks
+    /*!
+     *  Function to retrieve the number of stored non-zero blocks (summed over all rows)
+     *  \return Number of stored non-zero blocks
+     */
+    int getNumberOfBlocks( ) const
+    {
+        return static_cast< int >( blockStartColumns_.size( ) );
+    }
+
+    //! Function to retrieve the number of stored entries
+    /*!
+     *  Function to retrieve the number of stored entries (equal to the number of non-zero entries of the matrix)
+     *  \return Number of stored entries
+     */
+    int getNumberOfStoredEntries( ) const
+    {
+        return static_cast< int >( values_.size( ) );
+    }
+
+private:
+
+    //! Function to check whether the size of a vector is equal to the number of rows of the matrix
+    void checkRowVectorSize( const Eigen::VectorXd& vector, const std::string& operation ) const;
+
+    //! Number of columns of the matrix
+    int numberOfColumns_;
+
+    //! Index (in blockStartColumns_) of the first block of each row, with the total number of blocks appended at the end
+    std::vector< int > rowBlockStartIndices_;
+
+    //! Index of the first column of each of the stored blocks
+    std::vector< int > blockStartColumns_;
+
+    //! Index (in values_) of the first entry of each of the stored blocks, with the total number of entries appended
+    std::vector< int > blockValueStartIndices_;
+
+    //! Entries of all stored blocks (concatenated)
+    std::vector< double > values_;
+};
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_BLOCKSPARSEDESIGNMATRIX_H
@@ -0,0 +1,472 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Mathematics/BasicMathematics/blockedSphericalHarmonics.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+//! Constructor, computes all recursion coefficients.
+BlockedLegendreRecursionCoefficients::BlockedLegendreRecursionCoefficients(
+        const int maximumDegree, const int maximumOrder ):
+    maximumDegree( maximumDegree ), maximumOrder( std::min( maximumOrder, maximumDegree ) )
+{
+    // Legendre polynomials of order maximumOrder + 1 are needed for latitude derivatives.
+    numberOfLegendreOrders = std::min( this->maximumOrder + 1, maximumDegree ) + 1;
+
+    // Set start indices of order blocks, block m containing degrees m...maximumDegree.
+    blockStartIndices.resize( numberOfLegendreOrders + 1 );
+    blockStartIndices[ 0 ] = 0;
+    for( int order = 0; order < numberOfLegendreOrders; order++ )
+    {
+        blockStartIndices[ order + 1 ] = blockStartIndices[ order ] + ( maximumDegree - order + 1 );
+    }
+
+    int numberOfEntries = blockStartIndices[ numberOfLegendreOrders ];
+    firstRecursionCoefficients = Eigen::ArrayXd::Zero( numberOfEntries );
+    secondRecursionCoefficients = Eigen::ArrayXd::Zero( numberOfEntries );
+    derivativeNormalizations = Eigen::ArrayXd::Zero( numberOfEntries );
+
+    // Pre-compute coefficients of vertical recursion and derivative normalization (see legendrePolynomials.h).
+    for( int order = 0; order < numberOfLegendreOrders; order++ )
+    {
+        double doubleOrder = static_cast< double >( order );
+        for( int degree = order; degree <= maximumDegree; degree++ )
+        {
+            double doubleDegree = static_cast< double >( degree );
+            int currentIndex = getIndex( degree, order );
+
+            if( degree > order )
+            {
+                firstRecursionCoefficients( currentIndex ) = std::sqrt(
+                            ( 2.0 * doubleDegree + 1.0 ) * ( 2.0 * doubleDegree - 1.0 ) /
+                            ( ( doubleDegree + doubleOrder ) * ( doubleDegree - doubleOrder ) ) );
+            }
+
+            if( degree > order + 1 )
+            {
+                secondRecursionCoefficients( currentIndex ) = std::sqrt(
+                            ( 2.0 * doubleDegree + 1.0 ) * ( doubleDegree + doubleOrder - 1.0 ) *
+                            ( doubleDegree - doubleOrder - 1.0 ) /
+                            ( ( 2.0 * doubleDegree - 3.0 ) * ( doubleDegree + doubleOrder ) *
+                              ( doubleDegree - doubleOrder ) ) );
+            }
+
+            derivativeNormalizations( currentIndex ) = std::sqrt(
+                        ( doubleDegree + doubleOrder + 1.0 ) * ( doubleDegree - doubleOrder ) );
+            if( order == 0 )
+            {
+                derivativeNormalizations( currentIndex ) *= std::sqrt( 0.5 );
+            }
+        }
+    }
+
+    // Pre-compute coefficients of sectoral recursion.
+    sectoralRecursionCoefficients = Eigen::ArrayXd::Zero( numberOfLegendreOrders );
+    for( int order = 1; order < numberOfLegendreOrders; order++ )
+    {
+        sectoralRecursionCoefficients( order ) = ( order == 1 ) ? std::sqrt( 3.0 ) :
+                std::sqrt( ( 2.0 * static_cast< double >( order ) + 1.0 ) / ( 2.0 * static_cast< double >( order ) ) );
+    }
+}
+
+//! Update maximum degree and order of kernel, and recompute recursion coefficients.
+void BlockedSphericalHarmonicsKernel::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    recursionCoefficients_ = BlockedLegendreRecursionCoefficients( maximumDegree, maximumOrder );
+    maximumDegree_ = recursionCoefficients_.maximumDegree;
+    maximumOrder_ = recursionCoefficients_.maximumOrder;
+
+    legendreValues_ = Eigen::ArrayXd::Zero(
+                recursionCoefficients_.blockStartIndices[ recursionCoefficients_.numberOfLegendreOrders ] );
+
+    degreesPlusOne_ = Eigen::ArrayXd::LinSpaced( maximumDegree_ + 2, 0.0, static_cast< double >( maximumDegree_ + 1 ) );
+    referenceRadiusRatioPowers_ = Eigen::ArrayXd::Zero( maximumDegree_ + 2 );
+    cosinesOfLongitude_ = Eigen::ArrayXd::Zero( maximumOrder_ + 1 );
+    sinesOfLongitude_ = Eigen::ArrayXd::Zero( maximumOrder_ + 1 );
+
+    weightedLegendreValues_ = Eigen::ArrayXd::Zero( maximumDegree_ + 1 );
+    latitudeDerivatives_ = Eigen::ArrayXd::Zero( maximumDegree_ + 1 );
+    cosineTerms_ = Eigen::ArrayXd::Zero( maximumDegree_ + 1 );
+    sineTerms_ = Eigen::ArrayXd::Zero( maximumDegree_ + 1 );
+
+    currentPolynomialParameter_ = TUDAT_NAN;
+    currentPolynomialParameterComplement_ = TUDAT_NAN;
+    currentLongitude_ = TUDAT_NAN;
+    currentReferenceRadiusRatio_ = TUDAT_NAN;
+    currentRadius_ = TUDAT_NAN;
+}
+
+//! Compute the Legendre polynomials, in order-major blocks, for the given polynomial parameter.
+void BlockedSphericalHarmonicsKernel::updateLegendrePolynomials( const double polynomialParameter )
+{
+    currentPolynomialParameter_ = polynomialParameter;
+    currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
+
+    double* legendreValues = legendreValues_.data( );
+    const double* firstRecursionCoefficients = recursionCoefficients_.firstRecursionCoefficients.data( );
+    const double* secondRecursionCoefficients = recursionCoefficients_.secondRecursionCoefficients.data( );
+
+    double sectoralValue = 1.0;
+    for( int order = 0; order < recursionCoefficients_.numberOfLegendreOrders; order++ )
+    {
+        // Compute sectoral term from that of previous order.
+        if( order > 0 )
+        {
+            sectoralValue *= recursionCoefficients_.sectoralRecursionCoefficients( order ) * currentPolynomialParameterComplement_;
+        }
+
+        // Compute remainder of order block using vertical recursion.
+        int startIndex = recursionCoefficients_.blockStartIndices[ order ];
+        int blockSize = maximumDegree_ - order + 1;
+        legendreValues[ startIndex ] = sectoralValue;
+        if( blockSize > 1 )
+        {
+            legendreValues[ startIndex + 1 ] =
+                    firstRecursionCoefficients[ startIndex + 1 ] * polynomialParameter * sectoralValue;
+        }
+        for( int i = startIndex + 2; i < startIndex + blockSize; i++ )
+        {
+            legendreValues[ i ] = firstRecursionCoefficients[ i ] * polynomialParameter * legendreValues[ i - 1 ] -
+                    secondRecursionCoefficients[ i ] * legendreValues[ i - 2 ];
+        }
+    }
+}
+
+//! Update Legendre polynomials, trigonometric functions of longitude and powers of radius ratio to current state.
+void BlockedSphericalHarmonicsKernel::update( const double radius, const double polynomialParameter,
+                                              const double longitude, const double referenceRadius )
+{
+    if( !( polynomialParameter == currentPolynomialParameter_ ) )
+    {
+        updateLegendrePolynomials( polynomialParameter );
+    }
+
+    if( !( longitude == currentLongitude_ ) )
+    {
+        currentLongitude_ = longitude;
+        for( int order = 0; order <= maximumOrder_; order++ )
+        {
+            cosinesOfLongitude_( order ) = std::cos( static_cast< double >( order ) * longitude );
+            sinesOfLongitude_( order ) = std::sin( static_cast< double >( order ) * longitude );
+        }
+    }
+
+    currentRadius_ = radius;
+    double referenceRadiusRatio = referenceRadius / radius;
+    if( !( referenceRadiusRatio == currentReferenceRadiusRatio_ ) )
+    {
+        currentReferenceRadiusRatio_ = referenceRadiusRatio;
+        double currentRatioPower = 1.0;
+        for( int i = 0; i <= maximumDegree_ + 1; i++ )
+        {
+            referenceRadiusRatioPowers_( i ) = currentRatioPower;
+            currentRatioPower *= referenceRadiusRatio;
+        }
+    }
+}
+
+//! Compute the spherical potential gradient of a geodesy-normalized field at the current state.
+Eigen::Vector3d BlockedSphericalHarmonicsKernel::computePotentialGradient(
+        const double preMultiplier,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    const int numberOfDegrees = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+    const int numberOfOrders = std::min( static_cast< int >( cosineHarmonicCoefficients.cols( ) ), numberOfDegrees );
+
+    if( numberOfDegrees > maximumDegree_ + 1 || numberOfOrders > maximumOrder_ + 1 )
+    {
+        throw std::runtime_error( "Error in blocked spherical harmonics kernel, maximum degree or order exceeded: " +
+                                  std::to_string( numberOfDegrees - 1 ) + " " + std::to_string( maximumDegree_ ) + " " +
+                                  std::to_string( numberOfOrders - 1 ) + " " + std::to_string( maximumOrder_ ) );
+    }
+
+    if( sineHarmonicCoefficients.rows( ) != cosineHarmonicCoefficients.rows( ) ||
+            sineHarmonicCoefficients.cols( ) != cosineHarmonicCoefficients.cols( ) )
+    {
+        throw std::runtime_error( "Error in blocked spherical harmonics kernel, coefficient matrix sizes are inconsistent" );
+    }
+
+    double radialSum = 0.0;
+    double latitudeSum = 0.0;
+    double longitudeSum = 0.0;
+
+    // Tangent of latitude, multiplying order times P_{n,m} in the latitude derivative
+    const double latitudeTangent = currentPolynomialParameter_ / currentPolynomialParameterComplement_;
+
+    for( int order = 0; order < numberOfOrders; order++ )
+    {
+        const int blockSize = numberOfDegrees - order;
+        const double doubleOrder = static_cast< double >( order );
+
+        // Retrieve contiguous data for current order: Legendre polynomials and coefficients for degrees order...N
+        Eigen::Map< const Eigen::ArrayXd > legendreBlock(
+                    legendreValues_.data( ) + recursionCoefficients_.blockStartIndices[ order ], blockSize );
+        Eigen::Map< const Eigen::ArrayXd > cosineCoefficientBlock(
+                    cosineHarmonicCoefficients.data( ) + order * numberOfDegrees + order, blockSize );
+        Eigen::Map< const Eigen::ArrayXd > sineCoefficientBlock(
+                    sineHarmonicCoefficients.data( ) + order * numberOfDegrees + order, blockSize );
+
+        cosineTerms_.head( blockSize ) = cosineCoefficientBlock * cosinesOfLongitude_( order ) +
+                sineCoefficientBlock * sinesOfLongitude_( order );
+        sineTerms_.head( blockSize ) = sineCoefficientBlock * cosinesOfLongitude_( order ) -
+                cosineCoefficientBlock * sinesOfLongitude_( order );
+        weightedLegendreValues_.head( blockSize ) =
+                referenceRadiusRatioPowers_.segment( order + 1, blockSize ) * legendreBlock;
+
+        // Compute latitude derivatives (times cosine of latitude), using the Legendre polynomials of next order.
+        latitudeDerivatives_.head( blockSize ) = -doubleOrder * latitudeTangent * legendreBlock;
+        if( blockSize > 1 )
+        {
+            latitudeDerivatives_.segment( 1, blockSize - 1 ) +=
+                    recursionCoefficients_.derivativeNormalizations.segment(
+                        recursionCoefficients_.blockStartIndices[ order ] + 1, blockSize - 1 ) *
+                    legendreValues_.segment( recursionCoefficients_.blockStartIndices[ order + 1 ], blockSize - 1 );
+        }
+
+        radialSum += ( degreesPlusOne_.segment( order + 1, blockSize ) * weightedLegendreValues_.head( blockSize ) *
+                       cosineTerms_.head( blockSize ) ).sum( );
+        latitudeSum += ( referenceRadiusRatioPowers_.segment( order + 1, blockSize ) *
+                         latitudeDerivatives_.head( blockSize ) * cosineTerms_.head( blockSize ) ).sum( );
+        longitudeSum += doubleOrder *
+                ( weightedLegendreValues_.head( blockSize ) * sineTerms_.head( blockSize ) ).sum( );
+    }
+
+    return ( Eigen::Vector3d( ) << -preMultiplier / currentRadius_ * radialSum,
+             preMultiplier * latitudeSum,
+             preMultiplier * longitudeSum ).finished( );
+}
+
+//! Function to retrieve a Legendre polynomial value at the current state.
+double BlockedSphericalHarmonicsKernel::getLegendrePolynomial( const int degree, const int order )
+{
+    if( degree > maximumDegree_ || order >= recursionCoefficients_.numberOfLegendreOrders || degree < 0 || order < 0 )
+    {
+        throw std::runtime_error( "Error when requesting Legendre polynomial from blocked spherical harmonics kernel, "
+                                  "degree or order out of bounds: " + std::to_string( degree ) + " " +
+                                  std::to_string( order ) );
+    }
+    else if( order > degree )
+    {
+        return 0.0;
+    }
+    else
+    {
+        return legendreValues_( recursionCoefficients_.getIndex( degree, order ) );
+    }
+}
+
+//! Update maximum degree and order of kernel, and recompute recursion coefficients.
+void BlockedSphericalHarmonicsTileKernel::resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    recursionCoefficients_ = BlockedLegendreRecursionCoefficients( maximumDegree, maximumOrder );
+
+    pointProperties_ = TileBlock::Zero( tileSize, 5 );
+    referenceRadiusRatioPowers_ = TileBlock::Zero( tileSize, recursionCoefficients_.maximumDegree + 2 );
+    cosinesOfLongitude_ = TileBlock::Zero( tileSize, recursionCoefficients_.maximumOrder + 1 );
+    sinesOfLongitude_ = TileBlock::Zero( tileSize, recursionCoefficients_.maximumOrder + 1 );
+    currentOrderLegendreValues_ = TileBlock::Zero( tileSize, recursionCoefficients_.maximumDegree + 1 );
+    nextOrderLegendreValues_ = TileBlock::Zero( tileSize, recursionCoefficients_.maximumDegree + 1 );
+
+    potentials_ = TileBlock::Zero( tileSize, 1 );
+    sphericalGradients_ = TileBlock::Zero( tileSize, 3 );
+    sphericalHessians_ = TileBlock::Zero( tileSize, 6 );
+}
+
+//! Update trigonometric functions of longitude and powers of radius ratio to current points.
+void BlockedSphericalHarmonicsTileKernel::update( const TileArray& radii, const TileArray& polynomialParameters,
+                                                  const TileArray& longitudes, const double referenceRadius )
+{
+    pointProperties_.col( 0 ) = radii;
+    pointProperties_.col( 1 ) = polynomialParameters;
+    pointProperties_.col( 2 ) = ( 1.0 - polynomialParameters.square( ) ).sqrt( );
+    pointProperties_.col( 3 ) = pointProperties_.col( 1 ) / pointProperties_.col( 2 );
+    pointProperties_.col( 4 ) = pointProperties_.col( 2 ).square( ).inverse( );
+
+    const TileArray referenceRadiusRatios = referenceRadius / radii;
+    referenceRadiusRatioPowers_.col( 0 ).setOnes( );
+    for( int i = 1; i < referenceRadiusRatioPowers_.cols( ); i++ )
+    {
+        referenceRadiusRatioPowers_.col( i ) = referenceRadiusRatioPowers_.col( i - 1 ) * referenceRadiusRatios;
+    }
+
+    for( int order = 0; order < cosinesOfLongitude_.cols( ); order++ )
+    {
+        cosinesOfLongitude_.col( order ) = ( static_cast< double >( order ) * longitudes ).cos( );
+        sinesOfLongitude_.col( order ) = ( static_cast< double >( order ) * longitudes ).sin( );
+    }
+}
+
+//! Compute the potential and its spherical derivatives of a geodesy-normalized field at the current points.
+void BlockedSphericalHarmonicsTileKernel::computeSphericalQuantities(
+        const double preMultiplier,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients,
+        const bool computeSecondDerivatives )
+{
+    const int numberOfDegrees = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+    const int numberOfOrders = std::min( static_cast< int >( cosineHarmonicCoefficients.cols( ) ), numberOfDegrees );
+
+    if( numberOfDegrees > recursionCoefficients_.maximumDegree + 1 ||
+            numberOfOrders > recursionCoefficients_.maximumOrder + 1 )
+    {
+        throw std::runtime_error( "Error in blocked spherical harmonics tile kernel, maximum degree or order exceeded: " +
+                                  std::to_string( numberOfDegrees - 1 ) + " " +
+                                  std::to_string( recursionCoefficients_.maximumDegree ) + " " +
+                                  std::to_string( numberOfOrders - 1 ) + " " +
+                                  std::to_string( recursionCoefficients_.maximumOrder ) );
+    }
+
+    if( sineHarmonicCoefficients.rows( ) != cosineHarmonicCoefficients.rows( ) ||
+            sineHarmonicCoefficients.cols( ) != cosineHarmonicCoefficients.cols( ) )
+    {
+        throw std::runtime_error(
+                    "Error in blocked spherical harmonics tile kernel, coefficient matrix sizes are inconsistent" );
+    }
+
+    const TileArray polynomialParameters = pointProperties_.col( 1 );
+    const TileArray polynomialParameterComplements = pointProperties_.col( 2 );
+    const TileArray latitudeTangents = pointProperties_.col( 3 );
+    const TileArray squaredLatitudeSecants = pointProperties_.col( 4 );
+
+    TileArray potentialSum = TileArray::Zero( );
+    TileArray radialSum = TileArray::Zero( );
+    TileArray latitudeSum = TileArray::Zero( );
+    TileArray longitudeSum = TileArray::Zero( );
+    TileArray radialRadialSum = TileArray::Zero( );
+    TileArray radialLatitudeSum = TileArray::Zero( );
+    TileArray radialLongitudeSum = TileArray::Zero( );
+    TileArray latitudeLatitudeSum = TileArray::Zero( );
+    TileArray latitudeLongitudeSum = TileArray::Zero( );
+    TileArray longitudeLongitudeSum = TileArray::Zero( );
+
+    // Compute zonal Legendre polynomials using vertical recursion.
+    const double* firstRecursionCoefficients = recursionCoefficients_.firstRecursionCoefficients.data( );
+    const double* secondRecursionCoefficients = recursionCoefficients_.secondRecursionCoefficients.data( );
+    currentOrderLegendreValues_.col( 0 ).setOnes( );
+    for( int degree = 1; degree < numberOfDegrees; degree++ )
+    {
+        currentOrderLegendreValues_.col( degree ) = firstRecursionCoefficients[ degree ] * polynomialParameters *
+                currentOrderLegendreValues_.col( degree - 1 );
+        if( degree > 1 )
+        {
+            currentOrderLegendreValues_.col( degree ) -= secondRecursionCoefficients[ degree ] *
+                    currentOrderLegendreValues_.col( degree - 2 );
+        }
+    }
+
+    for( int order = 0; order < numberOfOrders; order++ )
+    {
+        const double doubleOrder = static_cast< double >( order );
+        const TileArray cosineOfOrderLongitude = cosinesOfLongitude_.col( order );
+        const TileArray sineOfOrderLongitude = sinesOfLongitude_.col( order );
+
+        // Retrieve contiguous data for current order, indexed by degree
+        const double* cosineCoefficients = cosineHarmonicCoefficients.data( ) + order * numberOfDegrees;
+        const double* sineCoefficients = sineHarmonicCoefficients.data( ) + order * numberOfDegrees;
+        const double* derivativeNormalizations = recursionCoefficients_.derivativeNormalizations.data( ) +
+                recursionCoefficients_.blockStartIndices[ order ] - order;
+
+        // Compute sectoral term of next order, remainder of next order is computed along with summation.
+        const bool computeNextOrder = ( order + 1 < numberOfDegrees );
+        const double* nextFirstRecursionCoefficients = nullptr;
+        const double* nextSecondRecursionCoefficients = nullptr;
+        if( computeNextOrder )
+        {
+            nextOrderLegendreValues_.col( order + 1 ) =
+                    recursionCoefficients_.sectoralRecursionCoefficients( order + 1 ) *
+                    polynomialParameterComplements * currentOrderLegendreValues_.col( order );
+            nextFirstRecursionCoefficients = firstRecursionCoefficients +
+                    recursionCoefficients_.blockStartIndices[ order + 1 ] - ( order + 1 );
+            nextSecondRecursionCoefficients = secondRecursionCoefficients +
+                    recursionCoefficients_.blockStartIndices[ order + 1 ] - ( order + 1 );
+        }
+
+        for( int degree = order; degree < numberOfDegrees; degree++ )
+        {
+            const double doubleDegree = static_cast< double >( degree );
+
+            // Compute Legendre polynomial of next order, required for latitude derivative.
+            if( computeNextOrder && degree > order + 1 )
+            {
+                nextOrderLegendreValues_.col( degree ) = nextFirstRecursionCoefficients[ degree ] *
+                        polynomialParameters * nextOrderLegendreValues_.col( degree - 1 );
+                if( degree > order + 2 )
+                {
+                    nextOrderLegendreValues_.col( degree ) -= nextSecondRecursionCoefficients[ degree ] *
+                            nextOrderLegendreValues_.col( degree - 2 );
+                }
+            }
+
+            const TileArray cosineTerms = cosineCoefficients[ degree ] * cosineOfOrderLongitude +
+                    sineCoefficients[ degree ] * sineOfOrderLongitude;
+            const TileArray sineTerms = sineCoefficients[ degree ] * cosineOfOrderLongitude -
+                    cosineCoefficients[ degree ] * sineOfOrderLongitude;
+            const TileArray radiusPowers = referenceRadiusRatioPowers_.col( degree + 1 );
+            const TileArray weightedLegendreValues = radiusPowers * currentOrderLegendreValues_.col( degree );
+
+            TileArray latitudeDerivatives = -doubleOrder * latitudeTangents * currentOrderLegendreValues_.col( degree );
+            if( degree > order )
+            {
+                latitudeDerivatives += derivativeNormalizations[ degree ] * nextOrderLegendreValues_.col( degree );
+            }
+
+            const TileArray weightedCosineTerms = weightedLegendreValues * cosineTerms;
+            potentialSum += weightedCosineTerms;
+            radialSum += ( doubleDegree + 1.0 ) * weightedCosineTerms;
+            latitudeSum += radiusPowers * latitudeDerivatives * cosineTerms;
+            longitudeSum += doubleOrder * weightedLegendreValues * sineTerms;
+
+            if( computeSecondDerivatives )
+            {
+                radialRadialSum += ( doubleDegree + 1.0 ) * ( doubleDegree + 2.0 ) * weightedCosineTerms;
+                radialLatitudeSum += ( doubleDegree + 1.0 ) * radiusPowers * latitudeDerivatives * cosineTerms;
+                radialLongitudeSum += ( doubleDegree + 1.0 ) * doubleOrder * weightedLegendreValues * sineTerms;
+                latitudeLatitudeSum += radiusPowers * cosineTerms * (
+                            latitudeTangents * latitudeDerivatives -
+                            ( doubleDegree * ( doubleDegree + 1.0 ) - doubleOrder * doubleOrder * squaredLatitudeSecants ) *
+                            currentOrderLegendreValues_.col( degree ) );
+                latitudeLongitudeSum += doubleOrder * radiusPowers * latitudeDerivatives * sineTerms;
+                longitudeLongitudeSum += doubleOrder * doubleOrder * weightedCosineTerms;
+            }
+        }
+
+        currentOrderLegendreValues_.swap( nextOrderLegendreValues_ );
+    }
+
+    const TileArray radii = pointProperties_.col( 0 );
+    potentials_.col( 0 ) = preMultiplier * potentialSum;
+    sphericalGradients_.col( 0 ) = -preMultiplier * radialSum / radii;
+    sphericalGradients_.col( 1 ) = preMultiplier * latitudeSum;
+    sphericalGradients_.col( 2 ) = preMultiplier * longitudeSum;
+
+    if( computeSecondDerivatives )
+    {
+        sphericalHessians_.col( 0 ) = preMultiplier * radialRadialSum / radii.square( );
+        sphericalHessians_.col( 1 ) = -preMultiplier * radialLatitudeSum / radii;
+        sphericalHessians_.col( 2 ) = -preMultiplier * radialLongitudeSum / radii;
+        sphericalHessians_.col( 3 ) = preMultiplier * latitudeLatitudeSum;
+        sphericalHessians_.col( 4 ) = preMultiplier * latitudeLongitudeSum;
+        sphericalHessians_.col( 5 ) = -preMultiplier * longitudeLongitudeSum;
+    }
+}
+
+} // namespace basic_mathematics
+} // namespace tudat
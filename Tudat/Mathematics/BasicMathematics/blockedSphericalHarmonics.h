@@ -0,0 +1,394 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BLOCKED_SPHERICAL_HARMONICS_H
+#define TUDAT_BLOCKED_SPHERICAL_HARMONICS_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+namespace basic_mathematics
+{
+
+//! Pre-computed coefficients for the recursive computation of geodesy-normalized Legendre polynomials per order block.
+/*!
+ *  Pre-computed coefficients for the recursive computation of geodesy-normalized Legendre polynomials, stored in
+ *  contiguous order-major blocks (block m containing the coefficients for degrees m...N). The polynomials are computed
+ *  using the sectoral recursion P_{m,m} = s_m * cos(lat) * P_{m-1,m-1} and the vertical recursion
+ *  P_{n,m} = a_{n,m} * sin(lat) * P_{n-1,m} - b_{n,m} * P_{n-2,m}, while the derivative w.r.t. latitude is obtained as
+ *  dP_{n,m}/dlat = c_{n,m} * P_{n,m+1} - m * tan(lat) * P_{n,m}. Coefficients are computed up to one order higher
+ *  than the maximum order, as required for the latitude derivatives.
+ */
+struct BlockedLegendreRecursionCoefficients
+{
+    //! Constructor, computes all recursion coefficients.
+    /*!
+     * Constructor, computes all recursion coefficients.
+     * \param maximumDegree Maximum degree for which coefficients are computed.
+     * \param maximumOrder Maximum order of fields that are to be evaluated (limited to maximumDegree).
+     */
+    BlockedLegendreRecursionCoefficients( const int maximumDegree = 0, const int maximumOrder = 0 );
+
+    //! Function to retrieve the index of the coefficient of given degree and order in the order-major blocks.
+    /*!
+     * Function to retrieve the index of the coefficient of given degree and order in the order-major blocks.
+     * \param degree Degree of the coefficient (must be equal to or larger than order)
+     * \param order Order of the coefficient
+     * \return Index of the coefficient in the order-major blocks.
+     */
+    int getIndex( const int degree, const int order ) const
+    {
+        return blockStartIndices[ order ] + ( degree - order );
+    }
+
+    //! Maximum degree for which coefficients are computed.
+    int maximumDegree;
+
+    //! Maximum order of fields that are to be evaluated.
+    int maximumOrder;
+
+    //! Number of orders for which the coefficients are computed (maximum order + 2, limited by maximum degree).
+    int numberOfLegendreOrders;
+
+    //! Index of the first entry (degree = order) of each order block, with the total size as final entry.
+    std::vector< int > blockStartIndices;
+
+    //! Coefficients a_{n,m}, multiplying the polynomial parameter times P_{n-1,m} in the vertical recursion for P_{n,m}.
+    Eigen::ArrayXd firstRecursionCoefficients;
+
+    //! Coefficients b_{n,m}, multiplying P_{n-2,m} in the vertical recursion for P_{n,m}.
+    Eigen::ArrayXd secondRecursionCoefficients;
+
+    //! Coefficients c_{n,m}, multiplying P_{n,m+1} in the derivative of P_{n,m} w.r.t. latitude.
+    Eigen::ArrayXd derivativeNormalizations;
+
+    //! Coefficients s_m, multiplying cosine of latitude times P_{m-1,m-1} in the recursion for P_{m,m} (per order).
+    Eigen::ArrayXd sectoralRecursionCoefficients;
+};
+
+//! Kernel for the evaluation of a full geodesy-normalized spherical harmonic potential gradient.
+/*!
+ *  Kernel for the evaluation of a full geodesy-normalized spherical harmonic potential gradient, optimized for
+ *  high degree and order (100-360) fields. As opposed to the term-by-term evaluation using the SphericalHarmonicsCache,
+ *  the Legendre polynomials are stored in contiguous order-major blocks (block m containing P_{m,m}...P_{N,m}), and are
+ *  computed using pre-computed recursion coefficients. The gradient is then accumulated per order, using Eigen array
+ *  expressions on the Legendre block, the matching column of the (column-major) coefficient matrices and the powers of
+ *  the radius ratio, which are vectorized by Eigen (SSE/AVX, depending on the compiler settings).
+ *
+ *  Equations are the same as those of the computePotentialGradient functions (see sphericalHarmonics.h), with the
+ *  derivative of the Legendre polynomials w.r.t. latitude obtained from the polynomial of the next higher order.
+ *  Consequently, Legendre polynomials are computed up to one order higher than the maximum order of the field.
+ */
+class BlockedSphericalHarmonicsKernel
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree of fields that can be evaluated with this kernel.
+     * \param maximumOrder Maximum order of fields that can be evaluated with this kernel.
+     */
+    BlockedSphericalHarmonicsKernel( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of kernel, and recompute recursion coefficients.
+    /*!
+     * Update maximum degree and order of kernel, and recompute recursion coefficients.
+     * \param maximumDegree Maximum degree of fields that can be evaluated with this kernel.
+     * \param maximumOrder Maximum order of fields that can be evaluated with this kernel.
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Update Legendre polynomials, trigonometric functions of longitude and powers of radius ratio to current state.
+    /*!
+     * Update Legendre polynomials, trigonometric functions of longitude and powers of radius ratio to current state.
+     * Each of the three sets of quantities is only recomputed if its input has changed w.r.t. the previous call.
+     * \param radius Distance from origin
+     * \param polynomialParameter Input parameter to Legendre polynomials (sine of latitude)
+     * \param longitude Current longitude
+     * \param referenceRadius Reference (typically equatorial) radius of gravity field.
+     */
+    void update( const double radius, const double polynomialParameter,
+                 const double longitude, const double referenceRadius );
+
+    //! Function to compute the spherical potential gradient of a geodesy-normalized field at the current state.
+    /*!
+     * Function to compute the potential gradient, in spherical coordinates, of a geodesy-normalized field at the state
+     * set by the last call to update, summed over all degrees and orders of the coefficient matrices.
+     * \param preMultiplier Generic multiplication factor (gravitational parameter divided by reference radius).
+     * \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (row index: degree; column index: order).
+     * \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (row index: degree; column index: order).
+     * \return Vector with derivatives of potential field w.r.t. radius, latitude and longitude (in that order).
+     */
+    Eigen::Vector3d computePotentialGradient( const double preMultiplier,
+                                              const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                                              const Eigen::MatrixXd& sineHarmonicCoefficients );
+
+    //! Function to retrieve a Legendre polynomial value at the current state.
+    /*!
+     * Function to retrieve a geodesy-normalized Legendre polynomial value at the current state.
+     * \param degree Degree of Legendre polynomial
+     * \param order Order of Legendre polynomial
+     * \return Legendre polynomial value at the current state.
+     */
+    double getLegendrePolynomial( const int degree, const int order );
+
+    //! Function to get the maximum degree of kernel.
+    /*!
+     * Function to get the maximum degree of kernel.
+     * \return Maximum degree of kernel.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to get the maximum order of kernel.
+    /*!
+     * Function to get the maximum order of kernel.
+     * \return Maximum order of kernel.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+private:
+
+    //! Function to compute the Legendre polynomials, in order-major blocks, for the given polynomial parameter.
+    /*!
+     * Function to compute the Legendre polynomials, in order-major blocks, for the given polynomial parameter.
+     * \param polynomialParameter Input parameter to Legendre polynomials (sine of latitude)
+     */
+    void updateLegendrePolynomials( const double polynomialParameter );
+
+    //! Maximum degree of kernel.
+    int maximumDegree_;
+
+    //! Maximum order of kernel.
+    int maximumOrder_;
+
+    //! Pre-computed recursion coefficients of the Legendre polynomials.
+    BlockedLegendreRecursionCoefficients recursionCoefficients_;
+
+    //! Current Legendre polynomials, in order-major blocks.
+    Eigen::ArrayXd legendreValues_;
+
+    //! Degree plus one, for each degree from 0 (entry i contains i).
+    Eigen::ArrayXd degreesPlusOne_;
+
+    //! List of powers of reference radius divided by distance (entry i contains power i).
+    Eigen::ArrayXd referenceRadiusRatioPowers_;
+
+    //! List of cosines of order times longitude.
+    Eigen::ArrayXd cosinesOfLongitude_;
+
+    //! List of sines of order times longitude.
+    Eigen::ArrayXd sinesOfLongitude_;
+
+    //! Pre-allocated work array for the radius ratio powers times Legendre polynomials of a single order block.
+    Eigen::ArrayXd weightedLegendreValues_;
+
+    //! Pre-allocated work array for the latitude derivatives of the Legendre polynomials of a single order block.
+    Eigen::ArrayXd latitudeDerivatives_;
+
+    //! Pre-allocated work array for the longitude-dependent cosine terms of a single order block.
+    Eigen::ArrayXd cosineTerms_;
+
+    //! Pre-allocated work array for the longitude-dependent sine terms of a single order block.
+    Eigen::ArrayXd sineTerms_;
+
+    //! Current polynomial parameter (sine of latitude).
+    double currentPolynomialParameter_;
+
+    //! Current complement to polynomial parameter (cosine of latitude).
+    double currentPolynomialParameterComplement_;
+
+    //! Current longitude.
+    double currentLongitude_;
+
+    //! Current ratio of reference radius and distance.
+    double currentReferenceRadiusRatio_;
+
+    //! Current distance.
+    double currentRadius_;
+};
+
+//! Kernel for the simultaneous evaluation of a geodesy-normalized spherical harmonic field at a tile of points.
+/*!
+ *  Kernel for the simultaneous evaluation of a full geodesy-normalized spherical harmonic potential, its gradient and
+ *  (optionally) its second derivatives at a tile of (up to) tileSize points, for batch evaluation of the same field at
+ *  many points. All per-point quantities are stored as columns of tileSize entries (one column per degree/order), so
+ *  that each operation of the summation is vectorized across the points of the tile, and each coefficient is loaded only
+ *  once per tile. The Legendre polynomials are not stored for all orders, but computed per order during the summation,
+ *  using the recursions of BlockedLegendreRecursionCoefficients, with only the blocks of the current order and the next
+ *  higher order (required for the latitude derivatives) kept in memory. The memory used per point is therefore linear
+ *  in the maximum degree, and remains in cache for high degree fields.
+ *
+ *  Second derivatives w.r.t. latitude are obtained from the associated Legendre differential equation:
+ *  d^2P_{n,m}/dlat^2 = tan(lat) * dP_{n,m}/dlat - ( n( n + 1 ) - m^2 / cos^2(lat) ) * P_{n,m}.
+ */
+class BlockedSphericalHarmonicsTileKernel
+{
+public:
+
+    //! Number of points that is evaluated simultaneously.
+    static const int tileSize = 8;
+
+    //! Typedef for an array with a single quantity for each point in the tile.
+    typedef Eigen::Array< double, tileSize, 1 > TileArray;
+
+    //! Typedef for an array with multiple quantities (one per column) for each point in the tile.
+    typedef Eigen::Array< double, tileSize, Eigen::Dynamic > TileBlock;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param maximumDegree Maximum degree of fields that can be evaluated with this kernel.
+     * \param maximumOrder Maximum order of fields that can be evaluated with this kernel.
+     */
+    BlockedSphericalHarmonicsTileKernel( const int maximumDegree = 0, const int maximumOrder = 0 )
+    {
+        resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
+    }
+
+    //! Update maximum degree and order of kernel, and recompute recursion coefficients.
+    /*!
+     * Update maximum degree and order of kernel, and recompute recursion coefficients.
+     * \param maximumDegree Maximum degree of fields that can be evaluated with this kernel.
+     * \param maximumOrder Maximum order of fields that can be evaluated with this kernel.
+     */
+    void resetMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder );
+
+    //! Update trigonometric functions of longitude and powers of radius ratio to current points.
+    /*!
+     * Update trigonometric functions of longitude and powers of radius ratio to current points. Unused points of the
+     * tile should be filled with a valid (e.g. repeated) position, their results are to be ignored.
+     * \param radii Distance from origin of each point
+     * \param polynomialParameters Input parameter to Legendre polynomials (sine of latitude) of each point
+     * \param longitudes Longitude of each point
+     * \param referenceRadius Reference (typically equatorial) radius of gravity field.
+     */
+    void update( const TileArray& radii, const TileArray& polynomialParameters,
+                 const TileArray& longitudes, const double referenceRadius );
+
+    //! Function to compute the potential and its spherical derivatives of a geodesy-normalized field at current points.
+    /*!
+     * Function to compute the potential, and its gradient and (optionally) second derivatives in spherical coordinates,
+     * of a geodesy-normalized field at the points set by the last call to update, summed over all degrees and orders of
+     * the coefficient matrices. Results are retrieved using getPotentials, getSphericalGradients and
+     * getSphericalHessians.
+     * \param preMultiplier Generic multiplication factor (gravitational parameter divided by reference radius).
+     * \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (row index: degree; column index: order).
+     * \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (row index: degree; column index: order).
+     * \param computeSecondDerivatives Boolean denoting whether the second derivatives are to be computed.
+     */
+    void computeSphericalQuantities( const double preMultiplier,
+                                     const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                                     const Eigen::MatrixXd& sineHarmonicCoefficients,
+                                     const bool computeSecondDerivatives );
+
+    //! Function to retrieve the potentials at the current points, as computed by the last computeSphericalQuantities call
+    /*!
+     * Function to retrieve the potentials at the current points, as computed by the last computeSphericalQuantities call
+     * \return Potential at each point of the tile.
+     */
+    const TileBlock& getPotentials( )
+    {
+        return potentials_;
+    }
+
+    //! Function to retrieve the spherical gradients, as computed by the last computeSphericalQuantities call
+    /*!
+     * Function to retrieve the spherical gradients, as computed by the last computeSphericalQuantities call
+     * \return Derivatives of potential w.r.t. radius, latitude and longitude (columns 0, 1 and 2) at each point.
+     */
+    const TileBlock& getSphericalGradients( )
+    {
+        return sphericalGradients_;
+    }
+
+    //! Function to retrieve the spherical second derivatives, as computed by the last computeSphericalQuantities call
+    /*!
+     * Function to retrieve the spherical second derivatives, as computed by the last computeSphericalQuantities call
+     * (only set if computeSecondDerivatives was true).
+     * \return Second derivatives of potential w.r.t. (radius, radius), (radius, latitude), (radius, longitude),
+     * (latitude, latitude), (latitude, longitude) and (longitude, longitude) (columns 0 to 5) at each point.
+     */
+    const TileBlock& getSphericalHessians( )
+    {
+        return sphericalHessians_;
+    }
+
+    //! Function to get the maximum degree of kernel.
+    /*!
+     * Function to get the maximum degree of kernel.
+     * \return Maximum degree of kernel.
+     */
+    int getMaximumDegree( )
+    {
+        return recursionCoefficients_.maximumDegree;
+    }
+
+    //! Function to get the maximum order of kernel.
+    /*!
+     * Function to get the maximum order of kernel.
+     * \return Maximum order of kernel.
+     */
+    int getMaximumOrder( )
+    {
+        return recursionCoefficients_.maximumOrder;
+    }
+
+private:
+
+    //! Pre-computed recursion coefficients of the Legendre polynomials.
+    BlockedLegendreRecursionCoefficients recursionCoefficients_;
+
+    //! Current distances (column 0), sines (column 1), cosines (column 2), tangents (column 3) and squared secants
+    //! (column 4) of latitude of the points.
+    TileBlock pointProperties_;
+
+    //! Powers of reference radius divided by distance (column i contains power i).
+    TileBlock referenceRadiusRatioPowers_;
+
+    //! Cosines of order times longitude (column i contains order i).
+    TileBlock cosinesOfLongitude_;
+
+    //! Sines of order times longitude (column i contains order i).
+    TileBlock sinesOfLongitude_;
+
+    //! Legendre polynomials of order currently being summed (column i contains degree i).
+    TileBlock currentOrderLegendreValues_;
+
+    //! Legendre polynomials of order one higher than currently being summed (column i contains degree i).
+    TileBlock nextOrderLegendreValues_;
+
+    //! Potentials computed by last call to computeSphericalQuantities.
+    TileBlock potentials_;
+
+    //! Spherical gradients computed by last call to computeSphericalQuantities.
+    TileBlock sphericalGradients_;
+
+    //! Spherical second derivatives computed by last call to computeSphericalQuantities.
+    TileBlock sphericalHessians_;
+};
+
+} // namespace basic_mathematics
+} // namespace tudat
+
+#endif // TUDAT_BLOCKED_SPHERICAL_HARMONICS_H
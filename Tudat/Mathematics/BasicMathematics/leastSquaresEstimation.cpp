@@ -9,11 +9,15 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
+#include <Eigen/Eigenvalues>
 #include <Eigen/LU>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/utilities.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 
@@ -93,26 +97,22 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
                 Eigen::MatrixXd::Zero( informationMatrix.cols( ), informationMatrix.cols( ) ) );
 }
 
-//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
-//! information
-std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
-        const Eigen::MatrixXd& informationMatrix,
-        const Eigen::VectorXd& observationResiduals,
-        const Eigen::VectorXd& diagonalOfWeightMatrix,
-        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+//! Function to perform an iteration of least squares estimation from the normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSide,
         const bool checkConditionNumber,
         const double maximumAllowedConditionNumber,
         const Eigen::MatrixXd& constraintMultiplier,
         const Eigen::VectorXd& constraintRightHandside )
 {
-//    std::cout<<"Residuals "<<observationResiduals.transpose( )<<std::endl;
-//    std::cout<<"Weight diag. "<<diagonalOfWeightMatrix.transpose( )<<std::endl;
-//    std::cout<<"Partials "<<informationMatrix.transpose( )<<std::endl;
+    if( inverseOfCovarianceMatrix.rows( ) != rightHandSide.rows( ) )
+    {
+        throw std::runtime_error( "Error when performing least-squares from normal equations, sizes are incompatible" );
+    }
 
-    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
-            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
-    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
-                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
+    Eigen::VectorXd constrainedRightHandSide = rightHandSide;
+    Eigen::MatrixXd constrainedInverseOfCovarianceMatrix = inverseOfCovarianceMatrix;
 
     // Add constraints to inverse covariance matrix if required
     if( constraintMultiplier.rows( ) != 0 )
@@ -122,7 +122,7 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
         }
 
-        if( constraintMultiplier.cols( ) != informationMatrix.cols( ) )
+        if( constraintMultiplier.cols( ) != inverseOfCovarianceMatrix.cols( ) )
         {
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
@@ -130,26 +130,45 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         int numberOfConstraints = constraintMultiplier.rows( );
         int numberOfParameters = constraintMultiplier.cols( );
 
-        inverseOfCovarianceMatrix.conservativeResize(
+        constrainedInverseOfCovarianceMatrix.conservativeResize(
                     numberOfParameters + numberOfConstraints, numberOfParameters + numberOfConstraints );
-        inverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
+        constrainedInverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
                constraintMultiplier;
-        inverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
+        constrainedInverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
                constraintMultiplier.transpose( );
-        inverseOfCovarianceMatrix.block(
+        constrainedInverseOfCovarianceMatrix.block(
                     numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
 
-        rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
-        rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+        constrainedRightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+        constrainedRightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
     }
 
-//    std::cout<<"RHS "<<rightHandSide.transpose( )<<std::endl;
-//    std::cout<<"Inv cov "<<inverseOfCovarianceMatrix<<std::endl;
-
     return std::make_pair( solveSystemOfEquationsWithSvd(
-                               inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber ),
-                           inverseOfCovarianceMatrix );
+                               constrainedInverseOfCovarianceMatrix, constrainedRightHandSide,
+                               checkConditionNumber, maximumAllowedConditionNumber ),
+                           constrainedInverseOfCovarianceMatrix );
+}
+
+//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
+//! information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
+            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
+    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
+                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
 
+    return performLeastSquaresAdjustmentFromNormalEquations(
+                inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber,
+                constraintMultiplier, constraintRightHandside );
 }
 
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals
@@ -178,6 +197,788 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
                 checkConditionNumber, maximumAllowedConditionNumber );
 }
 
+//! Constructor
+ObservationBlockAccumulator::ObservationBlockAccumulator( const int numberOfParameters ):
+    numberOfParameters_( numberOfParameters )
+{
+    ObservationBlockAccumulator::reset( );
+}
+
+//! Function to reset the accumulated information to zero
+void ObservationBlockAccumulator::reset( )
+{
+    minimumColumnValues_ = Eigen::VectorXd::Constant( numberOfParameters_, std::numeric_limits< double >::infinity( ) );
+    maximumColumnValues_ = Eigen::VectorXd::Constant( numberOfParameters_, -std::numeric_limits< double >::infinity( ) );
+    numberOfObservations_ = 0;
+}
+
+//! Function to add parameters to the estimation
+void ObservationBlockAccumulator::addParameters( const int numberOfNewParameters )
+{
+    if( numberOfNewParameters < 0 )
+    {
+        throw std::runtime_error( "Error when adding parameters to least squares problem, number of parameters is negative" );
+    }
+
+    minimumColumnValues_.conservativeResize( numberOfParameters_ + numberOfNewParameters );
+    maximumColumnValues_.conservativeResize( numberOfParameters_ + numberOfNewParameters );
+
+    // New parameters are consistent with a zero column in the observations added so far
+    const double initialExtremum = ( numberOfObservations_ > 0 ) ? 0.0 : std::numeric_limits< double >::infinity( );
+    minimumColumnValues_.tail( numberOfNewParameters ).setConstant( initialExtremum );
+    maximumColumnValues_.tail( numberOfNewParameters ).setConstant( -initialExtremum );
+
+    numberOfParameters_ += numberOfNewParameters;
+}
+
+//! Function to retrieve the normalization terms of the columns of the information matrix
+Eigen::VectorXd ObservationBlockAccumulator::getNormalizationTerms( ) const
+{
+    Eigen::VectorXd normalizationTerms = Eigen::VectorXd::Ones( numberOfParameters_ );
+    if( numberOfObservations_ > 0 )
+    {
+        for( int i = 0; i < numberOfParameters_; i++ )
+        {
+            if( std::fabs( minimumColumnValues_( i ) ) > maximumColumnValues_( i ) )
+            {
+                normalizationTerms( i ) = minimumColumnValues_( i );
+            }
+            else
+            {
+                normalizationTerms( i ) = maximumColumnValues_( i );
+            }
+            if( normalizationTerms( i ) == 0.0 )
+            {
+                normalizationTerms( i ) = 1.0;
+            }
+        }
+    }
+    return normalizationTerms;
+}
+
+//! Function to check a block of observations and update the column extrema and number of observations accordingly
+bool ObservationBlockAccumulator::registerObservationBlock(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( informationMatrixBlock.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when accumulating observation block, number of parameters is incompatible" );
+    }
+
+    if( ( informationMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ) ||
+            ( informationMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when accumulating observation block, number of observations is incompatible" );
+    }
+
+    if( informationMatrixBlock.rows( ) == 0 )
+    {
+        return false;
+    }
+
+    minimumColumnValues_ = minimumColumnValues_.cwiseMin( informationMatrixBlock.colwise( ).minCoeff( ).transpose( ) );
+    maximumColumnValues_ = maximumColumnValues_.cwiseMax( informationMatrixBlock.colwise( ).maxCoeff( ).transpose( ) );
+    numberOfObservations_ += informationMatrixBlock.rows( );
+
+    return true;
+}
+
+//! Number of columns of normal matrix that are updated by a single task in NormalEquationAccumulator
+static const int NORMAL_MATRIX_PANEL_WIDTH = 64;
+
+//! Constructor
+NormalEquationAccumulator::NormalEquationAccumulator(
+        const int numberOfParameters, const unsigned int numberOfThreads ):
+    ObservationBlockAccumulator( numberOfParameters ),
+    numberOfThreads_( ( numberOfThreads == 0 ) ? utilities::getNumberOfAvailableThreads( ) : numberOfThreads )
+{
+    reset( );
+}
+
+//! Function to reset the accumulated normal equations to zero
+void NormalEquationAccumulator::reset( )
+{
+    ObservationBlockAccumulator::reset( );
+    normalMatrix_ = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    rightHandSide_ = Eigen::VectorXd::Zero( numberOfParameters_ );
+}
+
+//! Function to add a block of observations to the normal equations
+void NormalEquationAccumulator::addObservationBlock(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( !registerObservationBlock( informationMatrixBlock, observationResidualsBlock, diagonalOfWeightMatrixBlock ) )
+    {
+        return;
+    }
+
+    // Update right-hand side
+    const Eigen::MatrixXd weightedInformationMatrixBlock =
+            diagonalOfWeightMatrixBlock.asDiagonal( ) * informationMatrixBlock;
+    rightHandSide_ += weightedInformationMatrixBlock.transpose( ) * observationResidualsBlock;
+
+    // Update lower triangular part of normal matrix, per panel of columns (each task writes to its own columns only).
+    const int numberOfPanels = ( numberOfParameters_ + NORMAL_MATRIX_PANEL_WIDTH - 1 ) / NORMAL_MATRIX_PANEL_WIDTH;
+    auto updatePanel = [ & ]( const unsigned int panelIndex, const unsigned int )
+    {
+        const int startColumn = panelIndex * NORMAL_MATRIX_PANEL_WIDTH;
+        const int panelWidth = std::min( NORMAL_MATRIX_PANEL_WIDTH, numberOfParameters_ - startColumn );
+        const int panelHeight = numberOfParameters_ - startColumn;
+
+        normalMatrix_.block( startColumn, startColumn, panelHeight, panelWidth ).noalias( ) +=
+                weightedInformationMatrixBlock.rightCols( panelHeight ).transpose( ) *
+                informationMatrixBlock.middleCols( startColumn, panelWidth );
+    };
+
+    utilities::executeParallelTasks(
+                numberOfPanels, std::min( numberOfThreads_, static_cast< unsigned int >( numberOfPanels ) ), updatePanel );
+}
+
+//! Function to add parameters to the estimation
+void NormalEquationAccumulator::addParameters( const int numberOfNewParameters )
+{
+    const int oldNumberOfParameters = numberOfParameters_;
+    ObservationBlockAccumulator::addParameters( numberOfNewParameters );
+
+    normalMatrix_.conservativeResize( numberOfParameters_, numberOfParameters_ );
+    normalMatrix_.rightCols( numberOfNewParameters ).setZero( );
+    normalMatrix_.bottomLeftCorner( numberOfNewParameters, oldNumberOfParameters ).setZero( );
+
+    rightHandSide_.conservativeResize( numberOfParameters_ );
+    rightHandSide_.tail( numberOfNewParameters ).setZero( );
+}
+
+//! Function to retrieve the accumulated (full, symmetric) normal matrix A^T*W*A
+Eigen::MatrixXd NormalEquationAccumulator::getNormalMatrix( ) const
+{
+    Eigen::MatrixXd fullNormalMatrix = normalMatrix_.selfadjointView< Eigen::Lower >( );
+    return fullNormalMatrix;
+}
+
+//! Function to extract a subset of the rows and columns of a matrix
+static Eigen::MatrixXd getSubMatrix( const Eigen::MatrixXd& matrix,
+                                     const std::vector< int >& rowIndices,
+                                     const std::vector< int >& columnIndices )
+{
+    Eigen::MatrixXd subMatrix( rowIndices.size( ), columnIndices.size( ) );
+    for( unsigned int j = 0; j < columnIndices.size( ); j++ )
+    {
+        for( unsigned int i = 0; i < rowIndices.size( ); i++ )
+        {
+            subMatrix( i, j ) = matrix( rowIndices.at( i ), columnIndices.at( j ) );
+        }
+    }
+    return subMatrix;
+}
+
+//! Function to extract a subset of the entries of a vector
+static Eigen::VectorXd getSubVector( const Eigen::VectorXd& vector,
+                                     const std::vector< int >& indices )
+{
+    Eigen::VectorXd subVector( indices.size( ) );
+    for( unsigned int i = 0; i < indices.size( ); i++ )
+    {
+        subVector( i ) = vector( indices.at( i ) );
+    }
+    return subVector;
+}
+
+//! Constructor
+ArcWiseNormalEquationAccumulator::ArcWiseNormalEquationAccumulator( const std::vector< int >& parameterArcIndices ):
+    ObservationBlockAccumulator( parameterArcIndices.size( ) ), parameterArcIndices_( parameterArcIndices )
+{
+    for( unsigned int i = 0; i < parameterArcIndices_.size( ); i++ )
+    {
+        const int currentArcIndex = parameterArcIndices_.at( i );
+        if( currentArcIndex < -1 )
+        {
+            throw std::runtime_error( "Error when creating arc-wise normal equations, arc index is invalid" );
+        }
+        else if( currentArcIndex == -1 )
+        {
+            globalParameterIndices_.push_back( i );
+        }
+        else
+        {
+            if( currentArcIndex >= static_cast< int >( localParameterIndices_.size( ) ) )
+            {
+                localParameterIndices_.resize( currentArcIndex + 1 );
+            }
+            localParameterIndices_[ currentArcIndex ].push_back( i );
+        }
+    }
+
+    reset( );
+}
+
+//! Function to reset the accumulated normal equations to zero
+void ArcWiseNormalEquationAccumulator::reset( )
+{
+    ObservationBlockAccumulator::reset( );
+
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+    globalNormalMatrix_ = Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters );
+    globalRightHandSide_ = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+
+    localNormalMatrices_.resize( localParameterIndices_.size( ) );
+    localGlobalNormalMatrices_.resize( localParameterIndices_.size( ) );
+    localRightHandSides_.resize( localParameterIndices_.size( ) );
+    for( unsigned int arc = 0; arc < localParameterIndices_.size( ); arc++ )
+    {
+        const int numberOfLocalParameters = localParameterIndices_.at( arc ).size( );
+        localNormalMatrices_[ arc ] = Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfLocalParameters );
+        localGlobalNormalMatrices_[ arc ] = Eigen::MatrixXd::Zero( numberOfLocalParameters, numberOfGlobalParameters );
+        localRightHandSides_[ arc ] = Eigen::VectorXd::Zero( numberOfLocalParameters );
+    }
+}
+
+//! Function to add a block of observations to the normal equations
+void ArcWiseNormalEquationAccumulator::addObservationBlock(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( !registerObservationBlock( informationMatrixBlock, observationResidualsBlock, diagonalOfWeightMatrixBlock ) )
+    {
+        return;
+    }
+
+    const int numberOfBlockObservations = informationMatrixBlock.rows( );
+    const unsigned int numberOfArcs = localParameterIndices_.size( );
+
+    // Determine arc on the local parameters of which each observation depends (-1 if none)
+    std::vector< int > observationArcIndices( numberOfBlockObservations, -1 );
+    for( unsigned int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        for( unsigned int j = 0; j < localParameterIndices_.at( arc ).size( ); j++ )
+        {
+            const int currentColumn = localParameterIndices_.at( arc ).at( j );
+            for( int i = 0; i < numberOfBlockObservations; i++ )
+            {
+                if( informationMatrixBlock( i, currentColumn ) != 0.0 )
+                {
+                    if( observationArcIndices[ i ] >= 0 && observationArcIndices[ i ] != static_cast< int >( arc ) )
+                    {
+                        throw std::runtime_error( "Error when accumulating arc-wise normal equations, observation depends "
+                                                  "on local parameters of multiple arcs" );
+                    }
+                    observationArcIndices[ i ] = arc;
+                }
+            }
+        }
+    }
+
+    // Update global part of normal equations
+    std::vector< int > allObservationIndices( numberOfBlockObservations );
+    for( int i = 0; i < numberOfBlockObservations; i++ )
+    {
+        allObservationIndices[ i ] = i;
+    }
+    const Eigen::MatrixXd globalInformationMatrixBlock = getSubMatrix(
+                informationMatrixBlock, allObservationIndices, globalParameterIndices_ );
+    const Eigen::MatrixXd weightedGlobalInformationMatrixBlock =
+            diagonalOfWeightMatrixBlock.asDiagonal( ) * globalInformationMatrixBlock;
+    globalNormalMatrix_.noalias( ) += weightedGlobalInformationMatrixBlock.transpose( ) * globalInformationMatrixBlock;
+    globalRightHandSide_.noalias( ) += weightedGlobalInformationMatrixBlock.transpose( ) * observationResidualsBlock;
+
+    // Update local and local-global parts of normal equations, per arc
+    std::vector< int > globalColumnIndices( globalParameterIndices_.size( ) );
+    for( unsigned int j = 0; j < globalParameterIndices_.size( ); j++ )
+    {
+        globalColumnIndices[ j ] = j;
+    }
+
+    std::vector< std::vector< int > > arcObservationIndices( numberOfArcs );
+    for( int i = 0; i < numberOfBlockObservations; i++ )
+    {
+        if( observationArcIndices[ i ] >= 0 )
+        {
+            arcObservationIndices[ observationArcIndices[ i ] ].push_back( i );
+        }
+    }
+
+    for( unsigned int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        const std::vector< int >& currentObservationIndices = arcObservationIndices.at( arc );
+        if( currentObservationIndices.size( ) == 0 )
+        {
+            continue;
+        }
+
+        const Eigen::MatrixXd localInformationMatrix = getSubMatrix(
+                    informationMatrixBlock, currentObservationIndices, localParameterIndices_.at( arc ) );
+        const Eigen::MatrixXd weightedLocalInformationMatrix =
+                getSubVector( diagonalOfWeightMatrixBlock, currentObservationIndices ).asDiagonal( ) *
+                localInformationMatrix;
+
+        localNormalMatrices_[ arc ].noalias( ) += weightedLocalInformationMatrix.transpose( ) * localInformationMatrix;
+        localGlobalNormalMatrices_[ arc ].noalias( ) += weightedLocalInformationMatrix.transpose( ) * getSubMatrix(
+                    globalInformationMatrixBlock, currentObservationIndices, globalColumnIndices );
+        localRightHandSides_[ arc ].noalias( ) += weightedLocalInformationMatrix.transpose( ) *
+                getSubVector( observationResidualsBlock, currentObservationIndices );
+    }
+}
+
+//! Function to add parameters to the estimation
+void ArcWiseNormalEquationAccumulator::addParameters( const int numberOfNewParameters )
+{
+    const int oldNumberOfParameters = numberOfParameters_;
+    ObservationBlockAccumulator::addParameters( numberOfNewParameters );
+
+    const int newArcIndex = localParameterIndices_.size( );
+    localParameterIndices_.push_back( std::vector< int >( ) );
+    for( int i = oldNumberOfParameters; i < numberOfParameters_; i++ )
+    {
+        parameterArcIndices_.push_back( newArcIndex );
+        localParameterIndices_[ newArcIndex ].push_back( i );
+    }
+
+    localNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfNewParameters, numberOfNewParameters ) );
+    localGlobalNormalMatrices_.push_back( Eigen::MatrixXd::Zero( numberOfNewParameters, globalParameterIndices_.size( ) ) );
+    localRightHandSides_.push_back( Eigen::VectorXd::Zero( numberOfNewParameters ) );
+}
+
+//! Function to compute the parameter adjustment by elimination of the arc-wise parameters
+Eigen::VectorXd ArcWiseNormalEquationAccumulator::getParameterAdjustment(
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const Eigen::VectorXd& normalizationTerms,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber ) const
+{
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+    const unsigned int numberOfArcs = localParameterIndices_.size( );
+
+    // Check input
+    const Eigen::VectorXd parameterNormalization =
+            ( normalizationTerms.rows( ) == 0 ) ? Eigen::VectorXd::Ones( numberOfParameters_ ) : normalizationTerms;
+    if( parameterNormalization.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when solving arc-wise normal equations, normalization size is incompatible" );
+    }
+
+    const bool useAPrioriInformation = ( inverseOfAPrioriCovarianceMatrix.size( ) != 0 );
+    if( useAPrioriInformation )
+    {
+        if( ( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters_ ) ||
+                ( inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters_ ) )
+        {
+            throw std::runtime_error( "Error when solving arc-wise normal equations, a priori covariance size is "
+                                      "incompatible" );
+        }
+
+        for( int j = 0; j < numberOfParameters_; j++ )
+        {
+            for( int i = 0; i < numberOfParameters_; i++ )
+            {
+                if( ( parameterArcIndices_.at( i ) >= 0 ) && ( parameterArcIndices_.at( j ) >= 0 ) &&
+                        ( parameterArcIndices_.at( i ) != parameterArcIndices_.at( j ) ) &&
+                        ( inverseOfAPrioriCovarianceMatrix( i, j ) != 0.0 ) )
+                {
+                    throw std::runtime_error( "Error when solving arc-wise normal equations, a priori covariance "
+                                              "correlates local parameters of different arcs" );
+                }
+            }
+        }
+    }
+
+    // Set (normalized) global system
+    const Eigen::VectorXd globalNormalization = getSubVector( parameterNormalization, globalParameterIndices_ );
+    Eigen::MatrixXd reducedNormalMatrix = globalNormalMatrix_.cwiseQuotient(
+                globalNormalization * globalNormalization.transpose( ) );
+    Eigen::VectorXd reducedRightHandSide = globalRightHandSide_.cwiseQuotient( globalNormalization );
+    if( useAPrioriInformation )
+    {
+        reducedNormalMatrix += getSubMatrix(
+                    inverseOfAPrioriCovarianceMatrix, globalParameterIndices_, globalParameterIndices_ );
+    }
+
+    // Eliminate local parameters of each arc from global system (Schur complement)
+    std::vector< Eigen::MatrixXd > localSolutions( numberOfArcs );
+    for( unsigned int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( arc );
+        if( currentLocalIndices.size( ) == 0 )
+        {
+            continue;
+        }
+
+        const Eigen::VectorXd localNormalization = getSubVector( parameterNormalization, currentLocalIndices );
+        Eigen::MatrixXd localNormalMatrix = localNormalMatrices_.at( arc ).cwiseQuotient(
+                    localNormalization * localNormalization.transpose( ) );
+        Eigen::MatrixXd localGlobalNormalMatrix = localGlobalNormalMatrices_.at( arc ).cwiseQuotient(
+                    localNormalization * globalNormalization.transpose( ) );
+        if( useAPrioriInformation )
+        {
+            localNormalMatrix += getSubMatrix(
+                        inverseOfAPrioriCovarianceMatrix, currentLocalIndices, currentLocalIndices );
+            localGlobalNormalMatrix += getSubMatrix(
+                        inverseOfAPrioriCovarianceMatrix, currentLocalIndices, globalParameterIndices_ );
+        }
+
+        // Compute inverse of local normal matrix, multiplied by coupling to global parameters and local right-hand side
+        Eigen::MatrixXd localRightHandSides( currentLocalIndices.size( ), numberOfGlobalParameters + 1 );
+        localRightHandSides.leftCols( numberOfGlobalParameters ) = localGlobalNormalMatrix;
+        localRightHandSides.col( numberOfGlobalParameters ) =
+                localRightHandSides_.at( arc ).cwiseQuotient( localNormalization );
+        localSolutions[ arc ] = localNormalMatrix.jacobiSvd( Eigen::ComputeThinU | Eigen::ComputeThinV ).solve(
+                    localRightHandSides );
+
+        reducedNormalMatrix.noalias( ) -=
+                localGlobalNormalMatrix.transpose( ) * localSolutions[ arc ].leftCols( numberOfGlobalParameters );
+        reducedRightHandSide.noalias( ) -=
+                localGlobalNormalMatrix.transpose( ) * localSolutions[ arc ].col( numberOfGlobalParameters );
+    }
+
+    // Solve reduced system for global parameters, and back-substitute to obtain local parameters
+    Eigen::VectorXd parameterAdjustment = Eigen::VectorXd::Zero( numberOfParameters_ );
+    Eigen::VectorXd globalParameterAdjustment = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        globalParameterAdjustment = solveSystemOfEquationsWithSvd(
+                    reducedNormalMatrix, reducedRightHandSide, checkConditionNumber, maximumAllowedConditionNumber );
+    }
+
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        parameterAdjustment( globalParameterIndices_.at( i ) ) = globalParameterAdjustment( i );
+    }
+
+    for( unsigned int arc = 0; arc < numberOfArcs; arc++ )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( arc );
+        if( currentLocalIndices.size( ) == 0 )
+        {
+            continue;
+        }
+
+        const Eigen::VectorXd localParameterAdjustment =
+                localSolutions.at( arc ).col( numberOfGlobalParameters ) -
+                localSolutions.at( arc ).leftCols( numberOfGlobalParameters ) * globalParameterAdjustment;
+        for( unsigned int i = 0; i < currentLocalIndices.size( ); i++ )
+        {
+            parameterAdjustment( currentLocalIndices.at( i ) ) = localParameterAdjustment( i );
+        }
+    }
+
+    return parameterAdjustment;
+}
+
+//! Function to retrieve the accumulated (full, symmetric) normal matrix A^T*W*A
+Eigen::MatrixXd ArcWiseNormalEquationAccumulator::getNormalMatrix( ) const
+{
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+
+    const int numberOfGlobalParameters = globalParameterIndices_.size( );
+    for( int j = 0; j < numberOfGlobalParameters; j++ )
+    {
+        for( int i = 0; i < numberOfGlobalParameters; i++ )
+        {
+            normalMatrix( globalParameterIndices_.at( i ), globalParameterIndices_.at( j ) ) = globalNormalMatrix_( i, j );
+        }
+    }
+
+    for( unsigned int arc = 0; arc < localParameterIndices_.size( ); arc++ )
+    {
+        const std::vector< int >& currentLocalIndices = localParameterIndices_.at( arc );
+        for( unsigned int i = 0; i < currentLocalIndices.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < currentLocalIndices.size( ); j++ )
+            {
+                normalMatrix( currentLocalIndices.at( i ), currentLocalIndices.at( j ) ) =
+                        localNormalMatrices_.at( arc )( i, j );
+            }
+            for( int j = 0; j < numberOfGlobalParameters; j++ )
+            {
+                normalMatrix( currentLocalIndices.at( i ), globalParameterIndices_.at( j ) ) =
+                        localGlobalNormalMatrices_.at( arc )( i, j );
+                normalMatrix( globalParameterIndices_.at( j ), currentLocalIndices.at( i ) ) =
+                        localGlobalNormalMatrices_.at( arc )( i, j );
+            }
+        }
+    }
+
+    return normalMatrix;
+}
+
+//! Function to retrieve the accumulated right-hand side A^T*W*r
+Eigen::VectorXd ArcWiseNormalEquationAccumulator::getRightHandSide( ) const
+{
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        rightHandSide( globalParameterIndices_.at( i ) ) = globalRightHandSide_( i );
+    }
+
+    for( unsigned int arc = 0; arc < localParameterIndices_.size( ); arc++ )
+    {
+        for( unsigned int i = 0; i < localParameterIndices_.at( arc ).size( ); i++ )
+        {
+            rightHandSide( localParameterIndices_.at( arc ).at( i ) ) = localRightHandSides_.at( arc )( i );
+        }
+    }
+    return rightHandSide;
+}
+
+//! Constructor
+SparseDesignMatrixAccumulator::SparseDesignMatrixAccumulator( const int numberOfParameters ):
+    ObservationBlockAccumulator( numberOfParameters ),
+    designMatrix_( numberOfParameters )
+{
+    reset( );
+}
+
+//! Function to remove all stored observations
+void SparseDesignMatrixAccumulator::reset( )
+{
+    ObservationBlockAccumulator::reset( );
+    designMatrix_.clear( );
+    observationResiduals_.clear( );
+    diagonalOfWeightMatrix_.clear( );
+}
+
+//! Function to add a block of observations to the block-sparse information matrix
+void SparseDesignMatrixAccumulator::addObservationBlock(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( !registerObservationBlock( informationMatrixBlock, observationResidualsBlock, diagonalOfWeightMatrixBlock ) )
+    {
+        return;
+    }
+
+    designMatrix_.addRows( informationMatrixBlock );
+    observationResiduals_.insert( observationResiduals_.end( ), observationResidualsBlock.data( ),
+                                  observationResidualsBlock.data( ) + observationResidualsBlock.rows( ) );
+    diagonalOfWeightMatrix_.insert( diagonalOfWeightMatrix_.end( ), diagonalOfWeightMatrixBlock.data( ),
+                                    diagonalOfWeightMatrixBlock.data( ) + diagonalOfWeightMatrixBlock.rows( ) );
+}
+
+//! Function to add parameters to the estimation
+void SparseDesignMatrixAccumulator::addParameters( const int numberOfNewParameters )
+{
+    ObservationBlockAccumulator::addParameters( numberOfNewParameters );
+    designMatrix_.addColumns( numberOfNewParameters );
+}
+
+//! Function to compute the (full, symmetric) normal matrix A^T*W*A from the stored observations
+Eigen::MatrixXd SparseDesignMatrixAccumulator::getNormalMatrix( ) const
+{
+    return designMatrix_.computeWeightedNormalMatrix( getDiagonalOfWeightMatrix( ) );
+}
+
+//! Function to compute the right-hand side A^T*W*r from the stored observations
+Eigen::VectorXd SparseDesignMatrixAccumulator::getRightHandSide( ) const
+{
+    return designMatrix_.computeWeightedRightHandSide( getObservationResiduals( ), getDiagonalOfWeightMatrix( ) );
+}
+
+//! Function to add rows to a square-root information matrix and transformed residuals
+double updateSquareRootInformation(
+        Eigen::MatrixXd& squareRootInformationMatrix,
+        Eigen::VectorXd& transformedResiduals,
+        const Eigen::MatrixXd& informationMatrixRows,
+        const Eigen::VectorXd& residuals )
+{
+    const int numberOfParameters = squareRootInformationMatrix.cols( );
+    const int numberOfRows = informationMatrixRows.rows( );
+
+    if( ( squareRootInformationMatrix.rows( ) != numberOfParameters ) ||
+            ( transformedResiduals.rows( ) != numberOfParameters ) ||
+            ( informationMatrixRows.cols( ) != numberOfParameters ) ||
+            ( residuals.rows( ) != numberOfRows ) )
+    {
+        throw std::runtime_error( "Error when updating square-root information, sizes are incompatible" );
+    }
+
+    if( numberOfRows == 0 )
+    {
+        return 0.0;
+    }
+
+    // Eliminate the new rows column by column, using for each column j a Householder reflection that acts only on row j of
+    // [ R z ] and on the new rows [ A r ]. Since R is upper triangular, this requires O(m*p^2) operations for m new rows,
+    // as opposed to O((p+m)*p^2) for a QR decomposition of the full stacked system [ R z; A r ].
+    Eigen::MatrixXd newRows = informationMatrixRows;
+    Eigen::VectorXd newResiduals = residuals;
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        const double squaredColumnNorm = newRows.col( j ).squaredNorm( );
+        if( squaredColumnNorm == 0.0 )
+        {
+            continue;
+        }
+
+        // Compute reflection I - tau*v*v^T, with v = [ 1; u ], mapping [ R(j,j); A(:,j) ] to [ beta; 0 ]
+        const double diagonalEntry = squareRootInformationMatrix( j, j );
+        const double beta = ( diagonalEntry >= 0.0 ? -1.0 : 1.0 ) *
+                std::sqrt( diagonalEntry * diagonalEntry + squaredColumnNorm );
+        const double tau = ( beta - diagonalEntry ) / beta;
+        const Eigen::VectorXd reflectionVector = newRows.col( j ) / ( diagonalEntry - beta );
+
+        // Apply reflection to remaining columns of [ R; A ]
+        const int numberOfRemainingColumns = numberOfParameters - j - 1;
+        if( numberOfRemainingColumns > 0 )
+        {
+            Eigen::RowVectorXd reflectionProduct = squareRootInformationMatrix.row( j ).tail( numberOfRemainingColumns ) +
+                    reflectionVector.transpose( ) * newRows.rightCols( numberOfRemainingColumns );
+            reflectionProduct *= tau;
+            squareRootInformationMatrix.row( j ).tail( numberOfRemainingColumns ) -= reflectionProduct;
+            newRows.rightCols( numberOfRemainingColumns ).noalias( ) -= reflectionVector * reflectionProduct;
+        }
+
+        // Apply reflection to [ z; r ]
+        const double residualProduct = tau * ( transformedResiduals( j ) + reflectionVector.dot( newResiduals ) );
+        transformedResiduals( j ) -= residualProduct;
+        newResiduals -= residualProduct * reflectionVector;
+
+        squareRootInformationMatrix( j, j ) = beta;
+        newRows.col( j ).setZero( );
+    }
+
+    // Remaining residuals [ 0 e ] cannot be removed by a parameter adjustment
+    return newResiduals.squaredNorm( );
+}
+
+//! Constructor
+SquareRootInformationAccumulator::SquareRootInformationAccumulator( const int numberOfParameters ):
+    ObservationBlockAccumulator( numberOfParameters )
+{
+    reset( );
+}
+
+//! Function to reset the accumulated square-root information to zero
+void SquareRootInformationAccumulator::reset( )
+{
+    ObservationBlockAccumulator::reset( );
+    squareRootInformationMatrix_ = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    transformedResiduals_ = Eigen::VectorXd::Zero( numberOfParameters_ );
+    squaredResidualNorm_ = 0.0;
+}
+
+//! Function to add a block of observations to the square-root information
+void SquareRootInformationAccumulator::addObservationBlock(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( diagonalOfWeightMatrixBlock.rows( ) > 0 && diagonalOfWeightMatrixBlock.minCoeff( ) < 0.0 )
+    {
+        throw std::runtime_error( "Error when accumulating square-root information, weights must be non-negative" );
+    }
+
+    if( !registerObservationBlock( informationMatrixBlock, observationResidualsBlock, diagonalOfWeightMatrixBlock ) )
+    {
+        return;
+    }
+
+    const Eigen::VectorXd squareRootOfWeights = diagonalOfWeightMatrixBlock.cwiseSqrt( );
+    squaredResidualNorm_ += updateSquareRootInformation(
+                squareRootInformationMatrix_, transformedResiduals_,
+                squareRootOfWeights.asDiagonal( ) * informationMatrixBlock,
+                squareRootOfWeights.cwiseProduct( observationResidualsBlock ) );
+}
+
+//! Function to add parameters to the estimation
+void SquareRootInformationAccumulator::addParameters( const int numberOfNewParameters )
+{
+    const int oldNumberOfParameters = numberOfParameters_;
+    ObservationBlockAccumulator::addParameters( numberOfNewParameters );
+
+    squareRootInformationMatrix_.conservativeResize( numberOfParameters_, numberOfParameters_ );
+    squareRootInformationMatrix_.rightCols( numberOfNewParameters ).setZero( );
+    squareRootInformationMatrix_.bottomLeftCorner( numberOfNewParameters, oldNumberOfParameters ).setZero( );
+
+    transformedResiduals_.conservativeResize( numberOfParameters_ );
+    transformedResiduals_.tail( numberOfNewParameters ).setZero( );
+}
+
+//! Function to retrieve the normal matrix R^T*R
+Eigen::MatrixXd SquareRootInformationAccumulator::getNormalMatrix( ) const
+{
+    return squareRootInformationMatrix_.transpose( ) * squareRootInformationMatrix_;
+}
+
+//! Function to perform an iteration of least squares estimation from square-root information and a priori information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromSquareRootInformation(
+        const Eigen::MatrixXd& squareRootInformationMatrix,
+        const Eigen::VectorXd& transformedResiduals,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    const int numberOfParameters = squareRootInformationMatrix.cols( );
+    if( ( squareRootInformationMatrix.rows( ) != numberOfParameters ) ||
+            ( transformedResiduals.rows( ) != numberOfParameters ) ||
+            ( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters ) ||
+            ( inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters ) )
+    {
+        throw std::runtime_error( "Error when performing least-squares from square-root information, sizes are incompatible" );
+    }
+
+    Eigen::MatrixXd updatedSquareRootInformationMatrix = squareRootInformationMatrix;
+    Eigen::VectorXd updatedTransformedResiduals = transformedResiduals;
+
+    // Add a priori information as rows sqrt(lambda_i)*v_i^T, with (lambda_i, v_i) the eigenpairs of the inverse a priori
+    // covariance (which need not be positive definite)
+    if( !inverseOfAPrioriCovarianceMatrix.isZero( 0.0 ) )
+    {
+        Eigen::SelfAdjointEigenSolver< Eigen::MatrixXd > eigenDecomposition( inverseOfAPrioriCovarianceMatrix );
+        Eigen::MatrixXd aPrioriRows =
+                eigenDecomposition.eigenvalues( ).cwiseMax( 0.0 ).cwiseSqrt( ).asDiagonal( ) *
+                eigenDecomposition.eigenvectors( ).transpose( );
+        updateSquareRootInformation( updatedSquareRootInformationMatrix, updatedTransformedResiduals, aPrioriRows,
+                                     Eigen::VectorXd::Zero( numberOfParameters ) );
+    }
+
+    Eigen::MatrixXd inverseOfCovarianceMatrix =
+            updatedSquareRootInformationMatrix.transpose( ) * updatedSquareRootInformationMatrix;
+
+    // Solve constrained problem from normal equations
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        return performLeastSquaresAdjustmentFromNormalEquations(
+                    inverseOfCovarianceMatrix,
+                    updatedSquareRootInformationMatrix.transpose( ) * updatedTransformedResiduals,
+                    checkConditionNumber, maximumAllowedConditionNumber, constraintMultiplier, constraintRightHandside );
+    }
+
+    // Solve triangular system R*x = z; condition number of R^T*R is the square of that of R.
+    Eigen::JacobiSVD< Eigen::MatrixXd > svdDecomposition = updatedSquareRootInformationMatrix.jacobiSvd(
+                Eigen::ComputeThinU | Eigen::ComputeThinV );
+    if( checkConditionNumber )
+    {
+        double conditionNumber = getConditionNumberOfDecomposedMatrix( svdDecomposition );
+        conditionNumber *= conditionNumber;
+
+        if( conditionNumber > maximumAllowedConditionNumber )
+        {
+            std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+        }
+    }
+
+    return std::make_pair( svdDecomposition.solve( updatedTransformedResiduals ), inverseOfCovarianceMatrix );
+}
+
+//! Function to perform an iteration of least squares estimation from square-root information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromSquareRootInformation(
+        const Eigen::MatrixXd& squareRootInformationMatrix,
+        const Eigen::VectorXd& transformedResiduals,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber )
+{
+    return performLeastSquaresAdjustmentFromSquareRootInformation(
+                squareRootInformationMatrix, transformedResiduals,
+                Eigen::MatrixXd::Zero( squareRootInformationMatrix.cols( ), squareRootInformationMatrix.cols( ) ),
+                checkConditionNumber, maximumAllowedConditionNumber );
+}
+
 //! Function to fit a univariate polynomial through a set of data
 Eigen::VectorXd getLeastSquaresPolynomialFit(
         const Eigen::VectorXd& independentValues,
@@ -16,12 +16,16 @@
 #define TUDAT_LEASTSQUARESESTIMATION_H
 
 #include <map>
+#include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/QR>
 #include <Eigen/SVD>
 
 #include <boost/function.hpp>
 
+#include "Tudat/Mathematics/BasicMathematics/blockSparseDesignMatrix.h"
+
 namespace tudat
 {
 
@@ -100,6 +104,30 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::MatrixXd& informationMatrix,
         const Eigen::VectorXd& diagonalOfWeightMatrix );
 
+//! Function to perform an iteration of least squares estimation from the normal equations
+/*!
+ * Function to perform an iteration of least squares estimation from the normal equations, i.e. from the inverse of the
+ * covariance matrix (sum of the weighted normal matrix A^T*W*A and the inverse a priori covariance) and the right-hand side
+ * A^T*W*r. This allows the estimation to be performed without the full information matrix A being stored (see
+ * NormalEquationAccumulator).
+ * \param inverseOfCovarianceMatrix Inverse of covariance matrix, including influence of a priori information
+ * \param rightHandSide Right-hand side of normal equations (transpose of information matrix, multiplied by weighted
+ * observation residuals)
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 /*!
@@ -169,6 +197,566 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8 );
 
+//! Base class to accumulate the information of a least squares problem, one block of observations at a time.
+/*!
+ *  Base class to accumulate the information of a least squares problem, one block of rows of the information matrix A
+ *  (with associated residuals r and diagonal weights W) at a time. In this way, the full information matrix (of size
+ *  number of observations times number of parameters) never needs to be stored, and the memory use is independent of the
+ *  number of observations. The way in which the information is stored is defined by the derived class. This base class
+ *  stores the minimum and maximum value of each column of the information matrix, so that the same column normalization
+ *  as for the full information matrix can be applied.
+ */
+class ObservationBlockAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfParameters Number of estimated parameters (columns of the information matrix)
+     */
+    ObservationBlockAccumulator( const int numberOfParameters );
+
+    //! Destructor
+    virtual ~ObservationBlockAccumulator( ){ }
+
+    //! Function to reset the accumulated information to zero
+    virtual void reset( );
+
+    //! Function (pure virtual) to add a block of observations to the accumulated information
+    /*!
+     *  Function (pure virtual) to add a block of observations to the accumulated information
+     *  \param informationMatrixBlock Rows of the information matrix for the current block of observations
+     *  \param observationResidualsBlock Observation residuals for the current block of observations
+     *  \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the current block of observations
+     */
+    virtual void addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                                      const Eigen::VectorXd& observationResidualsBlock,
+                                      const Eigen::VectorXd& diagonalOfWeightMatrixBlock ) = 0;
+
+    //! Function to add parameters to the estimation
+    /*!
+     *  Function to add parameters to the estimation (e.g. the parameters of a new arc), without modifying the information
+     *  that has been accumulated so far. The new parameters are appended to the end of the parameter vector, and have no
+     *  information from the observations that were added before this function is called.
+     *  \param numberOfNewParameters Number of parameters that is to be added
+     */
+    virtual void addParameters( const int numberOfNewParameters );
+
+    //! Function to retrieve the normalization terms of the columns of the information matrix
+    /*!
+     *  Function to retrieve the normalization terms of the columns of the information matrix, equal to the entry of each
+     *  column with the largest absolute value (retaining its sign; 1 if column is zero). Dividing the columns of the full
+     *  information matrix by these values would yield entries in the range [-1,1].
+     *  \return Normalization terms of the columns of the information matrix
+     */
+    Eigen::VectorXd getNormalizationTerms( ) const;
+
+    //! Function to retrieve the number of observations that have been added
+    /*!
+     *  Function to retrieve the number of observations that have been added
+     *  \return Number of observations that have been added
+     */
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to retrieve the number of estimated parameters
+    /*!
+     *  Function to retrieve the number of estimated parameters
+     *  \return Number of estimated parameters
+     */
+    int getNumberOfParameters( ) const
+    {
+        return numberOfParameters_;
+    }
+
+protected:
+
+    //! Function to check a block of observations and update the column extrema and number of observations accordingly
+    /*!
+     *  Function to check the consistency of the sizes of a block of observations (exception is thrown if inconsistent),
+     *  and update the column extrema and number of observations accordingly.
+     *  \param informationMatrixBlock Rows of the information matrix for the current block of observations
+     *  \param observationResidualsBlock Observation residuals for the current block of observations
+     *  \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the current block of observations
+     *  \return True if the block contains at least one observation, false if it is empty.
+     */
+    bool registerObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                                   const Eigen::VectorXd& observationResidualsBlock,
+                                   const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Number of estimated parameters
+    int numberOfParameters_;
+
+    //! Minimum value of each column of the information matrix added so far
+    Eigen::VectorXd minimumColumnValues_;
+
+    //! Maximum value of each column of the information matrix added so far
+    Eigen::VectorXd maximumColumnValues_;
+
+    //! Number of observations that have been added
+    int numberOfObservations_;
+};
+
+//! Class to accumulate the weighted normal equations of a least squares problem, one block of observations at a time.
+/*!
+ *  Class to accumulate the weighted normal matrix A^T*W*A and right-hand side A^T*W*r of a least squares problem, one block
+ *  of rows of the information matrix A at a time (see ObservationBlockAccumulator).
+ *  The update of the normal matrix is distributed over a fixed number of threads, each of which computes a set of panels
+ *  of columns of the (lower triangular part of the) normal matrix. The summation order of each entry is fixed, so that
+ *  the result does not depend on the number of threads.
+ */
+class NormalEquationAccumulator: public ObservationBlockAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfParameters Number of estimated parameters (columns of the information matrix)
+     *  \param numberOfThreads Number of threads over which the update of the normal matrix is distributed (if 0, the number
+     *  of threads that can be executed concurrently on the current hardware is used).
+     */
+    NormalEquationAccumulator( const int numberOfParameters,
+                               const unsigned int numberOfThreads = 1 );
+
+    //! Function to reset the accumulated normal equations to zero
+    void reset( );
+
+    //! Function to add a block of observations to the normal equations
+    /*!
+     *  Function to add a block of observations to the normal equations
+     *  \param informationMatrixBlock Rows of the information matrix for the current block of observations
+     *  \param observationResidualsBlock Observation residuals for the current block of observations
+     *  \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the current block of observations
+     */
+    void addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                              const Eigen::VectorXd& observationResidualsBlock,
+                              const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add parameters to the estimation
+    /*!
+     *  Function to add parameters to the estimation, extending the normal equations with zero rows and columns.
+     *  \param numberOfNewParameters Number of parameters that is to be added
+     */
+    void addParameters( const int numberOfNewParameters );
+
+    //! Function to retrieve the accumulated (full, symmetric) normal matrix A^T*W*A
+    /*!
+     *  Function to retrieve the accumulated (full, symmetric) normal matrix A^T*W*A
+     *  \return Accumulated normal matrix
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to retrieve the accumulated right-hand side A^T*W*r
+    /*!
+     *  Function to retrieve the accumulated right-hand side A^T*W*r
+     *  \return Accumulated right-hand side
+     */
+    Eigen::VectorXd getRightHandSide( ) const
+    {
+        return rightHandSide_;
+    }
+
+private:
+
+    //! Number of threads over which the update of the normal matrix is distributed
+    unsigned int numberOfThreads_;
+
+    //! Accumulated normal matrix (only lower triangular part is set)
+    Eigen::MatrixXd normalMatrix_;
+
+    //! Accumulated right-hand side of normal equations
+    Eigen::VectorXd rightHandSide_;
+};
+
+//! Class to accumulate the square-root information of a least squares problem, one block of observations at a time.
+/*!
+ *  Class to accumulate the square-root information of a least squares problem (square-root information filter, SRIF), one
+ *  block of rows of the information matrix A at a time (see ObservationBlockAccumulator). The accumulated information is
+ *  stored as an upper triangular matrix R and vector z, such that the (weighted) least squares problem is equivalent to
+ *  minimizing |R*x - z|^2. Each block of observations is added by a Householder QR decomposition of the stacked system
+ *  [ R z; W^(1/2)*A W^(1/2)*r ], so that the normal matrix A^T*W*A (which has the square of the condition number of
+ *  W^(1/2)*A) is never formed. The observations can be added in time-ordered blocks, and parameters (e.g. those of a new
+ *  arc) can be added in between blocks, without recomputing the contribution of earlier observations.
+ */
+class SquareRootInformationAccumulator: public ObservationBlockAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfParameters Number of estimated parameters (columns of the information matrix)
+     */
+    SquareRootInformationAccumulator( const int numberOfParameters );
+
+    //! Function to reset the accumulated square-root information to zero
+    void reset( );
+
+    //! Function to add a block of observations to the square-root information
+    /*!
+     *  Function to add a block of observations to the square-root information
+     *  \param informationMatrixBlock Rows of the information matrix for the current block of observations
+     *  \param observationResidualsBlock Observation residuals for the current block of observations
+     *  \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the current block of observations
+     *  (must be non-negative)
+     */
+    void addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                              const Eigen::VectorXd& observationResidualsBlock,
+                              const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add parameters to the estimation
+    /*!
+     *  Function to add parameters to the estimation, extending the square-root information with zero rows and columns.
+     *  \param numberOfNewParameters Number of parameters that is to be added
+     */
+    void addParameters( const int numberOfNewParameters );
+
+    //! Function to retrieve the accumulated (upper triangular) square-root information matrix R
+    /*!
+     *  Function to retrieve the accumulated (upper triangular) square-root information matrix R, for which R^T*R is equal to
+     *  the normal matrix A^T*W*A.
+     *  \return Accumulated square-root information matrix
+     */
+    Eigen::MatrixXd getSquareRootInformationMatrix( ) const
+    {
+        return squareRootInformationMatrix_;
+    }
+
+    //! Function to retrieve the accumulated transformed residuals z
+    /*!
+     *  Function to retrieve the accumulated transformed residuals z, for which R^T*z is equal to the right-hand side of the
+     *  normal equations A^T*W*r.
+     *  \return Accumulated transformed residuals
+     */
+    Eigen::VectorXd getTransformedResiduals( ) const
+    {
+        return transformedResiduals_;
+    }
+
+    //! Function to retrieve the weighted squared norm of the residuals that cannot be removed by a parameter adjustment
+    /*!
+     *  Function to retrieve the weighted squared norm of the residuals that cannot be removed by a parameter adjustment,
+     *  i.e. the value of (r-A*x)^T*W*(r-A*x) for the least squares solution x (without a priori information).
+     *  \return Weighted squared norm of the post-fit residuals
+     */
+    double getSquaredResidualNorm( ) const
+    {
+        return squaredResidualNorm_;
+    }
+
+    //! Function to retrieve the normal matrix R^T*R
+    /*!
+     *  Function to retrieve the normal matrix R^T*R, which is equal to the inverse of the covariance matrix (without a
+     *  priori information).
+     *  \return Normal matrix
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+private:
+
+    //! Accumulated square-root information matrix (upper triangular)
+    Eigen::MatrixXd squareRootInformationMatrix_;
+
+    //! Accumulated transformed residuals
+    Eigen::VectorXd transformedResiduals_;
+
+    //! Weighted squared norm of the residuals that cannot be removed by a parameter adjustment
+    double squaredResidualNorm_;
+};
+
+//! Class to accumulate the normal equations of a least squares problem with arc-wise (local) and global parameters.
+/*!
+ *  Class to accumulate the weighted normal equations of a least squares problem in which most parameters are local to a
+ *  single arc (e.g. arc-wise initial states, empirical accelerations or observation biases), and only a limited number of
+ *  parameters are global (e.g. gravity field coefficients or station positions), one block of observations at a time (see
+ *  ObservationBlockAccumulator). Each observation may depend on the global parameters and on the local parameters of at
+ *  most one arc, so that the normal matrix consists of a block-diagonal local part, a local-global coupling part and a
+ *  global part, which are stored separately (the local-local blocks of different arcs, which are zero, are not stored).
+ *  The least squares problem is solved by eliminating the local parameters arc by arc (Schur complement), solving the
+ *  reduced system for the global parameters, and back-substituting the global solution to obtain the local parameters.
+ *  Both memory use and computation time then scale linearly with the number of arcs.
+ */
+class ArcWiseNormalEquationAccumulator: public ObservationBlockAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param parameterArcIndices Index of the arc to which each parameter is local (-1 for global parameters), with entry
+     *  i associated with column i of the information matrix. Arc indices must be in the range [0, number of arcs).
+     */
+    ArcWiseNormalEquationAccumulator( const std::vector< int >& parameterArcIndices );
+
+    //! Function to reset the accumulated normal equations to zero
+    void reset( );
+
+    //! Function to add a block of observations to the normal equations
+    /*!
+     *  Function to add a block of observations to the normal equations. An exception is thrown if a single observation
+     *  depends on the local parameters of more than one arc.
+     *  \param informationMatrixBlock Rows of the information matrix for the current block of observations
+     *  \param observationResidualsBlock Observation residuals for the current block of observations
+     *  \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the current block of observations
+     */
+    void addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                              const Eigen::VectorXd& observationResidualsBlock,
+                              const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add parameters to the estimation
+    /*!
+     *  Function to add parameters to the estimation, which are local to a new arc (appended to the end of the list of arcs).
+     *  \param numberOfNewParameters Number of parameters that is to be added
+     */
+    void addParameters( const int numberOfNewParameters );
+
+    //! Function to compute the parameter adjustment by elimination of the arc-wise parameters
+    /*!
+     *  Function to compute the parameter adjustment by elimination of the arc-wise parameters. The system is normalized
+     *  by the provided normalization terms N (i.e. the normal matrix is divided by N*N^T and the right-hand side by N,
+     *  consistent with the normalization of the columns of the information matrix by N). For each arc, the local block of
+     *  the normal matrix is decomposed (SVD), and its contribution is removed from the global system (Schur complement).
+     *  The reduced global system is solved using an SVD decomposition, after which the local parameters are computed per
+     *  arc.
+     *  \param inverseOfAPrioriCovarianceMatrix Inverse of (normalized) a priori covariance matrix, which may not contain
+     *  correlations between the local parameters of different arcs (empty matrix if no a priori information is used).
+     *  \param normalizationTerms Normalization terms of the parameters (empty vector if no normalization is used).
+     *  \param checkConditionNumber Boolean to denote whether the condition number of the reduced global system is checked
+     *  (warning is printed when value exceeds maximumAllowedConditionNumber)
+     *  \param maximumAllowedConditionNumber Maximum value of the condition number that is allowed
+     *  \return Adjustment of the (normalized) parameters
+     */
+    Eigen::VectorXd getParameterAdjustment(
+            const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix = Eigen::MatrixXd( 0, 0 ),
+            const Eigen::VectorXd& normalizationTerms = Eigen::VectorXd( 0 ),
+            const bool checkConditionNumber = 1,
+            const double maximumAllowedConditionNumber = 1.0E8 ) const;
+
+    //! Function to retrieve the accumulated (full, symmetric) normal matrix A^T*W*A
+    /*!
+     *  Function to retrieve the accumulated (full, symmetric) normal matrix A^T*W*A, assembled from the stored blocks.
+     *  \return Accumulated normal matrix
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to retrieve the accumulated right-hand side A^T*W*r
+    /*!
+     *  Function to retrieve the accumulated right-hand side A^T*W*r, assembled from the stored blocks.
+     *  \return Accumulated right-hand side
+     */
+    Eigen::VectorXd getRightHandSide( ) const;
+
+    //! Function to retrieve the number of arcs
+    /*!
+     *  Function to retrieve the number of arcs
+     *  \return Number of arcs
+     */
+    int getNumberOfArcs( ) const
+    {
+        return localParameterIndices_.size( );
+    }
+
+    //! Function to retrieve the number of global parameters
+    /*!
+     *  Function to retrieve the number of global parameters
+     *  \return Number of global parameters
+     */
+    int getNumberOfGlobalParameters( ) const
+    {
+        return globalParameterIndices_.size( );
+    }
+
+private:
+
+    //! Index of the arc to which each parameter is local (-1 for global parameters)
+    std::vector< int > parameterArcIndices_;
+
+    //! Indices of the global parameters
+    std::vector< int > globalParameterIndices_;
+
+    //! Indices of the local parameters, per arc
+    std::vector< std::vector< int > > localParameterIndices_;
+
+    //! Accumulated normal matrix of the global parameters
+    Eigen::MatrixXd globalNormalMatrix_;
+
+    //! Accumulated right-hand side of the global parameters
+    Eigen::VectorXd globalRightHandSide_;
+
+    //! Accumulated normal matrix of the local parameters, per arc
+    std::vector< Eigen::MatrixXd > localNormalMatrices_;
+
+    //! Accumulated coupling between local (rows) and global (columns) parameters in the normal matrix, per arc
+    std::vector< Eigen::MatrixXd > localGlobalNormalMatrices_;
+
+    //! Accumulated right-hand side of the local parameters, per arc
+    std::vector< Eigen::VectorXd > localRightHandSides_;
+};
+
+//! Class to store the information matrix of a least squares problem in block-sparse form, one block of observations at a
+//! time.
+/*!
+ *  Class to store the information matrix of a least squares problem in block-sparse form (see BlockSparseDesignMatrix),
+ *  one block of observations at a time, together with the residuals and weights of the observations. Only the non-zero
+ *  blocks of each row of the information matrix are retained, so that the memory use, and the number of operations
+ *  required to compute the normal equations, scale with the number of non-zero partials instead of with the product of the
+ *  number of observations and parameters.
+ */
+class SparseDesignMatrixAccumulator: public ObservationBlockAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfParameters Number of estimated parameters (columns of the information matrix)
+     */
+    SparseDesignMatrixAccumulator( const int numberOfParameters );
+
+    //! Function to remove all stored observations
+    void reset( );
+
+    //! Function to add a block of observations to the block-sparse information matrix
+    /*!
+     *  Function to add a block of observations to the block-sparse information matrix
+     *  \param informationMatrixBlock Rows of the information matrix for the current block of observations
+     *  \param observationResidualsBlock Observation residuals for the current block of observations
+     *  \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for the current block of observations
+     */
+    void addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                              const Eigen::VectorXd& observationResidualsBlock,
+                              const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add parameters to the estimation
+    /*!
+     *  Function to add parameters to the estimation, extending the information matrix with zero columns.
+     *  \param numberOfNewParameters Number of parameters that is to be added
+     */
+    void addParameters( const int numberOfNewParameters );
+
+    //! Function to compute the (full, symmetric) normal matrix A^T*W*A from the stored observations
+    /*!
+     *  Function to compute the (full, symmetric) normal matrix A^T*W*A from the stored observations
+     *  \return Normal matrix
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const;
+
+    //! Function to compute the right-hand side A^T*W*r from the stored observations
+    /*!
+     *  Function to compute the right-hand side A^T*W*r from the stored observations
+     *  \return Right-hand side of normal equations
+     */
+    Eigen::VectorXd getRightHandSide( ) const;
+
+    //! Function to retrieve the block-sparse information matrix
+    /*!
+     *  Function to retrieve the block-sparse information matrix
+     *  \return Block-sparse information matrix
+     */
+    const BlockSparseDesignMatrix& getDesignMatrix( ) const
+    {
+        return designMatrix_;
+    }
+
+    //! Function to retrieve the stored observation residuals
+    /*!
+     *  Function to retrieve the stored observation residuals
+     *  \return Stored observation residuals
+     */
+    Eigen::VectorXd getObservationResiduals( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( observationResiduals_.data( ), observationResiduals_.size( ) );
+    }
+
+    //! Function to retrieve the diagonal of the weight matrix of the stored observations
+    /*!
+     *  Function to retrieve the diagonal of the weight matrix of the stored observations
+     *  \return Diagonal of the weight matrix of the stored observations
+     */
+    Eigen::VectorXd getDiagonalOfWeightMatrix( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( diagonalOfWeightMatrix_.data( ), diagonalOfWeightMatrix_.size( ) );
+    }
+
+private:
+
+    //! Block-sparse information matrix of the observations added so far
+    BlockSparseDesignMatrix designMatrix_;
+
+    //! Residuals of the observations added so far
+    std::vector< double > observationResiduals_;
+
+    //! Diagonal of the weight matrix of the observations added so far
+    std::vector< double > diagonalOfWeightMatrix_;
+};
+
+//! Function to add rows to a square-root information matrix and transformed residuals
+/*!
+ *  Function to add rows to a square-root information matrix R and transformed residuals z, by triangularizing the stacked
+ *  system [ R z; A r ] with Householder reflections, so that the least squares problem |R*x - z|^2 + |A*x - r|^2 is
+ *  replaced by the equivalent problem |R'*x - z'|^2 + e^2. Since R is already upper triangular, each reflection only acts
+ *  on a single row of [ R z ] and on the new rows, so that adding m rows for p parameters requires O(m*p^2) operations.
+ *  \param squareRootInformationMatrix Upper triangular square-root information matrix R (modified by this function)
+ *  \param transformedResiduals Transformed residuals z (modified by this function)
+ *  \param informationMatrixRows Rows A that are to be added (must be pre-multiplied by the square root of the weights)
+ *  \param residuals Residuals r that are to be added (must be pre-multiplied by the square root of the weights)
+ *  \return Squared norm e^2 of the part of the residuals that cannot be removed by a parameter adjustment
+ */
+double updateSquareRootInformation(
+        Eigen::MatrixXd& squareRootInformationMatrix,
+        Eigen::VectorXd& transformedResiduals,
+        const Eigen::MatrixXd& informationMatrixRows,
+        const Eigen::VectorXd& residuals );
+
+//! Function to perform an iteration of least squares estimation from square-root information and a priori information
+/*!
+ * Function to perform an iteration of least squares estimation from square-root information (see
+ * SquareRootInformationAccumulator) and a priori information. The a priori information is added to the square-root
+ * information by a QR update, after which the parameter adjustment is obtained from the triangular system R*x = z (using an
+ * SVD decomposition of R, so that rank-deficient problems yield the minimum-norm solution). The condition number of the
+ * inverse covariance matrix R^T*R is computed as the square of the condition number of R. If linear constraints are
+ * provided, the estimation is performed from the normal equations that are formed from the (updated) square-root
+ * information.
+ * \param squareRootInformationMatrix Upper triangular square-root information matrix R
+ * \param transformedResiduals Transformed residuals z
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromSquareRootInformation(
+        const Eigen::MatrixXd& squareRootInformationMatrix,
+        const Eigen::VectorXd& transformedResiduals,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
+//! Function to perform an iteration of least squares estimation from square-root information
+/*!
+ * Function to perform an iteration of least squares estimation from square-root information (see
+ * SquareRootInformationAccumulator), without a priori information.
+ * \param squareRootInformationMatrix Upper triangular square-root information matrix R
+ * \param transformedResiduals Transformed residuals z
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromSquareRootInformation(
+        const Eigen::MatrixXd& squareRootInformationMatrix,
+        const Eigen::VectorXd& transformedResiduals,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8 );
+
 //! Function to fit a univariate polynomial through a set of data
 /*!
  *  Function to fit a univariate polynomial through a set of data. User must provide independent variables and observations
@@ -0,0 +1,190 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_TEST_FUNCTIONS_H
+#define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_TEST_FUNCTIONS_H
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Create quasi-random vector of non-uniform independent variables
+/*!
+ *  Create quasi-random vector of non-uniform independent variables
+ *  \return Non-uniform, but continuously increasing, set of independent variables.
+ */
+std::vector< double > getIndependentVariableVector( )
+{
+    std::vector< double > independentVariableVector;
+    independentVariableVector.push_back( 0.0 );
+    independentVariableVector.push_back( 0.1 );
+    independentVariableVector.push_back( 0.2 );
+    independentVariableVector.push_back( 0.3 );
+    independentVariableVector.push_back( 0.45 );
+    independentVariableVector.push_back( 0.7 );
+    independentVariableVector.push_back( 1.0 );
+    independentVariableVector.push_back( 1.4 );
+    independentVariableVector.push_back( 2.0 );
+    independentVariableVector.push_back( 2.1 );
+    independentVariableVector.push_back( 2.5 );
+    independentVariableVector.push_back( 4.1 );
+    independentVariableVector.push_back( 5.7 );
+    independentVariableVector.push_back( 6.3 );
+    independentVariableVector.push_back( 8.9 );
+    independentVariableVector.push_back( 10.2 );
+    independentVariableVector.push_back( 11.8 );
+    independentVariableVector.push_back( 12.4 );
+    independentVariableVector.push_back( 15.5 );
+    independentVariableVector.push_back( 16.4 );
+    independentVariableVector.push_back( 22.0 );
+    independentVariableVector.push_back( 25.0 );
+    independentVariableVector.push_back( 30.89 );
+    independentVariableVector.push_back( 35.21 );
+    independentVariableVector.push_back( 40.38 );
+    independentVariableVector.push_back( 43.23 );
+    independentVariableVector.push_back( 52.3 );
+    independentVariableVector.push_back( 72.0 );
+    independentVariableVector.push_back( 89.0 );
+    independentVariableVector.push_back( 104.0 );
+    return independentVariableVector;
+}
+
+//! Function to retrieve data (sine function and its derivative) at the independent variables of
+//! getIndependentVariableVector, used to compare the different interpolation functions of an interpolator.
+/*!
+ *  Function to retrieve data (sine function and its derivative) at the independent variables of
+ *  getIndependentVariableVector, used to compare the different interpolation functions of an interpolator.
+ *  \param dataVector Values of sine function at independent variables (returned by reference).
+ *  \param derivativeVector Derivatives of sine function at independent variables (returned by reference).
+ */
+void getSineInterpolationTestData( std::vector< double >& dataVector, std::vector< double >& derivativeVector )
+{
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+
+    dataVector.clear( );
+    derivativeVector.clear( );
+    for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+    {
+        dataVector.push_back( std::sin( 0.1 * independentVariableVector.at( i ) ) );
+        derivativeVector.push_back( 0.1 * std::cos( 0.1 * independentVariableVector.at( i ) ) );
+    }
+}
+
+//! Function to retrieve sorted values (with multiple values per interval, including data points) in the range of
+//! getIndependentVariableVector, at which interpolators are evaluated.
+/*!
+ *  Function to retrieve sorted values (with multiple values per interval, including data points) in the range of
+ *  getIndependentVariableVector, at which interpolators are evaluated.
+ *  \return Sorted values at which to interpolate.
+ */
+std::vector< double > getSortedValuesToInterpolate( )
+{
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+
+    std::vector< double > sortedValues;
+    for( double currentValue = independentVariableVector.front( ); currentValue <= independentVariableVector.back( );
+         currentValue += 0.37 )
+    {
+        sortedValues.push_back( currentValue );
+    }
+    sortedValues.push_back( independentVariableVector.at( 5 ) );
+    sortedValues.push_back( independentVariableVector.back( ) );
+    std::sort( sortedValues.begin( ), sortedValues.end( ) );
+
+    return sortedValues;
+}
+
+//! Function to retrieve unsorted values (including repeated values) at which interpolators are evaluated.
+/*!
+ *  Function to retrieve unsorted values (including repeated values) at which interpolators are evaluated.
+ *  \param includeOutOfRangeValues Boolean denoting whether values outside of range of getIndependentVariableVector are
+ *  to be included.
+ *  \return Unsorted values at which to interpolate.
+ */
+std::vector< double > getUnsortedValuesToInterpolate( const bool includeOutOfRangeValues )
+{
+    std::vector< double > unsortedValues = { 50.0, 3.0, 3.1, 104.0, 103.9, 44.0, 44.0, 0.0, 16.4, 16.0 };
+    if( includeOutOfRangeValues )
+    {
+        unsortedValues.insert( unsortedValues.begin( ) + 5, -10.0 );
+        unsortedValues.insert( unsortedValues.begin( ) + 6, 200.0 );
+    }
+    return unsortedValues;
+}
+
+//! Function to check whether interpolation at a list of values is equal to interpolation at the values individually
+/*!
+ *  Function to check whether interpolation at a list of values (interpolateMultipleValues) is equal to interpolation at
+ *  the values individually, for sorted and unsorted values, and for an empty list.
+ *  \param interpolator Interpolator to check.
+ */
+void checkMultipleValueInterpolation(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > interpolator )
+{
+    std::vector< std::vector< double > > valuesToInterpolate =
+    { getSortedValuesToInterpolate( ), getUnsortedValuesToInterpolate( true ) };
+    for( unsigned int i = 0; i < valuesToInterpolate.size( ); i++ )
+    {
+        std::vector< double > interpolatedValues = interpolator->interpolateMultipleValues( valuesToInterpolate.at( i ) );
+        BOOST_CHECK_EQUAL( interpolatedValues.size( ), valuesToInterpolate.at( i ).size( ) );
+        for( unsigned int j = 0; j < valuesToInterpolate.at( i ).size( ); j++ )
+        {
+            BOOST_CHECK_SMALL( interpolatedValues.at( j ) - interpolator->interpolate( valuesToInterpolate.at( i ).at( j ) ),
+                               1.0E-14 );
+        }
+    }
+    BOOST_CHECK_EQUAL( interpolator->interpolateMultipleValues( std::vector< double >( ) ).size( ), 0 );
+}
+
+//! Function to check whether interpolation with a caller-owned lookup hint is equal to regular interpolation
+/*!
+ *  Function to check whether interpolation with a caller-owned lookup hint (interpolateWithLookUpHint) is equal to
+ *  regular interpolation, and whether the hint is updated to the interval containing the interpolated value (for a value
+ *  equal to a data point, either of the adjacent intervals).
+ *  \param interpolator Interpolator to check.
+ */
+void checkLookUpHintInterpolation(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > interpolator )
+{
+    std::vector< double > valuesToInterpolate = getSortedValuesToInterpolate( );
+    std::vector< double > unsortedValues = getUnsortedValuesToInterpolate( false );
+    valuesToInterpolate.insert( valuesToInterpolate.end( ), unsortedValues.begin( ), unsortedValues.end( ) );
+
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+    int lookUpHint = -1;
+    for( unsigned int j = 0; j < valuesToInterpolate.size( ); j++ )
+    {
+        BOOST_CHECK_SMALL( interpolator->interpolateWithLookUpHint( valuesToInterpolate.at( j ), lookUpHint ) -
+                           interpolator->interpolate( valuesToInterpolate.at( j ) ), 1.0E-14 );
+        BOOST_CHECK( lookUpHint >= 0 && lookUpHint + 1 < static_cast< int >( independentVariableVector.size( ) ) );
+        BOOST_CHECK( independentVariableVector.at( lookUpHint ) <= valuesToInterpolate.at( j ) );
+        BOOST_CHECK( independentVariableVector.at( lookUpHint + 1 ) >= valuesToInterpolate.at( j ) );
+    }
+
+    // Check that invalid hint is not used
+    lookUpHint = static_cast< int >( independentVariableVector.size( ) ) + 10;
+    BOOST_CHECK_SMALL( interpolator->interpolateWithLookUpHint( 44.0, lookUpHint ) - interpolator->interpolate( 44.0 ),
+                       1.0E-14 );
+}
+
+} // namespace unit_tests
+} // namespace tudat
+
+#endif // TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_TEST_FUNCTIONS_H
@@ -19,6 +19,7 @@
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/UnitTests/oneDimensionalInterpolatorTestFunctions.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 namespace tudat
@@ -287,6 +288,21 @@ BOOST_AUTO_TEST_CASE( test_cubicSplineInterpolator_boundary_case )
     }
 }
 
+// Test whether interpolation at a list of values, and interpolation with a caller-owned lookup hint, give the same result
+// as regular interpolation.
+BOOST_AUTO_TEST_CASE( test_cubicSplineInterpolator_multiple_values_and_lookup_hint )
+{
+    using namespace interpolators;
+
+    std::vector< double > dataVector, derivativeVector;
+    getSineInterpolationTestData( dataVector, derivativeVector );
+
+    checkMultipleValueInterpolation( std::make_shared< CubicSplineInterpolator< double, double > >(
+                                         getIndependentVariableVector( ), dataVector, binarySearch ) );
+    checkLookUpHintInterpolation( std::make_shared< CubicSplineInterpolator< double, double > >(
+                                      getIndependentVariableVector( ), dataVector, huntingAlgorithm ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -18,6 +18,7 @@
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 
 #include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/UnitTests/oneDimensionalInterpolatorTestFunctions.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 namespace tudat
@@ -170,6 +171,30 @@ BOOST_AUTO_TEST_CASE( testHermiteCubicSplineInterpolatorWithMatlab )
     }
 }
 
+// Test whether interpolation at a list of values, and interpolation with a caller-owned lookup hint, give the same result
+// as regular interpolation.
+BOOST_AUTO_TEST_CASE( testHermiteCubicSplineInterpolatorMultipleValuesAndLookUpHint )
+{
+    using namespace interpolators;
+
+    std::vector< double > dataVector, derivativeVector;
+    getSineInterpolationTestData( dataVector, derivativeVector );
+
+    checkMultipleValueInterpolation( std::make_shared< HermiteCubicSplineInterpolator< double, double > >(
+                                         getIndependentVariableVector( ), dataVector, derivativeVector, binarySearch,
+                                         use_default_value, std::make_pair( 1.0E3, -1.0E3 ) ) );
+
+    std::shared_ptr< HermiteCubicSplineInterpolator< double, double > > interpolator =
+            std::make_shared< HermiteCubicSplineInterpolator< double, double > >(
+                getIndependentVariableVector( ), dataVector, derivativeVector, huntingAlgorithm,
+                use_default_value, std::make_pair( 1.0E3, -1.0E3 ) );
+    checkLookUpHintInterpolation( interpolator );
+
+    // Check that out-of-range value does not modify hint when default value is used
+    int lookUpHint = 3;
+    BOOST_CHECK_EQUAL( interpolator->interpolateWithLookUpHint( 200.0, lookUpHint ), -1.0E3 );
+    BOOST_CHECK_EQUAL( lookUpHint, 3 );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -14,9 +14,11 @@
 #include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/UnitTests/oneDimensionalInterpolatorTestFunctions.h"
 
 namespace tudat
 {
@@ -71,48 +73,6 @@ std::map< int, double > getPolynomialCoefficients( const int polynomialOrder)
 
 }
 
-//! Create quasi-random vector of non-uniform independent variables
-/*!
- *  Create quasi-random vector of non-uniform independent variables
- *  \return Non-uniform, but continuously increasing, set of independent variables.
- */
-std::vector< double > getIndependentVariableVector( )
-{
-    std::vector< double > independentVariableVector;
-    independentVariableVector.push_back( 0.0 );
-    independentVariableVector.push_back( 0.1 );
-    independentVariableVector.push_back( 0.2 );
-    independentVariableVector.push_back( 0.3 );
-    independentVariableVector.push_back( 0.45 );
-    independentVariableVector.push_back( 0.7 );
-    independentVariableVector.push_back( 1.0 );
-    independentVariableVector.push_back( 1.4 );
-    independentVariableVector.push_back( 2.0 );
-    independentVariableVector.push_back( 2.1 );
-    independentVariableVector.push_back( 2.5 );
-    independentVariableVector.push_back( 4.1 );
-    independentVariableVector.push_back( 5.7 );
-    independentVariableVector.push_back( 6.3 );
-    independentVariableVector.push_back( 8.9 );
-    independentVariableVector.push_back( 10.2 );
-    independentVariableVector.push_back( 11.8 );
-    independentVariableVector.push_back( 12.4 );
-    independentVariableVector.push_back( 15.5 );
-    independentVariableVector.push_back( 16.4 );
-    independentVariableVector.push_back( 22.0 );
-    independentVariableVector.push_back( 25.0 );
-    independentVariableVector.push_back( 30.89 );
-    independentVariableVector.push_back( 35.21 );
-    independentVariableVector.push_back( 40.38 );
-    independentVariableVector.push_back( 43.23 );
-    independentVariableVector.push_back( 52.3 );
-    independentVariableVector.push_back( 72.0 );
-    independentVariableVector.push_back( 89.0 );
-    independentVariableVector.push_back( 104.0 );
-    return independentVariableVector;
-}
-
-
 BOOST_AUTO_TEST_SUITE( test_lagrange_interpolation )
 
 // Test whetehr Lagrange interpolator can properly reproduce polynomial interpolation
@@ -565,6 +525,115 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
 }
 
 
+// Test whether interpolation at a list of values gives the same result as individual interpolation, for sorted, unsorted
+// and out-of-range values.
+BOOST_AUTO_TEST_CASE( test_multiple_value_interpolation )
+{
+    using namespace interpolators;
+
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+    std::vector< double > dataVector, derivativeVector;
+    getSineInterpolationTestData( dataVector, derivativeVector );
+
+    // Check interpolators (using binary search, so that individual interpolation is independent of previous calls).
+    checkMultipleValueInterpolation( std::make_shared< LagrangeInterpolator< double, double > >(
+                                         independentVariableVector, dataVector, 6, binarySearch ) );
+    checkMultipleValueInterpolation( std::make_shared< LagrangeInterpolator< double, double > >(
+                                         independentVariableVector, dataVector, 8, binarySearch,
+                                         lagrange_cubic_spline_boundary_interpolation, use_boundary_value ) );
+
+    // Check interpolation of fixed-size vector states
+    std::vector< Eigen::Vector6d > stateVector;
+    for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+    {
+        Eigen::Vector6d currentState;
+        for( int j = 0; j < 6; j++ )
+        {
+            currentState( j ) = std::sin( 0.1 * independentVariableVector.at( i ) + static_cast< double >( j ) );
+        }
+        stateVector.push_back( currentState );
+    }
+    std::shared_ptr< LagrangeInterpolator< double, Eigen::Vector6d > > stateInterpolator =
+            std::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >(
+                independentVariableVector, stateVector, 8, binarySearch );
+
+    std::vector< double > sortedValues = getSortedValuesToInterpolate( );
+    std::vector< Eigen::Vector6d > interpolatedStates( sortedValues.size( ) );
+    stateInterpolator->interpolateMultipleValues( sortedValues.data( ), static_cast< int >( sortedValues.size( ) ),
+                                                  interpolatedStates.data( ) );
+    for( unsigned int i = 0; i < sortedValues.size( ); i++ )
+    {
+        Eigen::Vector6d stateDifference = interpolatedStates.at( i ) - stateInterpolator->interpolate( sortedValues.at( i ) );
+        BOOST_CHECK_SMALL( stateDifference.norm( ), 1.0E-14 );
+    }
+}
+
+// Test whether interpolation with a caller-owned lookup hint gives the same result as regular interpolation, also when a
+// single interpolator is used concurrently by multiple threads.
+BOOST_AUTO_TEST_CASE( test_lookup_hint_interpolation )
+{
+    using namespace interpolators;
+
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+    std::vector< double > dataVector, derivativeVector;
+    getSineInterpolationTestData( dataVector, derivativeVector );
+
+    checkLookUpHintInterpolation( std::make_shared< LagrangeInterpolator< double, double > >(
+                                      independentVariableVector, dataVector, 8, huntingAlgorithm ) );
+
+    // Define values to interpolate, including unsorted values.
+    std::vector< double > valuesToInterpolate = getSortedValuesToInterpolate( );
+    std::vector< double > unsortedValues = getUnsortedValuesToInterpolate( false );
+    valuesToInterpolate.insert( valuesToInterpolate.end( ), unsortedValues.begin( ), unsortedValues.end( ) );
+
+    // Compute reference results of state interpolation
+    std::vector< Eigen::Vector6d > stateVector;
+    for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+    {
+        Eigen::Vector6d currentState;
+        for( int j = 0; j < 6; j++ )
+        {
+            currentState( j ) = std::sin( 0.1 * independentVariableVector.at( i ) + static_cast< double >( j ) );
+        }
+        stateVector.push_back( currentState );
+    }
+    std::shared_ptr< LagrangeInterpolator< double, Eigen::Vector6d > > stateInterpolator =
+            std::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >(
+                independentVariableVector, stateVector, 8, huntingAlgorithm );
+
+    std::vector< Eigen::Vector6d > referenceStates;
+    for( unsigned int i = 0; i < valuesToInterpolate.size( ); i++ )
+    {
+        referenceStates.push_back( stateInterpolator->interpolate( valuesToInterpolate.at( i ) ) );
+    }
+
+    // Interpolate states concurrently using single interpolator, with one lookup hint per worker, and with workers
+    // traversing the values in opposite directions.
+    const unsigned int numberOfThreads = 4;
+    const unsigned int numberOfTasks = 40;
+    std::vector< std::vector< Eigen::Vector6d > > interpolatedStates(
+                numberOfTasks, std::vector< Eigen::Vector6d >( valuesToInterpolate.size( ) ) );
+    std::vector< int > lookUpHints( numberOfThreads, -1 );
+    utilities::executeParallelTasks(
+                numberOfTasks, numberOfThreads,
+                [ & ]( const unsigned int taskIndex, const unsigned int workerIndex )
+    {
+        for( unsigned int i = 0; i < valuesToInterpolate.size( ); i++ )
+        {
+            const unsigned int valueIndex = ( workerIndex % 2 == 0 ) ? i : ( valuesToInterpolate.size( ) - 1 - i );
+            interpolatedStates[ taskIndex ][ valueIndex ] = stateInterpolator->interpolateWithLookUpHint(
+                        valuesToInterpolate[ valueIndex ], lookUpHints[ workerIndex ] );
+        }
+    } );
+
+    for( unsigned int i = 0; i < numberOfTasks; i++ )
+    {
+        for( unsigned int j = 0; j < valuesToInterpolate.size( ); j++ )
+        {
+            BOOST_CHECK_SMALL( ( interpolatedStates.at( i ).at( j ) - referenceStates.at( j ) ).norm( ), 1.0E-14 );
+        }
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -13,6 +13,7 @@
 
 #include <boost/test/unit_test.hpp>
 #include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/UnitTests/oneDimensionalInterpolatorTestFunctions.h"
 
 #include <Eigen/Core>
 
@@ -453,6 +454,21 @@ BOOST_AUTO_TEST_CASE( test_linearInterpolation_boundary_case_extrapolation_user_
     }
 }
 
+// Test whether interpolation at a list of values, and interpolation with a caller-owned lookup hint, give the same result
+// as regular interpolation.
+BOOST_AUTO_TEST_CASE( test_linearInterpolation_multiple_values_and_lookup_hint )
+{
+    using namespace interpolators;
+
+    std::vector< double > dataVector, derivativeVector;
+    getSineInterpolationTestData( dataVector, derivativeVector );
+
+    checkMultipleValueInterpolation( std::make_shared< LinearInterpolator< double, double > >(
+                                         getIndependentVariableVector( ), dataVector, binarySearch ) );
+    checkLookUpHintInterpolation( std::make_shared< LinearInterpolator< double, double > >(
+                                      getIndependentVariableVector( ), dataVector, huntingAlgorithm ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -116,6 +116,7 @@ public:
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::
     lookUpScheme_;
     using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolateMultipleValues;
 
     //! Cubic spline interpolator constructor.
     /*!
@@ -295,6 +296,67 @@ public:
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry_ );
+    }
+
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values, stored contiguously, and writing the
+     *  results to contiguous memory. If the values are sorted in ascending order, no search is required to find the
+     *  interval of each value from that of the previous value.
+     *  \param independentVariableValues Pointer to first of the independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values at which the value of the dependent variable is to be
+     *      determined.
+     *  \param interpolatedValues Pointer to first entry of output array, with (at least) numberOfValues entries, to which
+     *      the interpolated values of the dependent variable are written (returned by reference).
+     */
+    void interpolateMultipleValues(
+            const IndependentVariableType* independentVariableValues,
+            const int numberOfValues,
+            DependentVariableType* interpolatedValues )
+    {
+        this->interpolateMultipleValuesInIntervals(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+        { return interpolateInInterval( targetIndependentVariableValue, lowerEntry ); } );
+    }
+
+    //! Function to perform interpolation, using a caller-owned hint for the lookup of the interval.
+    /*!
+     *  Function to perform interpolation, using a caller-owned hint for the lookup of the interval, instead of the index
+     *  stored in the lookup scheme, so that the interpolator may be used concurrently by multiple threads, each with its
+     *  own hint (see base class).
+     *  \param independentVariableValue Independent variable value at which the value of the dependent variable is to be
+     *      determined.
+     *  \param nearestLowerIndexHint Nearest lower neighbour found during previous call, or -1 if no previous call has been
+     *      made (updated by this function to nearest lower neighbour of independentVariableValue).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateWithLookUpHint(
+            const IndependentVariableType independentVariableValue, int& nearestLowerIndexHint )
+    {
+        return this->interpolateInIntervalFromLookUpHint(
+                    independentVariableValue, nearestLowerIndexHint,
+                    [ this ]( const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+        { return interpolateInInterval( targetIndependentVariableValue, lowerEntry ); } );
+    }
+
+protected:
+
+private:
+
+    //! Function interpolates dependent variable value at given independent variable value, in given interval.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, in the interval with given
+     *  nearest lower neighbour.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry_ )
+    {
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
         ScalarType squareDifference;
@@ -319,10 +381,6 @@ public:
                 coefficientD_ * secondDerivativeOfCurve_[ lowerEntry_ + 1 ];
     }
 
-protected:
-
-private:
-
     //! Calculates the second derivatives of the curve.
     /*!
      *  This function calculates the second derivatives of the curve at the nodes, assuming
@@ -60,6 +60,7 @@ public:
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::lookUpScheme_;
     using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolateMultipleValues;
 
     //! Constructor from vectors of independent/dependent data.
     /*!
@@ -137,9 +138,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -210,8 +208,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -248,6 +244,79 @@ public:
         int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
                     targetIndependentVariableValue );
 
+        return interpolateInInterval( targetIndependentVariableValue, lowerEntry );
+    }
+
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values, stored contiguously, and writing the
+     *  results to contiguous memory. If the values are sorted in ascending order, no search is required to find the
+     *  interval of each value from that of the previous value.
+     *  \param independentVariableValues Pointer to first of the independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values at which the value of the dependent variable is to be
+     *      determined.
+     *  \param interpolatedValues Pointer to first entry of output array, with (at least) numberOfValues entries, to which
+     *      the interpolated values of the dependent variable are written (returned by reference).
+     */
+    void interpolateMultipleValues(
+            const IndependentVariableType* independentVariableValues,
+            const int numberOfValues,
+            DependentVariableType* interpolatedValues )
+    {
+        this->interpolateMultipleValuesInIntervals(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+        { return interpolateInInterval( targetIndependentVariableValue, lowerEntry ); } );
+    }
+
+    //! Function to perform interpolation, using a caller-owned hint for the lookup of the interval.
+    /*!
+     *  Function to perform interpolation, using a caller-owned hint for the lookup of the interval, instead of the index
+     *  stored in the lookup scheme, so that the interpolator may be used concurrently by multiple threads, each with its
+     *  own hint (see base class).
+     *  \param independentVariableValue Independent variable value at which the value of the dependent variable is to be
+     *      determined.
+     *  \param nearestLowerIndexHint Nearest lower neighbour found during previous call, or -1 if no previous call has been
+     *      made (updated by this function to nearest lower neighbour of independentVariableValue).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateWithLookUpHint(
+            const IndependentVariableType independentVariableValue, int& nearestLowerIndexHint )
+    {
+        return this->interpolateInIntervalFromLookUpHint(
+                    independentVariableValue, nearestLowerIndexHint,
+                    [ this ]( const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+        { return interpolateInInterval( targetIndependentVariableValue, lowerEntry ); } );
+    }
+
+    //! Function to retrieve the number of stages of interpolator
+    /*!
+     *  Function to retrieve the number of stages of interpolator
+     *  \return Number of stages of interpolator
+     */
+    int getNumberOfStages( )
+    {
+        return numberOfStages_;
+    }
+
+protected:
+
+private:
+
+    //! Function interpolates dependent variable value at given independent variable value, in given interval.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, in the interval with given
+     *  nearest lower neighbour (see interpolate function for details).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType targetIndependentVariableValue, const int lowerEntry )
+    {
+        DependentVariableType interpolatedValue = zeroEntry_;
+
         // Check if requested interval is inside region in which centered lagrange interpolation
         // can be used.
         if( lowerEntry < offsetEntries_ )
@@ -298,7 +367,13 @@ public:
             else
             {
                 // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // interpolant is created (cache is thread-local, so that interpolator may be used concurrently).
+                static thread_local std::vector< ScalarType > independentVariableDifferenceCache;
+                if( static_cast< int >( independentVariableDifferenceCache.size( ) ) < 2 * offsetEntries_ + 2 )
+                {
+                    independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
+                }
+
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
@@ -311,14 +386,21 @@ public:
 
                 }
 
+                // Compute Lagrange basis polynomials at requested data point (in place of the differences, in a separate
+                // loop without dependencies between iterations, so that it can be vectorized).
+                const ScalarType* currentDenominators = denominators[ lowerEntry ].data( );
+                ScalarType* lagrangeBasisPolynomials = independentVariableDifferenceCache.data( );
+                for( int i = 0; i < numberOfStages_; i++ )
+                {
+                    lagrangeBasisPolynomials[ i ] =
+                            repeatedNumerator / ( lagrangeBasisPolynomials[ i ] * currentDenominators[ i ] );
+                }
+
                 // Evaluate interpolating polynomial at requested data point.
+                const DependentVariableType* currentDependentValues = &dependentValues_[ lowerEntry - offsetEntries_ ];
                 for( int i = 0; i < numberOfStages_; i++ )
                 {
-                    j = i + lowerEntry - offsetEntries_;
-                    interpolatedValue += dependentValues_[ j ]  *
-                            ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
-                                denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
+                    interpolatedValue += currentDependentValues[ i ] * lagrangeBasisPolynomials[ i ];
                 }
             }
         }
@@ -326,20 +408,6 @@ public:
         return interpolatedValue;
     }
 
-    //! Function to retrieve the number of stages of interpolator
-    /*!
-     *  Function to retrieve the number of stages of interpolator
-     *  \return Number of stages of interpolator
-     */
-    int getNumberOfStages( )
-    {
-        return numberOfStages_;
-    }
-
-protected:
-
-private:
-
     //! Function called at initialization which pre-computes the denominators of the
     //! interpolants at each interval.
     /*!
@@ -461,8 +529,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     std::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
@@ -55,6 +55,7 @@ public:
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::
     lookUpScheme_;
     using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolateMultipleValues;
 
     //! Constructor from map of independent and dependent data.
     /*!
@@ -230,15 +231,72 @@ public:
         int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour(
                     independentVariableValue );
 
+        return interpolateInInterval( independentVariableValue, newNearestLowerIndex );
+    }
+
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values, stored contiguously, and writing the
+     *  results to contiguous memory. If the values are sorted in ascending order, no search is required to find the
+     *  interval of each value from that of the previous value.
+     *  \param independentVariableValues Pointer to first of the independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values at which the value of the dependent variable is to be
+     *      determined.
+     *  \param interpolatedValues Pointer to first entry of output array, with (at least) numberOfValues entries, to which
+     *      the interpolated values of the dependent variable are written (returned by reference).
+     */
+    void interpolateMultipleValues(
+            const IndependentVariableType* independentVariableValues,
+            const int numberOfValues,
+            DependentVariableType* interpolatedValues )
+    {
+        this->interpolateMultipleValuesInIntervals(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType independentVariableValue, const int lowerEntry )
+        { return interpolateInInterval( independentVariableValue, lowerEntry ); } );
+    }
+
+    //! Function to perform interpolation, using a caller-owned hint for the lookup of the interval.
+    /*!
+     *  Function to perform interpolation, using a caller-owned hint for the lookup of the interval, instead of the index
+     *  stored in the lookup scheme, so that the interpolator may be used concurrently by multiple threads, each with its
+     *  own hint (see base class).
+     *  \param independentVariableValue Independent variable value at which the value of the dependent variable is to be
+     *      determined.
+     *  \param nearestLowerIndexHint Nearest lower neighbour found during previous call, or -1 if no previous call has been
+     *      made (updated by this function to nearest lower neighbour of independentVariableValue).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateWithLookUpHint(
+            const IndependentVariableType independentVariableValue, int& nearestLowerIndexHint )
+    {
+        return this->interpolateInIntervalFromLookUpHint(
+                    independentVariableValue, nearestLowerIndexHint,
+                    [ this ]( const IndependentVariableType independentVariableValue, const int lowerEntry )
+        { return interpolateInInterval( independentVariableValue, lowerEntry ); } );
+    }
+
+private:
+
+    //! Function interpolates dependent variable value at given independent variable value, in given interval.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, in the interval with given
+     *  nearest lower neighbour.
+     *  \param independentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of independentVariableValue in independentValues_
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval(
+            const IndependentVariableType independentVariableValue, const int lowerEntry )
+    {
         // Perform linear interpolation.
-        interpolatedValue = dependentValues_[ newNearestLowerIndex ] +
-                ( independentVariableValue - independentValues_[ newNearestLowerIndex ] ) /
-                ( independentValues_[ newNearestLowerIndex + 1 ] -
-                independentValues_[ newNearestLowerIndex ] ) *
-                ( dependentValues_[ newNearestLowerIndex + 1 ] -
-                dependentValues_[ newNearestLowerIndex ] );
-
-        return interpolatedValue;
+        return dependentValues_[ lowerEntry ] +
+                ( independentVariableValue - independentValues_[ lowerEntry ] ) /
+                ( independentValues_[ lowerEntry + 1 ] -
+                independentValues_[ lowerEntry ] ) *
+                ( dependentValues_[ lowerEntry + 1 ] -
+                dependentValues_[ lowerEntry ] );
     }
 
 };
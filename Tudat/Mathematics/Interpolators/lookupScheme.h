@@ -12,6 +12,7 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <atomic>
 #include <vector>
 
 #include <memory>
@@ -92,15 +93,14 @@ public:
 
     //! Constructor, used to set data vector.
     /*!
-     *  Constructor, used to set data vector. Initializes guess from 'previous' request to 0.
+     *  Constructor, used to set data vector. Initializes guess from 'previous' request to -1 (no previous request).
      * \param independentVariableValues vector of independent variable values in which to perform
      * lookup procedure.
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
         : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+          previousNearestLowerIndex_( -1 )
     { }
 
     //! Default destructor
@@ -112,7 +112,9 @@ public:
     //! Find nearest left neighbour.
     /*!
      * Function finds nearest left neighbour of given value in ndependentVariableValues_. If this
-     * is first call of function, a binary search is used.
+     * is first call of function, a binary search is used. The function may be called concurrently from
+     * multiple threads, in which case the index found during the previous call (by any thread) is only used as
+     * initial guess of the hunting algorithm, so that the result is unaffected.
      * \param valueToLookup Value of which nearest neighbour is to be determined.
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
@@ -121,22 +123,22 @@ public:
     {
         // Initialize return value.
         int newNearestLowerIndex = 0;
+        int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
 
         // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        if ( previousNearestLowerIndex < 0 )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
         }
 
         else
         {
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = previousNearestLowerIndex;
             }
 
             // Otherwise, perform hunting algorithm.
@@ -145,29 +147,24 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
-    /*!
-     * Boolean to denote whether a lookup has been done.
-     */
-    bool isFirstLookupDone;
-
     //! Nearest left index during previous call.
     /*!
-     * Nearest left index during previous call
+     * Nearest left index during previous call (-1 if no lookup has been done). Stored atomically, so that the lookup
+     * scheme may be used concurrently.
      */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
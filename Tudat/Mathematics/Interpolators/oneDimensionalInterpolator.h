@@ -125,6 +125,69 @@ public:
         return interpolate( independentVariableValue );
     }
 
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values, stored contiguously, and writing the
+     *  results to contiguous memory. This base class implementation calls the interpolate function for each of the values.
+     *  Derived classes may override this function to reduce the overhead per value, in particular when the values are
+     *  sorted in ascending order (see interpolateMultipleValuesInIntervals).
+     *  \param independentVariableValues Pointer to first of the independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values at which the value of the dependent variable is to be
+     *      determined.
+     *  \param interpolatedValues Pointer to first entry of output array, with (at least) numberOfValues entries, to which
+     *      the interpolated values of the dependent variable are written (returned by reference).
+     */
+    virtual void interpolateMultipleValues(
+            const IndependentVariableType* independentVariableValues,
+            const int numberOfValues,
+            DependentVariableType* interpolatedValues )
+    {
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = interpolate( independentVariableValues[ i ] );
+        }
+    }
+
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values (see function above).
+     *  \param independentVariableValues Independent variable values at which the value of the dependent variable is to be
+     *      determined. Interpolation is most efficient if these values are sorted in ascending order.
+     *  \return Interpolated values of dependent variable, one for each entry of independentVariableValues.
+     */
+    std::vector< DependentVariableType > interpolateMultipleValues(
+            const std::vector< IndependentVariableType >& independentVariableValues )
+    {
+        std::vector< DependentVariableType > interpolatedValues( independentVariableValues.size( ) );
+        if( independentVariableValues.size( ) > 0 )
+        {
+            interpolateMultipleValues( independentVariableValues.data( ), static_cast< int >( independentVariableValues.size( ) ),
+                                       interpolatedValues.data( ) );
+        }
+        return interpolatedValues;
+    }
+
+    //! Function to perform interpolation, using a caller-owned hint for the lookup of the interval.
+    /*!
+     *  Function to perform interpolation, using a caller-owned hint for the lookup of the interval, instead of the index
+     *  stored in the lookUpScheme_. The hint is the nearest lower neighbour found during the previous call with the same
+     *  hint, and is updated by this function. Since no state of the interpolator is modified, a single interpolator may be
+     *  used concurrently by multiple threads, each with its own hint, without the lookups of one thread degrading those
+     *  of another. This base class implementation ignores the hint and calls the interpolate function; derived classes
+     *  that interpolate in a given interval override it (see interpolateInIntervalFromLookUpHint).
+     *  \param independentVariableValue Independent variable value at which the value of the dependent variable is to be
+     *      determined.
+     *  \param nearestLowerIndexHint Nearest lower neighbour found during previous call, or -1 if no previous call has been
+     *      made (updated by this function to nearest lower neighbour of independentVariableValue).
+     *  \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType interpolateWithLookUpHint(
+            const IndependentVariableType independentVariableValue, int& nearestLowerIndexHint )
+    {
+        return interpolate( independentVariableValue );
+    }
+
     //! Function to return the number of independent variables of the interpolation.
     /*!
      *  Function to return the number of independent variables of the interpolation, which is always
@@ -297,6 +360,109 @@ protected:
         }
     }
 
+    //! Function to find the nearest lower neighbour of a value, using the nearest lower neighbour of a previous value.
+    /*!
+     *  Function to find the nearest lower neighbour of a value in independentValues_, using the nearest lower neighbour of
+     *  the previous value of a list (as used by interpolateMultipleValuesInIntervals). If the value is in the same interval
+     *  as the previous value, or in the next interval, it is returned without search. Otherwise, the hunting algorithm is
+     *  used, with the previous index as initial guess. If no valid previous index is provided, a binary search is used.
+     *  Since the state of the lookUpScheme_ is not used, this is also efficient if other calls to the interpolator are
+     *  interleaved with those of a list, and the function may be called concurrently.
+     *  \param targetIndependentVariable Value of independent variable for which the nearest lower neighbour is to be found.
+     *  \param previousLowerEntry Nearest lower neighbour of previous value of list (-1 if this is first value).
+     *  \return Index of entry in independentValues_ vector which is nearest lower neighbour to targetIndependentVariable.
+     */
+    int findNearestLowerNeighbourFromPreviousEntry(
+            const IndependentVariableType& targetIndependentVariable, const int previousLowerEntry )
+    {
+        if( ( previousLowerEntry < 0 ) || ( previousLowerEntry + 1 >= static_cast< int >( independentValues_.size( ) ) ) )
+        {
+            return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch< IndependentVariableType >(
+                        independentValues_, targetIndependentVariable );
+        }
+        else if( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >(
+                     previousLowerEntry, targetIndependentVariable, independentValues_ ) )
+        {
+            return previousLowerEntry;
+        }
+        else if( ( previousLowerEntry + 2 < static_cast< int >( independentValues_.size( ) ) ) &&
+                 basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >(
+                     previousLowerEntry + 1, targetIndependentVariable, independentValues_ ) )
+        {
+            return previousLowerEntry + 1;
+        }
+        else
+        {
+            return basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm< IndependentVariableType >(
+                        targetIndependentVariable, previousLowerEntry, independentValues_ );
+        }
+    }
+
+    //! Function to perform interpolation using a caller-owned lookup hint, from a function interpolating in a given
+    //! interval.
+    /*!
+     *  Function to perform interpolation using a caller-owned lookup hint, for use by derived classes overriding the
+     *  interpolateWithLookUpHint function. The boundary handling is applied, after which the interval is determined from
+     *  the hint (see findNearestLowerNeighbourFromPreviousEntry), and the value is interpolated using the provided
+     *  function.
+     *  \param independentVariableValue Independent variable value at which the value of the dependent variable is to be
+     *      determined.
+     *  \param nearestLowerIndexHint Nearest lower neighbour found during previous call, or -1 if no previous call has been
+     *      made (updated by this function, unless boundary handling is applied).
+     *  \param intervalInterpolationFunction Function interpolating the dependent variable at a given independent variable
+     *      value (first argument), with given index of nearest lower neighbour (second argument).
+     *  \return Interpolated value of dependent variable.
+     */
+    template< typename IntervalInterpolationFunction >
+    DependentVariableType interpolateInIntervalFromLookUpHint(
+            const IndependentVariableType independentVariableValue,
+            int& nearestLowerIndexHint,
+            const IntervalInterpolationFunction& intervalInterpolationFunction )
+    {
+        // Check whether boundary handling needs to be applied
+        DependentVariableType interpolatedValue;
+        bool useValue = false;
+        this->checkBoundaryCase( interpolatedValue, useValue, independentVariableValue );
+        if( !useValue )
+        {
+            nearestLowerIndexHint = findNearestLowerNeighbourFromPreviousEntry(
+                        independentVariableValue, nearestLowerIndexHint );
+            interpolatedValue = intervalInterpolationFunction( independentVariableValue, nearestLowerIndexHint );
+        }
+        return interpolatedValue;
+    }
+
+    //! Function to perform interpolation at a list of independent variable values, from a function interpolating in a
+    //! given interval.
+    /*!
+     *  Function to perform interpolation at a list of independent variable values, for use by derived classes overriding
+     *  the interpolateMultipleValues function. For each value, the boundary handling is applied, after which the interval
+     *  is determined from the interval of the previous value (see findNearestLowerNeighbourFromPreviousEntry), and the
+     *  value is interpolated using the provided function.
+     *  \param independentVariableValues Pointer to first of the independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values at which the value of the dependent variable is to be
+     *      determined.
+     *  \param interpolatedValues Pointer to first entry of output array, to which the interpolated values of the dependent
+     *      variable are written (returned by reference).
+     *  \param intervalInterpolationFunction Function interpolating the dependent variable at a given independent variable
+     *      value (first argument), with given index of nearest lower neighbour (second argument).
+     */
+    template< typename IntervalInterpolationFunction >
+    void interpolateMultipleValuesInIntervals(
+            const IndependentVariableType* independentVariableValues,
+            const int numberOfValues,
+            DependentVariableType* interpolatedValues,
+            const IntervalInterpolationFunction& intervalInterpolationFunction )
+    {
+        int lowerEntry = -1;
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = interpolateInIntervalFromLookUpHint(
+                        independentVariableValues[ i ], lowerEntry, intervalInterpolationFunction );
+        }
+    }
+
     //! Make look-up scheme that is to be used.
     /*!
      * This function creates the look-up scheme that is to be used in determining the interval of
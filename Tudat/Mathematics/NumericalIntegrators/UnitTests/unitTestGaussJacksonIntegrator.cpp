@@ -0,0 +1,320 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson Integration for Orbit Propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 2004.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Core>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Basics/timeType.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/adamsBashforthMoultonIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_gauss_jackson_integrator )
+
+using namespace numerical_integrators;
+
+//! Eccentricity of the (normalized, a = mu = 1) Kepler orbit used in the tests.
+const double testEccentricity = 0.1;
+
+//! Function to compute the state derivative of the normalized Kepler problem (mu = 1), and count the evaluations.
+Eigen::VectorXd computeKeplerStateDerivative( const Eigen::VectorXd& state, int& numberOfEvaluations )
+{
+    numberOfEvaluations++;
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Function to compute the analytical state of the normalized Kepler orbit (periapsis at t = 0).
+Eigen::VectorXd computeAnalyticalKeplerState( const double time )
+{
+    // Solve Kepler's equation
+    double eccentricAnomaly = time;
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        eccentricAnomaly -= ( eccentricAnomaly - testEccentricity * std::sin( eccentricAnomaly ) - time ) /
+                ( 1.0 - testEccentricity * std::cos( eccentricAnomaly ) );
+    }
+
+    double semiMinorAxis = std::sqrt( 1.0 - testEccentricity * testEccentricity );
+    double eccentricAnomalyRate = 1.0 / ( 1.0 - testEccentricity * std::cos( eccentricAnomaly ) );
+
+    Eigen::VectorXd state = Eigen::VectorXd::Zero( 6 );
+    state( 0 ) = std::cos( eccentricAnomaly ) - testEccentricity;
+    state( 1 ) = semiMinorAxis * std::sin( eccentricAnomaly );
+    state( 2 ) = 0.0;
+    state( 3 ) = -std::sin( eccentricAnomaly ) * eccentricAnomalyRate;
+    state( 4 ) = semiMinorAxis * std::cos( eccentricAnomaly ) * eccentricAnomalyRate;
+    state( 5 ) = 0.0;
+    return state;
+}
+
+//! Test the coefficients of the backward difference operators against tabulated values.
+BOOST_AUTO_TEST_CASE( testGaussJacksonCoefficients )
+{
+    std::pair< std::vector< long double >, std::vector< long double > > coefficients =
+            computeGaussJacksonDifferenceCoefficients( 8 );
+
+    // Summed Adams coefficients (Berry and Healy, 2004)
+    std::vector< double > expectedSummedAdamsCoefficients =
+    { -1.0 / 2.0, -1.0 / 12.0, -1.0 / 24.0, -19.0 / 720.0, -3.0 / 160.0, -863.0 / 60480.0, -275.0 / 24192.0,
+      -33953.0 / 3628800.0, -8183.0 / 1036800.0 };
+
+    // Stormer-Cowell/Gauss-Jackson coefficients (Berry and Healy, 2004)
+    std::vector< double > expectedGaussJacksonCoefficients =
+    { 1.0 / 12.0, 0.0, -1.0 / 240.0, -1.0 / 240.0, -221.0 / 60480.0, -19.0 / 6048.0, -9829.0 / 3628800.0,
+      -407.0 / 172800.0, -330157.0 / 159667200.0 };
+
+    BOOST_CHECK_EQUAL( coefficients.first.size( ), 9 );
+    BOOST_CHECK_EQUAL( coefficients.second.size( ), 9 );
+    for( unsigned int i = 0; i < 9; i++ )
+    {
+        BOOST_CHECK_SMALL( static_cast< double >( coefficients.first.at( i ) ) - expectedSummedAdamsCoefficients.at( i ),
+                           1.0E-15 );
+        BOOST_CHECK_SMALL( static_cast< double >( coefficients.second.at( i ) ) - expectedGaussJacksonCoefficients.at( i ),
+                           1.0E-15 );
+    }
+
+    // Check that, for a constant function, only the zeroth order term of the (shifted) operator contributes
+    std::vector< long double > weights = convertDifferenceCoefficientsToOrdinateWeights( coefficients.first, -1 );
+    long double weightSum = 0.0L;
+    for( unsigned int i = 0; i < weights.size( ); i++ )
+    {
+        weightSum += weights.at( i );
+    }
+    BOOST_CHECK_SMALL( static_cast< double >( weightSum - coefficients.first.at( 0 ) ), 1.0E-15 );
+
+    // Check second-order state indices of two Cartesian states, starting at row 1
+    std::vector< std::pair< unsigned int, unsigned int > > secondOrderStateIndices =
+            getCartesianSecondOrderStateIndices( 2, 1 );
+    BOOST_CHECK_EQUAL( secondOrderStateIndices.size( ), 6 );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( secondOrderStateIndices.at( i ).first, 1 + 6 * ( i / 3 ) + i % 3 );
+        BOOST_CHECK_EQUAL( secondOrderStateIndices.at( i ).second, 4 + 6 * ( i / 3 ) + i % 3 );
+    }
+}
+
+//! Test accuracy of the integrator for a Kepler orbit, with and without second-order integration of the position.
+BOOST_AUTO_TEST_CASE( testGaussJacksonKeplerOrbit )
+{
+    double orbitalPeriod = 2.0 * mathematical_constants::PI;
+    double stepSize = orbitalPeriod / 200.0;
+    double finalTime = 10.0 * orbitalPeriod;
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        int numberOfEvaluations = 0;
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+                [ & ]( const double, const Eigen::VectorXd& state )
+        {
+            return computeKeplerStateDerivative( state, numberOfEvaluations );
+        };
+
+        GaussJacksonIntegratorXd integrator(
+                    stateDerivativeFunction, 0.0, computeAnalyticalKeplerState( 0.0 ), stepSize,
+                    ( test == 0 ) ? getCartesianSecondOrderStateIndices( 1 ) :
+                                    std::vector< std::pair< unsigned int, unsigned int > >( ) );
+
+        unsigned int numberOfSteps = 0;
+        while( integrator.getCurrentIndependentVariable( ) < finalTime - 0.5 * stepSize )
+        {
+            integrator.performIntegrationStep( stepSize );
+            numberOfSteps++;
+
+            // Check that time is not affected by accumulation of rounding errors
+            BOOST_CHECK_EQUAL( integrator.getCurrentIndependentVariable( ),
+                               static_cast< double >( numberOfSteps ) * stepSize );
+        }
+
+        Eigen::VectorXd stateError =
+                integrator.getCurrentState( ) - computeAnalyticalKeplerState( integrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK_SMALL( stateError.norm( ), ( test == 0 ) ? 1.0E-9 : 1.0E-8 );
+
+        // Check that the number of state derivative evaluations is (close to) one per step after the startup, when
+        // using the second-order formulation
+        BOOST_CHECK_EQUAL( numberOfEvaluations, integrator.getNumberOfStateDerivativeEvaluations( ) );
+        BOOST_CHECK( numberOfEvaluations < static_cast< int >( ( ( test == 0 ) ? 1.05 : 2.0 ) * numberOfSteps ) + 200 );
+    }
+}
+
+//! Compare computational cost and accuracy of the Gauss-Jackson, Adams-Bashforth-Moulton and RKF7(8) integrators.
+BOOST_AUTO_TEST_CASE( testGaussJacksonBenchmark )
+{
+    double orbitalPeriod = 2.0 * mathematical_constants::PI;
+    double finalTime = 50.0 * orbitalPeriod;
+    Eigen::VectorXd analyticalFinalState = computeAnalyticalKeplerState( finalTime );
+
+    int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        return computeKeplerStateDerivative( state, numberOfEvaluations );
+    };
+
+    // Gauss-Jackson
+    GaussJacksonIntegratorXd gaussJacksonIntegrator(
+                stateDerivativeFunction, 0.0, computeAnalyticalKeplerState( 0.0 ), orbitalPeriod / 150.0,
+                getCartesianSecondOrderStateIndices( 1 ) );
+    double gaussJacksonError =
+            ( gaussJacksonIntegrator.integrateTo( finalTime, orbitalPeriod / 150.0 ) - analyticalFinalState ).norm( );
+    int gaussJacksonEvaluations = numberOfEvaluations;
+
+    // Adams-Bashforth-Moulton
+    numberOfEvaluations = 0;
+    Eigen::VectorXd tolerance = Eigen::VectorXd::Constant( 6, 1.0E-12 );
+    AdamsBashforthMoultonIntegratorXd adamsBashforthMoultonIntegrator(
+                stateDerivativeFunction, 0.0, computeAnalyticalKeplerState( 0.0 ),
+                orbitalPeriod * 1.0E-8, orbitalPeriod / 20.0, tolerance, tolerance );
+    double adamsBashforthMoultonError =
+            ( adamsBashforthMoultonIntegrator.integrateTo( finalTime, orbitalPeriod / 150.0 ) -
+              analyticalFinalState ).norm( );
+    int adamsBashforthMoultonEvaluations = numberOfEvaluations;
+
+    // Runge-Kutta-Fehlberg 7(8)
+    numberOfEvaluations = 0;
+    RungeKuttaVariableStepSizeIntegratorXd rungeKuttaIntegrator(
+                RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg78 ), stateDerivativeFunction,
+                0.0, computeAnalyticalKeplerState( 0.0 ), std::numeric_limits< double >::epsilon( ),
+                std::numeric_limits< double >::infinity( ), tolerance, tolerance );
+    double rungeKuttaError =
+            ( rungeKuttaIntegrator.integrateTo( finalTime, orbitalPeriod / 150.0 ) - analyticalFinalState ).norm( );
+    int rungeKuttaEvaluations = numberOfEvaluations;
+
+    // Check that Gauss-Jackson is at least as accurate as the other integrators, at a fraction of the cost
+    BOOST_CHECK( gaussJacksonError < 1.0E-8 );
+    BOOST_CHECK( gaussJacksonError < 2.0 * rungeKuttaError );
+    BOOST_CHECK( gaussJacksonError < 2.0 * adamsBashforthMoultonError );
+    BOOST_CHECK( 2 * gaussJacksonEvaluations < rungeKuttaEvaluations );
+    BOOST_CHECK( gaussJacksonEvaluations < adamsBashforthMoultonEvaluations );
+}
+
+//! Test integration with Time as independent variable, as well as non-nominal steps, rollback and state modification.
+BOOST_AUTO_TEST_CASE( testGaussJacksonTimeAndStepControl )
+{
+    double orbitalPeriod = 2.0 * mathematical_constants::PI;
+    double stepSize = orbitalPeriod / 200.0;
+    double finalTime = 3.3 * orbitalPeriod;
+
+    int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        return computeKeplerStateDerivative( state, numberOfEvaluations );
+    };
+    std::function< Eigen::VectorXd( const Time, const Eigen::VectorXd& ) > timeStateDerivativeFunction =
+            [ & ]( const Time, const Eigen::VectorXd& state )
+    {
+        return computeKeplerStateDerivative( state, numberOfEvaluations );
+    };
+
+    // Integrate to epoch that is not a multiple of the step size
+    GaussJacksonIntegratorXd integrator(
+                stateDerivativeFunction, 0.0, computeAnalyticalKeplerState( 0.0 ), stepSize,
+                getCartesianSecondOrderStateIndices( 1 ) );
+    Eigen::VectorXd finalState = integrator.integrateTo( finalTime, stepSize );
+    BOOST_CHECK_SMALL( ( finalState - computeAnalyticalKeplerState( finalTime ) ).norm( ), 1.0E-9 );
+
+    // Integrate with Time as independent variable, and compare to double
+    GaussJacksonIntegrator< Time, Eigen::VectorXd, Eigen::VectorXd, long double > timeIntegrator(
+                timeStateDerivativeFunction, Time( 0.0 ), computeAnalyticalKeplerState( 0.0 ), stepSize,
+                getCartesianSecondOrderStateIndices( 1 ) );
+    Eigen::VectorXd timeFinalState = timeIntegrator.integrateTo( Time( finalTime ), stepSize );
+    BOOST_CHECK_SMALL( ( timeFinalState - finalState ).norm( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( static_cast< double >( timeIntegrator.getCurrentIndependentVariable( ) - Time( finalTime ) ),
+                       1.0E-12 );
+
+    // Check rollback of nominal step, both during startup and during predictor-corrector steps
+    for( unsigned int numberOfInitialSteps = 3; numberOfInitialSteps < 20; numberOfInitialSteps += 15 )
+    {
+        GaussJacksonIntegratorXd rollbackIntegrator(
+                    stateDerivativeFunction, 0.0, computeAnalyticalKeplerState( 0.0 ), stepSize,
+                    getCartesianSecondOrderStateIndices( 1 ) );
+        for( unsigned int i = 0; i < numberOfInitialSteps; i++ )
+        {
+            rollbackIntegrator.performIntegrationStep( stepSize );
+        }
+        Eigen::VectorXd previousState = rollbackIntegrator.getCurrentState( );
+        double previousTime = rollbackIntegrator.getCurrentIndependentVariable( );
+
+        Eigen::VectorXd firstState = rollbackIntegrator.performIntegrationStep( stepSize );
+        BOOST_CHECK_EQUAL( rollbackIntegrator.rollbackToPreviousState( ), true );
+        BOOST_CHECK_EQUAL( rollbackIntegrator.rollbackToPreviousState( ), false );
+        BOOST_CHECK_EQUAL( rollbackIntegrator.getCurrentIndependentVariable( ), previousTime );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( rollbackIntegrator.getCurrentState( ), previousState,
+                                           std::numeric_limits< double >::epsilon( ) );
+
+        // Redo step, and continue integration
+        Eigen::VectorXd secondState = rollbackIntegrator.performIntegrationStep( stepSize );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( firstState, secondState, 1.0E-13 );
+        for( unsigned int i = 0; i < 50; i++ )
+        {
+            rollbackIntegrator.performIntegrationStep( stepSize );
+        }
+        BOOST_CHECK_SMALL( ( rollbackIntegrator.getCurrentState( ) - computeAnalyticalKeplerState(
+                                 rollbackIntegrator.getCurrentIndependentVariable( ) ) ).norm( ), 1.0E-10 );
+    }
+
+    // Check restart of method after state modification
+    GaussJacksonIntegratorXd modifiedIntegrator(
+                stateDerivativeFunction, 0.0, computeAnalyticalKeplerState( 0.0 ), stepSize,
+                getCartesianSecondOrderStateIndices( 1 ) );
+    modifiedIntegrator.integrateTo( orbitalPeriod / 2.0, stepSize );
+    double modificationTime = modifiedIntegrator.getCurrentIndependentVariable( );
+    modifiedIntegrator.modifyCurrentIntegrationVariables( computeAnalyticalKeplerState( 0.0 ), 0.0 );
+    modifiedIntegrator.integrateTo( modificationTime, stepSize );
+    BOOST_CHECK_SMALL( ( modifiedIntegrator.getCurrentState( ) - computeAnalyticalKeplerState( modificationTime ) ).norm( ),
+                       1.0E-10 );
+
+    // Check that resetting the current state to an identical value (as done by the propagation loop after each step)
+    // does not restart the method, while a true modification of the state does. Nominal steps are taken first, so that
+    // the method is in its predictor-corrector phase.
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        modifiedIntegrator.performIntegrationStep( stepSize );
+    }
+    numberOfEvaluations = 0;
+    modifiedIntegrator.modifyCurrentState( modifiedIntegrator.getCurrentState( ), true );
+    modifiedIntegrator.performIntegrationStep( stepSize );
+    int unmodifiedStepEvaluations = numberOfEvaluations;
+
+    numberOfEvaluations = 0;
+    modifiedIntegrator.modifyCurrentState( computeAnalyticalKeplerState(
+                                               modifiedIntegrator.getCurrentIndependentVariable( ) ), true );
+    modifiedIntegrator.performIntegrationStep( stepSize );
+    int modifiedStepEvaluations = numberOfEvaluations;
+    BOOST_CHECK( unmodifiedStepEvaluations < modifiedStepEvaluations );
+    BOOST_CHECK( unmodifiedStepEvaluations <= 4 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
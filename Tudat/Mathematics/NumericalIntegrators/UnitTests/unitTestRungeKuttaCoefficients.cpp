@@ -10,6 +10,7 @@
  *    References
  *      Burden, R.L., Faires, J.D. Numerical Analysis, 7th Edition, Books/Cole, 2001.
  *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
  *
  *    Notes
  *      There might be a problem with the RKF78 and DOPRI8 integrators, as the coefficients do not
@@ -23,6 +24,7 @@
 #define BOOST_TEST_MAIN
 
 #include <cmath>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 
@@ -71,10 +73,114 @@ void checkValidityOfCoefficientSet( const RungeKuttaCoefficients::CoefficientSet
     }
 }
 
+//! Function to add all rooted trees of a given order, with their density and elementary weights per stage.
+/*!
+ *  Function to add all rooted trees of a given order, with their density and elementary weights per stage (Hairer et al.,
+ *  1993, Section II.2). A tree of order n consists of a root with a set of subtrees of total order n-1. These subtrees are
+ *  taken from the trees that have already been added, in order of non-decreasing index, so that each tree is added once.
+ *  \param aCoefficients Square matrix of a-coefficients of the Butcher tableau.
+ *  \param treeOrder Order of the trees that are added.
+ *  \param remainingOrder Total order of the subtrees that remain to be attached to the root.
+ *  \param firstSubtreeIndex Index of the first existing tree that may be attached to the root.
+ *  \param numberOfSubtreeCandidates Number of existing trees that may be attached to the root (all of lower order).
+ *  \param currentStageWeights Elementary weights per stage of the root with the subtrees attached so far.
+ *  \param currentDensity Product of the densities of the subtrees attached so far.
+ *  \param treeOrders Orders of the rooted trees (appended to by this function).
+ *  \param treeDensities Densities of the rooted trees (appended to by this function).
+ *  \param treeStageWeights Elementary weights per stage of the rooted trees (appended to by this function).
+ */
+void addRootedTrees( const Eigen::MatrixXd& aCoefficients,
+                     const int treeOrder,
+                     const int remainingOrder,
+                     const unsigned int firstSubtreeIndex,
+                     const unsigned int numberOfSubtreeCandidates,
+                     const Eigen::VectorXd& currentStageWeights,
+                     const double currentDensity,
+                     std::vector< int >& treeOrders,
+                     std::vector< double >& treeDensities,
+                     std::vector< Eigen::VectorXd >& treeStageWeights )
+{
+    if( remainingOrder == 0 )
+    {
+        treeOrders.push_back( treeOrder );
+        treeDensities.push_back( currentDensity * static_cast< double >( treeOrder ) );
+        treeStageWeights.push_back( currentStageWeights );
+    }
+    else
+    {
+        for( unsigned int i = firstSubtreeIndex; i < numberOfSubtreeCandidates; i++ )
+        {
+            if( treeOrders.at( i ) <= remainingOrder )
+            {
+                addRootedTrees( aCoefficients, treeOrder, remainingOrder - treeOrders.at( i ), i,
+                                numberOfSubtreeCandidates,
+                                currentStageWeights.cwiseProduct( aCoefficients * treeStageWeights.at( i ) ),
+                                currentDensity * treeDensities.at( i ), treeOrders, treeDensities, treeStageWeights );
+            }
+        }
+    }
+}
+
+//! Function to check the order conditions of both order estimates of a coefficient set.
+/*!
+ *  Function to check the order conditions of both order estimates of a coefficient set: for each rooted tree t up to the
+ *  order of the estimate, the b-coefficients b and elementary weights Phi(t) must satisfy b^T Phi(t) = 1 / gamma(t), with
+ *  gamma(t) the density of the tree (Hairer et al., 1993, Section II.2).
+ *  \param coefficientSet Coefficient set to check.
+ *  \param tolerance Tolerance with which order conditions must be satisfied.
+ */
+void checkOrderConditionsOfCoefficientSet( const RungeKuttaCoefficients::CoefficientSets& coefficientSet,
+                                           const double tolerance )
+{
+    const RungeKuttaCoefficients& coefficients = RungeKuttaCoefficients::get( coefficientSet );
+
+    // Extend a-coefficients to square matrix
+    const int numberOfStages = coefficients.cCoefficients.rows( );
+    Eigen::MatrixXd aCoefficients = Eigen::MatrixXd::Zero( numberOfStages, numberOfStages );
+    aCoefficients.block( 0, 0, coefficients.aCoefficients.rows( ), coefficients.aCoefficients.cols( ) ) =
+            coefficients.aCoefficients;
+
+    // Generate all rooted trees up to higher order.
+    std::vector< int > treeOrders;
+    std::vector< double > treeDensities;
+    std::vector< Eigen::VectorXd > treeStageWeights;
+    for( int treeOrder = 1; treeOrder <= coefficients.higherOrder; treeOrder++ )
+    {
+        addRootedTrees( aCoefficients, treeOrder, treeOrder - 1, 0, treeOrders.size( ),
+                        Eigen::VectorXd::Ones( numberOfStages ), 1.0, treeOrders, treeDensities, treeStageWeights );
+    }
+
+    // Check number of trees (1, 1, 2, 4, 9, 20, 48, 115, 286 trees of order 1 to 9).
+    const std::vector< unsigned int > numberOfTreesUpToOrder = { 0, 1, 2, 4, 8, 17, 37, 85, 200, 486 };
+    BOOST_CHECK_EQUAL( treeOrders.size( ), numberOfTreesUpToOrder.at( coefficients.higherOrder ) );
+
+    // Check order conditions of lower (row 0) and higher (row 1) order estimates.
+    const std::vector< int > ordersOfEstimates = { coefficients.lowerOrder, coefficients.higherOrder };
+    for( unsigned int i = 0; i < ordersOfEstimates.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < treeOrders.size( ); j++ )
+        {
+            if( treeOrders.at( j ) <= ordersOfEstimates.at( i ) )
+            {
+                BOOST_CHECK_SMALL( coefficients.bCoefficients.row( i ).dot( treeStageWeights.at( j ) ) -
+                                   1.0 / treeDensities.at( j ), tolerance );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( testRungeKuttaFehlberg45Coefficients )
 {
     // Check validity of Runge-Kutta-Fehlberg 45 coefficients.
     checkValidityOfCoefficientSet( RungeKuttaCoefficients::rungeKuttaFehlberg45, 1.0e-15 );
+    checkOrderConditionsOfCoefficientSet( RungeKuttaCoefficients::rungeKuttaFehlberg45, 1.0e-15 );
+}
+
+BOOST_AUTO_TEST_CASE( testRungeKuttaFehlberg56Coefficients )
+{
+    // Check validity of Runge-Kutta-Fehlberg 56 coefficients.
+    checkValidityOfCoefficientSet( RungeKuttaCoefficients::rungeKuttaFehlberg56, 1.0e-15 );
+    checkOrderConditionsOfCoefficientSet( RungeKuttaCoefficients::rungeKuttaFehlberg56, 1.0e-15 );
 }
 
 BOOST_AUTO_TEST_CASE( testRungeKuttaFehlberg78Coefficients )
@@ -85,6 +191,7 @@ BOOST_AUTO_TEST_CASE( testRungeKuttaFehlberg78Coefficients )
     // aCoefficients matrix sum does not correspond to cCoefficient counterpart with tolerance less
     // than 1.0e-14).
     checkValidityOfCoefficientSet( RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0e-14 );
+    checkOrderConditionsOfCoefficientSet( RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0e-14 );
 }
 
 BOOST_AUTO_TEST_CASE( testRungeKutta87DormandAndPrinceCoefficients )
@@ -95,6 +202,47 @@ BOOST_AUTO_TEST_CASE( testRungeKutta87DormandAndPrinceCoefficients )
     // matrix sum does not correspond to cCoefficient counterpart with tolerance less than
     // 1.0e-14).
     checkValidityOfCoefficientSet( RungeKuttaCoefficients::rungeKutta87DormandPrince, 1.0e-14 );
+    checkOrderConditionsOfCoefficientSet( RungeKuttaCoefficients::rungeKutta87DormandPrince, 1.0e-14 );
+}
+
+BOOST_AUTO_TEST_CASE( testRungeKutta54DormandAndPrinceCoefficients )
+{
+    // Check validity of Runge-Kutta 54 (Dormand and Prince) coefficients.
+    checkValidityOfCoefficientSet( RungeKuttaCoefficients::rungeKutta54DormandPrince, 1.0e-15 );
+    checkOrderConditionsOfCoefficientSet( RungeKuttaCoefficients::rungeKutta54DormandPrince, 1.0e-15 );
+
+    const RungeKuttaCoefficients& coefficients =
+            RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKutta54DormandPrince );
+    BOOST_CHECK_EQUAL( coefficients.isFirstSameAsLast( ), true );
+    BOOST_CHECK_EQUAL( coefficients.hasDenseOutputCoefficients( ), true );
+
+    // Check that the continuous extension reduces to the integrated (5th order) solution at the end of the step.
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                Eigen::VectorXd( coefficients.bCoefficients.row( 1 ).transpose( ) ),
+                Eigen::VectorXd( coefficients.denseOutputCoefficients.rowwise( ).sum( ) ), 1.0e-14 );
+
+    // Check first and second order conditions of the continuous extension
+    for( double theta = 0.1; theta < 1.0; theta += 0.2 )
+    {
+        Eigen::VectorXd thetaPowers = ( Eigen::VectorXd( 4 ) << theta, theta * theta, theta * theta * theta,
+                                        theta * theta * theta * theta ).finished( );
+        Eigen::VectorXd weights = coefficients.denseOutputCoefficients * thetaPowers;
+        BOOST_CHECK_CLOSE_FRACTION( weights.sum( ), theta, 1.0e-14 );
+        BOOST_CHECK_CLOSE_FRACTION( weights.dot( coefficients.cCoefficients ), theta * theta / 2.0, 1.0e-14 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testRungeKutta65VernerCoefficients )
+{
+    // Check validity of Runge-Kutta 65 (Verner) coefficients. Note, the sum of row 6 of the aCoefficients matrix
+    // (c = 1/15, from terms up to 2.3) is only equal to its cCoefficient counterpart to within 1.0e-14.
+    checkValidityOfCoefficientSet( RungeKuttaCoefficients::rungeKutta65Verner, 1.0e-14 );
+    checkOrderConditionsOfCoefficientSet( RungeKuttaCoefficients::rungeKutta65Verner, 1.0e-15 );
+
+    const RungeKuttaCoefficients& coefficients =
+            RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKutta65Verner );
+    BOOST_CHECK_EQUAL( coefficients.isFirstSameAsLast( ), false );
+    BOOST_CHECK_EQUAL( coefficients.hasDenseOutputCoefficients( ), false );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
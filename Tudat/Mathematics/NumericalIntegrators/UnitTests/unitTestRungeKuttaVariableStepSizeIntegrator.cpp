@@ -34,9 +34,11 @@
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/Mathematics/NumericalIntegrators/UnitTests/numericalIntegratorTestFunctions.h"
 
+#include <cmath>
 #include <limits>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace tudat
 {
@@ -313,6 +315,354 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Test number of state derivative evaluations per step, including rejected steps and first-same-as-last reuse.
+BOOST_AUTO_TEST_CASE( testStateDerivativeEvaluationCount )
+{
+    using namespace numerical_integrators;
+    using namespace unit_tests::numerical_integrator_test_functions;
+
+    // State derivative function that counts its number of evaluations.
+    unsigned int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > countingStateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        return computeVanDerPolStateDerivative( time, state );
+    };
+
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( );
+    const unsigned int numberOfSteps = 50;
+
+    // Check that none of the predefined coefficient sets has the FSAL property
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get(
+                           RungeKuttaCoefficients::rungeKuttaFehlberg45 ).isFirstSameAsLast( ), false );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get(
+                           RungeKuttaCoefficients::rungeKuttaFehlberg56 ).isFirstSameAsLast( ), false );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get(
+                           RungeKuttaCoefficients::rungeKuttaFehlberg78 ).isFirstSameAsLast( ), false );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get(
+                           RungeKuttaCoefficients::rungeKutta87DormandPrince ).isFirstSameAsLast( ), false );
+
+    // Test rejected steps: step size function that rejects every first attempt of a step (halving the step size).
+    {
+        bool rejectStep = false;
+        RungeKuttaVariableStepSizeIntegratorXd::NewStepSizeFunction rejectingStepSizeFunction =
+                [ & ]( const double stepSize, const std::pair< double, double >&, const double,
+                const std::pair< double, double >&, const Eigen::VectorXd&, const Eigen::VectorXd&,
+                const Eigen::VectorXd&, const Eigen::VectorXd& )
+        {
+            rejectStep = !rejectStep;
+            return std::make_pair( rejectStep ? 0.5 * stepSize : stepSize, !rejectStep );
+        };
+
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg78 ),
+                    countingStateDerivativeFunction, 0.0, initialState, 1.0E-12, 10.0, 1.0E-8, 1.0E-8,
+                    0.8, 4.0, 0.1, rejectingStepSizeFunction );
+        BOOST_CHECK_EQUAL( integrator.isFirstSameAsLast( ), false );
+
+        numberOfEvaluations = 0;
+        for( unsigned int i = 0; i < numberOfSteps; i++ )
+        {
+            integrator.performIntegrationStep( 1.0E-3 );
+        }
+
+        // Each step consists of one rejected and one accepted attempt, the first stage of which is evaluated only once.
+        BOOST_CHECK_EQUAL( numberOfEvaluations, numberOfSteps * ( 13 + 12 ) );
+        BOOST_CHECK_CLOSE_FRACTION( integrator.getCurrentIndependentVariable( ),
+                                    static_cast< double >( numberOfSteps ) * 0.5E-3, 1.0E-12 );
+        BOOST_TEST_MESSAGE( "RKF78, state derivative evaluations per step with one rejection: " <<
+                            static_cast< double >( numberOfEvaluations ) / static_cast< double >( numberOfSteps ) );
+    }
+
+    // Test FSAL reuse, using the Bogacki-Shampine 3(2) coefficient set.
+    {
+        Eigen::MatrixXd aCoefficients = Eigen::MatrixXd::Zero( 4, 3 );
+        aCoefficients( 1, 0 ) = 1.0 / 2.0;
+        aCoefficients( 2, 1 ) = 3.0 / 4.0;
+        aCoefficients( 3, 0 ) = 2.0 / 9.0;
+        aCoefficients( 3, 1 ) = 1.0 / 3.0;
+        aCoefficients( 3, 2 ) = 4.0 / 9.0;
+
+        Eigen::MatrixXd bCoefficients = Eigen::MatrixXd::Zero( 2, 4 );
+        bCoefficients( 0, 0 ) = 7.0 / 24.0;
+        bCoefficients( 0, 1 ) = 1.0 / 4.0;
+        bCoefficients( 0, 2 ) = 1.0 / 3.0;
+        bCoefficients( 0, 3 ) = 1.0 / 8.0;
+        bCoefficients.block( 1, 0, 1, 3 ) = aCoefficients.block( 3, 0, 1, 3 );
+
+        Eigen::VectorXd cCoefficients = ( Eigen::VectorXd( 4 ) << 0.0, 1.0 / 2.0, 3.0 / 4.0, 1.0 ).finished( );
+
+        RungeKuttaCoefficients bogackiShampineCoefficients(
+                    aCoefficients, bCoefficients, cCoefficients, 3, 2, RungeKuttaCoefficients::higher );
+        BOOST_CHECK_EQUAL( bogackiShampineCoefficients.isFirstSameAsLast( ), true );
+
+        RungeKuttaVariableStepSizeIntegratorXd fsalIntegrator(
+                    bogackiShampineCoefficients, countingStateDerivativeFunction, 0.0, initialState,
+                    1.0E-12, 1.0, 1.0E-8, 1.0E-8 );
+        RungeKuttaVariableStepSizeIntegratorXd referenceIntegrator(
+                    bogackiShampineCoefficients, countingStateDerivativeFunction, 0.0, initialState,
+                    1.0E-12, 1.0, 1.0E-8, 1.0E-8 );
+        BOOST_CHECK_EQUAL( fsalIntegrator.isFirstSameAsLast( ), true );
+
+        // Propagate with FSAL reuse.
+        numberOfEvaluations = 0;
+        double stepSize = 1.0E-3;
+        for( unsigned int i = 0; i < numberOfSteps; i++ )
+        {
+            fsalIntegrator.performIntegrationStep( stepSize );
+            stepSize = fsalIntegrator.getNextStepSize( );
+        }
+        unsigned int numberOfFsalEvaluations = numberOfEvaluations;
+
+        // Propagate while resetting the state after each step (which forces re-evaluation of the first stage).
+        numberOfEvaluations = 0;
+        stepSize = 1.0E-3;
+        for( unsigned int i = 0; i < numberOfSteps; i++ )
+        {
+            referenceIntegrator.performIntegrationStep( stepSize );
+            stepSize = referenceIntegrator.getNextStepSize( );
+            // Resetting to an identical state retains the step history, so the state is first perturbed.
+            Eigen::VectorXd currentState = referenceIntegrator.getCurrentState( );
+            referenceIntegrator.modifyCurrentState( currentState + Eigen::VectorXd::Ones( currentState.rows( ) ) );
+            referenceIntegrator.modifyCurrentState( currentState );
+        }
+        unsigned int numberOfReferenceEvaluations = numberOfEvaluations;
+
+        // Check that results are identical, with one evaluation per step less (except for the first step)
+        BOOST_CHECK_EQUAL( fsalIntegrator.getCurrentIndependentVariable( ),
+                           referenceIntegrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK_EQUAL( ( fsalIntegrator.getCurrentState( ) - referenceIntegrator.getCurrentState( ) ).norm( ), 0.0 );
+        BOOST_CHECK_EQUAL( numberOfReferenceEvaluations - numberOfFsalEvaluations, numberOfSteps - 1 );
+        BOOST_TEST_MESSAGE( "Bogacki-Shampine, state derivative evaluations per step with/without FSAL reuse: " <<
+                            static_cast< double >( numberOfFsalEvaluations ) / static_cast< double >( numberOfSteps ) <<
+                            " " <<
+                            static_cast< double >( numberOfReferenceEvaluations ) / static_cast< double >( numberOfSteps ) );
+    }
+}
+
+//! Test that integration with a state derivative function that writes into an existing object gives identical results
+BOOST_AUTO_TEST_CASE( testInPlaceStateDerivativeFunction )
+{
+    using namespace numerical_integrators;
+
+    // Harmonic oscillator, with state derivative function returning by value, and writing into existing object.
+    unsigned int numberOfEvaluations = 0, numberOfInPlaceEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > harmonicOscillatorStateDerivative =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    std::function< void( const double, const Eigen::VectorXd&, Eigen::VectorXd& ) >
+            harmonicOscillatorInPlaceStateDerivative =
+            [ & ]( const double, const Eigen::VectorXd& state, Eigen::VectorXd& stateDerivative )
+    {
+        numberOfInPlaceEvaluations++;
+        stateDerivative.resize( 2 );
+        stateDerivative( 0 ) = state( 1 );
+        stateDerivative( 1 ) = -state( 0 );
+    };
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+
+    // Test for coefficient set without (RKF78) and with (DOPRI5) first-same-as-last property.
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        RungeKuttaCoefficients::CoefficientSets coefficientSet =
+                ( i == 0 ) ? RungeKuttaCoefficients::rungeKuttaFehlberg78 :
+                             RungeKuttaCoefficients::rungeKutta54DormandPrince;
+
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), harmonicOscillatorStateDerivative, 0.0,
+                    initialState, 1.0E-10, 1.0, 1.0E-10, 1.0E-10 );
+        RungeKuttaVariableStepSizeIntegratorXd inPlaceIntegrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), harmonicOscillatorStateDerivative, 0.0,
+                    initialState, 1.0E-10, 1.0, 1.0E-10, 1.0E-10 );
+        inPlaceIntegrator.setStateDerivativeInPlaceFunction( harmonicOscillatorInPlaceStateDerivative );
+
+        // Propagate with by-value state derivative function
+        numberOfEvaluations = 0;
+        numberOfInPlaceEvaluations = 0;
+        double stepSize = 0.01;
+        for( unsigned int j = 0; j < 50; j++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+            stepSize = integrator.getNextStepSize( );
+        }
+        BOOST_CHECK_EQUAL( numberOfInPlaceEvaluations, 0 );
+        unsigned int numberOfByValueEvaluations = numberOfEvaluations;
+
+        // Propagate with in-place state derivative function, and check that only this function is used
+        numberOfEvaluations = 0;
+        stepSize = 0.01;
+        for( unsigned int j = 0; j < 50; j++ )
+        {
+            inPlaceIntegrator.performIntegrationStep( stepSize );
+            stepSize = inPlaceIntegrator.getNextStepSize( );
+        }
+        BOOST_CHECK_EQUAL( numberOfEvaluations, 0 );
+        BOOST_CHECK_EQUAL( numberOfInPlaceEvaluations, numberOfByValueEvaluations );
+
+        // Check that results are identical
+        BOOST_CHECK_EQUAL( inPlaceIntegrator.getCurrentIndependentVariable( ), integrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK_EQUAL( ( inPlaceIntegrator.getCurrentState( ) - integrator.getCurrentState( ) ).norm( ), 0.0 );
+        BOOST_CHECK_EQUAL( ( inPlaceIntegrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) - 0.001 ) -
+                             integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) - 0.001 ) ).norm( ),
+                           0.0 );
+    }
+}
+
+//! Test order of convergence of coefficient sets, using a harmonic oscillator with known analytical solution (the
+//! order conditions themselves are checked in unitTestRungeKuttaCoefficients.cpp).
+BOOST_AUTO_TEST_CASE( testConvergenceOrder )
+{
+    using namespace numerical_integrators;
+
+    // Harmonic oscillator, with solution x = cos( t ), v = -sin( t ).
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > harmonicOscillatorStateDerivative =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+    const double finalTime = 8.0;
+    const Eigen::VectorXd finalState = ( Eigen::VectorXd( 2 ) << std::cos( finalTime ), -std::sin( finalTime ) ).finished( );
+
+    // Coefficient sets to test, with (largest) step sizes for which truncation error is well above rounding error.
+    const std::vector< RungeKuttaCoefficients::CoefficientSets > coefficientSets =
+    { RungeKuttaCoefficients::rungeKuttaFehlberg45, RungeKuttaCoefficients::rungeKuttaFehlberg56,
+      RungeKuttaCoefficients::rungeKuttaFehlberg78, RungeKuttaCoefficients::rungeKutta87DormandPrince,
+      RungeKuttaCoefficients::rungeKutta54DormandPrince, RungeKuttaCoefficients::rungeKutta65Verner };
+    const std::vector< double > stepSizes = { 0.1, 0.2, 0.4, 0.4, 0.1, 0.2 };
+
+    for( unsigned int i = 0; i < coefficientSets.size( ); i++ )
+    {
+        const RungeKuttaCoefficients& coefficients = RungeKuttaCoefficients::get( coefficientSets.at( i ) );
+        const int integratedOrder = ( coefficients.orderEstimateToIntegrate == RungeKuttaCoefficients::higher ) ?
+                    coefficients.higherOrder : coefficients.lowerOrder;
+
+        // Integrate with constant step size (no step is rejected, due to large tolerances), and halved step size.
+        std::vector< double > finalStateErrors;
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            const double stepSize = stepSizes.at( i ) / std::pow( 2.0, j );
+            RungeKuttaVariableStepSizeIntegratorXd integrator(
+                        coefficients, harmonicOscillatorStateDerivative, 0.0, initialState,
+                        1.0E-10, 10.0, 1.0E10, 1.0E10 );
+            const int numberOfSteps = static_cast< int >( std::round( finalTime / stepSize ) );
+            for( int k = 0; k < numberOfSteps; k++ )
+            {
+                integrator.performIntegrationStep( stepSize );
+            }
+            BOOST_CHECK_CLOSE_FRACTION( integrator.getCurrentIndependentVariable( ), finalTime, 1.0E-14 );
+            finalStateErrors.push_back( ( integrator.getCurrentState( ) - finalState ).norm( ) );
+        }
+
+        // Check that global error decreases with (at least) order of integrated estimate. The DOPRI8 set converges
+        // faster on this problem (observed order close to 9), due to its small leading error coefficients.
+        const double observedOrder = std::log2( finalStateErrors.at( 0 ) / finalStateErrors.at( 1 ) );
+        BOOST_CHECK_GE( observedOrder, static_cast< double >( integratedOrder ) - 0.3 );
+        BOOST_CHECK_LE( observedOrder, static_cast< double >( integratedOrder ) + 1.0 );
+    }
+}
+
+//! Test dense output of variable step size integrators, using a harmonic oscillator with known analytical solution.
+BOOST_AUTO_TEST_CASE( testDenseOutput )
+{
+    using namespace numerical_integrators;
+
+    // Harmonic oscillator, with solution x = cos( t ), v = -sin( t ).
+    unsigned int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > harmonicOscillatorStateDerivative =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        // Use coefficient set with (i=0) and without (i=1) dedicated dense output coefficients.
+        RungeKuttaCoefficients::CoefficientSets coefficientSet =
+                ( i == 0 ) ? RungeKuttaCoefficients::rungeKutta54DormandPrince :
+                             RungeKuttaCoefficients::rungeKuttaFehlberg78;
+        double tolerance = ( i == 0 ) ? 1.0E-10 : 1.0E-12;
+
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( coefficientSet ), harmonicOscillatorStateDerivative, 0.0,
+                    initialState, 1.0E-10, 1.0, tolerance, tolerance );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+
+        double maximumDenseOutputError = 0.0, maximumStepError = 0.0;
+        unsigned int numberOfSteps = 0;
+        double stepSize = 0.01;
+        while( integrator.getCurrentIndependentVariable( ) < 10.0 )
+        {
+            integrator.performIntegrationStep( stepSize );
+            stepSize = integrator.getNextStepSize( );
+            numberOfSteps++;
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+
+            double previousTime = integrator.getPreviousIndependentVariable( );
+            double currentTime = integrator.getCurrentIndependentVariable( );
+
+            // Check that dense output reproduces state at start and end of step.
+            BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( previousTime ) -
+                                 integrator.getPreviousState( ) ).norm( ), 1.0E-14 );
+            BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( currentTime ) -
+                                 integrator.getCurrentState( ) ).norm( ), 1.0E-14 );
+
+            maximumStepError = std::max(
+                        maximumStepError, std::fabs( integrator.getCurrentState( )( 0 ) - std::cos( currentTime ) ) );
+
+            // Compare dense output within step to analytical solution
+            for( double fraction = 0.1; fraction < 1.0; fraction += 0.2 )
+            {
+                double testTime = previousTime + fraction * ( currentTime - previousTime );
+                Eigen::VectorXd denseOutputState = integrator.getDenseOutputState( testTime );
+                maximumDenseOutputError = std::max(
+                            maximumDenseOutputError, std::fabs( denseOutputState( 0 ) - std::cos( testTime ) ) );
+                maximumDenseOutputError = std::max(
+                            maximumDenseOutputError, std::fabs( denseOutputState( 1 ) + std::sin( testTime ) ) );
+            }
+        }
+
+        if( i == 0 )
+        {
+            // Dense output of DOPRI5 should be of same order of accuracy as the integration itself.
+            BOOST_CHECK_SMALL( maximumDenseOutputError, 10.0 * maximumStepError + 1.0E-9 );
+        }
+        else
+        {
+            // Hermite interpolation of RKF78 steps is of lower order, and only roughly accurate.
+            BOOST_CHECK_SMALL( maximumDenseOutputError, 1.0E-4 );
+        }
+
+        // Check that dense output is not available outside the step, and only remains available after modifying the
+        // state if the state is unchanged.
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) + 1.0 ),
+                           std::runtime_error );
+        integrator.modifyCurrentState( integrator.getCurrentState( ) );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+        integrator.modifyCurrentState( 2.0 * integrator.getCurrentState( ) );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) ),
+                           std::runtime_error );
+    }
+
+    // Check that dense output of DOPRI5 requires no additional state derivative evaluations.
+    {
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKutta54DormandPrince ),
+                    harmonicOscillatorStateDerivative, 0.0, initialState, 1.0E-10, 1.0, 1.0E-10, 1.0E-10 );
+        integrator.performIntegrationStep( 0.01 );
+        numberOfEvaluations = 0;
+        integrator.getDenseOutputState( 0.005 );
+        BOOST_CHECK_EQUAL( numberOfEvaluations, 0 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -21,6 +21,7 @@
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKutta4Integrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/euler.h"
 #include "Tudat/Mathematics/NumericalIntegrators/adamsBashforthMoultonIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
@@ -38,7 +39,8 @@ enum AvailableIntegrators
     rungeKutta4,
     rungeKuttaVariableStepSize,
     bulirschStoer,
-    adamsBashforthMoulton
+    adamsBashforthMoulton,
+    gaussJackson
 };
 
 //! Class to define settings of numerical integrator
@@ -80,6 +82,17 @@ public:
      */
     virtual ~IntegratorSettings( ) { }
 
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< IntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of numerical integrator
     /*!
      *  Type of numerical integrator, from enum of available integrators.
@@ -174,6 +187,17 @@ public:
      */
     virtual ~RungeKuttaVariableStepSizeBaseSettings( ) { }
 
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >( *this );
+    }
+
     //! Boolean denoting whether integration error tolerances are defined as a scalar (or vector).
     bool areTolerancesDefinedAsScalar_;
 
@@ -310,6 +334,17 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsScalarTolerances( ) { }
 
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     IndependentVariableType relativeErrorTolerance_;
 
@@ -376,6 +411,17 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsVectorTolerances( ) { }
 
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     DependentVariableType relativeErrorTolerance_;
 
@@ -440,6 +486,17 @@ public:
      */
     ~BulirschStoerIntegratorSettings( ){ }
 
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of sequence that is to be used for Bulirsch-Stoer integrator
     ExtrapolationMethodStepSequences extrapolationSequence_;
 
@@ -528,6 +585,17 @@ public:
      */
     ~AdamsBashforthMoultonSettings( ){ }
 
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< AdamsBashforthMoultonSettings< IndependentVariableType > >( *this );
+    }
+
     //! Minimum step size for integration.
     /*!
      *  Minimum step size for integration. Integration stops (exception thrown) if time step comes below this value.
@@ -554,6 +622,106 @@ public:
 
 };
 
+//! Class to define settings of the Gauss-Jackson numerical integrator.
+/*!
+ *  Class to define settings of the fixed step, 8th order Gauss-Jackson (summed second-order) multistep integrator, for
+ *  instance for use in numerical integration of equations of motion/variational equations. The initialTimeStep_ member
+ *  of the base class is used as the (fixed) step size.
+ */
+template< typename IndependentVariableType = double >
+class GaussJacksonSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor for Gauss-Jackson integrator settings.
+     *  \param initialTime Start time (independent variable) of numerical integration.
+     *  \param stepSize Fixed time (independent variable) step used in numerical integration.
+     *  \param secondOrderStateIndices List of rows of the state that are the position of a second-order system (first),
+     *      with the row of the associated velocity (second). All other rows are integrated as a first-order system. For
+     *      translational dynamics in Cowell formulation, the list can be created with
+     *      getCartesianSecondOrderStateIndices. If empty, all rows are integrated as a first-order system, which requires
+     *      more corrector iterations.
+     *  \param startupCoefficientSet Coefficient set of the variable step Runge-Kutta integrator used to compute the first
+     *      steps after (re)starting the method, and steps that are not equal to the nominal step size.
+     *  \param startupRelativeErrorTolerance Relative error tolerance of the startup integrator.
+     *  \param startupAbsoluteErrorTolerance Absolute error tolerance of the startup integrator.
+     *  \param correctorRelativeErrorTolerance Relative difference between subsequent corrector iterations below which the
+     *      corrector is considered converged.
+     *  \param correctorAbsoluteErrorTolerance Absolute difference between subsequent corrector iterations below which the
+     *      corrector is considered converged.
+     *  \param maximumNumberOfCorrectorIterations Maximum number of corrector iterations per step.
+     *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration
+     *      time steps, with n = saveFrequency).
+     *  \param assessPropagationTerminationConditionDuringIntegrationSubsteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     */
+    GaussJacksonSettings(
+            const IndependentVariableType initialTime,
+            const IndependentVariableType stepSize,
+            const std::vector< std::pair< unsigned int, unsigned int > >& secondOrderStateIndices =
+            std::vector< std::pair< unsigned int, unsigned int > >( ),
+            const numerical_integrators::RungeKuttaCoefficients::CoefficientSets startupCoefficientSet =
+            numerical_integrators::RungeKuttaCoefficients::rungeKuttaFehlberg78,
+            const double startupRelativeErrorTolerance = 1.0E-13,
+            const double startupAbsoluteErrorTolerance = 1.0E-13,
+            const double correctorRelativeErrorTolerance = 1.0E-12,
+            const double correctorAbsoluteErrorTolerance = 1.0E-12,
+            const unsigned int maximumNumberOfCorrectorIterations = 10,
+            const int saveFrequency = 1,
+            const bool assessPropagationTerminationConditionDuringIntegrationSubsteps = false ):
+        IntegratorSettings< IndependentVariableType >(
+            gaussJackson, initialTime, stepSize, saveFrequency,
+            assessPropagationTerminationConditionDuringIntegrationSubsteps ),
+        secondOrderStateIndices_( secondOrderStateIndices ), startupCoefficientSet_( startupCoefficientSet ),
+        startupRelativeErrorTolerance_( startupRelativeErrorTolerance ),
+        startupAbsoluteErrorTolerance_( startupAbsoluteErrorTolerance ),
+        correctorRelativeErrorTolerance_( correctorRelativeErrorTolerance ),
+        correctorAbsoluteErrorTolerance_( correctorAbsoluteErrorTolerance ),
+        maximumNumberOfCorrectorIterations_( maximumNumberOfCorrectorIterations ) { }
+
+    //! Destructor
+    /*!
+     *  Destructor
+     */
+    ~GaussJacksonSettings( ){ }
+
+    //! Function to create a copy of the settings object.
+    /*!
+     *  Function to create a copy of the settings object, which can be modified (e.g. its initial time) without affecting
+     *  the original object.
+     *  \return Copy of the settings object.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< GaussJacksonSettings< IndependentVariableType > >( *this );
+    }
+
+    //! List of rows of the state that are the position of a second-order system, with the associated velocity row.
+    std::vector< std::pair< unsigned int, unsigned int > > secondOrderStateIndices_;
+
+    //! Coefficient set of the variable step Runge-Kutta integrator used to (re)start the method.
+    numerical_integrators::RungeKuttaCoefficients::CoefficientSets startupCoefficientSet_;
+
+    //! Relative error tolerance of the startup integrator.
+    double startupRelativeErrorTolerance_;
+
+    //! Absolute error tolerance of the startup integrator.
+    double startupAbsoluteErrorTolerance_;
+
+    //! Relative difference between subsequent corrector iterations below which the corrector is considered converged.
+    double correctorRelativeErrorTolerance_;
+
+    //! Absolute difference between subsequent corrector iterations below which the corrector is considered converged.
+    double correctorAbsoluteErrorTolerance_;
+
+    //! Maximum number of corrector iterations per step.
+    unsigned int maximumNumberOfCorrectorIterations_;
+
+};
+
 //! Function to create a numerical integrator.
 /*!
  *  Function to create a numerical integrator from given integrator settings, state derivative function and initial state.
@@ -764,6 +932,38 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         }
         break;
     }
+    case gaussJackson:
+    {
+        // Check input consistency
+        std::shared_ptr< GaussJacksonSettings< IndependentVariableType > > gaussJacksonSettings =
+                std::dynamic_pointer_cast< GaussJacksonSettings< IndependentVariableType > >( integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( gaussJacksonSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (GaussJacksonSettings) not compatible with "
+                                      "selected integrator (derived class of IntegratorSettings must be GaussJacksonSettings "
+                                      "for this type)." );
+        }
+        else
+        {
+            typedef typename DependentVariableType::Scalar StateScalarType;
+
+            // Create integrator
+            integrator = std::make_shared< GaussJacksonIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                    ( stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                      static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                      gaussJacksonSettings->secondOrderStateIndices_,
+                      gaussJacksonSettings->startupCoefficientSet_,
+                      static_cast< StateScalarType >( gaussJacksonSettings->startupRelativeErrorTolerance_ ),
+                      static_cast< StateScalarType >( gaussJacksonSettings->startupAbsoluteErrorTolerance_ ),
+                      static_cast< StateScalarType >( gaussJacksonSettings->correctorRelativeErrorTolerance_ ),
+                      static_cast< StateScalarType >( gaussJacksonSettings->correctorAbsoluteErrorTolerance_ ),
+                      gaussJacksonSettings->maximumNumberOfCorrectorIterations_ );
+        }
+        break;
+    }
     default:
         throw std::runtime_error( "Error, integrator " +  std::to_string( integratorSettings->integratorType_ ) + " not found." );
     }
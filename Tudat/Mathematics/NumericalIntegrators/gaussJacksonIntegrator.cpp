@@ -0,0 +1,122 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Function to compute the coefficients of the backward difference integration operators of the Gauss-Jackson method.
+std::pair< std::vector< long double >, std::vector< long double > > computeGaussJacksonDifferenceCoefficients(
+        const unsigned int order )
+{
+    // Series of -ln( 1 - nabla ) / nabla, and its reciprocal
+    std::vector< long double > logarithmSeries( order + 3 );
+    std::vector< long double > reciprocalSeries( order + 3, 0.0L );
+    for( unsigned int k = 0; k < order + 3; k++ )
+    {
+        logarithmSeries[ k ] = 1.0L / static_cast< long double >( k + 1 );
+    }
+
+    reciprocalSeries[ 0 ] = 1.0L;
+    for( unsigned int k = 1; k < order + 3; k++ )
+    {
+        for( unsigned int i = 1; i <= k; i++ )
+        {
+            reciprocalSeries[ k ] -= logarithmSeries[ i ] * reciprocalSeries[ k - i ];
+        }
+    }
+
+    // Square of reciprocal series
+    std::vector< long double > squaredReciprocalSeries( order + 3, 0.0L );
+    for( unsigned int k = 0; k < order + 3; k++ )
+    {
+        for( unsigned int i = 0; i <= k; i++ )
+        {
+            squaredReciprocalSeries[ k ] += reciprocalSeries[ i ] * reciprocalSeries[ k - i ];
+        }
+    }
+
+    // Remove terms that are represented by the first and second sum
+    std::vector< long double > firstSumCoefficients( order + 1 );
+    std::vector< long double > secondSumCoefficients( order + 1 );
+    for( unsigned int k = 0; k <= order; k++ )
+    {
+        firstSumCoefficients[ k ] = reciprocalSeries[ k + 1 ];
+        secondSumCoefficients[ k ] = squaredReciprocalSeries[ k + 2 ];
+    }
+
+    return std::make_pair( firstSumCoefficients, secondSumCoefficients );
+}
+
+//! Function to convert coefficients of a backward difference operator to weights of the function values (ordinates).
+std::vector< long double > convertDifferenceCoefficientsToOrdinateWeights(
+        const std::vector< long double >& differenceCoefficients, const int shiftPower )
+{
+    unsigned int numberOfTerms = differenceCoefficients.size( );
+
+    // Compute series of ( 1 - nabla )^shiftPower (binomial series)
+    std::vector< long double > shiftSeries( numberOfTerms, 0.0L );
+    shiftSeries[ 0 ] = 1.0L;
+    for( unsigned int k = 1; k < numberOfTerms; k++ )
+    {
+        shiftSeries[ k ] = -shiftSeries[ k - 1 ] * static_cast< long double >( shiftPower - static_cast< int >( k ) + 1 ) /
+                static_cast< long double >( k );
+    }
+
+    // Multiply operator with shift series
+    std::vector< long double > shiftedCoefficients( numberOfTerms, 0.0L );
+    for( unsigned int k = 0; k < numberOfTerms; k++ )
+    {
+        for( unsigned int i = 0; i <= k; i++ )
+        {
+            shiftedCoefficients[ k ] += differenceCoefficients[ i ] * shiftSeries[ k - i ];
+        }
+    }
+
+    // Expand nabla^k = sum_j ( -1 )^j ( k over j ) E^-j
+    std::vector< long double > ordinateWeights( numberOfTerms, 0.0L );
+    for( unsigned int k = 0; k < numberOfTerms; k++ )
+    {
+        long double binomialCoefficient = 1.0L;
+        for( unsigned int j = 0; j <= k; j++ )
+        {
+            ordinateWeights[ j ] += ( ( j % 2 == 0 ) ? 1.0L : -1.0L ) * binomialCoefficient * shiftedCoefficients[ k ];
+            binomialCoefficient *= static_cast< long double >( k - j ) / static_cast< long double >( j + 1 );
+        }
+    }
+
+    return ordinateWeights;
+}
+
+//! Function to retrieve the second-order position and associated velocity rows for a list of Cartesian states.
+std::vector< std::pair< unsigned int, unsigned int > > getCartesianSecondOrderStateIndices(
+        const unsigned int numberOfBodies, const unsigned int startIndex )
+{
+    std::vector< std::pair< unsigned int, unsigned int > > secondOrderStateIndices;
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            secondOrderStateIndices.push_back(
+                        std::make_pair( startIndex + 6 * i + j, startIndex + 6 * i + j + 3 ) );
+        }
+    }
+    return secondOrderStateIndices;
+}
+
+template class GaussJacksonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+template class GaussJacksonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class GaussJacksonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+} // namespace numerical_integrators
+} // namespace tudat
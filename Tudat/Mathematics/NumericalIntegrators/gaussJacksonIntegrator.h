@@ -0,0 +1,842 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson Integration for Orbit Propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 2004.
+ *      Montenbruck, O. and Gill, E., Satellite Orbits, Springer, 2000.
+ *
+ *    Notes
+ *      The predictor, corrector and startup coefficients are not tabulated, but are computed from the series expansion
+ *      of the backward difference integration operators upon construction of the integrator.
+ *
+ */
+
+#ifndef TUDAT_GAUSS_JACKSON_INTEGRATOR_H
+#define TUDAT_GAUSS_JACKSON_INTEGRATOR_H
+
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Function to compute the coefficients of the backward difference integration operators of the Gauss-Jackson method.
+/*!
+ * Function to compute the coefficients of the backward difference integration operators of the Gauss-Jackson method. For
+ * a function f sampled at n, n-1, ... with step h, the first and second integral are written as
+ * y_n = h ( S1_n + sum_k g1_k nabla^k f_n ) and x_n = h^2 ( S2_n - S1_n + sum_k g2_k nabla^k f_n ), with nabla the
+ * backward difference operator and S1, S2 the first and second sums of f. The coefficients g1 (summed Adams) and g2
+ * (Gauss-Jackson/Stormer-Cowell) follow from the series expansion of ( -ln( 1 - nabla ) )^-1 and ( -ln( 1 - nabla ) )^-2,
+ * respectively.
+ * \param order Highest power of the backward difference operator that is retained.
+ * \return Pair with summed Adams coefficients g1 (first) and Gauss-Jackson coefficients g2 (second), both of size order + 1.
+ */
+std::pair< std::vector< long double >, std::vector< long double > > computeGaussJacksonDifferenceCoefficients(
+        const unsigned int order );
+
+//! Function to convert coefficients of a backward difference operator to weights of the function values (ordinates).
+/*!
+ * Function to convert coefficients of a backward difference operator, multiplied by ( 1 - nabla )^shiftPower, to weights of
+ * the function values (ordinates). A negative shiftPower corresponds to a shift of the operator forward in time (e.g. -1
+ * for the predictor), a positive shiftPower to a shift backward in time (e.g. used in the startup procedure). The product
+ * is truncated at the same order as the input coefficients.
+ * \param differenceCoefficients Coefficients c_k of the backward difference operator sum_k c_k nabla^k.
+ * \param shiftPower Power of the ( 1 - nabla ) factor with which the operator is multiplied.
+ * \return Weights w_j such that the operator applied at point n equals sum_j w_j f_( n - j ).
+ */
+std::vector< long double > convertDifferenceCoefficientsToOrdinateWeights(
+        const std::vector< long double >& differenceCoefficients, const int shiftPower = 0 );
+
+//! Function to retrieve the second-order position and associated velocity rows for a list of Cartesian states.
+/*!
+ * Function to retrieve the second-order position and associated velocity rows for a list of Cartesian states (each
+ * consisting of 3 position and 3 velocity components), as used by the Gauss-Jackson integrator. This corresponds to the
+ * layout of the translational state in Cowell formulation.
+ * \param numberOfBodies Number of Cartesian states in the state vector.
+ * \param startIndex Row at which the first Cartesian state starts.
+ * \return List of second-order position (first) and associated velocity rows (second).
+ */
+std::vector< std::pair< unsigned int, unsigned int > > getCartesianSecondOrderStateIndices(
+        const unsigned int numberOfBodies, const unsigned int startIndex = 0 );
+
+//! Fixed step size Gauss-Jackson (summed second-order) multistep predictor-corrector integrator.
+/*!
+ * Class that implements the fixed step size, 8th order Gauss-Jackson integrator. Rows of the state that are the position of
+ * a second-order system (with paired velocity rows) are integrated using the Gauss-Jackson (second sum) formulas, all other
+ * rows (including the velocities) with the summed Adams (first sum) formulas. When the corrector converges after a single
+ * iteration, which is the nominal case for reasonable step sizes, a single state derivative evaluation is needed per step.
+ * The method is started (and restarted after the state has been modified) using a variable step size Runge-Kutta integrator
+ * with tight tolerances, which computes the first 8 steps after the start epoch. Steps with a size different from the
+ * nominal step size (e.g. when propagating to an exact termination epoch) are performed with the startup integrator, after
+ * which the method is restarted.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state. Rows of the state are paired per column for second-order integration, so a
+ *          matrix state (e.g. variational equations) is supported.
+ * \tparam StateDerivativeType The type of the state derivative.
+ * \tparam TimeStepType The type of the step size.
+ * \sa NumericalIntegrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = Eigen::VectorXd, typename TimeStepType = IndependentVariableType >
+class GaussJacksonIntegrator
+        : public ReinitializableNumericalIntegrator<
+        IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef for the base class.
+    /*!
+     * Typedef of the base class with all template parameters filled in.
+     */
+    typedef ReinitializableNumericalIntegrator< IndependentVariableType, StateType,
+    StateDerivativeType, TimeStepType > ReinitializableNumericalIntegratorBase;
+
+    //! Typedef for the state derivative function.
+    /*!
+     * Typedef to the state derivative function inherited from the base class.
+     * \sa NumericalIntegrator::StateDerivativeFunction.
+     */
+    typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
+    StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef for the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Typedef for the integrator used to start up the method.
+    typedef RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+    StartupIntegrator;
+
+    //! Order of the method, equal to the number of steps that are taken by the startup integrator.
+    static const unsigned int order = 8;
+
+    //! Constructor.
+    /*!
+     * Constructor, taking the state derivative function, initial conditions, step size and settings of the startup and
+     * corrector iterations as argument.
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state.
+     * \param stepSize The (fixed) step size of the integrator (may be negative).
+     * \param secondOrderStateIndices List of rows of the state that are the position of a second-order system (first), with
+     *          the row of the associated velocity (second). If empty, all rows are integrated as a first-order system.
+     * \param startupCoefficientSet Coefficient set of the variable step size Runge-Kutta integrator used for the startup.
+     * \param startupRelativeErrorTolerance Relative error tolerance of the startup integrator.
+     * \param startupAbsoluteErrorTolerance Absolute error tolerance of the startup integrator.
+     * \param correctorRelativeErrorTolerance Relative difference between subsequent corrector iterations below which the
+     *          corrector is considered converged.
+     * \param correctorAbsoluteErrorTolerance Absolute difference between subsequent corrector iterations below which the
+     *          corrector is considered converged.
+     * \param maximumNumberOfCorrectorIterations Maximum number of corrector iterations per step.
+     */
+    GaussJacksonIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType stepSize,
+            const std::vector< std::pair< unsigned int, unsigned int > >& secondOrderStateIndices =
+            std::vector< std::pair< unsigned int, unsigned int > >( ),
+            const RungeKuttaCoefficients::CoefficientSets startupCoefficientSet =
+            RungeKuttaCoefficients::rungeKuttaFehlberg78,
+            const StateScalarType startupRelativeErrorTolerance = 1.0E-13,
+            const StateScalarType startupAbsoluteErrorTolerance = 1.0E-13,
+            const StateScalarType correctorRelativeErrorTolerance = 1.0E-12,
+            const StateScalarType correctorAbsoluteErrorTolerance = 1.0E-12,
+            const unsigned int maximumNumberOfCorrectorIterations = 10 )
+        : ReinitializableNumericalIntegratorBase( stateDerivativeFunction ),
+          currentIndependentVariable_( intervalStart ),
+          currentState_( initialState ),
+          lastIndependentVariable_( intervalStart ),
+          lastState_( initialState ),
+          stepSize_( stepSize ),
+          secondOrderStateIndices_( secondOrderStateIndices ),
+          startupCoefficientSet_( startupCoefficientSet ),
+          startupRelativeErrorTolerance_( std::fabs( startupRelativeErrorTolerance ) ),
+          startupAbsoluteErrorTolerance_( std::fabs( startupAbsoluteErrorTolerance ) ),
+          correctorRelativeErrorTolerance_( std::fabs( correctorRelativeErrorTolerance ) ),
+          correctorAbsoluteErrorTolerance_( std::fabs( correctorAbsoluteErrorTolerance ) ),
+          maximumNumberOfCorrectorIterations_( maximumNumberOfCorrectorIterations ),
+          isRestartRequired_( true ), lastIsRestartRequired_( true ),
+          stepIndex_( 0 ), lastStepIndex_( 0 ), isLastStepNominal_( false ), isLastDerivativeDropped_( false ),
+          numberOfStateDerivativeEvaluations_( 0 )
+    {
+        if( !( stepSize_ != 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating Gauss-Jackson integrator, step size must be non-zero." );
+        }
+
+        if( maximumNumberOfCorrectorIterations_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating Gauss-Jackson integrator, at least one corrector iteration is "
+                                      "required." );
+        }
+
+        for( unsigned int i = 0; i < secondOrderStateIndices_.size( ); i++ )
+        {
+            if( secondOrderStateIndices_.at( i ).first >= static_cast< unsigned int >( initialState.rows( ) ) ||
+                    secondOrderStateIndices_.at( i ).second >= static_cast< unsigned int >( initialState.rows( ) ) ||
+                    secondOrderStateIndices_.at( i ).first == secondOrderStateIndices_.at( i ).second )
+            {
+                throw std::runtime_error( "Error when creating Gauss-Jackson integrator, second-order state indices (" +
+                                          std::to_string( secondOrderStateIndices_.at( i ).first ) + ", " +
+                                          std::to_string( secondOrderStateIndices_.at( i ).second ) +
+                                          ") are not consistent with state of size " +
+                                          std::to_string( initialState.rows( ) ) + "." );
+            }
+        }
+
+        // Compute coefficients of predictor, corrector and startup in terms of the function values
+        std::pair< std::vector< long double >, std::vector< long double > > differenceCoefficients =
+                computeGaussJacksonDifferenceCoefficients( order );
+
+        // First sum is updated before applying corrector, so predictor includes an additional f_( n + 1 ) term
+        std::vector< long double > firstSumPredictorCoefficients = differenceCoefficients.first;
+        firstSumPredictorCoefficients[ 0 ] += 1.0L;
+
+        castWeights( convertDifferenceCoefficientsToOrdinateWeights( firstSumPredictorCoefficients, -1 ),
+                     firstOrderPredictorWeights_ );
+        castWeights( convertDifferenceCoefficientsToOrdinateWeights( differenceCoefficients.second, -1 ),
+                     secondOrderPredictorWeights_ );
+        castWeights( convertDifferenceCoefficientsToOrdinateWeights( differenceCoefficients.first ),
+                     firstOrderCorrectorWeights_ );
+        castWeights( convertDifferenceCoefficientsToOrdinateWeights( differenceCoefficients.second ),
+                     secondOrderCorrectorWeights_ );
+        castWeights( convertDifferenceCoefficientsToOrdinateWeights( differenceCoefficients.first, order ),
+                     firstOrderStartupWeights_ );
+        castWeights( convertDifferenceCoefficientsToOrdinateWeights( differenceCoefficients.second, order ),
+                     secondOrderStartupWeights_ );
+    }
+
+    //! Destructor.
+    ~GaussJacksonIntegrator( ){ }
+
+    //! Get step size of the next step.
+    /*!
+     * Returns the (fixed) step size of the next step.
+     * \return Step size to be used for the next step.
+     */
+    virtual TimeStepType getNextStepSize( ) const { return stepSize_; }
+
+    //! Get current state.
+    /*!
+     * Returns the current state of the integrator.
+     * \return Current integrated state,
+     */
+    virtual StateType getCurrentState( ) const { return currentState_; }
+
+    //! Returns the current independent variable.
+    /*!
+     * Returns the current value of the independent variable of the integrator.
+     * \return Current independent variable.
+     */
+    virtual IndependentVariableType getCurrentIndependentVariable( ) const
+    {
+        return currentIndependentVariable_;
+    }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step. If the step size is equal to the nominal step size of the integrator, the first
+     * steps after (re)starting the method are computed by the startup integrator, and subsequent steps by the Gauss-Jackson
+     * predictor-corrector. For any other step size, the step is performed by the startup integrator, after which the method
+     * will be restarted at the next nominal step.
+     * \param stepSize The step size to take.
+     * \return The state at the end of the step.
+     */
+    virtual StateType performIntegrationStep( const TimeStepType stepSize );
+
+    //! Rollback internal state to the last state.
+    /*!
+     * Performs rollback of internal state to the last state. This function can only be called once
+     * after calling integrateTo( ) or performIntegrationStep( ) unless specified otherwise by
+     * implementations, and can not be called before any of these functions have been called. Will
+     * return true if the rollback was succesful, and false otherwise.
+     * \return True if the rollback was successful.
+     */
+    virtual bool rollbackToPreviousState( );
+
+    //! Get previous independent variable.
+    /*!
+     * Returns the value of the independent variable before the last step.
+     * \return Previous independent variable.
+     */
+    IndependentVariableType getPreviousIndependentVariable( )
+    {
+        return lastIndependentVariable_;
+    }
+
+    //! Get previous state value.
+    /*!
+     * Returns the state before the last step.
+     * \return Previous state
+     */
+    StateType getPreviousState( )
+    {
+        return lastState_;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     * Replace the state with a new value. This allows for discrete jumps in the state, often
+     * used in simulations of discrete events. In astrodynamics, this relates to simulations of rocket staging,
+     * impulsive shots, parachuting, ideal control, etc. The backward difference tables are no longer valid after the
+     * state has been modified, so the method is restarted at the next step. If the new state is identical to the current
+     * state (as is typically the case when the state is post-processed after each step), the method is not restarted.
+     * \param newState The value of the new state.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        modifyCurrentIntegrationVariables( newState, currentIndependentVariable_, allowRollback );
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step. The method is restarted at the next step, unless both the state and
+     * time are unchanged.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        if( !areStatesIdentical( newState, currentState_ ) || !( newTime == currentIndependentVariable_ ) )
+        {
+            currentState_ = newState;
+            currentIndependentVariable_ = newTime;
+            isRestartRequired_ = true;
+        }
+
+        if( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+            lastState_ = currentState_;
+            lastIsRestartRequired_ = isRestartRequired_;
+        }
+    }
+
+    //! Function to retrieve the number of state derivative evaluations performed by the integrator.
+    /*!
+     * Function to retrieve the number of state derivative evaluations performed by the integrator, including those of
+     * the startup integrator.
+     * \return Number of state derivative evaluations performed by the integrator.
+     */
+    unsigned int getNumberOfStateDerivativeEvaluations( )
+    {
+        return numberOfStateDerivativeEvaluations_;
+    }
+
+    //! Function to retrieve the list of second-order position and associated velocity rows of the state.
+    /*!
+     * Function to retrieve the list of second-order position and associated velocity rows of the state.
+     * \return List of second-order position and associated velocity rows of the state.
+     */
+    std::vector< std::pair< unsigned int, unsigned int > > getSecondOrderStateIndices( )
+    {
+        return secondOrderStateIndices_;
+    }
+
+protected:
+
+    //! Function to cast the (long double) ordinate weights to the scalar type of the state.
+    /*!
+     * Function to cast the (long double) ordinate weights to the scalar type of the state.
+     * \param weights Weights to cast.
+     * \param castWeights Weights cast to scalar type of the state (returned by reference).
+     */
+    void castWeights( const std::vector< long double >& weights, std::vector< StateScalarType >& castWeights )
+    {
+        castWeights.resize( weights.size( ) );
+        for( unsigned int i = 0; i < weights.size( ); i++ )
+        {
+            castWeights[ i ] = static_cast< StateScalarType >( weights.at( i ) );
+        }
+    }
+
+    //! Function to evaluate the state derivative, and convert it to the function that is summed by the method.
+    /*!
+     * Function to evaluate the state derivative, and convert it to the function that is summed by the method. For the
+     * position rows of a second-order system, the derivative of the associated velocity row is used.
+     * \param independentVariable Independent variable at which to evaluate the state derivative.
+     * \param state State at which to evaluate the state derivative.
+     * \return Function that is summed by the method.
+     */
+    StateDerivativeType evaluateSummedFunction( const IndependentVariableType independentVariable, const StateType& state )
+    {
+        numberOfStateDerivativeEvaluations_++;
+        StateDerivativeType summedFunction = this->stateDerivativeFunction_( independentVariable, state );
+        for( unsigned int i = 0; i < secondOrderStateIndices_.size( ); i++ )
+        {
+            summedFunction.row( secondOrderStateIndices_.at( i ).first ) =
+                    summedFunction.row( secondOrderStateIndices_.at( i ).second );
+        }
+        return summedFunction;
+    }
+
+    //! Function to compute the weighted sum of the stored function values.
+    /*!
+     * Function to compute the weighted sum of the stored function values (most recent first).
+     * \param weights Weights of the function values, with the first entry applied to the most recent value.
+     * \param firstIndex Index of the first weight that is to be used.
+     * \return Weighted sum of the stored function values.
+     */
+    StateDerivativeType computeWeightedSum( const std::vector< StateScalarType >& weights, const unsigned int firstIndex )
+    {
+        StateDerivativeType weightedSum = weights.at( firstIndex ) * summedFunctionHistory_.at( 0 );
+        for( unsigned int i = firstIndex + 1; i < weights.size( ); i++ )
+        {
+            weightedSum += weights.at( i ) * summedFunctionHistory_.at( i - firstIndex );
+        }
+        return weightedSum;
+    }
+
+    //! Function to compute the state from the first and second sum terms.
+    /*!
+     * Function to compute the state from the terms multiplying h (first-order rows) and h^2 (second-order position rows).
+     * \param firstOrderTerm Term multiplying the step size (for all rows that are not the position of a second-order system).
+     * \param secondOrderTerm Term multiplying the squared step size (for position rows of a second-order system).
+     * \return State computed from the given terms.
+     */
+    StateType computeStateFromSums( const StateDerivativeType& firstOrderTerm, const StateDerivativeType& secondOrderTerm )
+    {
+        StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ );
+        StateType state = stepSize * firstOrderTerm;
+        for( unsigned int i = 0; i < secondOrderStateIndices_.size( ); i++ )
+        {
+            state.row( secondOrderStateIndices_.at( i ).first ) =
+                    stepSize * stepSize * secondOrderTerm.row( secondOrderStateIndices_.at( i ).first );
+        }
+        return state;
+    }
+
+    //! Function to compute the independent variable at a given number of nominal steps after the (re)start epoch.
+    /*!
+     * Function to compute the independent variable at a given number of nominal steps after the (re)start epoch. The
+     * epochs are computed from the start epoch (rather than accumulated step by step) to prevent the build up of
+     * rounding errors in the independent variable.
+     * \param stepIndex Number of nominal steps after (re)start epoch.
+     * \return Independent variable at given number of steps after the (re)start epoch.
+     */
+    IndependentVariableType getIndependentVariableAtStep( const unsigned int stepIndex )
+    {
+        return startIndependentVariable_ + static_cast< TimeStepType >( stepIndex ) * stepSize_;
+    }
+
+    //! Function to create a startup integrator, starting at the current state and independent variable.
+    /*!
+     * Function to create a startup integrator, starting at the current state and independent variable.
+     * \param maximumStepSize Maximum step size of the startup integrator.
+     * \return Startup integrator.
+     */
+    std::shared_ptr< StartupIntegrator > createStartupIntegrator( const TimeStepType maximumStepSize );
+
+    //! Function to integrate to a given independent variable using a startup integrator.
+    /*!
+     * Function to integrate to a given independent variable using a startup integrator, such that the independent
+     * variable is reached exactly.
+     * \param integrator Startup integrator that is to be used.
+     * \param intervalEnd Independent variable at which integration is to be terminated.
+     * \param initialStepSize Initial step size of the integrator.
+     * \return State at the requested independent variable.
+     */
+    StateType integrateWithStartupIntegrator( const std::shared_ptr< StartupIntegrator > integrator,
+                                              const IndependentVariableType intervalEnd,
+                                              const TimeStepType initialStepSize );
+
+    //! Function to initialize the first and second sums, once the startup integrator has computed the first steps.
+    void initializeSums( );
+
+    //! Function to perform a single step of the Gauss-Jackson predictor-corrector method.
+    void performPredictorCorrectorStep( );
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Independent variable before the last step (used for rollback).
+    IndependentVariableType lastIndependentVariable_;
+
+    //! State before the last step (used for rollback).
+    StateType lastState_;
+
+    //! Nominal (fixed) step size.
+    TimeStepType stepSize_;
+
+    //! List of second-order position (first) and associated velocity rows (second) of the state.
+    std::vector< std::pair< unsigned int, unsigned int > > secondOrderStateIndices_;
+
+    //! Coefficient set of the variable step size Runge-Kutta integrator used for the startup.
+    RungeKuttaCoefficients::CoefficientSets startupCoefficientSet_;
+
+    //! Relative error tolerance of the startup integrator.
+    StateScalarType startupRelativeErrorTolerance_;
+
+    //! Absolute error tolerance of the startup integrator.
+    StateScalarType startupAbsoluteErrorTolerance_;
+
+    //! Relative difference between subsequent corrector iterations below which the corrector is considered converged.
+    StateScalarType correctorRelativeErrorTolerance_;
+
+    //! Absolute difference between subsequent corrector iterations below which the corrector is considered converged.
+    StateScalarType correctorAbsoluteErrorTolerance_;
+
+    //! Maximum number of corrector iterations per step.
+    unsigned int maximumNumberOfCorrectorIterations_;
+
+    //! Boolean denoting whether the method is to be restarted at the next nominal step.
+    bool isRestartRequired_;
+
+    //! Value of isRestartRequired_ before the last step (used for rollback).
+    bool lastIsRestartRequired_;
+
+    //! Independent variable at which the method was last (re)started.
+    IndependentVariableType startIndependentVariable_;
+
+    //! State at which the method was last (re)started.
+    StateType startState_;
+
+    //! Number of nominal steps since the method was last (re)started.
+    unsigned int stepIndex_;
+
+    //! Value of stepIndex_ before the last step (used for rollback).
+    unsigned int lastStepIndex_;
+
+    //! Integrator used to compute the first steps after the method is (re)started.
+    std::shared_ptr< StartupIntegrator > startupIntegrator_;
+
+    //! History of summed function values (state derivative, with acceleration for position rows), most recent first.
+    std::deque< StateDerivativeType > summedFunctionHistory_;
+
+    //! Oldest summed function value that was removed from the history during the last step (used for rollback).
+    StateDerivativeType lastDroppedSummedFunction_;
+
+    //! Boolean denoting whether the last step was taken with the nominal step size.
+    bool isLastStepNominal_;
+
+    //! Boolean denoting whether a summed function value was removed from the history during the last step.
+    bool isLastDerivativeDropped_;
+
+    //! Current first sum of the summed function.
+    StateDerivativeType firstSum_;
+
+    //! Current second sum of the summed function.
+    StateDerivativeType secondSum_;
+
+    //! First sum before the last step (used for rollback).
+    StateDerivativeType lastFirstSum_;
+
+    //! Second sum before the last step (used for rollback).
+    StateDerivativeType lastSecondSum_;
+
+    //! Ordinate weights of the first-order predictor (including the f_( n + 1 ) term of the first sum update).
+    std::vector< StateScalarType > firstOrderPredictorWeights_;
+
+    //! Ordinate weights of the second-order predictor.
+    std::vector< StateScalarType > secondOrderPredictorWeights_;
+
+    //! Ordinate weights of the first-order corrector.
+    std::vector< StateScalarType > firstOrderCorrectorWeights_;
+
+    //! Ordinate weights of the second-order corrector.
+    std::vector< StateScalarType > secondOrderCorrectorWeights_;
+
+    //! Ordinate weights used to initialize the first sum from the startup steps.
+    std::vector< StateScalarType > firstOrderStartupWeights_;
+
+    //! Ordinate weights used to initialize the second sum from the startup steps.
+    std::vector< StateScalarType > secondOrderStartupWeights_;
+
+    //! Number of state derivative evaluations performed by the integrator.
+    unsigned int numberOfStateDerivativeEvaluations_;
+};
+
+//! Perform a single integration step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType GaussJacksonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+performIntegrationStep( const TimeStepType stepSize )
+{
+    lastIndependentVariable_ = currentIndependentVariable_;
+    lastState_ = currentState_;
+    lastIsRestartRequired_ = isRestartRequired_;
+    lastStepIndex_ = stepIndex_;
+    isLastDerivativeDropped_ = false;
+    isLastStepNominal_ = false;
+
+    if( std::fabs( static_cast< double >( stepSize - stepSize_ ) ) >
+            10.0 * std::numeric_limits< double >::epsilon( ) * std::fabs( static_cast< double >( stepSize_ ) ) )
+    {
+        // Non-nominal step: use startup integrator, and restart method at next nominal step.
+        currentState_ = integrateWithStartupIntegrator(
+                    createStartupIntegrator( stepSize ), currentIndependentVariable_ + stepSize, stepSize );
+        currentIndependentVariable_ = currentIndependentVariable_ + stepSize;
+        isRestartRequired_ = true;
+        return currentState_;
+    }
+
+    if( isRestartRequired_ )
+    {
+        startIndependentVariable_ = currentIndependentVariable_;
+        startState_ = currentState_;
+        stepIndex_ = 0;
+        summedFunctionHistory_.clear( );
+        summedFunctionHistory_.push_front( evaluateSummedFunction( currentIndependentVariable_, currentState_ ) );
+        startupIntegrator_ = createStartupIntegrator( stepSize_ );
+        isRestartRequired_ = false;
+    }
+
+    isLastStepNominal_ = true;
+    if( stepIndex_ < order )
+    {
+        // Compute first steps using startup integrator
+        IndependentVariableType nextIndependentVariable = getIndependentVariableAtStep( stepIndex_ + 1 );
+        currentState_ = integrateWithStartupIntegrator( startupIntegrator_, nextIndependentVariable, stepSize_ );
+        currentIndependentVariable_ = nextIndependentVariable;
+        stepIndex_++;
+        summedFunctionHistory_.push_front( evaluateSummedFunction( currentIndependentVariable_, currentState_ ) );
+
+        if( stepIndex_ == order )
+        {
+            initializeSums( );
+        }
+    }
+    else
+    {
+        performPredictorCorrectorStep( );
+    }
+
+    return currentState_;
+}
+
+//! Rollback internal state to the last state.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+bool GaussJacksonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+rollbackToPreviousState( )
+{
+    if( currentIndependentVariable_ == lastIndependentVariable_ )
+    {
+        return false;
+    }
+
+    currentIndependentVariable_ = lastIndependentVariable_;
+    currentState_ = lastState_;
+
+    // Restore difference table and sums, unless they were (re)initialized or not modified in the last step
+    if( isLastStepNominal_ && !lastIsRestartRequired_ )
+    {
+        summedFunctionHistory_.pop_front( );
+        if( isLastDerivativeDropped_ )
+        {
+            summedFunctionHistory_.push_back( lastDroppedSummedFunction_ );
+        }
+
+        if( lastStepIndex_ >= order )
+        {
+            firstSum_ = lastFirstSum_;
+            secondSum_ = lastSecondSum_;
+        }
+        else
+        {
+            // Startup integrator has moved beyond the previous state, so reset it to the previous state.
+            startupIntegrator_ = createStartupIntegrator( stepSize_ );
+        }
+        stepIndex_ = lastStepIndex_;
+    }
+    isRestartRequired_ = lastIsRestartRequired_;
+    isLastDerivativeDropped_ = false;
+
+    // Recalculate the derivative in order to make sure that all
+    // update functions inside state derivative model get reactivated
+    numberOfStateDerivativeEvaluations_++;
+    this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+
+    return true;
+}
+
+//! Function to create a startup integrator, starting at the current state and independent variable.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+std::shared_ptr< RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > >
+GaussJacksonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+createStartupIntegrator( const TimeStepType maximumStepSize )
+{
+    // No minimum step size is imposed, since the steps are bounded by the (final) step that is to be taken.
+    return std::make_shared< StartupIntegrator >(
+                RungeKuttaCoefficients::get( startupCoefficientSet_ ),
+                [ = ]( const IndependentVariableType independentVariable, const StateType& state )
+    {
+        numberOfStateDerivativeEvaluations_++;
+        return this->stateDerivativeFunction_( independentVariable, state );
+    }, currentIndependentVariable_, currentState_, static_cast< TimeStepType >( 0.0 ),
+                static_cast< TimeStepType >( std::fabs( static_cast< double >( maximumStepSize ) ) ),
+                startupRelativeErrorTolerance_, startupAbsoluteErrorTolerance_ );
+}
+
+//! Function to integrate to a given independent variable using a startup integrator.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType GaussJacksonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+integrateWithStartupIntegrator( const std::shared_ptr< StartupIntegrator > integrator,
+                                const IndependentVariableType intervalEnd,
+                                const TimeStepType initialStepSize )
+{
+    TimeStepType stepSize = initialStepSize;
+    TimeStepType remainingInterval = static_cast< TimeStepType >( intervalEnd - integrator->getCurrentIndependentVariable( ) );
+    while( std::fabs( static_cast< double >( remainingInterval ) ) >
+           std::numeric_limits< double >::epsilon( ) * std::fabs( static_cast< double >( initialStepSize ) ) )
+    {
+        // Prevent very small final steps by splitting the remaining interval if needed
+        if( std::fabs( static_cast< double >( remainingInterval ) ) <= std::fabs( static_cast< double >( stepSize ) ) )
+        {
+            stepSize = remainingInterval;
+        }
+        else if( std::fabs( static_cast< double >( remainingInterval ) ) <
+                 2.0 * std::fabs( static_cast< double >( stepSize ) ) )
+        {
+            stepSize = remainingInterval / 2.0;
+        }
+
+        integrator->performIntegrationStep( stepSize );
+        stepSize = integrator->getNextStepSize( );
+        remainingInterval = static_cast< TimeStepType >( intervalEnd - integrator->getCurrentIndependentVariable( ) );
+    }
+    return integrator->getCurrentState( );
+}
+
+//! Function to initialize the first and second sums, once the startup integrator has computed the first steps.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void GaussJacksonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+initializeSums( )
+{
+    StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ );
+
+    // Initialize sums at (re)start epoch, using the function values at the (re)start epoch and the subsequent steps.
+    // The first sum of a position row is equal to the first sum of the associated velocity row.
+    firstSum_ = startState_ / stepSize - computeWeightedSum( firstOrderStartupWeights_, 0 );
+    for( unsigned int i = 0; i < secondOrderStateIndices_.size( ); i++ )
+    {
+        firstSum_.row( secondOrderStateIndices_.at( i ).first ) =
+                firstSum_.row( secondOrderStateIndices_.at( i ).second );
+    }
+    secondSum_ = startState_ / ( stepSize * stepSize ) + firstSum_ - computeWeightedSum( secondOrderStartupWeights_, 0 );
+
+    // Update sums to current step
+    for( int i = order - 1; i >= 0; i-- )
+    {
+        firstSum_ += summedFunctionHistory_.at( i );
+        secondSum_ += firstSum_;
+    }
+}
+
+//! Function to perform a single step of the Gauss-Jackson predictor-corrector method.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void GaussJacksonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+performPredictorCorrectorStep( )
+{
+    bool isSecondOrderSystemPresent = ( secondOrderStateIndices_.size( ) > 0 );
+    IndependentVariableType nextIndependentVariable = getIndependentVariableAtStep( stepIndex_ + 1 );
+
+    // Predict state at next step (second-order terms remain zero, and unused, for a purely first-order system)
+    StateDerivativeType firstOrderTerm = firstSum_ + computeWeightedSum( firstOrderPredictorWeights_, 0 );
+    StateDerivativeType secondOrderTerm = StateDerivativeType::Zero( firstSum_.rows( ), firstSum_.cols( ) );
+    if( isSecondOrderSystemPresent )
+    {
+        secondOrderTerm = secondSum_ + computeWeightedSum( secondOrderPredictorWeights_, 0 );
+    }
+    StateType nextState = computeStateFromSums( firstOrderTerm, secondOrderTerm );
+
+    // Compute contribution of current and previous steps to corrector
+    StateDerivativeType firstOrderCorrectorTerm = firstSum_ + computeWeightedSum( firstOrderCorrectorWeights_, 1 );
+    StateDerivativeType secondOrderCorrectorTerm = StateDerivativeType::Zero( firstSum_.rows( ), firstSum_.cols( ) );
+    if( isSecondOrderSystemPresent )
+    {
+        secondOrderCorrectorTerm = secondSum_ + computeWeightedSum( secondOrderCorrectorWeights_, 1 );
+    }
+
+    // Evaluate and correct, until subsequent iterations have converged (nominally after a single iteration)
+    StateDerivativeType nextSummedFunction;
+    StateType correctedState;
+    for( unsigned int i = 0; i < maximumNumberOfCorrectorIterations_; i++ )
+    {
+        nextSummedFunction = evaluateSummedFunction( nextIndependentVariable, nextState );
+
+        // First sum at next step includes function value at next step
+        firstOrderTerm = firstOrderCorrectorTerm +
+                ( 1.0 + firstOrderCorrectorWeights_.at( 0 ) ) * nextSummedFunction;
+        if( isSecondOrderSystemPresent )
+        {
+            secondOrderTerm = secondOrderCorrectorTerm + secondOrderCorrectorWeights_.at( 0 ) * nextSummedFunction;
+        }
+        correctedState = computeStateFromSums( firstOrderTerm, secondOrderTerm );
+
+        bool isCorrectorConverged =
+                ( ( correctedState - nextState ).array( ).abs( ) <=
+                  correctorRelativeErrorTolerance_ * correctedState.array( ).abs( ) + correctorAbsoluteErrorTolerance_ ).all( );
+        nextState = correctedState;
+
+        if( isCorrectorConverged )
+        {
+            break;
+        }
+    }
+
+    // Update sums and difference table
+    lastFirstSum_ = firstSum_;
+    lastSecondSum_ = secondSum_;
+    firstSum_ += nextSummedFunction;
+    secondSum_ += firstSum_;
+
+    summedFunctionHistory_.push_front( nextSummedFunction );
+    if( summedFunctionHistory_.size( ) > order + 1 )
+    {
+        lastDroppedSummedFunction_ = summedFunctionHistory_.back( );
+        summedFunctionHistory_.pop_back( );
+        isLastDerivativeDropped_ = true;
+    }
+
+    currentState_ = nextState;
+    currentIndependentVariable_ = nextIndependentVariable;
+    stepIndex_++;
+}
+
+extern template class GaussJacksonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class GaussJacksonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class GaussJacksonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+//! Typedef of Gauss-Jackson integrator (state/state derivative = VectorXd, independent variable = double).
+/*!
+ * Typedef of a Gauss-Jackson integrator with VectorXds as state and state derivative and double as independent variable.
+ */
+typedef GaussJacksonIntegrator< > GaussJacksonIntegratorXd;
+
+//! Typedef of pointer to default Gauss-Jackson integrator
+/*!
+ * Typedef of pointer to a Gauss-Jackson integrator with VectorXds as state and state derivative and double as
+ * independent variable.
+ */
+typedef std::shared_ptr< GaussJacksonIntegratorXd > GaussJacksonIntegratorXdPointer;
+
+} // namespace numerical_integrators
+} // namespace tudat
+
+#endif // TUDAT_GAUSS_JACKSON_INTEGRATOR_H
@@ -31,6 +31,36 @@ namespace tudat
 namespace numerical_integrators
 {
 
+//! Function to check whether two states are identical.
+/*!
+ * Function to check whether two states are identical, used by integrators to determine whether a modification of the
+ * current state (e.g. by a state post-processing function that leaves the state unchanged) invalidates the information
+ * stored from previous steps.
+ * \param firstState First state that is to be compared.
+ * \param secondState Second state that is to be compared.
+ * \return True if the two states are identical.
+ */
+template< typename StateType >
+bool areStatesIdentical( const StateType& firstState, const StateType& secondState )
+{
+    return firstState == secondState;
+}
+
+//! Function to check whether two Eigen matrix states are identical (in size and value).
+/*!
+ * Function to check whether two Eigen matrix states are identical (in size and value).
+ * \param firstState First state that is to be compared.
+ * \param secondState Second state that is to be compared.
+ * \return True if the two states are of equal size, and all entries are equal.
+ */
+template< typename ScalarType, int Rows, int Columns, int Options, int MaxRows, int MaxColumns >
+bool areStatesIdentical( const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaxRows, MaxColumns >& firstState,
+                         const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaxRows, MaxColumns >& secondState )
+{
+    return ( firstState.rows( ) == secondState.rows( ) ) && ( firstState.cols( ) == secondState.cols( ) ) &&
+            ( firstState == secondState );
+}
+
 //! Base class for the numerical integrators.
 /*!
  * Base class for numerical integrators.
@@ -54,6 +84,14 @@ public:
     typedef std::function< StateDerivativeType(
             const IndependentVariableType, const StateType& ) > StateDerivativeFunction;
 
+    //! Typedef to the state derivative function that writes the state derivative into an existing object.
+    /*!
+     * Typedef to the state derivative function that writes the state derivative into an existing object (third argument),
+     * so that no new state derivative object needs to be created for each evaluation.
+     */
+    typedef std::function< void( const IndependentVariableType, const StateType&, StateDerivativeType& ) >
+    StateDerivativeInPlaceFunction;
+
     //! Default constructor.
     /*!
      * Default constructor, taking a state derivative function as argument.
@@ -168,6 +206,21 @@ public:
         return stateDerivativeFunction_;
     }
 
+    //! Function to set a state derivative function that writes the state derivative into an existing object.
+    /*!
+     * Function to set a state derivative function that writes the state derivative into an existing object. It must
+     * compute the same state derivative as the function passed to the constructor. Integrators that store their state
+     * derivatives between evaluations (currently the RungeKuttaVariableStepSizeIntegrator) use it instead of the state
+     * derivative function passed to the constructor, so that the state derivative is not returned by value for each
+     * evaluation. Other integrators ignore it.
+     * \param stateDerivativeInPlaceFunction State derivative function that writes the state derivative into an existing
+     * object (empty function to use the state derivative function passed to the constructor).
+     */
+    void setStateDerivativeInPlaceFunction( const StateDerivativeInPlaceFunction& stateDerivativeInPlaceFunction )
+    {
+        stateDerivativeInPlaceFunction_ = stateDerivativeInPlaceFunction;
+    }
+
     //! Function to return the termination condition was reached during the current step
     /*!
      *  Function to return the termination condition was reached during the current step
@@ -232,6 +285,31 @@ public:
                                   "been implemented in this integrator." );
     }
 
+    //! Function to compute the state within the last integration step, using the continuous extension (dense output).
+    /*!
+     * Function to compute the state within the last integration step, i.e. between the previous and current independent
+     * variable, using the continuous extension (dense output) of the integrator. To be implemented in derived classes that
+     * provide dense output.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return State at the requested value of the independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Error in numerical integrator. Dense output has not been implemented in this integrator." );
+    }
+
+    //! Function to retrieve whether the dense output of the last integration step is available.
+    /*!
+     * Function to retrieve whether the dense output of the last integration step is available. By default, false is
+     * returned, to be overridden in derived classes that provide dense output.
+     * \return True if the dense output of the last integration step is available.
+     */
+    virtual bool isDenseOutputAvailable( ) const
+    {
+        return false;
+    }
+
 protected:
 
     //! Function that returns the state derivative.
@@ -240,6 +318,34 @@ protected:
      */
     StateDerivativeFunction stateDerivativeFunction_;
 
+    //! Function that writes the state derivative into an existing object (empty if not set).
+    /*!
+     * Function that writes the state derivative into an existing object (empty if not set).
+     * \sa setStateDerivativeInPlaceFunction
+     */
+    StateDerivativeInPlaceFunction stateDerivativeInPlaceFunction_;
+
+    //! Function to compute the state derivative, writing it into an existing object.
+    /*!
+     * Function to compute the state derivative, writing it into an existing object. If the stateDerivativeInPlaceFunction_
+     * is set, it is used, otherwise the result of the stateDerivativeFunction_ is assigned to the stateDerivative.
+     * \param independentVariable Independent variable at which state derivative is to be computed.
+     * \param state State at which state derivative is to be computed.
+     * \param stateDerivative State derivative (returned by reference).
+     */
+    void computeStateDerivative( const IndependentVariableType independentVariable, const StateType& state,
+                                 StateDerivativeType& stateDerivative )
+    {
+        if( stateDerivativeInPlaceFunction_ )
+        {
+            stateDerivativeInPlaceFunction_( independentVariable, state, stateDerivative );
+        }
+        else
+        {
+            stateDerivative = stateDerivativeFunction_( independentVariable, state );
+        }
+    }
+
     //! Boolean to denote whether the propagation termination condition was reached during the evaluation of one of the sub-steps
     /*!
      *  Boolean to denote whether the propagation termination condition was reached during the evaluation of one of the sub-steps
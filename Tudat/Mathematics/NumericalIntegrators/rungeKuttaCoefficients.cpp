@@ -12,12 +12,21 @@
  *      Fehlberg, E. Classical Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas With
  *          Stepsize Control, Marshall Spaceflight Center, NASA TR R-278, 1968.
  *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Dormand, J.R., Prince, P.J. A family of embedded Runge-Kutta formulae, Journal of Computational and Applied
+ *          Mathematics, 6(1), 1980.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *      Verner, J.H. Explicit Runge-Kutta Methods with Estimates of the Local Truncation Error, SIAM Journal on
+ *          Numerical Analysis, 15(4), 1978.
+ *      Hull, T.E., Enright, W.H., Jackson, K.R. User's Guide for DVERK - A Subroutine for Solving Non-Stiff ODE's,
+ *          Technical Report 100, Department of Computer Science, University of Toronto, 1976.
  *
  *    Notes
  *      The naming of the coefficient sets follows (Montenbruck and Gill, 2005).
  *
  */
 
+#include <stdexcept>
+
 #include <Eigen/Core>
 
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
@@ -411,49 +420,267 @@ void initializerungeKutta87DormandPrinceCoefficients(
     rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 12 ) = 1.0 / 4.0;
 }
 
+//! Initialize RK54 (Dormand and Prince) coefficients.
+void initializeRungeKutta54DormandPrinceCoefficients(
+        RungeKuttaCoefficients& rungeKutta54DormandPrinceCoefficients )
+{
+    // Define characteristics of coefficient set.
+    rungeKutta54DormandPrinceCoefficients.lowerOrder = 4;
+    rungeKutta54DormandPrinceCoefficients.higherOrder = 5;
+    rungeKutta54DormandPrinceCoefficients.orderEstimateToIntegrate = RungeKuttaCoefficients::higher;
+
+    // This coefficient set is taken from (Dormand and Prince, 1980), the continuous extension from
+    // (Hairer et al., 1993).
+
+    // Define a-coefficients for the Runge-Kutta method of order 5
+    // with an embedded 4th-order method for stepsize control and a total of 7 stages.
+    rungeKutta54DormandPrinceCoefficients.aCoefficients = Eigen::MatrixXd::Zero( 7, 6 );
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 1, 0 ) = 1.0 / 5.0;
+
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 2, 0 ) = 3.0 / 40.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 2, 1 ) = 9.0 / 40.0;
+
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 3, 0 ) = 44.0 / 45.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 3, 1 ) = -56.0 / 15.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 3, 2 ) = 32.0 / 9.0;
+
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 4, 0 ) = 19372.0 / 6561.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 4, 1 ) = -25360.0 / 2187.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 4, 2 ) = 64448.0 / 6561.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 4, 3 ) = -212.0 / 729.0;
+
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 5, 0 ) = 9017.0 / 3168.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 5, 1 ) = -355.0 / 33.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 5, 2 ) = 46732.0 / 5247.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 5, 3 ) = 49.0 / 176.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 5, 4 ) = -5103.0 / 18656.0;
+
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 6, 0 ) = 35.0 / 384.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 6, 2 ) = 500.0 / 1113.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 6, 3 ) = 125.0 / 192.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 6, 4 ) = -2187.0 / 6784.0;
+    rungeKutta54DormandPrinceCoefficients.aCoefficients( 6, 5 ) = 11.0 / 84.0;
+
+    // Define c-coefficients for the Runge-Kutta method of order 5
+    // with an embedded 4th-order method for stepsize control and a total of 7 stages.
+    rungeKutta54DormandPrinceCoefficients.cCoefficients = Eigen::VectorXd::Zero( 7 );
+    rungeKutta54DormandPrinceCoefficients.cCoefficients( 1 ) = 1.0 / 5.0;
+    rungeKutta54DormandPrinceCoefficients.cCoefficients( 2 ) = 3.0 / 10.0;
+    rungeKutta54DormandPrinceCoefficients.cCoefficients( 3 ) = 4.0 / 5.0;
+    rungeKutta54DormandPrinceCoefficients.cCoefficients( 4 ) = 8.0 / 9.0;
+    rungeKutta54DormandPrinceCoefficients.cCoefficients( 5 ) = 1.0;
+    rungeKutta54DormandPrinceCoefficients.cCoefficients( 6 ) = 1.0;
+
+    // Define b-coefficients for the Runge-Kutta method of order 5
+    // with an embedded 4th-order method for stepsize control and a total of 7 stages.
+    // The last stage is evaluated at the propagated state (first-same-as-last property).
+    rungeKutta54DormandPrinceCoefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 7 );
+    rungeKutta54DormandPrinceCoefficients.bCoefficients( 0, 0 ) = 5179.0 / 57600.0;
+    rungeKutta54DormandPrinceCoefficients.bCoefficients( 0, 2 ) = 7571.0 / 16695.0;
+    rungeKutta54DormandPrinceCoefficients.bCoefficients( 0, 3 ) = 393.0 / 640.0;
+    rungeKutta54DormandPrinceCoefficients.bCoefficients( 0, 4 ) = -92097.0 / 339200.0;
+    rungeKutta54DormandPrinceCoefficients.bCoefficients( 0, 5 ) = 187.0 / 2100.0;
+    rungeKutta54DormandPrinceCoefficients.bCoefficients( 0, 6 ) = 1.0 / 40.0;
+
+    rungeKutta54DormandPrinceCoefficients.bCoefficients.block( 1, 0, 1, 6 ) =
+            rungeKutta54DormandPrinceCoefficients.aCoefficients.block( 6, 0, 1, 6 );
+
+    // Define coefficients of 4th-order continuous extension of 5th-order method.
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients = Eigen::MatrixXd::Zero( 7, 4 );
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 0, 0 ) = 1.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 0, 1 ) = -8048581381.0 / 2820520608.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 0, 2 ) = 8663915743.0 / 2820520608.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 0, 3 ) = -12715105075.0 / 11282082432.0;
+
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 2, 1 ) = 131558114200.0 / 32700410799.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 2, 2 ) = -68118460800.0 / 10900136933.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 2, 3 ) = 87487479700.0 / 32700410799.0;
+
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 3, 1 ) = -1754552775.0 / 470086768.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 3, 2 ) = 14199869525.0 / 1410260304.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 3, 3 ) = -10690763975.0 / 1880347072.0;
+
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 4, 1 ) = 127303824393.0 / 49829197408.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 4, 2 ) = -318862633887.0 / 49829197408.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 4, 3 ) = 701980252875.0 / 199316789632.0;
+
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 5, 1 ) = -282668133.0 / 205662961.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 5, 2 ) = 2019193451.0 / 616988883.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 5, 3 ) = -1453857185.0 / 822651844.0;
+
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 6, 1 ) = 40617522.0 / 29380423.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 6, 2 ) = -110615467.0 / 29380423.0;
+    rungeKutta54DormandPrinceCoefficients.denseOutputCoefficients( 6, 3 ) = 69997945.0 / 29380423.0;
+}
+
+//! Initialize RK65 (Verner) coefficients.
+void initializeRungeKutta65VernerCoefficients(
+        RungeKuttaCoefficients& rungeKutta65VernerCoefficients )
+{
+    // Define characteristics of coefficient set.
+    rungeKutta65VernerCoefficients.lowerOrder = 5;
+    rungeKutta65VernerCoefficients.higherOrder = 6;
+    rungeKutta65VernerCoefficients.orderEstimateToIntegrate = RungeKuttaCoefficients::higher;
+
+    // This coefficient set is taken from (Verner, 1978), as used in DVERK (Hull et al., 1976).
+
+    // Define a-coefficients for the Runge-Kutta method of order 6
+    // with an embedded 5th-order method for stepsize control and a total of 8 stages.
+    rungeKutta65VernerCoefficients.aCoefficients = Eigen::MatrixXd::Zero( 8, 7 );
+    rungeKutta65VernerCoefficients.aCoefficients( 1, 0 ) = 1.0 / 6.0;
+
+    rungeKutta65VernerCoefficients.aCoefficients( 2, 0 ) = 4.0 / 75.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 2, 1 ) = 16.0 / 75.0;
+
+    rungeKutta65VernerCoefficients.aCoefficients( 3, 0 ) = 5.0 / 6.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 3, 1 ) = -8.0 / 3.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 3, 2 ) = 5.0 / 2.0;
+
+    rungeKutta65VernerCoefficients.aCoefficients( 4, 0 ) = -165.0 / 64.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 4, 1 ) = 55.0 / 6.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 4, 2 ) = -425.0 / 64.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 4, 3 ) = 85.0 / 96.0;
+
+    rungeKutta65VernerCoefficients.aCoefficients( 5, 0 ) = 12.0 / 5.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 5, 1 ) = -8.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 5, 2 ) = 4015.0 / 612.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 5, 3 ) = -11.0 / 36.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 5, 4 ) = 88.0 / 255.0;
+
+    rungeKutta65VernerCoefficients.aCoefficients( 6, 0 ) = -8263.0 / 15000.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 6, 1 ) = 124.0 / 75.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 6, 2 ) = -643.0 / 680.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 6, 3 ) = -81.0 / 250.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 6, 4 ) = 2484.0 / 10625.0;
+
+    rungeKutta65VernerCoefficients.aCoefficients( 7, 0 ) = 3501.0 / 1720.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 7, 1 ) = -300.0 / 43.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 7, 2 ) = 297275.0 / 52632.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 7, 3 ) = -319.0 / 2322.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 7, 4 ) = 24068.0 / 84065.0;
+    rungeKutta65VernerCoefficients.aCoefficients( 7, 6 ) = 3850.0 / 26703.0;
+
+    // Define c-coefficients for the Runge-Kutta method of order 6
+    // with an embedded 5th-order method for stepsize control and a total of 8 stages.
+    rungeKutta65VernerCoefficients.cCoefficients = Eigen::VectorXd::Zero( 8 );
+    rungeKutta65VernerCoefficients.cCoefficients( 1 ) = 1.0 / 6.0;
+    rungeKutta65VernerCoefficients.cCoefficients( 2 ) = 4.0 / 15.0;
+    rungeKutta65VernerCoefficients.cCoefficients( 3 ) = 2.0 / 3.0;
+    rungeKutta65VernerCoefficients.cCoefficients( 4 ) = 5.0 / 6.0;
+    rungeKutta65VernerCoefficients.cCoefficients( 5 ) = 1.0;
+    rungeKutta65VernerCoefficients.cCoefficients( 6 ) = 1.0 / 15.0;
+    rungeKutta65VernerCoefficients.cCoefficients( 7 ) = 1.0;
+
+    // Define b-coefficients for the Runge-Kutta method of order 6
+    // with an embedded 5th-order method for stepsize control and a total of 8 stages.
+    rungeKutta65VernerCoefficients.bCoefficients = Eigen::MatrixXd::Zero( 2, 8 );
+    rungeKutta65VernerCoefficients.bCoefficients( 0, 0 ) = 13.0 / 160.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 0, 2 ) = 2375.0 / 5984.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 0, 3 ) = 5.0 / 16.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 0, 4 ) = 12.0 / 85.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 0, 5 ) = 3.0 / 44.0;
+
+    rungeKutta65VernerCoefficients.bCoefficients( 1, 0 ) = 3.0 / 40.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 1, 2 ) = 875.0 / 2244.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 1, 3 ) = 23.0 / 72.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 1, 4 ) = 264.0 / 1955.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 1, 6 ) = 125.0 / 11592.0;
+    rungeKutta65VernerCoefficients.bCoefficients( 1, 7 ) = 43.0 / 616.0;
+}
+
+//! Function to create a coefficient set using a given initialization function.
+/*!
+ * Function to create a coefficient set using a given initialization function. Used to initialize the static
+ * coefficient sets in RungeKuttaCoefficients::get, which (as of C++11) is thread-safe.
+ * \param initializationFunction Function that sets the coefficients
+ * \return Coefficient set
+ */
+RungeKuttaCoefficients createRungeKuttaCoefficients(
+        void ( *initializationFunction )( RungeKuttaCoefficients& ) )
+{
+    RungeKuttaCoefficients coefficients;
+    initializationFunction( coefficients );
+    return coefficients;
+}
+
 //! Get coefficients for a specified coefficient set
 const RungeKuttaCoefficients& RungeKuttaCoefficients::get(
         RungeKuttaCoefficients::CoefficientSets coefficientSet )
 {
-    static RungeKuttaCoefficients rungeKuttaFehlberg45Coefficients,
-                                  rungeKuttaFehlberg56Coefficients,
-                                  rungeKuttaFehlberg78Coefficients,
-                                  rungeKutta87DormandPrinceCoefficients;
-
+    // Coefficient sets are created upon first use.
     switch ( coefficientSet )
     {
     case rungeKuttaFehlberg45:
-        if ( rungeKuttaFehlberg45Coefficients.higherOrder != 5 )
-        {
-            initializeRungeKuttaFehlberg45Coefficients( rungeKuttaFehlberg45Coefficients );
-        }
+    {
+        static const RungeKuttaCoefficients rungeKuttaFehlberg45Coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg45Coefficients );
         return rungeKuttaFehlberg45Coefficients;
-
+    }
     case rungeKuttaFehlberg56:
-        if ( rungeKuttaFehlberg56Coefficients.higherOrder != 6 )
-        {
-            initializeRungeKuttaFehlberg56Coefficients( rungeKuttaFehlberg56Coefficients );
-        }
+    {
+        static const RungeKuttaCoefficients rungeKuttaFehlberg56Coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg56Coefficients );
         return rungeKuttaFehlberg56Coefficients;
-
+    }
     case rungeKuttaFehlberg78:
-        if ( rungeKuttaFehlberg78Coefficients.higherOrder != 8 )
-        {
-            initializeRungeKuttaFehlberg78Coefficients( rungeKuttaFehlberg78Coefficients );
-        }
+    {
+        static const RungeKuttaCoefficients rungeKuttaFehlberg78Coefficients =
+                createRungeKuttaCoefficients( &initializeRungeKuttaFehlberg78Coefficients );
         return rungeKuttaFehlberg78Coefficients;
-
+    }
     case rungeKutta87DormandPrince:
-        if ( rungeKutta87DormandPrinceCoefficients.higherOrder != 7 )
-        {
-            initializerungeKutta87DormandPrinceCoefficients(
-                        rungeKutta87DormandPrinceCoefficients );
-        }
+    {
+        static const RungeKuttaCoefficients rungeKutta87DormandPrinceCoefficients =
+                createRungeKuttaCoefficients( &initializerungeKutta87DormandPrinceCoefficients );
         return rungeKutta87DormandPrinceCoefficients;
+    }
+    case rungeKutta54DormandPrince:
+    {
+        static const RungeKuttaCoefficients rungeKutta54DormandPrinceCoefficients =
+                createRungeKuttaCoefficients( &initializeRungeKutta54DormandPrinceCoefficients );
+        return rungeKutta54DormandPrinceCoefficients;
+    }
+    case rungeKutta65Verner:
+    {
+        static const RungeKuttaCoefficients rungeKutta65VernerCoefficients =
+                createRungeKuttaCoefficients( &initializeRungeKutta65VernerCoefficients );
+        return rungeKutta65VernerCoefficients;
+    }
+    default:
+        throw std::runtime_error( "Error, Runge-Kutta coefficient set not recognized." );
+    }
+}
 
-    default: // The default case will never occur because CoefficientsSet is an enum.
-        throw RungeKuttaCoefficients( );
+//! Function to check whether the coefficient set has the first-same-as-last (FSAL) property.
+bool RungeKuttaCoefficients::isFirstSameAsLast( ) const
+{
+    const int numberOfStages = cCoefficients.rows( );
+    if( numberOfStages < 2 || aCoefficients.rows( ) != numberOfStages || bCoefficients.cols( ) != numberOfStages )
+    {
+        return false;
     }
+
+    // Retrieve row of b-coefficients used for the propagated state
+    const int integratedOrderRow = ( orderEstimateToIntegrate == lower ) ? 0 : 1;
+
+    // Check whether last stage is evaluated at end of step, and does not contribute to propagated state
+    if( cCoefficients( numberOfStages - 1 ) != 1.0 ||
+            bCoefficients( integratedOrderRow, numberOfStages - 1 ) != 0.0 )
+    {
+        return false;
+    }
+
+    // Check whether state at last stage is identical to propagated state (exact comparison, since both must yield
+    // identical floating point values for the state derivative to be reused).
+    for( int column = 0; column < numberOfStages - 1; column++ )
+    {
+        if( aCoefficients( numberOfStages - 1, column ) != bCoefficients( integratedOrderRow, column ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 } // namespace numerical_integrators
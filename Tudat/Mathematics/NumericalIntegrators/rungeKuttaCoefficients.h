@@ -9,6 +9,7 @@
  *
  *    References
  *      Burden, R.L., Faires, J.D. Numerical Analysis, 7th Edition, Books/Cole, 2001.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
  *
  */
 
@@ -51,6 +52,15 @@ struct RungeKuttaCoefficients
     //! Order estimate to integrate.
     OrderEstimateToIntegrate orderEstimateToIntegrate;
 
+    //! Coefficients of the continuous extension (dense output) of the integrated order estimate.
+    /*!
+     * Coefficients of the continuous extension (dense output) of the integrated order estimate. Entry (i,j) is the
+     * coefficient of theta^(j+1) in the weight b_i(theta) of stage i, where theta is the fraction of the step, so
+     * that the state at theta is given by y_n + h sum_i b_i(theta) k_i. Empty if the coefficient set has no
+     * dedicated continuous extension.
+     */
+    Eigen::MatrixXd denseOutputCoefficients;
+
     //! Default constructor.
     /*!
      * Default constructor that initializes coefficients to 0.
@@ -61,7 +71,8 @@ struct RungeKuttaCoefficients
         cCoefficients( ),
         higherOrder( 0 ),
         lowerOrder( 0 ),
-        orderEstimateToIntegrate( lower )
+        orderEstimateToIntegrate( lower ),
+        denseOutputCoefficients( )
     { }
 
     //! Constructor.
@@ -74,19 +85,23 @@ struct RungeKuttaCoefficients
      * \param lowerOrder_ Order of the embedded low-order integrator.
      * \param order Enum denoting whether to use the lower or higher order scheme for numerical
      * integration.
+     * \param denseOutputCoefficients_ Coefficients of the continuous extension of the integrated order estimate
+     * (default none).
      */
     RungeKuttaCoefficients( const Eigen::MatrixXd& aCoefficients_,
                             const Eigen::MatrixXd& bCoefficients_,
                             const Eigen::MatrixXd& cCoefficients_,
                             const unsigned int higherOrder_,
                             const unsigned int lowerOrder_,
-                            OrderEstimateToIntegrate order ) :
+                            OrderEstimateToIntegrate order,
+                            const Eigen::MatrixXd& denseOutputCoefficients_ = Eigen::MatrixXd( ) ) :
         aCoefficients( aCoefficients_ ),
         bCoefficients( bCoefficients_ ),
         cCoefficients( cCoefficients_ ),
         higherOrder( higherOrder_ ),
         lowerOrder( lowerOrder_ ),
-        orderEstimateToIntegrate( order )
+        orderEstimateToIntegrate( order ),
+        denseOutputCoefficients( denseOutputCoefficients_ )
     { }
 
     //! Enum of predefined coefficient sets.
@@ -96,7 +111,9 @@ struct RungeKuttaCoefficients
         rungeKuttaFehlberg45,
         rungeKuttaFehlberg56,
         rungeKuttaFehlberg78,
-        rungeKutta87DormandPrince
+        rungeKutta87DormandPrince,
+        rungeKutta54DormandPrince,
+        rungeKutta65Verner
     };
 
     //! Get coefficients for a specified coefficient set.
@@ -106,6 +123,27 @@ struct RungeKuttaCoefficients
      * \return The requested coefficient set.
      */
     static const RungeKuttaCoefficients& get( CoefficientSets coefficientSet );
+
+    //! Function to check whether the coefficient set has the first-same-as-last (FSAL) property.
+    /*!
+     * Function to check whether the coefficient set has the first-same-as-last (FSAL) property, i.e. whether the
+     * last stage is evaluated at the end of the step, at exactly the state that is propagated (the last row of the
+     * a-coefficients is equal to the b-coefficients of the order estimate that is integrated, and the final stage
+     * does not contribute to this estimate). For such a coefficient set, the state derivative of the last stage is
+     * equal to that of the first stage of the next step, so that it need not be recomputed.
+     * \return True if the coefficient set has the FSAL property.
+     */
+    bool isFirstSameAsLast( ) const;
+
+    //! Function to check whether the coefficient set has a dedicated continuous extension (dense output).
+    /*!
+     * Function to check whether the coefficient set has a dedicated continuous extension (dense output).
+     * \return True if the denseOutputCoefficients are defined.
+     */
+    bool hasDenseOutputCoefficients( ) const
+    {
+        return ( denseOutputCoefficients.rows( ) > 0 );
+    }
 };
 
 //! Typedef for shared-pointer to RungeKuttaCoefficients object.
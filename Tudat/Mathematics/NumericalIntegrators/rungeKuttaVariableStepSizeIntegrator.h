@@ -145,6 +145,8 @@ public:
                         this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
                         std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8 );
         }
+
+        initializeStepBuffers( );
     }
 
     //! Default constructor.
@@ -201,13 +203,15 @@ public:
         newStepSizeFunction_( newStepSizeFunction ), useStepSizeControl_( true )
     {
         // Set default newStepSizeFunction_ to the class method.
-        if ( newStepSizeFunction_ == 0 )
+        if ( this->newStepSizeFunction_ == 0 )
         {
             this->newStepSizeFunction_ = std::bind(
                         &RungeKuttaVariableStepSizeIntegrator::computeNewStepSize,
                         this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
                         std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8 );
         }
+
+        initializeStepBuffers( );
     }
 
     //! Get step size of the next step.
@@ -271,6 +275,7 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+        resetStepHistory( );
         return true;
     }
 
@@ -300,13 +305,19 @@ public:
      * used in simulations of discrete events. In astrodynamics, this relates to simulations of rocket staging,
      * impulsive shots, parachuting, ideal control, etc. The modified state, by default, cannot be rolled back; to do this, either
      * set the flag to true, or store the state before calling this function the first time, and call it again with the initial state
-     * as parameter to revert to the state before the discrete change.
+     * as parameter to revert to the state before the discrete change. If the new state is identical to the current state
+     * (as is typically the case when the state is post-processed after each step), the state derivatives and dense output
+     * of the last step remain valid, and are retained.
      * \param newState The value of the new state.
      * \param allowRollback Boolean denoting whether roll-back should be allowed.
      */
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
-        currentState_ = newState;
+        if( !areStatesIdentical( newState, currentState_ ) )
+        {
+            currentState_ = newState;
+            resetStepHistory( );
+        }
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -315,7 +326,8 @@ public:
 
     //! Modify the state and time for the current step.
     /*!
-     * Modify the state and time for the current step.
+     * Modify the state and time for the current step. The state derivatives and dense output of the last step are only
+     * retained if both the state and time are unchanged.
      * \param newState The new state to set the current state to.
      * \param newTime The time to set the current time to.
      * \param allowRollback Boolean denoting whether roll-back should be allowed.
@@ -323,8 +335,12 @@ public:
     void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
                                             const bool allowRollback = false )
     {
-        currentState_ = newState;
-        currentIndependentVariable_ = newTime;
+        if( !areStatesIdentical( newState, currentState_ ) || !( newTime == currentIndependentVariable_ ) )
+        {
+            currentState_ = newState;
+            currentIndependentVariable_ = newTime;
+            resetStepHistory( );
+        }
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -341,8 +357,92 @@ public:
         useStepSizeControl_ = useStepSizeControl;
     }
 
+    //! Function to compute the state within the last integration step, using the continuous extension (dense output).
+    /*!
+     * Function to compute the state within the last (accepted) integration step, i.e. between the previous and current
+     * independent variable, using the continuous extension (dense output) of the integrator. If the coefficient set has
+     * dedicated dense output coefficients, these are used, requiring no additional state derivative evaluations.
+     * Otherwise, a cubic Hermite interpolation is used, based on the states and state derivatives at the start and end
+     * of the step. For coefficient sets without the first-same-as-last property, this requires a single state
+     * derivative evaluation at the end of the step, which is performed upon the first call for a given step (and is
+     * reused as the first stage of the next step). Note that the accuracy of the Hermite interpolation is lower than
+     * that of the integrator itself.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return State at the requested value of the independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
+    //! Function to retrieve whether the dense output of the last integration step is available.
+    /*!
+     * Function to retrieve whether the dense output of the last integration step is available (i.e. whether a step has
+     * been accepted since the creation of the integrator, or the last modification of its state).
+     * \return True if the dense output of the last integration step is available.
+     */
+    virtual bool isDenseOutputAvailable( ) const
+    {
+        return isDenseOutputAvailable_;
+    }
+
+    //! Function to retrieve whether the state derivative of the last stage is reused as first stage of the next step.
+    /*!
+     * Function to retrieve whether the state derivative of the last stage is reused as first stage of the next step,
+     * which is the case if the coefficient set has the first-same-as-last (FSAL) property.
+     * \return True if the state derivative of the last stage is reused as first stage of the next step.
+     */
+    bool isFirstSameAsLast( ) const
+    {
+        return isFirstSameAsLast_;
+    }
+
 protected:
 
+    //! Function to allocate the buffers used during an integration step.
+    /*!
+     * Function to allocate the buffers used during an integration step (stage state derivatives, intermediate state
+     * and order estimates), so that no allocations for these quantities are needed during the integration. The state
+     * derivatives are only computed without allocation if a state derivative function that writes into an existing object
+     * is set (see NumericalIntegrator::setStateDerivativeInPlaceFunction); otherwise, the state derivative function
+     * returns a new object for each evaluation.
+     */
+    void initializeStepBuffers( )
+    {
+        const int numberOfStages = coefficients_.cCoefficients.rows( );
+
+        currentStateDerivatives_.resize( numberOfStages );
+        intermediateState_ = currentState_;
+        lowerOrderEstimate_ = currentState_;
+        higherOrderEstimate_ = currentState_;
+
+        isFirstSameAsLast_ = coefficients_.isFirstSameAsLast( );
+        resetStepHistory( );
+    }
+
+    //! Function to mark the state derivatives and dense output of the previous step as no longer valid.
+    /*!
+     * Function to mark the state derivatives and dense output of the previous step as no longer valid, to be called
+     * whenever the current state or independent variable is changed other than by a regular integration step.
+     */
+    void resetStepHistory( )
+    {
+        isFirstStageStateDerivativeAvailable_ = false;
+        isLastStageStateDerivativeReusable_ = false;
+        isEndOfStepStateDerivativeAvailable_ = false;
+        isDenseOutputAvailable_ = false;
+    }
+
+    //! Function to compute the state derivatives of all stages, and the lower and higher order estimates.
+    /*!
+     * Function to compute the state derivatives of all stages, and the lower and higher order estimates, for a single
+     * (attempted) step from the current state. The results are stored in the currentStateDerivatives_,
+     * lowerOrderEstimate_ and higherOrderEstimate_ member variables. If the state derivative of the first stage is
+     * already available (from a previous rejected step or, for FSAL coefficient sets, from the last stage of the
+     * previous step), it is not recomputed.
+     * \param stepSize The step size to take.
+     * \return False if the propagation termination condition was reached during the computation of the stages, true
+     * otherwise.
+     */
+    bool computeStageStateDerivativesAndEstimates( const TimeStepType stepSize );
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -480,6 +580,39 @@ protected:
      */
     std::vector< StateDerivativeType > currentStateDerivatives_;
 
+    //! Intermediate state at which the state derivative of the current stage is evaluated.
+    StateType intermediateState_;
+
+    //! Lower order estimate of the state at the end of the current step.
+    StateType lowerOrderEstimate_;
+
+    //! Higher order estimate of the state at the end of the current step.
+    StateType higherOrderEstimate_;
+
+    //! Boolean denoting whether the coefficient set has the first-same-as-last (FSAL) property.
+    bool isFirstSameAsLast_;
+
+    //! Boolean denoting whether the first entry of currentStateDerivatives_ is the state derivative at the current
+    //! time and state (i.e. whether it need not be recomputed for the next step).
+    bool isFirstStageStateDerivativeAvailable_;
+
+    //! Boolean denoting whether the last entry of currentStateDerivatives_ is the state derivative at the current
+    //! time and state (FSAL coefficient sets only), to be used as first stage of the next step.
+    bool isLastStageStateDerivativeReusable_;
+
+    //! State derivative at the end of the last step (computed only for dense output of coefficient sets without FSAL
+    //! property and without dense output coefficients).
+    StateDerivativeType endOfStepStateDerivative_;
+
+    //! Boolean denoting whether endOfStepStateDerivative_ is the state derivative at the current time and state.
+    bool isEndOfStepStateDerivativeAvailable_;
+
+    //! Boolean denoting whether the dense output of the last integration step is available.
+    bool isDenseOutputAvailable_;
+
+    //! Step size of the last accepted integration step.
+    TimeStepType lastStepSize_;
+
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
@@ -490,81 +623,209 @@ extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::Vect
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
 
 
-//! Perform a single integration step.
+//! Compute the state derivatives of all stages, and the lower and higher order estimates.
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
-StateType
+bool
 RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
-::performIntegrationStep( const TimeStepType stepSize )
+::computeStageStateDerivativesAndEstimates( const TimeStepType stepSize )
 {
-    // Define and allocated vector for the number of stages.
-    currentStateDerivatives_.clear( );
-    currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
+    const int numberOfStages = this->coefficients_.cCoefficients.rows( );
+
+    // For FSAL coefficient sets, retrieve first stage from last stage of previous step. Otherwise, use the state
+    // derivative at the end of the previous step, if it has been computed for the dense output.
+    if( isLastStageStateDerivativeReusable_ )
+    {
+        currentStateDerivatives_[ 0 ] = currentStateDerivatives_[ numberOfStages - 1 ];
+        isFirstStageStateDerivativeAvailable_ = true;
+    }
+    else if( isEndOfStepStateDerivativeAvailable_ )
+    {
+        currentStateDerivatives_[ 0 ] = endOfStepStateDerivative_;
+        isFirstStageStateDerivativeAvailable_ = true;
+    }
+    isLastStageStateDerivativeReusable_ = false;
+    isEndOfStepStateDerivativeAvailable_ = false;
 
-    // Define lower and higher order estimates.
-    StateType lowerOrderEstimate( this->currentState_ ), higherOrderEstimate( this->currentState_ );
+    // Stage state derivatives of the last accepted step are overwritten.
+    isDenseOutputAvailable_ = false;
+
+    // Reset lower and higher order estimates.
+    lowerOrderEstimate_ = this->currentState_;
+    higherOrderEstimate_ = this->currentState_;
 
     // Compute the k_i state derivatives per stage.
-    for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
+    for ( int stage = 0; stage < numberOfStages; stage++ )
     {
-        // Compute the intermediate state to pass to the state derivative for this stage.
-        StateType intermediateState( this->currentState_ );
+        // The state derivative of the first stage is only recomputed if it is not yet available for the current state.
+        if( stage > 0 || !isFirstStageStateDerivativeAvailable_ )
+        {
+            // Compute the intermediate state. Zero coefficients are skipped, which does not modify the result.
+            intermediateState_ = this->currentState_;
+            for ( int column = 0; column < stage; column++ )
+            {
+                if( this->coefficients_.aCoefficients( stage, column ) != 0.0 )
+                {
+                    intermediateState_ += stepSize * this->coefficients_.aCoefficients( stage, column ) *
+                            currentStateDerivatives_[ column ];
+                }
+            }
+
+            // Compute the state derivative.
+            const IndependentVariableType time = this->currentIndependentVariable_ +
+                    this->coefficients_.cCoefficients( stage ) * stepSize;
+            this->computeStateDerivative( time, intermediateState_, currentStateDerivatives_[ stage ] );
+
+            // Check if propagation should terminate because the propagation termination condition has been reached
+            // while computing the intermediate state.
+            if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+            {
+                isFirstStageStateDerivativeAvailable_ = false;
+                return false;
+            }
+
+            if( stage == 0 )
+            {
+                isFirstStageStateDerivativeAvailable_ = true;
+            }
+        }
 
-        // Compute the intermediate state.
-        for ( int column = 0; column < stage; column++ )
+        // Update the estimates.
+        if( this->coefficients_.bCoefficients( 0, stage ) != 0.0 )
         {
-            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) *
-                    currentStateDerivatives_[ column ];
+            lowerOrderEstimate_ += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
+                    currentStateDerivatives_[ stage ];
         }
+        if( this->coefficients_.bCoefficients( 1, stage ) != 0.0 )
+        {
+            higherOrderEstimate_ += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
+                    currentStateDerivatives_[ stage ];
+        }
+    }
 
-        // Compute the state derivative.
-        const IndependentVariableType time = this->currentIndependentVariable_ +
-                this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+    return true;
+}
+
+//! Perform a single integration step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::performIntegrationStep( const TimeStepType stepSize )
+{
+    TimeStepType currentStepSize = stepSize;
 
-        // Check if propagation should terminate because the propagation termination condition has been reached
-        // while computing the intermediate state.
-        // If so, return immediately the current state (not recomputed yet), which will be discarded.
-        if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+    // Repeat step until it is accepted. For a rejected step, the state derivative of the first stage is reused.
+    while( true )
+    {
+        if( !computeStageStateDerivativesAndEstimates( currentStepSize ) )
         {
+            // If propagation termination condition was reached during step, return immediately the current state (not
+            // recomputed yet), which will be discarded.
             this->propagationTerminationConditionReachedDuringStep_ = true;
             return this->currentState_;
         }
 
-        // Update the estimate.
-        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
-        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
+        // Determine if the error was within bounds and compute a new step size.
+        if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate_, higherOrderEstimate_, currentStepSize ) )
+        {
+            break;
+        }
+
+        // Reject current step, and retry with new step size.
+        currentStepSize = this->stepSize_;
     }
 
-    // Determine if the error was within bounds and compute a new step size.
-    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate,
-                                               higherOrderEstimate, stepSize ) )
+    // Accept the current step.
+    this->lastIndependentVariable_ = this->currentIndependentVariable_;
+    this->lastState_ = this->currentState_;
+    this->currentIndependentVariable_ += currentStepSize;
+
+    switch ( this->coefficients_.orderEstimateToIntegrate )
     {
-        // Accept the current step.
-        this->lastIndependentVariable_ = this->currentIndependentVariable_;
-        this->lastState_ = this->currentState_;
-        this->currentIndependentVariable_ += stepSize;
+    case RungeKuttaCoefficients::lower:
+        this->currentState_ = lowerOrderEstimate_;
+        break;
 
-        switch ( this->coefficients_.orderEstimateToIntegrate )
-        {
-        case RungeKuttaCoefficients::lower:
-            this->currentState_ = lowerOrderEstimate;
-            return this->currentState_;
+    case RungeKuttaCoefficients::higher:
+        this->currentState_ = higherOrderEstimate_;
+        break;
 
-        case RungeKuttaCoefficients::higher:
-            this->currentState_ = higherOrderEstimate;
-            return this->currentState_;
+    default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
+        throw std::runtime_error( "Order estimate to integrate is invalid." );
+    }
+
+    // For FSAL coefficient sets, the last stage was evaluated at the new current time and state, and is reused as
+    // first stage of the next step.
+    isFirstStageStateDerivativeAvailable_ = false;
+    isLastStageStateDerivativeReusable_ = isFirstSameAsLast_;
+
+    lastStepSize_ = currentStepSize;
+    isDenseOutputAvailable_ = true;
+
+    return this->currentState_;
+}
+
+//! Function to compute the state within the last integration step, using the continuous extension (dense output).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    if( !isDenseOutputAvailable_ )
+    {
+        throw std::runtime_error( "Error when computing dense output of Runge-Kutta integrator, no step available." );
+    }
+
+    // Compute fraction of step at which state is to be computed.
+    const TimeStepType theta = static_cast< TimeStepType >(
+                static_cast< double >( independentVariable - this->lastIndependentVariable_ ) ) / lastStepSize_;
+    if( theta < -1.0E-12 || theta > 1.0 + 1.0E-12 )
+    {
+        throw std::runtime_error( "Error when computing dense output of Runge-Kutta integrator, requested value of "
+                                  "independent variable is outside last step." );
+    }
 
-        default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
-            throw std::runtime_error( "Order estimate to integrate is invalid." );
+    StateType denseOutputState = this->lastState_;
+    if( coefficients_.hasDenseOutputCoefficients( ) )
+    {
+        // Evaluate polynomial weights of each stage.
+        for( int stage = 0; stage < coefficients_.denseOutputCoefficients.rows( ); stage++ )
+        {
+            TimeStepType stageWeight = 0.0;
+            TimeStepType thetaPower = theta;
+            for( int power = 0; power < coefficients_.denseOutputCoefficients.cols( ); power++ )
+            {
+                stageWeight += coefficients_.denseOutputCoefficients( stage, power ) * thetaPower;
+                thetaPower *= theta;
+            }
+
+            if( stageWeight != 0.0 )
+            {
+                denseOutputState += stageWeight * lastStepSize_ * currentStateDerivatives_[ stage ];
+            }
         }
     }
     else
     {
-        // Reject current step.
-        return performIntegrationStep( this->stepSize_ );
+        // Retrieve state derivative at end of step, evaluating it if needed.
+        if( !isFirstSameAsLast_ && !isEndOfStepStateDerivativeAvailable_ )
+        {
+            this->computeStateDerivative(
+                        this->currentIndependentVariable_, this->currentState_, endOfStepStateDerivative_ );
+            isEndOfStepStateDerivativeAvailable_ = true;
+        }
+        const StateDerivativeType& endOfStepStateDerivative =
+                isFirstSameAsLast_ ? currentStateDerivatives_.back( ) : endOfStepStateDerivative_;
+
+        // Compute cubic Hermite interpolation.
+        const TimeStepType thetaSquared = theta * theta;
+        const TimeStepType thetaCubed = thetaSquared * theta;
+        denseOutputState *= ( 2.0 * thetaCubed - 3.0 * thetaSquared + 1.0 );
+        denseOutputState += ( -2.0 * thetaCubed + 3.0 * thetaSquared ) * this->currentState_;
+        denseOutputState += ( thetaCubed - 2.0 * thetaSquared + theta ) * lastStepSize_ * currentStateDerivatives_[ 0 ];
+        denseOutputState += ( thetaCubed - thetaSquared ) * lastStepSize_ * endOfStepStateDerivative;
     }
+
+    return denseOutputState;
 }
 
 //! Compute the next step size and validate the result.
@@ -106,6 +106,26 @@ std::string getGlobalFrameOrigin( const NamedBodyMap& bodyMap )
     return globalFrameOrigin;
 }
 
+//! Function to retrieve the total number of state and rotation cache hits and misses of all bodies
+BodyStateCacheStatistics getStateCacheStatistics( const NamedBodyMap& bodyMap )
+{
+    BodyStateCacheStatistics totalStateCacheStatistics;
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        totalStateCacheStatistics += bodyIterator->second->getStateCacheStatistics( );
+    }
+    return totalStateCacheStatistics;
+}
+
+//! Function to reset the number of state and rotation cache hits and misses of all bodies
+void resetStateCacheStatistics( const NamedBodyMap& bodyMap )
+{
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        bodyIterator->second->resetStateCacheStatistics( );
+    }
+}
+
 
 } // namespace simulation_setup
 
@@ -24,6 +24,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/bodyShapeModel.h"
+#include "Tudat/Astrodynamics/Ephemerides/cachedRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
@@ -33,6 +34,7 @@
 #include "Tudat/Astrodynamics/ElectroMagnetism/radiationPressureInterface.h"
 #include "Tudat/Astrodynamics/ReferenceFrames/dependentOrientationCalculator.h"
 #include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/SystemModels/vehicleSystems.h"
 #include "Tudat/Mathematics/BasicMathematics/numericalDerivative.h"
@@ -203,6 +205,49 @@ private:
 };
 
 
+//! Structure containing the number of times that a body's state and rotation were retrieved from, or added to, the cache
+/*!
+ *  Structure containing the number of times that a body's (translational) state was retrieved from the value computed at
+ *  the same epoch by a previous call (hits), and the number of times that it had to be computed from the ephemeris
+ *  (misses), as counted by the Body::setStateFromEphemeris function. The same numbers are provided for the rotations of
+ *  the body's ground stations and other link ends, which are cached per epoch by the body's cached rotational ephemeris
+ *  (see Body::getCachedRotationalEphemeris).
+ */
+struct BodyStateCacheStatistics
+{
+    //! Constructor, sets all counters to zero
+    BodyStateCacheStatistics( ):
+        numberOfStateCacheHits_( 0 ), numberOfStateCacheMisses_( 0 ),
+        numberOfRotationCacheHits_( 0 ), numberOfRotationCacheMisses_( 0 ){ }
+
+    //! Operator to add the counters of another object to those of this object
+    /*!
+     *  Operator to add the counters of another object to those of this object
+     *  \param statisticsToAdd Object of which the counters are to be added to those of this object
+     *  \return This object, with updated counters
+     */
+    BodyStateCacheStatistics& operator+=( const BodyStateCacheStatistics& statisticsToAdd )
+    {
+        numberOfStateCacheHits_ += statisticsToAdd.numberOfStateCacheHits_;
+        numberOfStateCacheMisses_ += statisticsToAdd.numberOfStateCacheMisses_;
+        numberOfRotationCacheHits_ += statisticsToAdd.numberOfRotationCacheHits_;
+        numberOfRotationCacheMisses_ += statisticsToAdd.numberOfRotationCacheMisses_;
+        return *this;
+    }
+
+    //! Number of times that the state was requested at the epoch of the current state.
+    unsigned int numberOfStateCacheHits_;
+
+    //! Number of times that the state was computed from the ephemeris.
+    unsigned int numberOfStateCacheMisses_;
+
+    //! Number of times that a rotation (or its derivative) was retrieved from the cached rotational ephemeris.
+    unsigned int numberOfRotationCacheHits_;
+
+    //! Number of times that a rotation (or its derivative) was computed by the rotational ephemeris, and cached.
+    unsigned int numberOfRotationCacheMisses_;
+};
+
 //! Body class representing the properties of a celestial body (natural or artificial).
 /*!
  *  Body class representing the properties of a celestial body (natural or artificial). By storing
@@ -350,11 +395,54 @@ public:
             }
 
             timeOfCurrentState_ = static_cast< TimeType >( time );
+            stateCacheStatistics_.numberOfStateCacheMisses_++;
+        }
+        else
+        {
+            stateCacheStatistics_.numberOfStateCacheHits_++;
         }
     }
 
 //    extern template void setStateFromEphemeris< double, double >( const double& time );
 
+    //! Templated function to compute the state of the body from its ephemeris and global-to-ephemeris-frame function,
+    //! without using or modifying the current state.
+    /*!
+     * Templated function to compute the state of the body from its ephemeris and global-to-ephemeris-frame function,
+     * without using or modifying the currentState_/currentLongState_ (and barycentric) variables. This function is used
+     * instead of setStateFromEphemeris when the state is requested from tasks that concurrently access the same bodies (see
+     * utilities::isAccessingSharedObjectsConcurrently), in which case the current state cannot be safely cached.
+     * \param time Time at which to evaluate states.
+     * \param computeBarycentricState Boolean denoting whether the barycentric state of the global frame origin (true), or
+     * the state in the base frame (false) is to be computed.
+     * \return State at requested time
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > computeStateFromEphemerisWithoutCaching(
+            const TimeType time, const bool computeBarycentricState = false )
+    {
+        if( bodyIsGlobalFrameOrigin_ == 0 )
+        {
+            return ( bodyEphemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time ) +
+                     ephemerisFrameToBaseFrame_->getBaseFrameState< TimeType, StateScalarType >( time ) );
+        }
+        else if( bodyIsGlobalFrameOrigin_ == 1 )
+        {
+            if( computeBarycentricState )
+            {
+                return ephemerisFrameToBaseFrame_->getBaseFrameState< TimeType, StateScalarType >( time );
+            }
+            else
+            {
+                return Eigen::Matrix< StateScalarType, 6, 1 >::Zero( );
+            }
+        }
+        else
+        {
+            throw std::runtime_error( "Error when setting body state, global origin not yet defined." );
+        }
+    }
+
     //! Templated function to get the current state of the body from its ephemeris and
     //! global-to-ephemeris-frame function.
     /*!
@@ -367,6 +455,11 @@ public:
     template< typename StateScalarType = double, typename TimeType = double >
     Eigen::Matrix< StateScalarType, 6, 1 > getStateInBaseFrameFromEphemeris( const TimeType time )
     {
+        if( utilities::isAccessingSharedObjectsConcurrently( ) )
+        {
+            return computeStateFromEphemerisWithoutCaching< StateScalarType, TimeType >( time );
+        }
+
         setStateFromEphemeris< StateScalarType, TimeType >( time );
         if( sizeof( StateScalarType ) == 8 )
         {
@@ -396,6 +489,11 @@ public:
             throw std::runtime_error( "Error, calling global frame origin barycentric state on body that is not global frame origin" );
         }
 
+        if( utilities::isAccessingSharedObjectsConcurrently( ) )
+        {
+            return computeStateFromEphemerisWithoutCaching< StateScalarType, TimeType >( time, true );
+        }
+
         setStateFromEphemeris< StateScalarType, TimeType >( time );
 
         if( sizeof( StateScalarType ) == 8 )
@@ -700,6 +798,7 @@ public:
     void setEphemeris( const std::shared_ptr< ephemerides::Ephemeris > bodyEphemeris )
     {
         bodyEphemeris_ = bodyEphemeris;
+        recomputeStateOnNextCall( );
     }
 
     //! Function to set the gravity field of the body.
@@ -748,6 +847,8 @@ public:
             std::cerr << "Warning when setting rotational ephemeris, dependentOrientationCalculator_ already found, NOT setting closure" << std::endl;
         }
         rotationalEphemeris_ = rotationalEphemeris;
+        cachedRotationalEphemeris_ = ( rotationalEphemeris == nullptr ) ? nullptr :
+                std::make_shared< ephemerides::CachedRotationalEphemeris >( rotationalEphemeris );
     }
 
     //! Function to set a rotation model that is only valid during numerical propagation
@@ -913,6 +1014,19 @@ public:
         return rotationalEphemeris_;
     }
 
+    //! Function to get the rotation model of the body, with rotations cached per epoch.
+    /*!
+     *  Function to get the rotation model of the body, with rotations cached per epoch while a rotation caching scope is
+     *  active (see ephemerides::CachedRotationalEphemeris). This object is used for the rotations of the body's ground
+     *  stations and other link ends, which are requested at the same epochs by the light-time solution, the viability
+     *  calculators and the observation partials.
+     *  eturn Rotation model of the body, with rotations cached per epoch (nullptr if body has no rotation model).
+     */
+    std::shared_ptr< ephemerides::CachedRotationalEphemeris > getCachedRotationalEphemeris( )
+    {
+        return cachedRotationalEphemeris_;
+    }
+
     //! Function to retrieve the model to compute the rotation of the body based on the current state of the environment.
     /*!
      * Function to retrieve the model to compute the rotation of the body based on the current state of the environment
@@ -1250,6 +1364,33 @@ public:
         timeOfCurrentState_ = Time( TUDAT_NAN );
     }
 
+    //! Function to retrieve the number of state and rotation cache hits and misses
+    /*!
+     * Function to retrieve the number of state and rotation cache hits and misses, counted since the creation of the body
+     * (or of its rotation model), or the last call to resetStateCacheStatistics
+     * \return Number of state and rotation cache hits and misses
+     */
+    BodyStateCacheStatistics getStateCacheStatistics( )
+    {
+        BodyStateCacheStatistics stateCacheStatistics = stateCacheStatistics_;
+        if( cachedRotationalEphemeris_ != nullptr )
+        {
+            stateCacheStatistics.numberOfRotationCacheHits_ = cachedRotationalEphemeris_->getNumberOfCacheHits( );
+            stateCacheStatistics.numberOfRotationCacheMisses_ = cachedRotationalEphemeris_->getNumberOfCacheMisses( );
+        }
+        return stateCacheStatistics;
+    }
+
+    //! Function to reset the number of state and rotation cache hits and misses
+    void resetStateCacheStatistics( )
+    {
+        stateCacheStatistics_ = BodyStateCacheStatistics( );
+        if( cachedRotationalEphemeris_ != nullptr )
+        {
+            cachedRotationalEphemeris_->resetCacheStatistics( );
+        }
+    }
+
     //! Function to retrieve variable denoting whether this body is the global frame origin
     /*!
      * Function to retrieve variable denoting whether this body is the global frame origin
@@ -1292,6 +1433,9 @@ private:
     //! Time at which state was last set from ephemeris
     Time timeOfCurrentState_;
 
+    //! Number of state cache hits and misses, and rotation model evaluations
+    BodyStateCacheStatistics stateCacheStatistics_;
+
     //! Class returning the state of this body's ephemeris origin w.r.t. the global origin (as typically created by
     //! setGlobalFrameBodyEphemerides function).
     std::shared_ptr< BaseStateInterface > ephemerisFrameToBaseFrame_;
@@ -1347,6 +1491,9 @@ private:
     //! Rotation model of body.
     std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris_;
 
+    //! Rotation model of body, with rotations cached per epoch (used for ground stations and link ends).
+    std::shared_ptr< ephemerides::CachedRotationalEphemeris > cachedRotationalEphemeris_;
+
     //! Model to compute the rotation of the body based on the current state of the environment, only valid during propagation.
     std::shared_ptr< reference_frames::DependentOrientationCalculator > dependentOrientationCalculator_;
 
@@ -1379,6 +1526,22 @@ typedef std::unordered_map< std::string, std::shared_ptr< Body > > NamedBodyMap;
  */
 std::string getGlobalFrameOrigin( const NamedBodyMap& bodyMap );
 
+//! Function to retrieve the total number of state and rotation cache hits and misses of all bodies
+/*!
+ * Function to retrieve the total number of state and rotation cache hits and misses of all bodies (summed over all bodies,
+ * see Body::getStateCacheStatistics)
+ * \param bodyMap List of body objects.
+ * \return Total number of state and rotation cache hits and misses of all bodies
+ */
+BodyStateCacheStatistics getStateCacheStatistics( const NamedBodyMap& bodyMap );
+
+//! Function to reset the number of state and rotation cache hits and misses of all bodies
+/*!
+ * Function to reset the number of state and rotation cache hits and misses of all bodies
+ * \param bodyMap List of body objects.
+ */
+void resetStateCacheStatistics( const NamedBodyMap& bodyMap );
+
 //! Function to compute the acceleration of a body, using its ephemeris and finite differences
 /*!
  *  Function to compute the acceleration of a body, using its ephemeris and 8th order finite difference and 100 s time step
@@ -13,6 +13,7 @@
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #endif
 
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/customEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/multiArcEphemeris.h"
@@ -302,6 +303,45 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevEphemerisSettings >( ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error( "Error, expected Chebyshev ephemeris settings for " + bodyName );
+            }
+            else
+            {
+                // Create ephemeris to which Chebyshev ephemeris is fit (direct Spice by default)
+                std::shared_ptr< EphemerisSettings > sourceEphemerisSettings =
+                        chebyshevEphemerisSettings->getSourceEphemerisSettings( );
+                if( sourceEphemerisSettings == nullptr )
+                {
+                    sourceEphemerisSettings = std::make_shared< DirectSpiceEphemerisSettings >(
+                                chebyshevEphemerisSettings->getFrameOrigin( ),
+                                chebyshevEphemerisSettings->getFrameOrientation( ) );
+                }
+                else if( ( sourceEphemerisSettings->getFrameOrigin( ) != chebyshevEphemerisSettings->getFrameOrigin( ) ) ||
+                         ( sourceEphemerisSettings->getFrameOrientation( ) !=
+                           chebyshevEphemerisSettings->getFrameOrientation( ) ) )
+                {
+                    throw std::runtime_error( "Error, frame of source ephemeris of Chebyshev ephemeris of " + bodyName +
+                                              " is inconsistent" );
+                }
+
+                // Create ephemeris
+                ephemeris = createChebyshevEphemeris(
+                            createBodyEphemeris( sourceEphemerisSettings, bodyName ),
+                            chebyshevEphemerisSettings->getInitialTime( ),
+                            chebyshevEphemerisSettings->getFinalTime( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ),
+                            chebyshevEphemerisSettings->getVelocityTolerance( ),
+                            chebyshevEphemerisSettings->getNumberOfCoefficients( ) );
+            }
+            break;
+        }
         default:
         {
             throw std::runtime_error(
@@ -326,6 +366,14 @@ std::pair< double, double > getSafeInterpolationInterval( const std::shared_ptr<
     {
         safeInterval = getTabulatedEphemerisSafeInterval( ephemerisModel );
     }
+    // Check if model is Chebyshev ephemeris, and retrieve interval on which it is defined
+    else if( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel ) != nullptr )
+    {
+        std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemerisModel  =
+                std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel );
+        safeInterval = std::make_pair( chebyshevEphemerisModel->getInitialTime( ),
+                                       chebyshevEphemerisModel->getFinalTime( ) );
+    }
     // Check if model is multi-arc, and retrieve safe intervals from first and last arc.
     else if( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemerisModel ) != nullptr )
     {
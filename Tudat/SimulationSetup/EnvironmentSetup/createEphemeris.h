@@ -42,7 +42,8 @@ enum EphemerisType
     interpolated_spice,
     constant_ephemeris,
     kepler_ephemeris,
-    custom_ephemeris
+    custom_ephemeris,
+    chebyshev_ephemeris
 };
 
 //! Class for providing settings for ephemeris model.
@@ -625,6 +626,115 @@ private:
     bool useLongDoubleStates_;
 };
 
+//! EphemerisSettings derived class for defining settings of an ephemeris of piecewise Chebyshev polynomials, fit to
+//! another ephemeris.
+/*!
+ *  EphemerisSettings derived class for defining settings of an ephemeris of piecewise Chebyshev polynomials (see
+ *  ChebyshevEphemeris class), fit to another ephemeris (by default, Spice) when the ephemeris is created. The segment
+ *  length is chosen automatically, such that the position and velocity tolerances are met. Evaluating the resulting
+ *  ephemeris is typically much faster than evaluating Spice directly (DirectSpiceEphemerisSettings), and the ephemeris is
+ *  more accurate and requires less memory than an ephemeris interpolated from Spice with a fixed time step
+ *  (InterpolatedSpiceEphemerisSettings).
+ */
+class ChebyshevEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param initialTime Start time of the interval on which the ephemeris is to be valid.
+     *  \param finalTime End time of the interval on which the ephemeris is to be valid.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *        (optional "SSB" by default).
+     *  \param frameOrientation Orientation of the reference frame in which the epehemeris is to be
+     *          calculated (optional "ECLIPJ2000" by default).
+     *  \param positionTolerance Maximum permitted difference in position w.r.t. the source ephemeris
+     *  (optional 1 mm by default).
+     *  \param velocityTolerance Maximum permitted difference in velocity w.r.t. the source ephemeris
+     *  (optional 1 micrometer/s by default).
+     *  \param numberOfCoefficients Number of Chebyshev coefficients per position component per segment
+     *  (optional 14 by default).
+     *  \param sourceEphemerisSettings Settings for the ephemeris to which the Chebyshev ephemeris is to be fit. If
+     *  nullptr (default), a direct Spice ephemeris in the frame defined by frameOrigin and frameOrientation is used.
+     */
+    ChebyshevEphemerisSettings( const double initialTime,
+                                const double finalTime,
+                                const std::string& frameOrigin = "SSB",
+                                const std::string& frameOrientation = "ECLIPJ2000",
+                                const double positionTolerance = 1.0E-3,
+                                const double velocityTolerance = 1.0E-6,
+                                const int numberOfCoefficients = 14,
+                                const std::shared_ptr< EphemerisSettings > sourceEphemerisSettings = nullptr ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        initialTime_( initialTime ), finalTime_( finalTime ),
+        positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+        numberOfCoefficients_( numberOfCoefficients ), sourceEphemerisSettings_( sourceEphemerisSettings ){ }
+
+    //! Function to return start time of the interval on which the ephemeris is to be valid.
+    /*!
+     *  Function to return start time of the interval on which the ephemeris is to be valid.
+     *  \return Start time of the interval on which the ephemeris is to be valid.
+     */
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function to return end time of the interval on which the ephemeris is to be valid.
+    /*!
+     *  Function to return end time of the interval on which the ephemeris is to be valid.
+     *  \return End time of the interval on which the ephemeris is to be valid.
+     */
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function to return maximum permitted difference in position w.r.t. the source ephemeris.
+    /*!
+     *  Function to return maximum permitted difference in position w.r.t. the source ephemeris.
+     *  \return Maximum permitted difference in position w.r.t. the source ephemeris.
+     */
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    //! Function to return maximum permitted difference in velocity w.r.t. the source ephemeris.
+    /*!
+     *  Function to return maximum permitted difference in velocity w.r.t. the source ephemeris.
+     *  \return Maximum permitted difference in velocity w.r.t. the source ephemeris.
+     */
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    //! Function to return number of Chebyshev coefficients per position component per segment.
+    /*!
+     *  Function to return number of Chebyshev coefficients per position component per segment.
+     *  \return Number of Chebyshev coefficients per position component per segment.
+     */
+    int getNumberOfCoefficients( ){ return numberOfCoefficients_; }
+
+    //! Function to return settings for the ephemeris to which the Chebyshev ephemeris is to be fit.
+    /*!
+     *  Function to return settings for the ephemeris to which the Chebyshev ephemeris is to be fit (nullptr if a
+     *  direct Spice ephemeris is to be used).
+     *  \return Settings for the ephemeris to which the Chebyshev ephemeris is to be fit.
+     */
+    std::shared_ptr< EphemerisSettings > getSourceEphemerisSettings( ){ return sourceEphemerisSettings_; }
+
+private:
+
+    //! Start time of the interval on which the ephemeris is to be valid.
+    double initialTime_;
+
+    //! End time of the interval on which the ephemeris is to be valid.
+    double finalTime_;
+
+    //! Maximum permitted difference in position w.r.t. the source ephemeris.
+    double positionTolerance_;
+
+    //! Maximum permitted difference in velocity w.r.t. the source ephemeris.
+    double velocityTolerance_;
+
+    //! Number of Chebyshev coefficients per position component per segment.
+    int numberOfCoefficients_;
+
+    //! Settings for the ephemeris to which the Chebyshev ephemeris is to be fit (nullptr if direct Spice is used).
+    std::shared_ptr< EphemerisSettings > sourceEphemerisSettings_;
+};
+
 #if USE_CSPICE
 
 //! Function to create a tabulated ephemeris using data from Spice.
@@ -96,7 +96,7 @@ std::map< observation_models::LinkEndType, std::shared_ptr< CartesianStatePartia
             partialMap[ linkEndIterator->first ] = std::make_shared< CartesianStatePartialWrtRotationMatrixParameter >(
                         std::make_shared< RotationMatrixPartialWrtRotationalState >(
                             std::bind( &ephemerides::RotationalEphemeris::getRotationToBaseFrame,
-                                         currentBody->getRotationalEphemeris( ), std::placeholders::_1 ) ), groundStationPositionFunction );
+                                         currentBody->getCachedRotationalEphemeris( ), std::placeholders::_1 ) ), groundStationPositionFunction );
         }
     }
 
@@ -259,7 +259,7 @@ std::map< observation_models::LinkEndType, std::shared_ptr< CartesianStatePartia
 
                         // Create partial object.
                         partialMap[ linkEndIterator->first ] = std::make_shared< CartesianPartialWrtBodyFixedPosition >(
-                                    currentBody->getRotationalEphemeris( ) );
+                                    currentBody->getCachedRotationalEphemeris( ) );
                     }
                     break;
                 default:
@@ -86,7 +86,7 @@ std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > getLi
         linkEndCompleteEphemerisFunction =
                 std::bind( &ephemerides::Ephemeris::getTemplatedStateFromEphemeris< StateScalarType,TimeType >,
                              createReferencePointEphemeris< TimeType, StateScalarType >(
-                                 bodyWithLinkEnd, bodyWithLinkEnd->getRotationalEphemeris( ),
+                                 bodyWithLinkEnd, bodyWithLinkEnd->getCachedRotationalEphemeris( ),
                                  std::bind( &ground_stations::GroundStation::getStateInPlanetFixedFrame
                                               < StateScalarType, TimeType >,
                                               bodyWithLinkEnd->getGroundStation( linkEndId.second ), std::placeholders::_1 ) ), std::placeholders::_1 );
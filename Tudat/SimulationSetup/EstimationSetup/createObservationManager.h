@@ -287,6 +287,11 @@ void performObservationParameterEstimationClosure(
  *  \param bodyMap Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param performBiasParameterClosure Boolean denoting whether the estimated observation bias parameters are to be linked
+ *  to the observation biases of the new object (false for thread-local copies, see createThreadLocalObservationManagers)
+ *  \param cartesianStatePartialCache Object used to share the partials of the link end states w.r.t. the parameters between
+ *  the observation partials of this and other observation managers (see CartesianStatePartialCache; partials w.r.t.
+ *  Cartesian states are not shared); no sharing if nullptr (default).
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< int ObservationSize = 1, typename ObservationScalarType, typename TimeType >
@@ -297,7 +302,9 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
         parametersToEstimate,
         const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
-        stateTransitionMatrixInterface )
+        stateTransitionMatrixInterface,
+        const bool performBiasParameterClosure = true,
+        const std::shared_ptr< observation_partials::CartesianStatePartialCache > cartesianStatePartialCache = nullptr )
 {
     using namespace observation_models;
     using namespace observation_partials;
@@ -307,8 +314,11 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
             createObservationSimulator< ObservationSize, ObservationScalarType, TimeType >(
                 observableType, settingsPerLinkEnds, bodyMap );
 
-    performObservationParameterEstimationClosure(
-                observationSimulator, parametersToEstimate );
+    if( performBiasParameterClosure )
+    {
+        performObservationParameterEstimationClosure(
+                    observationSimulator, parametersToEstimate );
+    }
 
     // Create observation partials for all link ends/parameters
     std::shared_ptr< ObservationPartialCreator< ObservationSize, ObservationScalarType, TimeType > > observationPartialCreator =
@@ -329,6 +339,17 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     std::map< LinkEnds, std::shared_ptr< observation_partials::PositionPartialScaling  > > observationPartialScalers;
     splitObservationPartialsAndScalers( observationPartialsAndScaler, observationPartials, observationPartialScalers );
 
+    // Share partials of link end states with observation partials of other observation managers
+    if( cartesianStatePartialCache != nullptr )
+    {
+        for( auto linkEndIterator : observationPartials )
+        {
+            for( auto partialIterator : linkEndIterator.second )
+            {
+                partialIterator.second->setCartesianStatePartialCache( cartesianStatePartialCache, linkEndIterator.first );
+            }
+        }
+    }
 
     return std::make_shared< ObservationManager< ObservationSize, ObservationScalarType, TimeType > >(
                 observableType, observationSimulator, observationPartials,
@@ -345,6 +366,11 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
  *  \param bodyMap Map of Body objects that comprise the environment
  *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
  *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param performBiasParameterClosure Boolean denoting whether the estimated observation bias parameters are to be linked
+ *  to the observation biases of the new object (false for thread-local copies, see createThreadLocalObservationManagers)
+ *  \param cartesianStatePartialCache Object used to share the partials of the link end states w.r.t. the parameters between
+ *  the observation partials of this and other observation managers (see CartesianStatePartialCache; partials w.r.t.
+ *  Cartesian states are not shared); no sharing if nullptr (default).
  *  \return Object that simulates the observations of a given type and associated partials
  */
 template< typename ObservationScalarType, typename TimeType >
@@ -353,7 +379,9 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
         const std::map< LinkEnds, std::shared_ptr< ObservationSettings  > > settingsPerLinkEnds,
         const simulation_setup::NamedBodyMap &bodyMap,
         const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
-        const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface )
+        const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface,
+        const bool performBiasParameterClosure = true,
+        const std::shared_ptr< observation_partials::CartesianStatePartialCache > cartesianStatePartialCache = nullptr )
 {
     std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager;
     switch( observableType )
@@ -361,42 +389,42 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     case one_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case n_way_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case one_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case two_way_doppler:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case one_way_differenced_range:
         observationManager = createObservationManager< 1, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case angular_position:
         observationManager = createObservationManager< 2, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case position_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     case euler_angle_313_observable:
         observationManager = createObservationManager< 3, ObservationScalarType, TimeType >(
                     observableType, settingsPerLinkEnds, bodyMap, parametersToEstimate,
-                    stateTransitionMatrixInterface );
+                    stateTransitionMatrixInterface, performBiasParameterClosure, cartesianStatePartialCache );
         break;
     default:
         throw std::runtime_error(
@@ -406,6 +434,46 @@ std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > cre
     return observationManager;
 }
 
+//! Function to create and set the observation managers used by additional threads when computing observations and partials
+/*!
+ *  Function to create and set the observation managers used by additional threads when computing observations and
+ *  partials (see ObservationManager::computeObservationsWithPartials). Each thread-local observation manager is created
+ *  from the same settings as the original observation manager, so that each thread uses its own light-time calculators
+ *  and partial objects, while sharing the environment, the observation biases and the state transition matrix interface.
+ *  All environment models used by the observation models must support concurrent evaluation (which is not the case for
+ *  ephemerides and rotation models that directly call Spice).
+ *  \param observationManager Observation manager for which the thread-local observation managers are to be set
+ *  \param settingsPerLinkEnds Map of settings for the observation models from which observationManager was created.
+ *  \param bodyMap Map of Body objects that comprise the environment
+ *  \param parametersToEstimate Object containing the list of all parameters that are to be estimated
+ *  \param stateTransitionMatrixInterface Object used to compute the state transition/sensitivity matrix at a given time
+ *  \param numberOfThreads Total number of threads to use when computing observations and partials (including the calling
+ *  thread; if 0, the number of threads that can be executed concurrently on the current hardware is used).
+ */
+template< typename ObservationScalarType, typename TimeType >
+void createThreadLocalObservationManagers(
+        const std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > observationManager,
+        const std::map< LinkEnds, std::shared_ptr< ObservationSettings  > > settingsPerLinkEnds,
+        const simulation_setup::NamedBodyMap &bodyMap,
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate,
+        const std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionMatrixInterface,
+        const unsigned int numberOfThreads )
+{
+    unsigned int numberOfUsedThreads =
+            ( numberOfThreads == 0 ) ? utilities::getNumberOfAvailableThreads( ) : numberOfThreads;
+
+    std::vector< std::shared_ptr< ObservationManagerBase< ObservationScalarType, TimeType > > >
+            threadLocalObservationManagers;
+    for( unsigned int i = 1; i < numberOfUsedThreads; i++ )
+    {
+        threadLocalObservationManagers.push_back(
+                    createObservationManagerBase< ObservationScalarType, TimeType >(
+                        observationManager->getObservationSimulator( )->getObservableType( ), settingsPerLinkEnds, bodyMap,
+                        parametersToEstimate, stateTransitionMatrixInterface, false ) );
+    }
+    observationManager->setThreadLocalObservationManagers( threadLocalObservationManagers );
+}
+
 //extern template std::shared_ptr< ObservationManagerBase< double, double > > createObservationManagerBase< double, double >(
 //        const ObservableType observableType,
 //        const std::map< LinkEnds, std::shared_ptr< ObservationSettings  > > settingsPerLinkEnds,
@@ -13,12 +13,15 @@
 
 #include <algorithm>
 
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/estimationCheckpoint.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/arcWiseParameterIndices.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/initialTranslationalState.h"
 #include "Tudat/SimulationSetup/EstimationSetup/variationalEquationsSolver.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createObservationManager.h"
@@ -163,6 +166,37 @@ public:
                                              propagateOnCreation );
     }
 
+    //! Constructor, using an existing variational equations solver
+    /*!
+     *  Constructor, using an existing variational equations solver to propagate the dynamics and variational equations. This
+     *  allows for e.g. a MultiArcVariationalEquationsSolver that propagates its arcs in parallel to be used in the
+     *  estimation. The solver must have been created using the same body map and estimated parameters as provided here.
+     *  \param bodyMap Map of body objects with names of bodies, storing all environment models used in simulation.
+     *  \param parametersToEstimate Container object for all parameters that are to be estimated
+     *  \param observationSettingsMap Sets of observation model settings per link ends (i.e. transmitter, receiver, etc.)
+     *  for which measurement data is to be provided in orbit determination process
+     *  (through estimateParameters function)
+     *  \param variationalEquationsSolver Object used to propagate the dynamics and variational equations
+     */
+    OrbitDeterminationManager(
+            const NamedBodyMap &bodyMap,
+            const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > >
+            parametersToEstimate,
+            const observation_models::ObservationSettingsMap& observationSettingsMap,
+            const std::shared_ptr< propagators::VariationalEquationsSolver< ObservationScalarType, TimeType > >
+            variationalEquationsSolver ):
+        parametersToEstimate_( parametersToEstimate )
+    {
+        if( variationalEquationsSolver == nullptr )
+        {
+            throw std::runtime_error( "Error when creating OrbitDeterminationManager, no variational equations solver provided" );
+        }
+
+        initializeOrbitDeterminationManager( bodyMap, observation_models::convertUnsortedToSortedObservationSettingsMap(
+                                                 observationSettingsMap ), nullptr, nullptr, false,
+                                             variationalEquationsSolver );
+    }
+
     //! Function to retrieve map of all observation managers
     /*!
      *  Function to retrieve map of all observation managers. A single observation manager can simulate observations and
@@ -281,6 +315,9 @@ public:
         residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
+        // Share partials of link end states between observables while computing partials for current parameter values
+        observation_partials::ScopedCartesianStatePartialCacheActivation cacheActivation( cartesianStatePartialCache_ );
+
         // Declare variable denoting current index in vector of all observations.
         int startIndex = 0;
 
@@ -322,10 +359,125 @@ public:
                         residualsAndPartials.first.block( observableStartIndex, 0, currentObservableSize, 1 ),
                         observablesIterator->first );
         }
-
     }
 
+    //! Function to calculate the residuals and accumulate the normal equations, without storing the observation partials matrix
+    /*!
+     *  Function to calculate the residuals and accumulate the (unnormalized) weighted normal equations A^T*W*A and A^T*W*r
+     *  (or the equivalent square-root information), based on the state transition matrix, sensitivity matrix and body states
+     *  resulting from the previous numerical integration iteration. The observations and partials are computed for blocks of
+     *  observation times, which are added to the accumulator and then discarded, so that the full observation partials
+     *  matrix is never stored (at most its non-zero blocks, see linear_algebra::SparseDesignMatrixAccumulator).
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsMatrixDiagonals Weight matrix diagonals, per observable type and set of link ends.
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param maximumNumberOfObservationTimesPerBlock Maximum number of observation times for which observations and
+     *  partials are computed at once.
+     *  \param observationBlockAccumulator Object to which the blocks of observations are added (reset by this function).
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     */
+    void calculateNormalEquationsAndResiduals(
+            const PodInputType& observationsAndTimes,
+            const std::map< observation_models::ObservableType,
+            std::map< observation_models::LinkEnds, Eigen::VectorXd > >& weightsMatrixDiagonals,
+            const int totalObservationSize,
+            const int maximumNumberOfObservationTimesPerBlock,
+            linear_algebra::ObservationBlockAccumulator& observationBlockAccumulator,
+            Eigen::VectorXd& residuals )
+    {
+        // Initialize return data.
+        observationBlockAccumulator.reset( );
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+
+        // Share partials of link end states between observables while computing partials for current parameter values
+        observation_partials::ScopedCartesianStatePartialCacheActivation cacheActivation( cartesianStatePartialCache_ );
+
+        // Declare variable denoting current index in vector of all observations.
+        int startIndex = 0;
+
+        // Iterate over all observable types in observationsAndTimes
+        std::vector< TimeType > simulationInputTime;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            int observableStartIndex = startIndex;
+
+            // Iterate over all link ends for current observable type in observationsAndTimes
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                const std::vector< TimeType >& currentObservationTimes = dataIterator->second.second.first;
+                const Eigen::VectorXd& currentWeights =
+                        weightsMatrixDiagonals.at( observablesIterator->first ).at( dataIterator->first );
+                int linkEndStartIndex = startIndex;
+
+                // Iterate over blocks of observation times
+                for( unsigned int firstTimeIndex = 0; firstTimeIndex < currentObservationTimes.size( );
+                     firstTimeIndex += maximumNumberOfObservationTimesPerBlock )
+                {
+                    simulationInputTime.assign(
+                                currentObservationTimes.begin( ) + firstTimeIndex,
+                                currentObservationTimes.begin( ) + std::min(
+                                    currentObservationTimes.size( ),
+                                    static_cast< std::size_t >( firstTimeIndex + maximumNumberOfObservationTimesPerBlock ) ) );
+
+                    // Compute estimated observations and partials for current block from current parameter estimate.
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                            observationManagers_[ observablesIterator->first ]->computeObservationsWithPartials(
+                                simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+                    int currentBlockSize = observationsWithPartials.first.rows( );
+                    int blockStartIndex = startIndex - linkEndStartIndex;
+
+                    if( blockStartIndex + currentBlockSize > dataIterator->second.first.rows( ) )
+                    {
+                        throw std::runtime_error(
+                                    "Error when accumulating normal equations, number of observations is inconsistent" );
+                    }
+
+                    // Compute residuals for current block, and add block to accumulator
+                    residuals.segment( startIndex, currentBlockSize ) =
+                            ( dataIterator->second.first.segment( blockStartIndex, currentBlockSize ) -
+                              observationsWithPartials.first ).template cast< double >( );
+                    observationBlockAccumulator.addObservationBlock(
+                                observationsWithPartials.second, residuals.segment( startIndex, currentBlockSize ),
+                                currentWeights.segment( blockStartIndex, currentBlockSize ) );
+
+                    // Increment current index of observation.
+                    startIndex += currentBlockSize;
+                }
+
+                if( startIndex - linkEndStartIndex != dataIterator->second.first.rows( ) )
+                {
+                    throw std::runtime_error(
+                                "Error when accumulating normal equations, number of observations is inconsistent" );
+                }
+            }
 
+            int currentObservableSize = startIndex - observableStartIndex;
+            observation_models::checkObservationResidualDiscontinuities(
+                        residuals.block( observableStartIndex, 0, currentObservableSize, 1 ),
+                        observablesIterator->first );
+        }
+    }
+
+    //! Function to assemble the normalized inverse covariance matrix from arc-wise accumulated normal equations
+    /*!
+     * Function to assemble the (dense) normalized inverse covariance matrix from arc-wise accumulated normal equations,
+     * which are stored in block form by the accumulator.
+     * \param arcWiseNormalEquations Accumulated normal equations, with arc-wise parameters in block form
+     * \param transformationData Normalization terms of the parameters
+     * \param inverseAPrioriCovariance Inverse a priori covariance matrix (unnormalized)
+     * \return Normalized inverse covariance matrix
+     */
+    Eigen::MatrixXd getNormalizedInverseCovarianceFromArcWiseNormalEquations(
+            const std::shared_ptr< linear_algebra::ArcWiseNormalEquationAccumulator > arcWiseNormalEquations,
+            const Eigen::VectorXd& transformationData,
+            const Eigen::MatrixXd& inverseAPrioriCovariance )
+    {
+        Eigen::MatrixXd normalizationMatrix = transformationData * transformationData.transpose( );
+        return arcWiseNormalEquations->getNormalMatrix( ).cwiseQuotient( normalizationMatrix ) +
+                inverseAPrioriCovariance.cwiseQuotient( normalizationMatrix );
+    }
 
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
     /*!
@@ -398,6 +550,8 @@ public:
      *  estimate for covariance matrix and parameter adjustment.
      *  \param convergenceChecker Object used to check convergence/termination of algorithm
      *  \return Object containing estimated parameter value and associateed data, such as residuals and observation partials.
+     *  If so requested (see PodInput::defineCheckpointSettings), a checkpoint is written after each iteration, from which
+     *  the estimation is resumed, and the iteration histories are written to file instead of being stored in the output.
      */
     std::shared_ptr< PodOutput< ObservationScalarType, TimeType > > estimateParameters(
             const std::shared_ptr< PodInput< ObservationScalarType, TimeType > > podInput,
@@ -418,10 +572,18 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        Eigen::MatrixXd bestInformationMatrix;
+        if( !podInput->getAccumulateNormalEquations( ) )
+        {
+            bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        }
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
 
+        // Normal equations of best iteration in block form, if arc-wise parameters are eliminated (in which case the
+        // dense inverse covariance matrix is only assembled when it is needed)
+        std::shared_ptr< linear_algebra::ArcWiseNormalEquationAccumulator > bestArcWiseNormalEquations;
+
         std::vector< Eigen::VectorXd > residualHistory;
         std::vector< Eigen::VectorXd > parameterHistory;
         std::vector< std::vector< std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > > > dynamicsHistoryPerIteration;
@@ -440,11 +602,90 @@ public:
 
         int numberOfEstimatedParameters = parameterVectorSize;
 
-        bool exceptionDuringPropagation = false, exceptionDuringInversion = false;
-        // Iterate until convergence (at least once)
+        // Create object to accumulate normal equations or square-root information, if full partials matrix is not to be
+        // stored
+        std::shared_ptr< linear_algebra::ObservationBlockAccumulator > observationBlockAccumulator;
+        std::shared_ptr< linear_algebra::NormalEquationAccumulator > normalEquationAccumulator;
+        std::shared_ptr< linear_algebra::SquareRootInformationAccumulator > squareRootInformationAccumulator;
+        std::shared_ptr< linear_algebra::ArcWiseNormalEquationAccumulator > arcWiseNormalEquationAccumulator;
+        std::shared_ptr< linear_algebra::SparseDesignMatrixAccumulator > sparseDesignMatrixAccumulator;
+        if( podInput->getAccumulateNormalEquations( ) )
+        {
+            if( podInput->getUseSparseDesignMatrix( ) )
+            {
+                sparseDesignMatrixAccumulator = std::make_shared< linear_algebra::SparseDesignMatrixAccumulator >(
+                            parameterVectorSize );
+                observationBlockAccumulator = sparseDesignMatrixAccumulator;
+            }
+            else if( podInput->getEliminateArcParameters( ) )
+            {
+                arcWiseNormalEquationAccumulator = std::make_shared< linear_algebra::ArcWiseNormalEquationAccumulator >(
+                            estimatable_parameters::getArcIndicesOfEstimatedParameters( parametersToEstimate_ ) );
+                observationBlockAccumulator = arcWiseNormalEquationAccumulator;
+            }
+            else if( podInput->getUseSquareRootInformationFilter( ) )
+            {
+                squareRootInformationAccumulator = std::make_shared< linear_algebra::SquareRootInformationAccumulator >(
+                            parameterVectorSize );
+                observationBlockAccumulator = squareRootInformationAccumulator;
+            }
+            else
+            {
+                normalEquationAccumulator = std::make_shared< linear_algebra::NormalEquationAccumulator >(
+                            parameterVectorSize, podInput->getNumberOfNormalEquationThreads( ) );
+                observationBlockAccumulator = normalEquationAccumulator;
+            }
+        }
+
+        // Resume estimation from checkpoint, if requested and available
+        const std::string checkpointDirectory = podInput->getCheckpointDirectory( );
+        const bool saveIterationHistoriesToFile = podInput->getSaveIterationHistoriesToFile( );
         int numberOfIterations = 0;
-        do
+        bool isEstimationConverged = false;
+        if( checkpointDirectory != "" && podInput->getResumeFromCheckpoint( ) &&
+                boost::filesystem::exists( getEstimationCheckpointFileName( checkpointDirectory ) ) )
         {
+            std::shared_ptr< EstimationCheckpoint< ObservationScalarType > > checkpoint =
+                    readEstimationCheckpointFromFile< ObservationScalarType >(
+                        getEstimationCheckpointFileName( checkpointDirectory ) );
+            if( ( checkpoint->parameterEstimate_.rows( ) != parameterVectorSize ) ||
+                    ( checkpoint->bestResiduals_.rows( ) != totalNumberOfObservations ) )
+            {
+                throw std::runtime_error( "Error when resuming estimation from checkpoint, numbers of parameters or observations are inconsistent" );
+            }
+
+            numberOfIterations = checkpoint->numberOfIterations_;
+            newParameterEstimate = checkpoint->parameterEstimate_;
+            rmsResidualHistory = checkpoint->rmsResidualHistory_;
+            bestResidual = checkpoint->bestResidual_;
+            bestParameterEstimate = checkpoint->bestParameterEstimate_;
+            bestResiduals = checkpoint->bestResiduals_;
+            bestInformationMatrix = checkpoint->bestInformationMatrix_;
+            bestWeightsMatrixDiagonal = getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) );
+            bestTransformationData = checkpoint->bestTransformationData_;
+            bestInverseNormalizedCovarianceMatrix = checkpoint->bestInverseNormalizedCovarianceMatrix_;
+
+            if( podInput->getPrintOutput( ) )
+            {
+                std::cout << "Resuming estimation from checkpoint after iteration " << numberOfIterations << std::endl;
+            }
+            if( numberOfIterations > 0 )
+            {
+                isEstimationConverged = convergenceChecker->isEstimationConverged( numberOfIterations, rmsResidualHistory );
+            }
+        }
+
+        bool exceptionDuringPropagation = false, exceptionDuringInversion = false;
+        // Iterate until convergence (at least once, unless resumed from a converged estimation)
+        while( !isEstimationConverged )
+        {
+            std::shared_ptr< EstimationIterationHistory< ObservationScalarType, TimeType > > currentIterationHistory;
+            if( saveIterationHistoriesToFile )
+            {
+                currentIterationHistory = std::make_shared< EstimationIterationHistory< ObservationScalarType, TimeType > >(
+                            numberOfIterations );
+            }
+
             try
             {
                 // Re-integrate equations of motion and variational equations with new parameter estimate.
@@ -455,10 +696,20 @@ public:
 
                 if( podInput->getSaveStateHistoryForEachIteration( ) )
                 {
-                    dynamicsHistoryPerIteration.push_back(
-                                variationalEquationsSolver_->getDynamicsSimulatorBase( )->getEquationsOfMotionNumericalSolutionBase( ) );
-                    dependentVariableHistoryPerIteration.push_back(
-                                variationalEquationsSolver_->getDynamicsSimulatorBase( )->getDependentVariableNumericalSolutionBase( ) );
+                    if( saveIterationHistoriesToFile )
+                    {
+                        currentIterationHistory->dynamicsHistory_ =
+                                variationalEquationsSolver_->getDynamicsSimulatorBase( )->getEquationsOfMotionNumericalSolutionBase( );
+                        currentIterationHistory->dependentVariableHistory_ =
+                                variationalEquationsSolver_->getDynamicsSimulatorBase( )->getDependentVariableNumericalSolutionBase( );
+                    }
+                    else
+                    {
+                        dynamicsHistoryPerIteration.push_back(
+                                    variationalEquationsSolver_->getDynamicsSimulatorBase( )->getEquationsOfMotionNumericalSolutionBase( ) );
+                        dependentVariableHistoryPerIteration.push_back(
+                                    variationalEquationsSolver_->getDynamicsSimulatorBase( )->getDependentVariableNumericalSolutionBase( ) );
+                    }
                 }
             }
             catch( std::runtime_error& error )
@@ -475,12 +726,24 @@ public:
             {
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
-            calculateObservationMatrixAndResiduals(
-                        podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
-
-            Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            Eigen::VectorXd transformationData;
+            if( observationBlockAccumulator != nullptr )
+            {
+                calculateNormalEquationsAndResiduals(
+                            podInput->getObservationsAndTimes( ), podInput->getWeightsMatrixDiagonals( ),
+                            totalNumberOfObservations, podInput->getMaximumNumberOfObservationTimesPerBlock( ),
+                            *observationBlockAccumulator, residualsAndPartials.first );
+                transformationData = observationBlockAccumulator->getNormalizationTerms( );
+            }
+            else
+            {
+                calculateObservationMatrixAndResiduals(
+                            podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials );
+                transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            }
 
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero(
                         numberOfEstimatedParameters, numberOfEstimatedParameters );
@@ -502,11 +765,85 @@ public:
                 Eigen::MatrixXd constraintStateMultiplier;
                 Eigen::VectorXd constraintRightHandSide;
                 parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
-                leastSquaresOutput =
-                        std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
-                                       residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                                       residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
-                                       normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                if( normalEquationAccumulator != nullptr )
+                {
+                    // Normalize accumulated normal equations, consistent with normalization of partials matrix
+                    Eigen::MatrixXd normalizedInverseCovarianceMatrix =
+                            normalEquationAccumulator->getNormalMatrix( ).cwiseQuotient(
+                                transformationData * transformationData.transpose( ) ) +
+                            normalizedInverseAprioriCovarianceMatrix;
+                    Eigen::VectorXd normalizedRightHandSide =
+                            normalEquationAccumulator->getRightHandSide( ).cwiseQuotient( transformationData );
+
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           normalizedInverseCovarianceMatrix, normalizedRightHandSide,
+                                           1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else if( sparseDesignMatrixAccumulator != nullptr )
+                {
+                    // Compute normal equations from non-zero blocks of partials, and normalize consistent with
+                    // normalization of partials matrix
+                    Eigen::MatrixXd normalizedInverseCovarianceMatrix =
+                            sparseDesignMatrixAccumulator->getNormalMatrix( ).cwiseQuotient(
+                                transformationData * transformationData.transpose( ) ) +
+                            normalizedInverseAprioriCovarianceMatrix;
+                    Eigen::VectorXd normalizedRightHandSide =
+                            sparseDesignMatrixAccumulator->getRightHandSide( ).cwiseQuotient( transformationData );
+
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           normalizedInverseCovarianceMatrix, normalizedRightHandSide,
+                                           1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else if( squareRootInformationAccumulator != nullptr )
+                {
+                    // Normalize columns of accumulated square-root information, consistent with normalization of partials
+                    // matrix
+                    Eigen::MatrixXd normalizedSquareRootInformationMatrix =
+                            squareRootInformationAccumulator->getSquareRootInformationMatrix( ) *
+                            transformationData.cwiseInverse( ).asDiagonal( );
+
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromSquareRootInformation(
+                                           normalizedSquareRootInformationMatrix,
+                                           squareRootInformationAccumulator->getTransformedResiduals( ),
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8,
+                                           constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else if( arcWiseNormalEquationAccumulator != nullptr )
+                {
+                    // Constraints may couple any of the parameters, in which case full normal equations are solved
+                    if( constraintStateMultiplier.rows( ) > 0 )
+                    {
+                        Eigen::MatrixXd normalizedInverseCovarianceMatrix =
+                                arcWiseNormalEquationAccumulator->getNormalMatrix( ).cwiseQuotient(
+                                    transformationData * transformationData.transpose( ) ) +
+                                normalizedInverseAprioriCovarianceMatrix;
+
+                        leastSquaresOutput =
+                                std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                               normalizedInverseCovarianceMatrix,
+                                               arcWiseNormalEquationAccumulator->getRightHandSide( ).cwiseQuotient(
+                                                   transformationData ),
+                                               1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                    }
+                    else
+                    {
+                        // Solve reduced system only; inverse covariance is left empty, and assembled from the
+                        // block-form normal equations of the best iteration when needed
+                        leastSquaresOutput.first = arcWiseNormalEquationAccumulator->getParameterAdjustment(
+                                    normalizedInverseAprioriCovarianceMatrix, transformationData );
+                    }
+                }
+                else
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                                           residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
+                                           residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -537,12 +874,29 @@ public:
 
             if( podInput->getSaveResidualsAndParametersFromEachIteration( ) )
             {
-                residualHistory.push_back( residualsAndPartials.first );
-                if( numberOfIterations == 0 )
+                if( saveIterationHistoriesToFile )
+                {
+                    currentIterationHistory->parameterEstimate_ = oldParameterEstimate;
+                    currentIterationHistory->updatedParameterEstimate_ = newParameterEstimate;
+                    currentIterationHistory->residuals_ = residualsAndPartials.first;
+                }
+                else
                 {
-                    parameterHistory.push_back( oldParameterEstimate.template cast< double >( ) );
+                    residualHistory.push_back( residualsAndPartials.first );
+                    if( numberOfIterations == 0 )
+                    {
+                        parameterHistory.push_back( oldParameterEstimate.template cast< double >( ) );
+                    }
+                    parameterHistory.push_back( newParameterEstimate.template cast< double >( ) );
                 }
-                parameterHistory.push_back( newParameterEstimate.template cast< double >( ) );
+            }
+
+            if( saveIterationHistoriesToFile )
+            {
+                writeEstimationIterationHistoryToFile(
+                            *currentIterationHistory,
+                            getEstimationIterationHistoryFileName( checkpointDirectory, numberOfIterations ) );
+                currentIterationHistory.reset( );
             }
 
             oldParameterEstimate = newParameterEstimate;
@@ -567,27 +921,70 @@ public:
                 bestResidual = residualRms;
                 bestParameterEstimate = std::move( oldParameterEstimate );
                 bestResiduals = std::move( residualsAndPartials.first );
-                if( podInput->getSaveInformationMatrix( ) )
+                if( podInput->getSaveInformationMatrix( ) && ( observationBlockAccumulator == nullptr ) )
                 {
                     bestInformationMatrix = std::move( residualsAndPartials.second );
                 }
+                else if( podInput->getSaveInformationMatrix( ) && ( sparseDesignMatrixAccumulator != nullptr ) )
+                {
+                    linear_algebra::BlockSparseDesignMatrix normalizedDesignMatrix =
+                            sparseDesignMatrixAccumulator->getDesignMatrix( );
+                    normalizedDesignMatrix.divideColumns( transformationData );
+                    bestInformationMatrix = normalizedDesignMatrix.getDenseMatrix( );
+                }
                 bestWeightsMatrixDiagonal = std::move( getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ) );
                 bestTransformationData = std::move( transformationData );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
+                if( ( arcWiseNormalEquationAccumulator != nullptr ) && ( bestInverseNormalizedCovarianceMatrix.rows( ) == 0 ) )
+                {
+                    bestArcWiseNormalEquations = std::make_shared< linear_algebra::ArcWiseNormalEquationAccumulator >(
+                                *arcWiseNormalEquationAccumulator );
+                }
             }
 
 
             // Increment number of iterations
             numberOfIterations++;
 
+            // Write checkpoint from which the next iteration can be started
+            if( checkpointDirectory != "" )
+            {
+                if( ( bestArcWiseNormalEquations != nullptr ) && ( bestInverseNormalizedCovarianceMatrix.rows( ) == 0 ) )
+                {
+                    bestInverseNormalizedCovarianceMatrix = getNormalizedInverseCovarianceFromArcWiseNormalEquations(
+                                bestArcWiseNormalEquations, bestTransformationData, podInput->getInverseOfAprioriCovariance( ) );
+                }
+
+                EstimationCheckpoint< ObservationScalarType > checkpoint;
+                checkpoint.numberOfIterations_ = numberOfIterations;
+                checkpoint.parameterEstimate_ = newParameterEstimate;
+                checkpoint.rmsResidualHistory_ = rmsResidualHistory;
+                checkpoint.bestResidual_ = bestResidual;
+                checkpoint.bestParameterEstimate_ = bestParameterEstimate;
+                checkpoint.bestResiduals_ = bestResiduals;
+                checkpoint.bestInformationMatrix_ = bestInformationMatrix;
+                checkpoint.bestTransformationData_ = bestTransformationData;
+                checkpoint.bestInverseNormalizedCovarianceMatrix_ = bestInverseNormalizedCovarianceMatrix;
+                writeEstimationCheckpointToFile( checkpoint, getEstimationCheckpointFileName( checkpointDirectory ) );
+            }
+
             // Check for convergence
-        } while( convergenceChecker->isEstimationConverged( numberOfIterations, rmsResidualHistory ) == false );
+            isEstimationConverged = convergenceChecker->isEstimationConverged( numberOfIterations, rmsResidualHistory );
+        }
 
         if( podInput->getPrintOutput( ) )
         {
             std::cout << "Final residual: " << bestResidual << std::endl;
         }
 
+        // Assemble inverse covariance of best iteration from arc-wise normal equations, if not yet done
+        if( ( bestArcWiseNormalEquations != nullptr ) && ( bestInverseNormalizedCovarianceMatrix.rows( ) == 0 ) )
+        {
+            bestInverseNormalizedCovarianceMatrix = getNormalizedInverseCovarianceFromArcWiseNormalEquations(
+                        bestArcWiseNormalEquations, bestTransformationData, podInput->getInverseOfAprioriCovariance( ) );
+            bestArcWiseNormalEquations.reset( );
+        }
+
 
         std::shared_ptr< PodOutput< ObservationScalarType, TimeType > > podOutput =
                 std::make_shared< PodOutput< ObservationScalarType, TimeType > >(
@@ -607,22 +1004,58 @@ public:
     //! Function to reset the current parameter estimate.
     /*!
      *  Function to reset the current parameter estimate; reintegrates the variational equations and equations of motion with new estimate.
+     *  The reintegration is skipped if none of the parameters that can influence the dynamics (see
+     *  estimatable_parameters::isParameterDynamicsProperty) differ from the values with which the dynamics (and, if
+     *  required, the variational equations) were last integrated by this object. In that case, only the parameter values
+     *  are reset (e.g. when only observation biases or ground station positions change).
      *  \param newParameterEstimate New estimate of parameter vector.
      *  \param reintegrateVariationalEquations Boolean denoting whether the variational equations are to be reintegrated
      */
     void resetParameterEstimate( const ParameterVectorType& newParameterEstimate, const bool reintegrateVariationalEquations = 1 )
     {
-        if( integrateAndEstimateOrbit_ )
+        if( integrateAndEstimateOrbit_ && isDynamicsPropagationRequired(
+                    newParameterEstimate, reintegrateVariationalEquations ) )
         {
+            // Invalidate propagated parameter values, in case propagation is not successful.
+            propagatedParameterEstimate_.resize( 0 );
             variationalEquationsSolver_->resetParameterEstimate( newParameterEstimate, reintegrateVariationalEquations );
+            propagatedParameterEstimate_ = newParameterEstimate;
+            areVariationalEquationsPropagated_ = reintegrateVariationalEquations;
         }
         else
         {
             parametersToEstimate_->template resetParameterValues< ObservationScalarType>( newParameterEstimate );
+            if( integrateAndEstimateOrbit_ )
+            {
+                numberOfSkippedDynamicsPropagations_++;
+            }
         }
         currentParameterEstimate_ = newParameterEstimate;
     }
 
+    //! Function to force the reintegration of the dynamics and variational equations on the next parameter reset
+    /*!
+     *  Function to force the reintegration of the dynamics and variational equations on the next call to
+     *  resetParameterEstimate, regardless of the change in parameter values. To be used if the environment or the
+     *  propagated dynamics have been modified by other means than this object.
+     */
+    void requireDynamicsPropagation( )
+    {
+        propagatedParameterEstimate_.resize( 0 );
+        areVariationalEquationsPropagated_ = false;
+    }
+
+    //! Function to retrieve the number of parameter resets for which the reintegration of the dynamics was skipped
+    /*!
+     *  Function to retrieve the number of calls to resetParameterEstimate for which the reintegration of the dynamics was
+     *  skipped, since none of the parameters that can influence the dynamics had changed.
+     *  \return Number of parameter resets for which the reintegration of the dynamics was skipped
+     */
+    int getNumberOfSkippedDynamicsPropagations( )
+    {
+        return numberOfSkippedDynamicsPropagations_;
+    }
+
     //! Function to convert from one representation of all measurement data to the other
     /*!
      *  Function to convert from one representation of all measurement data (AlternativePodInputType) to the other (PodInputType).
@@ -706,6 +1139,26 @@ public:
         return observationManagers_.at( observableType );
     }
 
+    //! Function to set the number of threads used to compute observations and partials
+    /*!
+     *  Function to set the number of threads used by each observation manager to compute observations and partials (see
+     *  ObservationManager::computeObservationsWithPartials). For each additional thread, a copy of each observation manager
+     *  is created from the observation settings (see createThreadLocalObservationManagers), so that each thread uses its own
+     *  light-time calculators and observation partials. All environment models used by the observation models must
+     *  support concurrent evaluation; this is not the case for ephemerides and rotation models that directly call Spice.
+     *  \param numberOfThreads Number of threads used to compute observations and partials (if 1, observations are computed
+     *  serially; if 0, the number of threads that can be executed concurrently on the current hardware is used).
+     */
+    void setNumberOfObservationThreads( const unsigned int numberOfThreads )
+    {
+        for( auto observablesIterator : observationSettingsMap_ )
+        {
+            observation_models::createThreadLocalObservationManagers< ObservationScalarType, TimeType >(
+                        observationManagers_.at( observablesIterator.first ), observablesIterator.second, bodyMap_,
+                        parametersToEstimate_, stateTransitionAndSensitivityMatrixInterface_, numberOfThreads );
+        }
+    }
+
     //! Function to retrieve the current paramater estimate.
     /*!
      *  Function to retrieve the current paramater estimate.
@@ -728,6 +1181,19 @@ public:
         return stateTransitionAndSensitivityMatrixInterface_;
     }
 
+    //! Function to retrieve the object used to share the partials of link end states between the observation managers
+    /*!
+     *  Function to retrieve the object used to share the partials of link end states w.r.t. the estimated parameters between
+     *  the observation partials of all observation managers. Partials w.r.t. the estimated (initial) Cartesian states are
+     *  constant, and are not shared, so that an estimation of only initial states does not benefit from this object (see
+     *  CartesianStatePartialCache).
+     *  \return Object used to share the partials of link end states between the observation managers.
+     */
+    std::shared_ptr< observation_partials::CartesianStatePartialCache > getCartesianStatePartialCache( )
+    {
+        return cartesianStatePartialCache_;
+    }
+
 protected:
 
     //! Function called by either constructor to initialize the object.
@@ -741,18 +1207,25 @@ protected:
      *  \param propagatorSettings Settings for propagator.
      *  \param propagateOnCreation Boolean denoting whether initial propagatoon is to be performed upon object creation (default
      *  true)
+     *  \param variationalEquationsSolver Existing object used to propagate the dynamics and variational equations. If
+     *  provided (default none), the integrator and propagator settings are not used.
      */
     void initializeOrbitDeterminationManager(
             const NamedBodyMap &bodyMap,
             const observation_models::SortedObservationSettingsMap& observationSettingsMap,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
-            const bool propagateOnCreation = true )
+            const bool propagateOnCreation = true,
+            const std::shared_ptr< propagators::VariationalEquationsSolver< ObservationScalarType, TimeType > >
+            variationalEquationsSolver = nullptr )
     {
         using namespace numerical_integrators;
         using namespace orbit_determination;
         using namespace observation_models;
 
+        bodyMap_ = bodyMap;
+        observationSettingsMap_ = observationSettingsMap;
+
         // Check if any dynamics is to be estimated
         std::map< propagators::IntegratedStateType, std::vector< std::pair< std::string, std::string > > >
                 initialDynamicalStates =
@@ -767,7 +1240,15 @@ protected:
             integrateAndEstimateOrbit_ = false;
         }
 
-        if( integrateAndEstimateOrbit_ )
+        if( variationalEquationsSolver != nullptr )
+        {
+            if( !integrateAndEstimateOrbit_ )
+            {
+                throw std::runtime_error( "Error, cannot use variational equations solver without estimating dynamics in OrbitDeterminationManager" );
+            }
+            variationalEquationsSolver_ = variationalEquationsSolver;
+        }
+        else if( integrateAndEstimateOrbit_ )
         {
             variationalEquationsSolver_ =
                     simulation_setup::createVariationalEquationsSolver(
@@ -789,7 +1270,8 @@ protected:
             throw std::runtime_error( "Error, cannot parse propagator settings without estimating dynamics in OrbitDeterminationManager" );
         }
 
-        // Iterate over all observables and create observation managers.
+        // Iterate over all observables and create observation managers, sharing the partials of link end states.
+        cartesianStatePartialCache_ = std::make_shared< observation_partials::CartesianStatePartialCache >( );
         for( SortedObservationSettingsMap::const_iterator observablesIterator = observationSettingsMap.begin( );
              observablesIterator != observationSettingsMap.end( ); observablesIterator++ )
         {
@@ -797,12 +1279,23 @@ protected:
             observationManagers_[ observablesIterator->first ] =
                     createObservationManagerBase< ObservationScalarType, TimeType >(
                         observablesIterator->first, observablesIterator->second, bodyMap, parametersToEstimate_,
-                        stateTransitionAndSensitivityMatrixInterface_ );
+                        stateTransitionAndSensitivityMatrixInterface_, true, cartesianStatePartialCache_ );
         }
 
         // Set current parameter estimate from body initial states and parameter set.
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
 
+        // Set parameters with which dynamics has been integrated (unknown if solver is provided, or not yet integrated)
+        dynamicsParameterIndices_ = estimatable_parameters::getIndicesOfParametersInfluencingDynamics(
+                    parametersToEstimate_ );
+        numberOfSkippedDynamicsPropagations_ = 0;
+        requireDynamicsPropagation( );
+        if( integrateAndEstimateOrbit_ && ( variationalEquationsSolver == nullptr ) && propagateOnCreation )
+        {
+            propagatedParameterEstimate_ = currentParameterEstimate_;
+            areVariationalEquationsPropagated_ = true;
+        }
+
         //        std::map< int, std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > > doubleParameters =
         //                parametersToEstimate_->getDoubleParameters( );
         //        for( std::map< int, std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > >::iterator
@@ -832,6 +1325,42 @@ protected:
 
     }
 
+    //! Function to determine whether the dynamics need to be reintegrated for a new parameter estimate
+    /*!
+     *  Function to determine whether the dynamics need to be reintegrated for a new parameter estimate, which is the case if
+     *  any of the parameters that can influence the dynamics differs from the values with which the dynamics were last
+     *  integrated (or if these are unknown), or if the variational equations are required, but were not integrated with
+     *  these values.
+     *  \param newParameterEstimate New estimate of parameter vector.
+     *  \param reintegrateVariationalEquations Boolean denoting whether the variational equations are to be reintegrated
+     *  \return True if the dynamics need to be reintegrated
+     */
+    bool isDynamicsPropagationRequired( const ParameterVectorType& newParameterEstimate,
+                                        const bool reintegrateVariationalEquations )
+    {
+        if( ( propagatedParameterEstimate_.rows( ) != newParameterEstimate.rows( ) ) ||
+                ( reintegrateVariationalEquations && !areVariationalEquationsPropagated_ ) )
+        {
+            return true;
+        }
+
+        for( unsigned int i = 0; i < dynamicsParameterIndices_.size( ); i++ )
+        {
+            if( newParameterEstimate( dynamicsParameterIndices_.at( i ) ) !=
+                    propagatedParameterEstimate_( dynamicsParameterIndices_.at( i ) ) )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Map of body objects with names of bodies, storing all environment models used in simulation.
+    NamedBodyMap bodyMap_;
+
+    //! Sets of observation model settings per link ends, from which observationManagers_ are created.
+    observation_models::SortedObservationSettingsMap observationSettingsMap_;
+
     //! Boolean to denote whether any dynamical parameters are estimated
     bool integrateAndEstimateOrbit_;
 
@@ -843,6 +1372,9 @@ protected:
     std::map< observation_models::ObservableType,
     std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > observationManagers_;
 
+    //! Object used to share the partials of link end states w.r.t. the estimated parameters between observationManagers_
+    std::shared_ptr< observation_partials::CartesianStatePartialCache > cartesianStatePartialCache_;
+
     //! Container object for all parameters that are to be estimated
     std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate_;
 
@@ -851,6 +1383,18 @@ protected:
 
     //std::vector< int > observationLinkParameterIndices_;
 
+    //! Indices of the entries of the vector of estimated parameters that can influence the dynamics
+    std::vector< int > dynamicsParameterIndices_;
+
+    //! Values of the vector of estimated parameters with which the dynamics were last integrated (empty if unknown)
+    ParameterVectorType propagatedParameterEstimate_;
+
+    //! Boolean denoting whether the variational equations were integrated with propagatedParameterEstimate_
+    bool areVariationalEquationsPropagated_;
+
+    //! Number of parameter resets for which the reintegration of the dynamics was skipped
+    int numberOfSkippedDynamicsPropagations_;
+
     //! Object used to interpolate the numerically integrated result of the state transition/sensitivity matrices.
     std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
     stateTransitionAndSensitivityMatrixInterface_;
@@ -23,24 +23,36 @@ template std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > ex
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< double, double > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 template std::pair< std::shared_ptr< PodOutput< long double > >, Eigen::VectorXd > executePlanetaryParameterEstimation< double, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< long double, double > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 template std::pair< std::shared_ptr< PodOutput< double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, double >(
         const int observableType ,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< double, Time > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 template std::pair< std::shared_ptr< PodOutput< long double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< long double, Time > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 #endif
 
 template Eigen::VectorXd executeEarthOrbiterParameterEstimation< double, double >(
@@ -48,7 +60,8 @@ template Eigen::VectorXd executeEarthOrbiterParameterEstimation< double, double
         const double startTime,
         const int numberOfDaysOfData,
         const int numberOfIterations,
-        const bool useFullParameterSet );
+        const bool useFullParameterSet,
+        const TestEstimationAccumulationMode accumulationMode );
 
 template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation< double, double >(
         const bool estimateRangeBiases,
@@ -56,7 +69,8 @@ template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation< d
         const bool useSingleBiasModel,
         const bool estimateAbsoluteBiases,
         const bool omitRangeData,
-        const bool useMultiArcBiases );
+        const bool useMultiArcBiases,
+        const bool perturbObservationParametersOnly );
 ;
 
 }
@@ -12,6 +12,8 @@
 #ifndef ORBITDETERMINATIONTESTCASES_H
 #define ORBITDETERMINATIONTESTCASES_H
 
+#include <functional>
+
 #include <boost/make_shared.hpp>
 
 #include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
@@ -39,6 +41,15 @@ using namespace tudat::basic_astrodynamics;
 using namespace tudat::coordinate_conversions;
 
 
+//! Manner in which the observation partials are processed in each iteration of a test estimation.
+enum TestEstimationAccumulationMode
+{
+    full_partials_matrix_accumulation,
+    normal_equations_accumulation,
+    square_root_information_accumulation,
+    sparse_partials_matrix_accumulation
+};
+
 Eigen::VectorXd getDefaultInitialParameterPerturbation( );
 
 template< typename TimeType = double, typename StateScalarType  = double >
@@ -46,7 +57,12 @@ std::pair< std::shared_ptr< PodOutput< StateScalarType, TimeType > >, Eigen::Vec
         const int observableType = 1,
         Eigen::VectorXd parameterPerturbation = getDefaultInitialParameterPerturbation( ),
         Eigen::MatrixXd inverseAPrioriCovariance  = Eigen::MatrixXd::Zero( 7, 7 ),
-        const double weight = 1.0 )
+        const double weight = 1.0,
+        const unsigned int numberOfObservationThreads = 1,
+        const std::function< void( const std::shared_ptr< PodInput< StateScalarType, TimeType > > ) >
+        podInputSettingsFunction = nullptr,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker =
+        std::make_shared< EstimationConvergenceChecker >( ) )
 {
     //Load spice kernels.
     spice_interface::loadStandardSpiceKernels( );
@@ -187,6 +203,10 @@ std::pair< std::shared_ptr< PodOutput< StateScalarType, TimeType > >, Eigen::Vec
             OrbitDeterminationManager< StateScalarType, TimeType >(
                 bodyMap, parametersToEstimate, observationSettingsMap,
                 integratorSettings, propagatorSettings );
+    if( numberOfObservationThreads != 1 )
+    {
+        orbitDeterminationManager.setNumberOfObservationThreads( numberOfObservationThreads );
+    }
 
 
     // Define observation times.
@@ -279,9 +299,15 @@ std::pair< std::shared_ptr< PodOutput< StateScalarType, TimeType > >, Eigen::Vec
     }
     podInput->defineEstimationSettings( true, true, false, false, false );
 
+    // Apply test-specific estimation settings
+    if( podInputSettingsFunction != nullptr )
+    {
+        podInputSettingsFunction( podInput );
+    }
+
     // Perform estimation
     std::shared_ptr< PodOutput< StateScalarType, TimeType > > podOutput = orbitDeterminationManager.estimateParameters(
-                podInput, std::make_shared< EstimationConvergenceChecker >( ) );
+                podInput, convergenceChecker );
 
     return std::make_pair( podOutput,
                            ( podOutput->parameterEstimate_.template cast< double >( ) -
@@ -293,24 +319,36 @@ extern template std::pair< std::shared_ptr< PodOutput< double > >, Eigen::Vector
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< double, double > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 extern template std::pair< std::shared_ptr< PodOutput< long double > >, Eigen::VectorXd > executePlanetaryParameterEstimation< double, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< long double, double > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 extern template std::pair< std::shared_ptr< PodOutput< double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, double >(
         const int observableType ,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< double, Time > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 extern template std::pair< std::shared_ptr< PodOutput< long double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const unsigned int numberOfObservationThreads,
+        const std::function< void( const std::shared_ptr< PodInput< long double, Time > > ) > podInputSettingsFunction,
+        const std::shared_ptr< EstimationConvergenceChecker > convergenceChecker );
 #endif
 
 
@@ -321,7 +359,8 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
         const TimeType startTime = TimeType( 1.0E7 ),
         const int numberOfDaysOfData = 3,
         const int numberOfIterations = 5,
-        const bool useFullParameterSet = true )
+        const bool useFullParameterSet = true,
+        const TestEstimationAccumulationMode accumulationMode = full_partials_matrix_accumulation )
 {
 
     //Load spice kernels.
@@ -622,6 +661,23 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
 
     podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     podInput->defineEstimationSettings( true, true, true, true, false );
+    switch( accumulationMode )
+    {
+    case full_partials_matrix_accumulation:
+        break;
+    case normal_equations_accumulation:
+        podInput->defineNormalEquationAccumulationSettings( true, 50, 2 );
+        break;
+    case square_root_information_accumulation:
+        podInput->defineSquareRootInformationFilterSettings( true, 50 );
+        break;
+    case sparse_partials_matrix_accumulation:
+        podInput->defineSparseDesignMatrixSettings( true, 50 );
+        break;
+    default:
+        throw std::runtime_error( "Error, accumulation mode " + std::to_string( accumulationMode ) +
+                                  " not recognized in test estimation" );
+    }
 
     // Perform estimation
     std::shared_ptr< PodOutput< StateScalarType > > podOutput = orbitDeterminationManager.estimateParameters(
@@ -640,12 +696,18 @@ extern template Eigen::VectorXd executeEarthOrbiterParameterEstimation< double,
         const double startTime,
         const int numberOfDaysOfData,
         const int numberOfIterations,
-        const bool useFullParameterSet );
+        const bool useFullParameterSet,
+        const TestEstimationAccumulationMode accumulationMode );
 
 
 
 
 //! Test the estimation of observation biases.
+/*!
+ *  Test the estimation of observation biases. If perturbObservationParametersOnly is true, only the biases are perturbed
+ *  w.r.t. the values used to simulate the observations, and the estimation is also denoted as unsuccessful if the
+ *  reintegration of the dynamics on the first iteration was not skipped.
+ */
 template< typename TimeType = double, typename StateScalarType  = double >
 std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
         const bool estimateRangeBiases = true,
@@ -653,7 +715,8 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
         const bool useSingleBiasModel = true,
         const bool estimateAbsoluteBiases = true,
         const bool omitRangeData = false,
-        const bool useMultiArcBiases = false )
+        const bool useMultiArcBiases = false,
+        const bool perturbObservationParametersOnly = false )
 {
 
     const int numberOfDaysOfData = 1;
@@ -1036,8 +1099,11 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
 
     if( numberOfIterations > 0 )
     {
-        parameterPerturbation.segment( 0, 3 ) = Eigen::Vector3d::Constant( 1.0 );
-        parameterPerturbation.segment( 3, 3 ) = Eigen::Vector3d::Constant( 1.E-3 );
+        if( !perturbObservationParametersOnly )
+        {
+            parameterPerturbation.segment( 0, 3 ) = Eigen::Vector3d::Constant( 1.0 );
+            parameterPerturbation.segment( 3, 3 ) = Eigen::Vector3d::Constant( 1.E-3 );
+        }
 
         for( unsigned int i = 6; i < initialParameterEstimate.rows( ); i++ )
         {
@@ -1087,7 +1153,9 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
 
     return std::make_pair( estimationError,
                            ( podOutput->exceptionDuringInversion_ ||
-                             !( podOutput->getUnnormalizedCovarianceMatrix( ) == podOutput->getUnnormalizedCovarianceMatrix( ) ) ) );
+                             !( podOutput->getUnnormalizedCovarianceMatrix( ) == podOutput->getUnnormalizedCovarianceMatrix( ) ) ||
+                             ( perturbObservationParametersOnly &&
+                               ( orbitDeterminationManager.getNumberOfSkippedDynamicsPropagations( ) == 0 ) ) ) );
 }
 
 extern template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation< double, double >(
@@ -1096,7 +1164,8 @@ extern template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstima
         const bool useSingleBiasModel,
         const bool estimateAbsoluteBiases,
         const bool omitRangeData,
-        const bool useMultiArcBiases );
+        const bool useMultiArcBiases,
+        const bool perturbObservationParametersOnly );
 
 }
 
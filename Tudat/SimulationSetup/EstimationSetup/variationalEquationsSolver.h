@@ -17,6 +17,7 @@
 #include <boost/tuple/tuple_io.hpp>
 
 #include "Tudat/Basics/utilities.h"
+#include "Tudat/Basics/parallelExecution.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
@@ -1050,6 +1051,7 @@ public:
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, parametersToEstimate, clearNumericalSolution ),
         propagatorSettings_( std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings ) ),
+        numberOfThreads_( 1 ),
         resetMultiArcDynamicsAfterPropagation_( resetMultiArcDynamicsAfterPropagation )
     {
         if(  std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings ) == nullptr )
@@ -1059,6 +1061,9 @@ public:
         checkMultiArcPropagatorSettingsAndParameterEstimationConsistency(
                     propagatorSettings_, parametersToEstimate, arcStartTimes );
 
+        threadPropagatorSettings_.push_back( propagatorSettings_ );
+        threadParametersToEstimate_.push_back( parametersToEstimate );
+
         parameterVectorSize_ = estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate );
 
         stateTransitionMatrixSize_ -= ( parametersToEstimate->getParameterSetSize( ) -
@@ -1068,49 +1073,101 @@ public:
                     bodyMap, integratorSettings, propagatorSettings, arcStartTimes,
                     false, clearNumericalSolution, resetMultiArcDynamicsAfterPropagation_ );
 
+        createArcVariationalEquations( { bodyMap }, arcStartTimes );
 
-        std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
-                dynamicsSimulator_->getSingleArcDynamicsSimulators( );
-
-        if( arcStartTimes.size( ) != singleArcDynamicsSimulators.size( ) )
+        // Integrate variational equations from initial state estimate.
+        if( integrateEquationsOnCreation )
         {
-            throw std::runtime_error( "Error when making multi-arc variational equartions solver, input is inconsistent" );
+            if( integrateDynamicalAndVariationalEquationsConcurrently )
+            {
+                integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStateList( ) , 1 );
+            }
+            else
+            {
+                integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStateList( ), 0 );
+            }
         }
+    }
 
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
+    //! Constructor for concurrent propagation of arcs
+    /*!
+     *  Constructor, sets up object for automatic evaluation and numerical integration of variational equations and equations
+     *  of motion, with the arcs distributed over a number of threads. Since the environment, state derivative models and
+     *  estimated parameters are not thread-safe, each thread requires its own, independently (but identically) created,
+     *  set of body map, propagator settings and estimated parameters. Arc i is propagated on thread ( i % numberOfThreads ),
+     *  and its variational equations are set up from the models of that thread. The first entry of each list is the primary
+     *  one, which is used by the base class (and should be used for e.g. creating observation models and partials). When
+     *  resetting the parameter estimate, the new values are set for all threads. Dynamics and variational equations are
+     *  always propagated concurrently in this mode, and the results are identical to those of the serial solver.
+     *  NOTE: the environment models must not use global, non-thread-safe resources (such as direct SPICE calls)
+     *  during the propagation.
+     *  \param threadBodyMaps List of maps of bodies (one per thread).
+     *  \param integratorSettings Settings for numerical integrator (copied for each arc).
+     *  \param threadPropagatorSettings List of (multi-arc) propagator settings (one per thread, created using the body map
+     *  of the same thread).
+     *  \param threadParametersToEstimate List of parameter sets that are to be estimated (one per thread, created using the
+     *  body map of the same thread).
+     *  \param arcStartTimes Start times for separate arcs
+     *  \param clearNumericalSolution Boolean to determine whether to clear the raw numerical solution member variables
+     *  (default true) after propagation and resetting of state transition interface.
+     *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
+     *  end of this contructor (default false).
+     *  \param resetMultiArcDynamicsAfterPropagation Boolean denoting whether to reset the multi-arc dynamics after
+     *  propagation (default true).
+     */
+    MultiArcVariationalEquationsSolver(
+            const std::vector< simulation_setup::NamedBodyMap >& threadBodyMaps,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const std::vector< std::shared_ptr< PropagatorSettings< StateScalarType > > >& threadPropagatorSettings,
+            const std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >&
+            threadParametersToEstimate,
+            const std::vector< double > arcStartTimes,
+            const bool clearNumericalSolution = true,
+            const bool integrateEquationsOnCreation = false,
+            const bool resetMultiArcDynamicsAfterPropagation = true ):
+        VariationalEquationsSolver< StateScalarType, TimeType >(
+            threadBodyMaps.at( 0 ), threadParametersToEstimate.at( 0 ), clearNumericalSolution ),
+        threadParametersToEstimate_( threadParametersToEstimate ),
+        numberOfThreads_( threadBodyMaps.size( ) ),
+        resetMultiArcDynamicsAfterPropagation_( resetMultiArcDynamicsAfterPropagation )
+    {
+        if( threadPropagatorSettings.size( ) != numberOfThreads_ || threadParametersToEstimate.size( ) != numberOfThreads_ )
         {
-            dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
-            // Create variational equations objects.
-            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
-                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
-                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), bodyMap, parametersToEstimate );
-            std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
-                    std::make_shared< VariationalEquations >(
-                        stateDerivativePartials, parametersToEstimate_, dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ) );
-
-            dynamicsStateDerivatives_.at( i )->addVariationalEquations( variationalEquationsObject_ );
-            arcStartTimes_.push_back( arcStartTimes.at( i ) );
+            throw std::runtime_error( "Error when making parallel multi-arc variational equations solver, number of body maps, "
+                                      "propagator settings and parameter sets is inconsistent" );
         }
 
-        numberOfArcs_ = dynamicsStateDerivatives_.size( );
-        // Resize solution of variational equations to 2 (state transition and sensitivity matrices)
-        variationalEquationsSolution_.resize( numberOfArcs_ );
-        for( int i = 0; i < numberOfArcs_; i++ )
+        // Retrieve and check propagator settings for each thread
+        for( unsigned int i = 0; i < numberOfThreads_; i++ )
         {
-            variationalEquationsSolution_[ i ].resize( 2 );
+            std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > currentPropagatorSettings =
+                    std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >(
+                        threadPropagatorSettings.at( i ) );
+            if( currentPropagatorSettings == nullptr )
+            {
+                throw std::runtime_error( "Error when making parallel multi-arc variational equations solver, input is single-arc" );
+            }
+            checkMultiArcPropagatorSettingsAndParameterEstimationConsistency(
+                        currentPropagatorSettings, threadParametersToEstimate.at( i ), arcStartTimes );
+            threadPropagatorSettings_.push_back( currentPropagatorSettings );
         }
+        propagatorSettings_ = threadPropagatorSettings_.at( 0 );
+
+        parameterVectorSize_ = estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate_ );
+
+        stateTransitionMatrixSize_ -= ( parametersToEstimate_->getParameterSetSize( ) -
+                                        estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate_ ) );
+
+        dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
+                    threadBodyMaps, integratorSettings, threadPropagatorSettings, arcStartTimes,
+                    false, clearNumericalSolution, resetMultiArcDynamicsAfterPropagation_ );
+
+        createArcVariationalEquations( threadBodyMaps, arcStartTimes );
 
         // Integrate variational equations from initial state estimate.
         if( integrateEquationsOnCreation )
         {
-            if( integrateDynamicalAndVariationalEquationsConcurrently )
-            {
-                integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStateList( ) , 1 );
-            }
-            else
-            {
-                integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStateList( ), 0 );
-            }
+            integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStateList( ) , 1 );
         }
     }
 
@@ -1220,8 +1277,6 @@ public:
         if( integrateEquationsConcurrently )
         {
             // Allocate maps that stored numerical solution for equations of motion
-            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
-                    currentEquationsOfMotionNumericalSolutionsRaw;
             std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
                     equationsOfMotionNumericalSolutions;
             std::vector< std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > > >
@@ -1233,77 +1288,55 @@ public:
             dependentVariableHistorySolutions.resize( numberOfArcs_ );
             cumulativeComputationTimeHistorySolutions.resize( numberOfArcs_ );
 
-            // Integrate equations for all arcs.
-            for( int i = 0; i < numberOfArcs_; i++ )
+            // Check if any arc initial state is to be taken from the previous arc, in which case arcs are not independent.
+            bool areArcsIndependent = true;
+            for( int i = 1; i < numberOfArcs_; i++ )
             {
-                // Retrieve integrator settings, and ensure correct initial time.
-                std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
-                        singleArcDynamicsSimulators.at( i )->getIntegratorSettings( );
-                integratorSettings->initialTime_ = arcStartTimes_.at( i );
-
-                // Set state derivative model to propagate both variational equations and equations of motion
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->setPropagationSettings(
-                            std::vector< IntegratedStateType >( ), 1, 1 );
-
-
-                // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
-                // previous arc
-                VectorType currentArcInitialState;
-
-                if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
+                if( linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) )
                 {
-                    currentArcInitialState = initialStateEstimate.at( i );
+                    areArcsIndependent = false;
                 }
-                else
-                {
-                    currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                                equationsOfMotionNumericalSolutions.at( i - 1 ), arcStartTimes_.at( i ) );
-                    updateInitialStates = true;
-                }
-                arcInitialStates.push_back( currentArcInitialState );
-
-                // Update state derivative model to (possible) update in state.
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->
-                        template updateStateDerivativeModelSettings( currentArcInitialState );
-
-                // Create initial state for combined variational/equations of motion.
-                MatrixType initialVariationalState = this->createInitialConditions(
-                            currentArcInitialState );
-
-
-                // Integrate variational and state equations.
-                dynamicsSimulator_->getDynamicsStateDerivative( ).at( i )->resetFunctionEvaluationCounter( );
-                std::map< TimeType, MatrixType > rawNumericalSolution;
-                EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
-                            singleArcDynamicsSimulators.at( i )->getStateDerivativeFunction( ),
-                            rawNumericalSolution,
-                            initialVariationalState, integratorSettings,
-                            singleArcDynamicsSimulators.at( i )->getPropagationTerminationCondition( ),
-                            dependentVariableHistorySolutions.at( i ),
-                            cumulativeComputationTimeHistorySolutions.at( i ),
-                            singleArcDynamicsSimulators.at( i )->getDependentVariablesFunctions( ),
-                            std::bind(
-                                &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
-                                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
-
-                // Extract solution of equations of motion.
-                utilities::createVectorBlockMatrixHistory(
-                            rawNumericalSolution, currentEquationsOfMotionNumericalSolutionsRaw,
-                            std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
-
+            }
 
-                // Transform equations of motion solution to output formulation
-                convertNumericalStateSolutionsToOutputSolutions(
-                            equationsOfMotionNumericalSolutions[ i ], currentEquationsOfMotionNumericalSolutionsRaw,
-                            dynamicsStateDerivatives_.at( i ) );
-                arcStartTimes_[ i ] = equationsOfMotionNumericalSolutions[ i ].begin( )->first;
+            // Integrate equations for all arcs, in parallel if arcs are independent. Arc i is integrated by thread
+            // ( i % numberOfThreads_ ), which owns the environment used by the arc's models
+            if( numberOfThreads_ > 1 && areArcsIndependent )
+            {
+                utilities::executeParallelTasks(
+                            numberOfArcs_, numberOfThreads_,
+                            [ & ]( const unsigned int arcIndex, const unsigned int )
+                {
+                    integrateSingleArcVariationalAndDynamicalEquations(
+                                arcIndex, initialStateEstimate.at( arcIndex ),
+                                equationsOfMotionNumericalSolutions.at( arcIndex ),
+                                dependentVariableHistorySolutions.at( arcIndex ),
+                                cumulativeComputationTimeHistorySolutions.at( arcIndex ) );
+                } );
+            }
+            else
+            {
+                for( int i = 0; i < numberOfArcs_; i++ )
+                {
+                    // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
+                    // previous arc
+                    VectorType currentArcInitialState;
 
-                // Save state transition and sensitivity matrix solutions for current arc.
-                setVariationalEquationsSolution(
-                            rawNumericalSolution, variationalEquationsSolution_[ i ],
-                            std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
-                            stateTransitionMatrixSize_, parameterVectorSize_ );
+                    if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
+                    {
+                        currentArcInitialState = initialStateEstimate.at( i );
+                    }
+                    else
+                    {
+                        currentArcInitialState = getArcInitialStateFromPreviousArcResult(
+                                    equationsOfMotionNumericalSolutions.at( i - 1 ), arcStartTimes_.at( i ) );
+                        updateInitialStates = true;
+                    }
+                    arcInitialStates.push_back( currentArcInitialState );
 
+                    integrateSingleArcVariationalAndDynamicalEquations(
+                                i, currentArcInitialState, equationsOfMotionNumericalSolutions.at( i ),
+                                dependentVariableHistorySolutions.at( i ), cumulativeComputationTimeHistorySolutions.at( i ) );
+                }
             }
 
             // Process numerical solution of equations of motion
@@ -1312,12 +1345,6 @@ public:
                         resetMultiArcDynamicsAfterPropagation_ );
             equationsOfMotionNumericalSolutions.clear( );
 
-            if( updateInitialStates )
-            {
-                propagatorSettings_->resetInitialStatesList( arcInitialStates );
-                setPropagatorSettingsMultiArcStatesInEstimatedDynamicalParameters(
-                            parametersToEstimate_, propagatorSettings_ );
-            }
         }
         else
         {
@@ -1383,9 +1410,12 @@ public:
 
         if( updateInitialStates )
         {
-            propagatorSettings_->resetInitialStatesList( arcInitialStates );
-            setPropagatorSettingsMultiArcStatesInEstimatedDynamicalParameters(
-                        parametersToEstimate_, propagatorSettings_ );
+            for( unsigned int i = 0; i < numberOfThreads_; i++ )
+            {
+                threadPropagatorSettings_.at( i )->resetInitialStatesList( arcInitialStates );
+                setPropagatorSettingsMultiArcStatesInEstimatedDynamicalParameters(
+                            threadParametersToEstimate_.at( i ), threadPropagatorSettings_.at( i ) );
+            }
         }
 
         // Reset solution for state transition and sensitivity matrices.
@@ -1427,11 +1457,13 @@ public:
     void resetParameterEstimate( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > newParameterEstimate,
                                  const bool areVariationalEquationsToBeIntegrated = true )
     {
-        // Reset values of parameters.
-        parametersToEstimate_->template resetParameterValues< StateScalarType >( newParameterEstimate );
-        propagatorSettings_->resetInitialStates(
-                    estimatable_parameters::getInitialStateVectorOfBodiesToEstimate( parametersToEstimate_ ) );
-
+        // Reset values of parameters (for the models of each thread).
+        for( unsigned int i = 0; i < numberOfThreads_; i++ )
+        {
+            threadParametersToEstimate_.at( i )->template resetParameterValues< StateScalarType >( newParameterEstimate );
+            threadPropagatorSettings_.at( i )->resetInitialStates(
+                        estimatable_parameters::getInitialStateVectorOfBodiesToEstimate( threadParametersToEstimate_.at( i ) ) );
+        }
 
         // Check if re-integration of variational equations is requested
         if( areVariationalEquationsToBeIntegrated )
@@ -1469,11 +1501,138 @@ public:
         return arcStartTimes_;
     }
 
+    //! Function to retrieve the number of threads over which the arcs are distributed during propagation.
+    /*!
+     * Function to retrieve the number of threads over which the arcs are distributed during propagation.
+     * \return Number of threads over which the arcs are distributed during propagation.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
 
 protected:
 
 private:
 
+    //! Function to create the variational equations for each arc, and add them to the arcs' state derivative models.
+    /*!
+     *  Function to create the variational equations for each arc, and add them to the arcs' state derivative models. The
+     *  state derivative partials of arc i are created from the body map and estimated parameters of thread
+     *  ( i % numberOfThreads_ ).
+     *  \param threadBodyMaps List of maps of bodies (one per thread).
+     *  \param arcStartTimes Start times for separate arcs
+     */
+    void createArcVariationalEquations(
+            const std::vector< simulation_setup::NamedBodyMap >& threadBodyMaps,
+            const std::vector< double >& arcStartTimes )
+    {
+        std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( );
+
+        if( arcStartTimes.size( ) != singleArcDynamicsSimulators.size( ) )
+        {
+            throw std::runtime_error( "Error when making multi-arc variational equartions solver, input is inconsistent" );
+        }
+
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
+        {
+            unsigned int threadIndex = i % numberOfThreads_;
+
+            dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
+            // Create variational equations objects.
+            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
+                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
+                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), threadBodyMaps.at( threadIndex ),
+                        threadParametersToEstimate_.at( threadIndex ) );
+            std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
+                    std::make_shared< VariationalEquations >(
+                        stateDerivativePartials, threadParametersToEstimate_.at( threadIndex ),
+                        dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ) );
+
+            dynamicsStateDerivatives_.at( i )->addVariationalEquations( variationalEquationsObject_ );
+            arcStartTimes_.push_back( arcStartTimes.at( i ) );
+        }
+
+        numberOfArcs_ = dynamicsStateDerivatives_.size( );
+        // Resize solution of variational equations to 2 (state transition and sensitivity matrices)
+        variationalEquationsSolution_.resize( numberOfArcs_ );
+        for( int i = 0; i < numberOfArcs_; i++ )
+        {
+            variationalEquationsSolution_[ i ].resize( 2 );
+        }
+    }
+
+    //! Function to integrate variational equations and equations of motion for a single arc.
+    /*!
+     *  Function to integrate variational equations and equations of motion for a single arc. Only data of the current arc
+     *  is modified, so that this function can be called concurrently for different arcs.
+     *  \param arcIndex Index of arc that is to be propagated
+     *  \param arcInitialState Initial state of the equations of motion for the arc
+     *  \param equationsOfMotionNumericalSolution Numerical solution of equations of motion (returned by reference)
+     *  \param dependentVariableHistory History of dependent variables (returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation time (returned by reference)
+     */
+    void integrateSingleArcVariationalAndDynamicalEquations(
+            const int arcIndex,
+            const VectorType& arcInitialState,
+            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+            std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > >& dependentVariableHistory,
+            std::map< TimeType, double >& cumulativeComputationTimeHistory )
+    {
+        std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > singleArcDynamicsSimulator =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( ).at( arcIndex );
+
+        // Retrieve integrator settings, and ensure correct initial time.
+        std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
+                singleArcDynamicsSimulator->getIntegratorSettings( );
+        integratorSettings->initialTime_ = arcStartTimes_.at( arcIndex );
+
+        // Set state derivative model to propagate both variational equations and equations of motion
+        dynamicsStateDerivatives_.at( arcIndex )->setPropagationSettings(
+                    std::vector< IntegratedStateType >( ), 1, 1 );
+
+        // Update state derivative model to (possible) update in state.
+        dynamicsStateDerivatives_.at( arcIndex )->template updateStateDerivativeModelSettings( arcInitialState );
+
+        // Create initial state for combined variational/equations of motion.
+        MatrixType initialVariationalState = this->createInitialConditions( arcInitialState );
+
+        // Integrate variational and state equations.
+        dynamicsStateDerivatives_.at( arcIndex )->resetFunctionEvaluationCounter( );
+        std::map< TimeType, MatrixType > rawNumericalSolution;
+        EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
+                    singleArcDynamicsSimulator->getStateDerivativeFunction( ),
+                    rawNumericalSolution,
+                    initialVariationalState, integratorSettings,
+                    singleArcDynamicsSimulator->getPropagationTerminationCondition( ),
+                    dependentVariableHistory,
+                    cumulativeComputationTimeHistory,
+                    singleArcDynamicsSimulator->getDependentVariablesFunctions( ),
+                    std::bind(
+                        &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
+                        dynamicsStateDerivatives_.at( arcIndex ), std::placeholders::_1 ) );
+
+        // Extract solution of equations of motion.
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw;
+        utilities::createVectorBlockMatrixHistory(
+                    rawNumericalSolution, equationsOfMotionNumericalSolutionRaw,
+                    std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
+
+        // Transform equations of motion solution to output formulation
+        convertNumericalStateSolutionsToOutputSolutions(
+                    equationsOfMotionNumericalSolution, equationsOfMotionNumericalSolutionRaw,
+                    dynamicsStateDerivatives_.at( arcIndex ) );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution.begin( )->first;
+
+        // Save state transition and sensitivity matrix solutions for current arc.
+        setVariationalEquationsSolution(
+                    rawNumericalSolution, variationalEquationsSolution_[ arcIndex ],
+                    std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
+                    stateTransitionMatrixSize_, parameterVectorSize_ );
+    }
+
     //! Reset solutions of variational equations.
     /*!
      *  Reset solutions of variational equations (stateTransitionMatrixInterpolator_ and sensitivityMatrixInterpolator_) for each
@@ -1539,6 +1698,16 @@ private:
     //! Settings for propagation of equations of motion.
     std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > propagatorSettings_;
 
+    //! Settings for propagation of equations of motion, for each thread (first entry equal to propagatorSettings_).
+    std::vector< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > > threadPropagatorSettings_;
+
+    //! Parameters that are to be estimated, for each thread (first entry equal to parametersToEstimate_).
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >
+    threadParametersToEstimate_;
+
+    //! Number of threads over which the arcs are distributed during propagation (1 for serial propagation).
+    unsigned int numberOfThreads_;
+
     //! State derivative models for each arc (retrieved from dynamicsSimulator_).
     std::vector< std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > > dynamicsStateDerivatives_;
 
@@ -72,17 +72,23 @@ public:
      *  Constructor to set maximum degree and order that is to be taken into account.
      *  \param maximumDegree Maximum degree
      *  \param maximumOrder Maximum order
+     *  \param useBlockedKernel Boolean denoting whether the blocked spherical harmonics kernel is to be used to compute
+     *  the acceleration, which is considerably faster for high degree and order (default false).
      */
     SphericalHarmonicAccelerationSettings( const int maximumDegree,
-                                           const int maximumOrder ):
+                                           const int maximumOrder,
+                                           const bool useBlockedKernel = false ):
         AccelerationSettings( basic_astrodynamics::spherical_harmonic_gravity ),
-        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ){ }
+        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ), useBlockedKernel_( useBlockedKernel ){ }
 
     //! Maximum degree that is to be used for spherical harmonic acceleration
     int maximumDegree_;
 
     //! Maximum order that is to be used for spherical harmonic acceleration
     int maximumOrder_;
+
+    //! Boolean denoting whether the blocked spherical harmonics kernel is to be used to compute the acceleration
+    bool useBlockedKernel_;
 };
 
 //! Class for providing acceleration settings for mutual spherical harmonics acceleration model.
@@ -374,6 +374,7 @@ createSphericalHarmonicsGravityAcceleration(
                       std::bind( &Body::getPosition, bodyExertingAcceleration ),
                       std::bind( &Body::getCurrentRotationToGlobalFrame,
                                    bodyExertingAcceleration ), useCentralBodyFixedFrame );
+            accelerationModel->setUseBlockedSphericalHarmonicsKernel( sphericalHarmonicsSettings->useBlockedKernel_ );
         }
     }
     return accelerationModel;
@@ -19,6 +19,7 @@
 
 #include "Tudat/Basics/tudatTypeTraits.h"
 #include "Tudat/Basics/utilities.h"
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
@@ -506,6 +507,7 @@ public:
         // Empty solution maps
         equationsOfMotionNumericalSolution_.clear( );
         equationsOfMotionNumericalSolutionRaw_.clear( );
+        clearMapOutput( );
 
         // Reset functions
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
@@ -515,6 +517,35 @@ public:
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
 
+        // Set up streaming of results to output sink, if required
+        std::shared_ptr< PropagationOutputSink > outputSink = propagatorSettings_->getOutputSink( );
+        std::function< Eigen::VectorXd( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&, const TimeType ) >
+                stateOutputConversionFunction;
+        if( outputSink != nullptr )
+        {
+            if( this->setIntegratedResult_ )
+            {
+                throw std::runtime_error( "Error in dynamics simulator, cannot set integrated result in environment when "
+                                          "propagation results are streamed to an output sink." );
+            }
+
+            outputSink->setDependentVariableIds( dependentVariableIds_ );
+            std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative =
+                    dynamicsStateDerivative_;
+            stateOutputConversionFunction = [ = ](
+                    const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& rawState, const TimeType time )
+            {
+                return Eigen::VectorXd(
+                            dynamicsStateDerivative->convertToOutputSolution( rawState, time ).template cast< double >( ) );
+            };
+        }
+
+        // Compute state derivatives during integration without returning them by value (if supported by integrator).
+        std::function< void( const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                             Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& ) > stateDerivativeInPlaceFunction =
+                std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::computeStateDerivativeInPlace,
+                           dynamicsStateDerivative_, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 );
+
         // Integrate equations of motion numerically.
         resetPropagationTerminationConditions( );
         propagationTerminationReason_ =
@@ -528,7 +559,10 @@ public:
                     dependentVariablesFunctions_,
                     statePostProcessingFunction_,
                     propagatorSettings_->getPrintInterval( ),
-                    initialClockTime_ );
+                    initialClockTime_,
+                    outputSink,
+                    stateOutputConversionFunction,
+                    stateDerivativeInPlaceFunction );
 
         // Convert numerical solution to conventional state
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
@@ -552,42 +586,103 @@ public:
 
     //! Function to return the map of state history of numerically integrated bodies.
     /*!
-     * Function to return the map of state history of numerically integrated bodies.
+     * Function to return the map of state history of numerically integrated bodies. The map is created from the columnar
+     * storage upon the first call after a propagation, and retained for subsequent calls.
      * \return Map of state history of numerically integrated bodies.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolution( )
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
     {
-        return equationsOfMotionNumericalSolution_;
+        if( !isEquationsOfMotionNumericalSolutionMapSet_ )
+        {
+            equationsOfMotionNumericalSolution_.fillMap( equationsOfMotionNumericalSolutionMap_ );
+            isEquationsOfMotionNumericalSolutionMapSet_ = true;
+        }
+        return equationsOfMotionNumericalSolutionMap_;
     }
 
     //! Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
     /*!
-     * Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
+     * Function to return the map of state history of numerically integrated bodies, in propagation coordinates. The map
+     * is created from the columnar storage upon the first call after a propagation, and retained for subsequent calls.
      * \return Map of state history of numerically integrated bodies, in propagation coordinates.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolutionRaw( )
+    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
     {
-        return equationsOfMotionNumericalSolutionRaw_;
+        if( !isEquationsOfMotionNumericalSolutionRawMapSet_ )
+        {
+            equationsOfMotionNumericalSolutionRaw_.fillMap( equationsOfMotionNumericalSolutionRawMap_ );
+            isEquationsOfMotionNumericalSolutionRawMapSet_ = true;
+        }
+        return equationsOfMotionNumericalSolutionRawMap_;
     }
 
     //! Function to return the map of dependent variable history that was saved during numerical propagation.
     /*!
-     * Function to return the map of dependent variable history that was saved during numerical propagation.
+     * Function to return the map of dependent variable history that was saved during numerical propagation. The map is
+     * created from the columnar storage upon the first call after a propagation, and retained for subsequent calls.
      * \return Map of dependent variable history that was saved during numerical propagation.
      */
-    std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
+    const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
     {
-        return dependentVariableHistory_;
+        if( !isDependentVariableHistoryMapSet_ )
+        {
+            dependentVariableHistory_.fillMap( dependentVariableHistoryMap_ );
+            isDependentVariableHistoryMapSet_ = true;
+        }
+        return dependentVariableHistoryMap_;
     }
 
     //! Function to return the map of cumulative computation time history that was saved during numerical propagation.
     /*!
-     * Function to return the map of cumulative computation time history that was saved during numerical propagation.
+     * Function to return the map of cumulative computation time history that was saved during numerical propagation. The
+     * map is created from the columnar storage upon the first call after a propagation, and retained for subsequent calls.
      * \return Map of cumulative computation time history that was saved during numerical propagation.
      */
-    std::map< TimeType, double > getCumulativeComputationTimeHistory( )
+    const std::map< TimeType, double >& getCumulativeComputationTimeHistory( )
     {
-        return cumulativeComputationTimeHistory_;
+        if( !isCumulativeComputationTimeHistoryMapSet_ )
+        {
+            cumulativeComputationTimeHistory_.fillMap( cumulativeComputationTimeHistoryMap_ );
+            isCumulativeComputationTimeHistoryMapSet_ = true;
+        }
+        return cumulativeComputationTimeHistoryMap_;
+    }
+
+    //! Function to return the state history of numerically integrated bodies, as stored during propagation.
+    /*!
+     * Function to return the state history of numerically integrated bodies, in contiguous (columnar) storage, in the
+     * order in which the states were computed. Unlike getEquationsOfMotionNumericalSolution, no copy is made.
+     * \return State history of numerically integrated bodies.
+     */
+    const utilities::ColumnarStateHistory< TimeType, StateScalarType >& getColumnarEquationsOfMotionNumericalSolution( )
+    {
+        return equationsOfMotionNumericalSolution_;
+    }
+
+    //! Function to return the state history of numerically integrated bodies in propagation coordinates, as stored
+    //! during propagation.
+    /*!
+     * Function to return the state history of numerically integrated bodies in propagation coordinates, in contiguous
+     * (columnar) storage, in the order in which the states were computed. Unlike
+     * getEquationsOfMotionNumericalSolutionRaw, no copy is made.
+     * \return State history of numerically integrated bodies, in propagation coordinates.
+     */
+    const utilities::ColumnarStateHistory< TimeType, StateScalarType >& getColumnarEquationsOfMotionNumericalSolutionRaw( )
+    {
+        return equationsOfMotionNumericalSolutionRaw_;
+    }
+
+    //! Function to return the dependent variable history that was saved during numerical propagation, as stored during
+    //! propagation.
+    /*!
+     * Function to return the dependent variable history that was saved during numerical propagation, in contiguous
+     * (columnar) storage, in the order in which the dependent variables were computed. Unlike getDependentVariableHistory,
+     * no copy is made.
+     * \return Dependent variable history that was saved during numerical propagation.
+     */
+    const utilities::ColumnarStateHistory< TimeType, double >& getColumnarDependentVariableHistory( )
+    {
+        return dependentVariableHistory_;
     }
 
     //! Function to return the map of number of cumulative function evaluations that was saved during numerical propagation.
@@ -646,13 +741,14 @@ public:
             const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
             const bool processSolution = true )
     {
-        equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
+        equationsOfMotionNumericalSolution_.setFromMap( equationsOfMotionNumericalSolution );
+        dependentVariableHistory_.setFromMap( dependentVariableHistory );
+        clearMapOutput( );
+
         if( processSolution )
         {
             processNumericalEquationsOfMotionSolution( );
         }
-
-        dependentVariableHistory_ = dependentVariableHistory;
     }
 
     //! Function to get the settings for the numerical integrator.
@@ -830,6 +926,7 @@ public:
         {
             equationsOfMotionNumericalSolution_.clear( );
             equationsOfMotionNumericalSolutionRaw_.clear( );
+            clearMapOutput( );
         }
 
         for( simulation_setup::NamedBodyMap::const_iterator
@@ -842,6 +939,20 @@ public:
 
 protected:
 
+    //! Function to clear the maps with the propagation results, after the (columnar) results have been modified
+    void clearMapOutput( )
+    {
+        equationsOfMotionNumericalSolutionMap_.clear( );
+        equationsOfMotionNumericalSolutionRawMap_.clear( );
+        dependentVariableHistoryMap_.clear( );
+        cumulativeComputationTimeHistoryMap_.clear( );
+
+        isEquationsOfMotionNumericalSolutionMapSet_ = false;
+        isEquationsOfMotionNumericalSolutionRawMapSet_ = false;
+        isDependentVariableHistoryMapSet_ = false;
+        isCumulativeComputationTimeHistoryMapSet_ = false;
+    }
+
     //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
     std::map< IntegratedStateType, std::vector< std::shared_ptr<
     IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
@@ -896,29 +1007,55 @@ protected:
     //! Object for retrieving ephemerides for transformation of reference frame (origins)
     std::shared_ptr< ephemerides::ReferenceFrameManager > frameManager_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! State history of numerically integrated bodies.
     /*!
-     *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
-     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Key of map denotes time,
-     *  values are concatenated vectors of integrated body states (order defined by propagatorSettings_).
-     *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+     *  State history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
+     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution), stored contiguously in the
+     *  order of propagation. Entries are concatenated vectors of integrated body states (order defined by
+     *  propagatorSettings_).
+     *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution_;
+    utilities::ColumnarStateHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolution_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! State history of numerically integrated bodies, in propagation coordinates.
     /*!
-    *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, in the
-    *  original propagation coordinates. Key of map denotes time, values are concatenated vectors of integrated body
-    * states (order defined by propagatorSettings_).
-    *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+    *  State history of numerically integrated bodies, i.e. the result of the numerical integration, in the
+    *  original propagation coordinates, stored contiguously in the order of propagation. Entries are concatenated vectors
+    *  of integrated body states (order defined by propagatorSettings_).
+    *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
     */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw_;
+    utilities::ColumnarStateHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw_;
+
+    //! Dependent variable history that was saved during numerical propagation.
+    utilities::ColumnarStateHistory< TimeType, double > dependentVariableHistory_;
+
+    //! Cumulative computation time history that was saved during numerical propagation.
+    utilities::ColumnarStateHistory< TimeType, double > cumulativeComputationTimeHistory_;
+
+    //! Map of state history of numerically integrated bodies (created from equationsOfMotionNumericalSolution_ on request)
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionMap_;
+
+    //! Map of state history of numerically integrated bodies, in propagation coordinates (created from
+    //! equationsOfMotionNumericalSolutionRaw_ on request)
+    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRawMap_;
 
-    //! Map of dependent variable history that was saved during numerical propagation.
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+    //! Map of dependent variable history (created from dependentVariableHistory_ on request)
+    std::map< TimeType, Eigen::VectorXd > dependentVariableHistoryMap_;
 
-    //! Map of cumulative computation time history that was saved during numerical propagation.
-    std::map< TimeType, double > cumulativeComputationTimeHistory_;
+    //! Map of cumulative computation time history (created from cumulativeComputationTimeHistory_ on request)
+    std::map< TimeType, double > cumulativeComputationTimeHistoryMap_;
+
+    //! Boolean denoting whether equationsOfMotionNumericalSolutionMap_ is consistent with the current results
+    bool isEquationsOfMotionNumericalSolutionMapSet_ = false;
+
+    //! Boolean denoting whether equationsOfMotionNumericalSolutionRawMap_ is consistent with the current results
+    bool isEquationsOfMotionNumericalSolutionRawMapSet_ = false;
+
+    //! Boolean denoting whether dependentVariableHistoryMap_ is consistent with the current results
+    bool isDependentVariableHistoryMapSet_ = false;
+
+    //! Boolean denoting whether cumulativeComputationTimeHistoryMap_ is consistent with the current results
+    bool isCumulativeComputationTimeHistoryMapSet_ = false;
 
     //! Map of cumulative number of function evaluations that was saved during numerical propagation.
     std::map< TimeType, unsigned int > cumulativeNumberOfFunctionEvaluations_;
@@ -1054,7 +1191,7 @@ public:
             const bool clearNumericalSolutions = true,
             const bool setIntegratedResult = true ):
         DynamicsSimulator< StateScalarType, TimeType >(
-            bodyMap, clearNumericalSolutions, setIntegratedResult )
+            bodyMap, clearNumericalSolutions, setIntegratedResult ), numberOfThreads_( 1 )
     {
         multiArcPropagatorSettings_ =
                 std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings );
@@ -1064,6 +1201,8 @@ public:
         }
         else
         {
+            threadPropagatorSettings_.push_back( multiArcPropagatorSettings_ );
+
             std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > singleArcSettings =
                     multiArcPropagatorSettings_->getSingleArcSettings( );
 
@@ -1118,7 +1257,7 @@ public:
             const bool clearNumericalSolutions = true,
             const bool setIntegratedResult = true ):
         DynamicsSimulator< StateScalarType, TimeType >(
-            bodyMap, clearNumericalSolutions, setIntegratedResult )
+            bodyMap, clearNumericalSolutions, setIntegratedResult ), numberOfThreads_( 1 )
     {
         multiArcPropagatorSettings_ =
                 std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >( propagatorSettings );
@@ -1128,6 +1267,8 @@ public:
         }
         else
         {
+            threadPropagatorSettings_.push_back( multiArcPropagatorSettings_ );
+
             std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > singleArcSettings =
                     multiArcPropagatorSettings_->getSingleArcSettings( );
 
@@ -1160,6 +1301,100 @@ public:
         }
     }
 
+    //! Constructor of multi-arc simulator for same integration settings per arc, with arcs propagated in parallel.
+    /*!
+     *  Constructor of multi-arc simulator for same integration settings per arc, with arcs propagated in parallel. Since
+     *  the environment and state derivative models are not thread-safe, each worker thread requires its own copy of these
+     *  models. The user must therefore provide a list of body maps and (multi-arc) propagator settings, one per thread,
+     *  each created independently but identically (e.g. by calling the same set-up code multiple times). Arc i is
+     *  propagated on thread ( i % numberOfThreads ), using the body map and propagator settings of that thread. The
+     *  first entry of each list is the primary one: it is used by the base class, and its propagator settings
+     *  define the initial states. Results are processed into the body maps of all threads, so that they stay
+     *  consistent. The propagation results are identical to those obtained with a serial simulator. If arc initial
+     *  states are to be taken from the previous arc's solution, the arcs are propagated sequentially.
+     *  NOTE: the environment models must not use global, non-thread-safe resources (such as direct SPICE calls)
+     *  during the propagation.
+     *  \param threadBodyMaps List of maps of bodies (one per thread), with each body map containing an independent copy
+     *  of the environment.
+     *  \param integratorSettings Integrator settings for numerical integrator, used for all arcs (copied per arc).
+     *  \param threadPropagatorSettings List of propagator settings for dynamics (one per thread, each of multi arc type,
+     *  and created using the body map of the same thread)
+     *  \param arcStartTimes Times at which the separate arcs start
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     *  \param clearNumericalSolutions Boolean to determine whether to clear the raw numerical solution member variables
+     *  after propagation and resetting ephemerides (default true).
+     *  \param setIntegratedResult Boolean to determine whether to automatically use the integrated results to set
+     *  ephemerides (default true).
+     */
+    MultiArcDynamicsSimulator(
+            const std::vector< simulation_setup::NamedBodyMap >& threadBodyMaps,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const std::vector< std::shared_ptr< PropagatorSettings< StateScalarType > > >& threadPropagatorSettings,
+            const std::vector< double > arcStartTimes,
+            const bool areEquationsOfMotionToBeIntegrated = true,
+            const bool clearNumericalSolutions = true,
+            const bool setIntegratedResult = true ):
+        DynamicsSimulator< StateScalarType, TimeType >(
+            threadBodyMaps.at( 0 ), clearNumericalSolutions, setIntegratedResult ),
+        numberOfThreads_( threadBodyMaps.size( ) )
+    {
+        if( threadPropagatorSettings.size( ) != numberOfThreads_ )
+        {
+            throw std::runtime_error( "Error when creating parallel multi-arc dynamics simulator, number of body maps and "
+                                      "propagator settings is inconsistent" );
+        }
+
+        // Retrieve and check propagator settings for each thread
+        for( unsigned int i = 0; i < numberOfThreads_; i++ )
+        {
+            std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > currentPropagatorSettings =
+                    std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >(
+                        threadPropagatorSettings.at( i ) );
+            if( currentPropagatorSettings == nullptr )
+            {
+                throw std::runtime_error( "Error when creating parallel multi-arc dynamics simulator, input is not multi arc" );
+            }
+            else if( currentPropagatorSettings->getSingleArcSettings( ).size( ) != arcStartTimes.size( ) )
+            {
+                throw std::runtime_error( "Error when creating parallel multi-arc dynamics simulator, input is inconsistent" );
+            }
+            threadPropagatorSettings_.push_back( currentPropagatorSettings );
+        }
+        multiArcPropagatorSettings_ = threadPropagatorSettings_.at( 0 );
+
+        arcStartTimes_.resize( arcStartTimes.size( ) );
+
+        // Create dynamics simulators, with each arc using the environment of the thread on which it is propagated
+        for( unsigned int i = 0; i < arcStartTimes.size( ); i++ )
+        {
+            unsigned int threadIndex = i % numberOfThreads_;
+
+            // Copy integrator settings, as initial time is modified during propagation
+            std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > arcIntegratorSettings =
+                    integratorSettings->clone( );
+            arcIntegratorSettings->initialTime_ = arcStartTimes.at( i );
+
+            singleArcDynamicsSimulators_.push_back(
+                        std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                            threadBodyMaps.at( threadIndex ), arcIntegratorSettings,
+                            threadPropagatorSettings_.at( threadIndex )->getSingleArcSettings( ).at( i ),
+                            false, false, true ) );
+            singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
+        }
+
+        equationsOfMotionNumericalSolution_.resize( arcStartTimes.size( ) );
+        dependentVariableHistory_.resize( arcStartTimes.size( ) );
+        cumulativeComputationTimeHistory_.resize( arcStartTimes.size( ) );
+        propagationTerminationReasons_.resize( arcStartTimes.size( ) );
+
+        // Integrate equations of motion if required.
+        if( areEquationsOfMotionToBeIntegrated )
+        {
+            integrateEquationsOfMotion( multiArcPropagatorSettings_->getInitialStates( ) );
+        }
+    }
+
     //! Destructor
     ~MultiArcDynamicsSimulator( ) { }
 
@@ -1226,42 +1461,61 @@ public:
         std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
         bool updateInitialStates = false;
 
-        // Propagate dynamics for each arc
-        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        // Check if any arc initial state is to be taken from the previous arc, in which case arcs are not independent.
+        bool areArcsIndependent = true;
+        for( unsigned int i = 1; i < singleArcDynamicsSimulators_.size( ); i++ )
         {
-            // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from previous
-            // arc
-            if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
+            if( linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) )
             {
-                currentArcInitialState = initialStatesList.at( i );
+                areArcsIndependent = false;
             }
-            else
+        }
+
+        // Propagate independent arcs in parallel; arc i is propagated by thread ( i % numberOfThreads_ ), which owns the
+        // environment used by the arc's simulator
+        if( numberOfThreads_ > 1 && areArcsIndependent )
+        {
+            utilities::executeParallelTasks(
+                        singleArcDynamicsSimulators_.size( ), numberOfThreads_,
+                        [ & ]( const unsigned int arcIndex, const unsigned int )
+            {
+                integrateSingleArcEquationsOfMotion( arcIndex, initialStatesList.at( arcIndex ) );
+            } );
+        }
+        else
+        {
+            // Propagate dynamics for each arc
+            for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
             {
-                currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                            equationsOfMotionNumericalSolution_.at( i - 1 ),
-                            singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
+                // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
+                // previous arc
+                if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
+                {
+                    currentArcInitialState = initialStatesList.at( i );
+                }
+                else
+                {
+                    currentArcInitialState = getArcInitialStateFromPreviousArcResult(
+                                equationsOfMotionNumericalSolution_.at( i - 1 ),
+                                singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
 
-                // If arc initial state is taken from previous arc, this indicates that the initial states in propagator settings
-                // need to be updated.
-                updateInitialStates = true;
+                    // If arc initial state is taken from previous arc, this indicates that the initial states in propagator
+                    // settings need to be updated.
+                    updateInitialStates = true;
+                }
+                arcInitialStateList.push_back( currentArcInitialState );
+
+                integrateSingleArcEquationsOfMotion( i, currentArcInitialState );
             }
-            arcInitialStateList.push_back( currentArcInitialState );
-
-            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( currentArcInitialState );
-            equationsOfMotionNumericalSolution_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( ) );
-            dependentVariableHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( ) );
-            cumulativeComputationTimeHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getCumulativeComputationTimeHistory( ) );
-            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
-            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
         }
 
         if( updateInitialStates )
         {
-            multiArcPropagatorSettings_->resetInitialStatesList(
-                        arcInitialStateList );
+            for( unsigned int i = 0; i < threadPropagatorSettings_.size( ); i++ )
+            {
+                threadPropagatorSettings_.at( i )->resetInitialStatesList(
+                            arcInitialStateList );
+            }
         }
 
         if( this->setIntegratedResult_ )
@@ -1429,9 +1683,13 @@ public:
      */
     void processNumericalEquationsOfMotionSolution( )
     {
-        resetIntegratedMultiArcStatesWithEqualArcDynamics(
-                    equationsOfMotionNumericalSolution_,
-                    singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ), arcStartTimes_ );
+        // Process solution into environment of each thread (arc i uses environment of thread i)
+        for( unsigned int i = 0; i < numberOfThreads_ && i < singleArcDynamicsSimulators_.size( ); i++ )
+        {
+            resetIntegratedMultiArcStatesWithEqualArcDynamics(
+                        equationsOfMotionNumericalSolution_,
+                        singleArcDynamicsSimulators_.at( i )->getIntegratedStateProcessors( ), arcStartTimes_ );
+        }
 
         if( clearNumericalSolutions_ )
         {
@@ -1443,8 +1701,41 @@ public:
         }
     }
 
+    //! Function to retrieve the number of threads over which the arcs are distributed during propagation.
+    /*!
+     * Function to retrieve the number of threads over which the arcs are distributed during propagation.
+     * \return Number of threads over which the arcs are distributed during propagation.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
 protected:
 
+    //! Function to propagate a single arc, and store its results
+    /*!
+     *  Function to propagate a single arc, and store its results in the member variables of this object. Only the entries
+     *  of the current arc are modified, so that this function can be called concurrently for different arcs.
+     *  \param arcIndex Index of arc that is to be propagated
+     *  \param arcInitialState Initial state of the arc
+     */
+    void integrateSingleArcEquationsOfMotion(
+            const unsigned int arcIndex,
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& arcInitialState )
+    {
+        singleArcDynamicsSimulators_.at( arcIndex )->integrateEquationsOfMotion( arcInitialState );
+        singleArcDynamicsSimulators_.at( arcIndex )->getColumnarEquationsOfMotionNumericalSolution( ).fillMap(
+                    equationsOfMotionNumericalSolution_[ arcIndex ] );
+        singleArcDynamicsSimulators_.at( arcIndex )->getColumnarDependentVariableHistory( ).fillMap(
+                    dependentVariableHistory_[ arcIndex ] );
+        cumulativeComputationTimeHistory_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getCumulativeComputationTimeHistory( );
+        propagationTerminationReasons_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getPropagationTerminationReason( );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution_[ arcIndex ].begin( )->first;
+    }
+
     //! List of maps of state history of numerically integrated states.
     /*!
      *  List of maps of state history of numerically integrated states. Each entry in the list contains data on a single arc.
@@ -1468,6 +1759,12 @@ protected:
 
     //! Propagator settings used by this objec
     std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > multiArcPropagatorSettings_;
+
+    //! Propagator settings for each thread (first entry equal to multiArcPropagatorSettings_).
+    std::vector< std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > > threadPropagatorSettings_;
+
+    //! Number of threads over which the arcs are distributed during propagation (1 for serial propagation).
+    unsigned int numberOfThreads_;
 };
 
 //! Class for performing full numerical integration of a dynamical system, with a compbination of single and multi-arc propagations
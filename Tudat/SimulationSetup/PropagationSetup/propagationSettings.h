@@ -26,6 +26,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/propagationOutputSink.h"
 #include "Tudat/Astrodynamics/Propagators/rotationalMotionStateDerivative.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationOutputSettings.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTerminationSettings.h"
@@ -240,6 +241,28 @@ public:
         terminationSettings_ = terminationSettings;
     }
 
+    //! Function to retrieve the sink to which the propagation results are streamed during the propagation.
+    /*!
+     * Function to retrieve the sink to which the propagation results are streamed during the propagation.
+     * \return Sink to which the propagation results are streamed during the propagation (nullptr if none).
+     */
+    std::shared_ptr< PropagationOutputSink > getOutputSink( )
+    {
+        return outputSink_;
+    }
+
+    //! Function to set a sink to which the propagation results are streamed during the propagation.
+    /*!
+     * Function to set a sink to which the propagation results are streamed (in chunks) during the propagation, instead of
+     * storing the full state and dependent variable history in memory. When a sink is set, the dynamics simulator only
+     * retains the last chunk of the results, and cannot be used to set the integrated results in the environment.
+     * \param outputSink Sink to which the propagation results are to be streamed (nullptr for none).
+     */
+    void setOutputSink( const std::shared_ptr< PropagationOutputSink > outputSink )
+    {
+        outputSink_ = outputSink;
+    }
+
 protected:
 
     //!Type of state being propagated
@@ -255,6 +278,9 @@ protected:
     //! current state and time are to be printed to console (default never).
     double printInterval_;
 
+    //! Sink to which the propagation results are streamed during the propagation (default none).
+    std::shared_ptr< PropagationOutputSink > outputSink_;
+
 };
 
 //! Function to get the total size of multi-arc initial state vector
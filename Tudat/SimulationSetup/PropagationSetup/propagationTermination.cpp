@@ -131,7 +131,8 @@ std::shared_ptr< PropagationTerminationCondition > createPropagationTerminationC
                 std::dynamic_pointer_cast< PropagationTimeTerminationSettings >( terminationSettings );
         propagationTerminationCondition = std::make_shared< FixedTimePropagationTerminationCondition >(
                     timeTerminationSettings->terminationTime_, ( initialTimeStep > 0 ),
-                    timeTerminationSettings->terminateExactlyOnFinalCondition_ );
+                    timeTerminationSettings->terminateExactlyOnFinalCondition_,
+                    timeTerminationSettings->useDenseOutputForExactTermination_ );
         break;
     }
     case cpu_time_stopping_condition:
@@ -167,7 +168,8 @@ std::shared_ptr< PropagationTerminationCondition > createPropagationTerminationC
                     dependentVariableFunction, dependentVariableTerminationSettings->limitValue_,
                     dependentVariableTerminationSettings->useAsLowerLimit_,
                     dependentVariableTerminationSettings->terminateExactlyOnFinalCondition_,
-                    dependentVariableTerminationSettings->terminationRootFinderSettings_ );
+                    dependentVariableTerminationSettings->terminationRootFinderSettings_,
+                    dependentVariableTerminationSettings->useDenseOutputForExactTermination_ );
         break;
     }
     case custom_stopping_condition:
@@ -48,11 +48,15 @@ public:
      * \param terminationType Type of termination condition
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
+     * \param useDenseOutputForExactTermination Boolean to denote whether the exact final condition is to be located using the
+     * continuous extension (dense output) of the last integration step (if available).
      */
     PropagationTerminationCondition(
             const PropagationTerminationTypes terminationType,
-            const bool terminateExactlyOnFinalCondition = false ):
-        terminationType_( terminationType ), terminateExactlyOnFinalCondition_( terminateExactlyOnFinalCondition ){ }
+            const bool terminateExactlyOnFinalCondition = false,
+            const bool useDenseOutputForExactTermination = false ):
+        terminationType_( terminationType ), terminateExactlyOnFinalCondition_( terminateExactlyOnFinalCondition ),
+        useDenseOutputForExactTermination_( useDenseOutputForExactTermination ){ }
 
     //! Destructor
     virtual ~PropagationTerminationCondition( ){ }
@@ -87,6 +91,17 @@ public:
         return terminateExactlyOnFinalCondition_;
     }
 
+    //! Function to retrieve boolean to denote whether the exact final condition is to be located using dense output
+    /*!
+     *  Function to retrieve boolean to denote whether the exact final condition is to be located using the continuous
+     *  extension (dense output) of the last integration step (if available).
+     *  \return Boolean to denote whether the exact final condition is to be located using dense output
+     */
+    bool getUseDenseOutputForExactTermination( )
+    {
+        return useDenseOutputForExactTermination_;
+    }
+
 protected:
 
     //! Type of termination condition
@@ -96,6 +111,10 @@ protected:
     //! on the first step where it is violated.
     bool terminateExactlyOnFinalCondition_;
 
+    //! Boolean to denote whether the exact final condition is to be located using the continuous extension (dense output)
+    //! of the last integration step (if available).
+    bool useDenseOutputForExactTermination_;
+
 };
 
 //! Class for stopping the propagation after a fixed amount of time (i.e. for certain independent variable value)
@@ -111,12 +130,16 @@ public:
      * (if false) in time.
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
+     * \param useDenseOutputForExactTermination Boolean to denote whether the state at the stop time is to be computed from
+     * the continuous extension (dense output) of the last integration step (if available).
      */
     FixedTimePropagationTerminationCondition(
             const double stopTime,
             const bool propagationDirectionIsPositive,
-            const bool terminateExactlyOnFinalCondition = false ):
-        PropagationTerminationCondition( time_stopping_condition, terminateExactlyOnFinalCondition ),
+            const bool terminateExactlyOnFinalCondition = false,
+            const bool useDenseOutputForExactTermination = false ):
+        PropagationTerminationCondition( time_stopping_condition, terminateExactlyOnFinalCondition,
+                                         useDenseOutputForExactTermination ),
         stopTime_( stopTime ),
         propagationDirectionIsPositive_( propagationDirectionIsPositive ){ }
 
@@ -198,6 +221,8 @@ public:
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param useDenseOutputForExactTermination Boolean to denote whether the root finder is to evaluate the dependent variable
+     * on the continuous extension (dense output) of the last integration step (if available).
      */
     SingleVariableLimitPropagationTerminationCondition(
             const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
@@ -205,9 +230,10 @@ public:
             const double limitingValue,
             const bool useAsLowerBound,
             const bool terminateExactlyOnFinalCondition = false,
-            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr ):
+            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+            const bool useDenseOutputForExactTermination = false ):
         PropagationTerminationCondition(
-            dependent_variable_stopping_condition, terminateExactlyOnFinalCondition ),
+            dependent_variable_stopping_condition, terminateExactlyOnFinalCondition, useDenseOutputForExactTermination ),
         dependentVariableSettings_( dependentVariableSettings ), variableRetrievalFunction_( variableRetrievalFuntion ),
         limitingValue_( limitingValue ), useAsLowerBound_( useAsLowerBound ),
         terminationRootFinderSettings_( terminationRootFinderSettings )
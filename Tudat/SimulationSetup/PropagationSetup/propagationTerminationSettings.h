@@ -51,10 +51,15 @@ public:
      * \param terminationType Type of stopping condition that is to be used.
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
+     * \param useDenseOutputForExactTermination Boolean to denote whether the exact final condition is to be located using the
+     * continuous extension (dense output) of the last integration step, instead of by repeatedly re-taking the last step.
+     * Only used if terminateExactlyOnFinalCondition is true, and if the integrator provides dense output.
      */
     PropagationTerminationSettings( const PropagationTerminationTypes terminationType,
-                                    const bool terminateExactlyOnFinalCondition = false ):
-        terminationType_( terminationType ), terminateExactlyOnFinalCondition_( terminateExactlyOnFinalCondition ){ }
+                                    const bool terminateExactlyOnFinalCondition = false,
+                                    const bool useDenseOutputForExactTermination = false ):
+        terminationType_( terminationType ), terminateExactlyOnFinalCondition_( terminateExactlyOnFinalCondition ),
+        useDenseOutputForExactTermination_( useDenseOutputForExactTermination ){ }
 
     //! Destructor
     virtual ~PropagationTerminationSettings( ){ }
@@ -66,6 +71,10 @@ public:
     //! on the first step where it is violated.
     bool terminateExactlyOnFinalCondition_;
 
+    //! Boolean to denote whether the exact final condition is to be located using the continuous extension (dense output)
+    //! of the last integration step, instead of by repeatedly re-taking the last step.
+    bool useDenseOutputForExactTermination_;
+
 };
 
 //! Class for propagation stopping conditions settings: stopping the propagation after a fixed amount of time
@@ -83,10 +92,14 @@ public:
      * \param terminationTime Maximum time for the propagation, upon which the propagation is to be stopped
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
+     * \param useDenseOutputForExactTermination Boolean to denote whether the state at the termination time is to be computed
+     * from the continuous extension (dense output) of the last integration step, instead of by re-taking the last step.
      */
     PropagationTimeTerminationSettings( const double terminationTime,
-                                        const bool terminateExactlyOnFinalCondition = false ):
-        PropagationTerminationSettings( time_stopping_condition, terminateExactlyOnFinalCondition ),
+                                        const bool terminateExactlyOnFinalCondition = false,
+                                        const bool useDenseOutputForExactTermination = false ):
+        PropagationTerminationSettings( time_stopping_condition, terminateExactlyOnFinalCondition,
+                                        useDenseOutputForExactTermination ),
         terminationTime_( terminationTime ){ }
 
     //! Destructor
@@ -146,15 +159,19 @@ public:
      * \param terminateExactlyOnFinalCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param useDenseOutputForExactTermination Boolean to denote whether the root finder is to evaluate the dependent variable
+     * on the continuous extension (dense output) of the last integration step, instead of re-taking the last step for each
+     * iteration. In the former case, each iteration requires only a single update of the environment.
      */
     PropagationDependentVariableTerminationSettings(
             const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
             const double limitValue,
             const bool useAsLowerLimit,
             const bool terminateExactlyOnFinalCondition = false,
-            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr ):
+            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+            const bool useDenseOutputForExactTermination = false ):
         PropagationTerminationSettings(
-            dependent_variable_stopping_condition, terminateExactlyOnFinalCondition ),
+            dependent_variable_stopping_condition, terminateExactlyOnFinalCondition, useDenseOutputForExactTermination ),
         dependentVariableSettings_( dependentVariableSettings ),
         limitValue_( limitValue ), useAsLowerLimit_( useAsLowerLimit ),
         terminationRootFinderSettings_( terminationRootFinderSettings )
@@ -11,6 +11,7 @@
 #ifndef TUDAT_SETNUMERICALLYINTEGRATEDSTATES_H
 #define TUDAT_SETNUMERICALLYINTEGRATEDSTATES_H
 
+#include "Tudat/Basics/columnarStateHistory.h"
 #include "Tudat/Basics/utilities.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
@@ -191,6 +192,74 @@ void convertNumericalSolutionToEphemerisInput(
     }
 }
 
+//! Function to convert output of translational motion to input for the ephemeris, from columnar state history.
+/*!
+ * Function to convert output of translational motion from the numerical integrator to the required input for the
+ * ephemeris, with the numerical solution stored as columnar state history (in the order of propagation), so that no map
+ * of the full numerical solution needs to be created (see map-based overload).
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
+ * \param equationsOfMotionNumericalSolution Full numerical solution of numerical integrator,
+ * already converted to Cartesian states (w.r.t. the integration origin of the body of bodyIndex)
+ * \param ephemerisTable State history of body bodyIndex w.r.t. the origin with which its ephemeris is defined
+ * (returned by reference).
+ * \param integrationToEphemerisFrameFunction Function to provide the state of the ephemeris origin
+ * of the current body w.r.t. its integration origin.
+*/
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToEphemerisInput(
+        const int bodyIndex,
+        const int startIndex,
+        const utilities::ColumnarStateHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisTable,
+        const std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) >
+        integrationToEphemerisFrameFunction = nullptr )
+{
+    for( unsigned int i = 0; i < equationsOfMotionNumericalSolution.size( ); i++ )
+    {
+        const TimeType& currentTime = equationsOfMotionNumericalSolution.getTime( i );
+        if( integrationToEphemerisFrameFunction == nullptr )
+        {
+            ephemerisTable[ currentTime ] =
+                    equationsOfMotionNumericalSolution.getEntry( i ).block( startIndex + 6 * bodyIndex, 0, 6, 1 );
+        }
+        else
+        {
+            ephemerisTable[ currentTime ] =
+                    equationsOfMotionNumericalSolution.getEntry( i ).block( startIndex + 6 * bodyIndex, 0, 6, 1 ) -
+                    integrationToEphemerisFrameFunction( currentTime );
+        }
+    }
+}
+
+//! Function to retrieve the size of the entries of a numerical solution
+/*!
+ * Function to retrieve the size of the entries of a numerical solution, stored as map
+ * \param equationsOfMotionNumericalSolution Numerical solution (must be non-empty)
+ * 
+eturn Size of the entries of the numerical solution
+ */
+template< typename TimeType, typename StateScalarType >
+int getNumericalSolutionEntrySize(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution )
+{
+    return equationsOfMotionNumericalSolution.begin( )->second.rows( );
+}
+
+//! Function to retrieve the size of the entries of a numerical solution
+/*!
+ * Function to retrieve the size of the entries of a numerical solution, stored as columnar state history
+ * \param equationsOfMotionNumericalSolution Numerical solution
+ * 
+eturn Size of the entries of the numerical solution
+ */
+template< typename TimeType, typename StateScalarType >
+int getNumericalSolutionEntrySize(
+        const utilities::ColumnarStateHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution )
+{
+    return equationsOfMotionNumericalSolution.getNumberOfEntryRows( );
+}
+
 //! Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
 /*!
  * Function to extract the numerical solution for the translational dynamics of a single body from full propagation history.
@@ -200,18 +269,18 @@ void convertNumericalSolutionToEphemerisInput(
  * \param translationalStateStartIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start
  * \param bodyForWhichToRetrieveState Name of body for which the states are to be extracted
  * \param equationsOfMotionNumericalSolution Numerical solution of dynamics, with translational results in Cartesian elements
- * w.r.t. integratation origins.
+ * w.r.t. integratation origins (stored as map or as ColumnarStateHistory).
  * \param ephemerisInput State history of requested body (returned by reference)
  * \param bodyIndex Index of bodyForWhichToRetrieveState in bodiesToIntegrate (returned by reference)
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void getSingleBodyStateHistoryFromPropagationOutpiut(
         const std::vector< std::string >& bodiesToIntegrate,
         const int translationalStateStartIndex,
         const std::string& bodyForWhichToRetrieveState,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& ephemerisInput,
         int& bodyIndex,
         const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
@@ -251,17 +320,17 @@ void getSingleBodyStateHistoryFromPropagationOutpiut(
  * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the translational states start.
  * \param ephemerisUpdateOrder Order in which to update the ephemeris objects.
  * \param equationsOfMotionNumericalSolution Numerical solution of translational equations of
- * motion, in Cartesian elements w.r.t. integratation origins.
+ * motion, in Cartesian elements w.r.t. integratation origins (stored as map or as ColumnarStateHistory).
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void createAndSetInterpolatorsForEphemerides(
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::vector< std::string >& bodiesToIntegrate,
         const int startIndex,
         const std::vector< std::string >& ephemerisUpdateOrder,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
         integrationToEphemerisFrameFunctions =
         std::map< std::string, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
@@ -294,14 +363,14 @@ void createAndSetInterpolatorsForEphemerides(
  * equationsOfMotionNumericalSolution
  * \param ephemerisUpdateOrder Order in which to update the ephemeris objects (empty if arbitrary).
  * \param equationsOfMotionNumericalSolution Numerical solution of translational equations of
- * motion, in Cartesian elements w.r.t. integratation origins.
+ * motion, in Cartesian elements w.r.t. integratation origins (stored as map or as ColumnarStateHistory).
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void resetIntegratedEphemerides(
         const simulation_setup::NamedBodyMap& bodyMap,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate,
         const std::pair< unsigned int, unsigned int > startIndexAndSize,
         std::vector< std::string > ephemerisUpdateOrder = std::vector< std::string >( ),
@@ -320,7 +389,7 @@ void resetIntegratedEphemerides(
         throw std::runtime_error( "Error when resetting ephemerides, input vectors have inconsistent size" );
     }
     
-    if( static_cast< unsigned int >( equationsOfMotionNumericalSolution.begin( )->second.rows( ) )
+    if( static_cast< unsigned int >( getNumericalSolutionEntrySize( equationsOfMotionNumericalSolution ) )
             < startIndexAndSize.first + startIndexAndSize.second )
     {
         throw std::runtime_error( "Error when resetting ephemerides, input solution inconsistent with start index and size." );
@@ -333,7 +402,7 @@ void resetIntegratedEphemerides(
     }
     
     // Create interpolators from numerical integration results (states) at discrete times.
-    createAndSetInterpolatorsForEphemerides(
+    createAndSetInterpolatorsForEphemerides< TimeType, StateScalarType >(
                 bodyMap, bodiesToIntegrate, startIndexAndSize.first, ephemerisUpdateOrder,
                 equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
 }
@@ -498,6 +567,29 @@ void convertNumericalSolutionToRotationalEphemerisInput(
     }
 }
 
+//! Function to convert output of rotational motion to input for the rotational ephemeris, from columnar state history.
+/*!
+ * Function to convert output of rotational motion from the numerical integrator to the required input for the rotational
+ * ephemeris, with the numerical solution stored as columnar state history (see map-based overload).
+ * \param startIndex Index in entries of equationsOfMotionNumericalSolution where the rotational states start.
+ * \param bodyIndex Index of integrated body for which the state is to be retrieved
+ * \param ephemerisTable State history of body bodyIndex (returned by reference).
+ * \param equationsOfMotionNumericalSolution Full numerical solution of numerical integrator
+*/
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToRotationalEphemerisInput(
+        const int startIndex,
+        const int bodyIndex,
+        std::map< TimeType, Eigen::Matrix< StateScalarType, 7, 1 > >& ephemerisTable,
+        const utilities::ColumnarStateHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution )
+{
+    for( unsigned int i = 0; i < equationsOfMotionNumericalSolution.size( ); i++ )
+    {
+        ephemerisTable[ equationsOfMotionNumericalSolution.getTime( i ) ] =
+                equationsOfMotionNumericalSolution.getEntry( i ).block( startIndex + 7 * bodyIndex, 0, 7, 1 );
+    }
+}
+
 //! Function to create an interpolator for the new translational state of a body.
 /*!
  * Function to create an interpolator for the new translational state of a body.
@@ -526,14 +618,15 @@ createRotationalStateInterpolator(
  * \param bodyMap List of bodies used in simulations.
  * \param bodiesToIntegrate List of names of bodies for which rotational state is numerically integrated
  * \param startIndex Index in the state vector where the rotational state starts.
- * \param equationsOfMotionNumericalSolution New rotational state history that is to be set
+ * \param equationsOfMotionNumericalSolution New rotational state history that is to be set (stored as map or as
+ * ColumnarStateHistory)
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void createAndSetInterpolatorsForRotationalEphemerides(
         const simulation_setup::NamedBodyMap& bodyMap,
         const std::vector< std::string >& bodiesToIntegrate,
         const int startIndex,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution )
+        const NumericalSolutionType& equationsOfMotionNumericalSolution )
 {
     using namespace tudat::interpolators;
     
@@ -558,20 +651,21 @@ void createAndSetInterpolatorsForRotationalEphemerides(
  * Resets the rotational ephemerides of a set of bodies from the numerical integration results, and
  * performs associated computation for ephemeris-dependent environment variables.
  * \param bodyMap List of bodies used in simulations.
- * \param equationsOfMotionNumericalSolution Numerical solution of rotational equations of motion
+ * \param equationsOfMotionNumericalSolution Numerical solution of rotational equations of motion (stored as map or as
+ * ColumnarStateHistory)
  * \param bodiesToIntegrate List of names of bodies which are numerically integrated
  * \param startIndexAndSize Pair with start index and total (contiguous) size of integrated states in entries of
  * equationsOfMotionNumericalSolution
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void resetIntegratedRotationalEphemerides(
         const simulation_setup::NamedBodyMap& bodyMap,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate,
         const std::pair< unsigned int, unsigned int > startIndexAndSize )
 {
     // Create interpolators from numerical integration results (states) at discrete times.
-    createAndSetInterpolatorsForRotationalEphemerides(
+    createAndSetInterpolatorsForRotationalEphemerides< TimeType, StateScalarType >(
                 bodyMap, bodiesToIntegrate, startIndexAndSize.first, equationsOfMotionNumericalSolution );
     
     // Having set new ephemerides, update body properties depending on ephemerides.
@@ -583,20 +677,63 @@ void resetIntegratedRotationalEphemerides(
     }
 }
 
+//! Function to extract the mass history of a single body from the numerical solution.
+/*!
+ * Function to extract the mass history of a single body from the numerical solution, stored as map.
+ * \param stateIndex Index in entries of equationsOfMotionNumericalSolution where the mass of the body is stored.
+ * \param equationsOfMotionNumericalSolution Numerical solution of the body masses.
+ * \param bodyMassTable Mass history of the body (returned by reference).
+ */
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToBodyMassInput(
+        const int stateIndex,
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        std::map< double, double >& bodyMassTable )
+{
+    for( typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
+         stateIterator = equationsOfMotionNumericalSolution.begin( );
+         stateIterator != equationsOfMotionNumericalSolution.end( ); stateIterator++ )
+    {
+        bodyMassTable[ static_cast< double >( stateIterator->first ) ] =
+                static_cast< double >( stateIterator->second( stateIndex ) );
+    }
+}
+
+//! Function to extract the mass history of a single body from the numerical solution.
+/*!
+ * Function to extract the mass history of a single body from the numerical solution, stored as columnar state history.
+ * \param stateIndex Index in entries of equationsOfMotionNumericalSolution where the mass of the body is stored.
+ * \param equationsOfMotionNumericalSolution Numerical solution of the body masses.
+ * \param bodyMassTable Mass history of the body (returned by reference).
+ */
+template< typename TimeType, typename StateScalarType >
+void convertNumericalSolutionToBodyMassInput(
+        const int stateIndex,
+        const utilities::ColumnarStateHistory< TimeType, StateScalarType >& equationsOfMotionNumericalSolution,
+        std::map< double, double >& bodyMassTable )
+{
+    for( unsigned int i = 0; i < equationsOfMotionNumericalSolution.size( ); i++ )
+    {
+        bodyMassTable[ static_cast< double >( equationsOfMotionNumericalSolution.getTime( i ) ) ] =
+                static_cast< double >( equationsOfMotionNumericalSolution.getEntry( i )( stateIndex ) );
+    }
+}
+
 //! Resets the mass models of the integrated bodies from the numerical integration results.
 /*!
  * Resets the mass models of the integrated bodies from the numerical integration results.
  * \param bodyMap List of bodies used in simulations.
- * \param equationsOfMotionNumericalSolution Numerical solution of the body masses.
+ * \param equationsOfMotionNumericalSolution Numerical solution of the body masses (stored as map or as
+ * ColumnarStateHistory).
  * \param bodiesToIntegrate List of names of bodies for which mass is numerically integrated (in the order in
  * which they are in the equationsOfMotionNumericalSolution map.
  * \param startIndexAndSize Pair with start index and total (contiguous) size of integrated states in entries of
  * equationsOfMotionNumericalSolution
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void resetIntegratedBodyMass(
         const simulation_setup::NamedBodyMap& bodyMap,
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::vector< std::string >& bodiesToIntegrate ,
         const std::pair< unsigned int, unsigned int > startIndexAndSize )
 {
@@ -608,16 +745,10 @@ void resetIntegratedBodyMass(
     // Iterate over all bodies for which mass is propagated.
     for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
     {
-        std::map< double, double > currentBodyMassMap;
-        
         // Create mass map with double entries.
-        for( typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
-             stateIterator = equationsOfMotionNumericalSolution.begin( );
-             stateIterator != equationsOfMotionNumericalSolution.end( ); stateIterator++ )
-        {
-            currentBodyMassMap[ static_cast< double >( stateIterator->first ) ] =
-                    static_cast< double >( stateIterator->second( startIndexAndSize.first + i ) );
-        }
+        std::map< double, double > currentBodyMassMap;
+        convertNumericalSolutionToBodyMassInput(
+                    startIndexAndSize.first + i, equationsOfMotionNumericalSolution, currentBodyMassMap );
         
         typedef interpolators::OneDimensionalInterpolator< double, double > LocalInterpolator;
         
@@ -664,6 +795,20 @@ public:
     virtual void processIntegratedStates(
             const std::map< TimeType, Eigen::Matrix< StateScalarType,
             Eigen::Dynamic, 1 > >& numericalSolution ) = 0;
+
+    //! Function that processes the entries of the stateType_ in the full numericalSolution, stored as columnar history
+    /*!
+     * Function that processes the entries of the stateType_ in the full numericalSolution, stored as columnar state
+     * history. This base class implementation converts the solution to a map; derived classes may override it to process
+     * the columnar history directly.
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in associated SingleStateTypeDerivative derived class.
+     */
+    virtual void processIntegratedStates(
+            const utilities::ColumnarStateHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        processIntegratedStates( numericalSolution.createMap( ) );
+    }
     
     virtual void processIntegratedMultiArcStates(
             const std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >& numericalSolution,
@@ -742,6 +887,21 @@ public:
                     bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
                     integrationToEphemerisFrameFunctions_ );
     }
+
+    //! Function processing single-arc translational state, resetting bodies' ephemerides with new states
+    /*!
+     * Function processing single-arc translational state, resetting bodies' ephemerides with new states in numericalSolution
+     * variable, stored as columnar state history (see map-based overload).
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in NBodyStateDerivative class.
+     */
+    void processIntegratedStates(
+            const utilities::ColumnarStateHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedEphemerides< TimeType, StateScalarType >(
+                    bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
+                    integrationToEphemerisFrameFunctions_ );
+    }
     
     //! Function processing multi-arc translational state, resetting bodies' ephemerides with new states
     /*!
@@ -821,6 +981,20 @@ public:
         resetIntegratedRotationalEphemerides< TimeType, StateScalarType >(
                     bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_ );
     }
+
+    //! Function processing rotational state in the full numericalSolution, stored as columnar state history
+    /*!
+     * Function that processes the entries of the rotational state in the full numericalSolution, stored as columnar
+     * state history (see map-based overload).
+     * \param numericalSolution Full numerical solution, in global representation (see
+     * convertToOutputSolution function in RotationalMotionStateDerivative class.
+     */
+    void processIntegratedStates(
+            const utilities::ColumnarStateHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedRotationalEphemerides< TimeType, StateScalarType >(
+                    bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_ );
+    }
     
     //! Function processing multi-arc rotational state, resetting bodies' ephemerides with new states
     /*!
@@ -885,7 +1059,22 @@ public:
     void processIntegratedStates(
             const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& numericalSolution )
     {
-        resetIntegratedBodyMass( bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_ );
+        resetIntegratedBodyMass< TimeType, StateScalarType >(
+                    bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_ );
+    }
+
+    //! Function processing mass state in the full numericalSolution, stored as columnar state history
+    /*!
+     * Function that processes the entries of the propagated mass in the full numericalSolution, stored as columnar state
+     * history, resetting bodies' mass models (see map-based overload).
+     * \param numericalSolution Full numerical solution of state, in global representation (representation is constant
+     * for mass).
+     */
+    void processIntegratedStates(
+            const utilities::ColumnarStateHistory< TimeType, StateScalarType >& numericalSolution )
+    {
+        resetIntegratedBodyMass< TimeType, StateScalarType >(
+                    bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_ );
     }
     
     //! Function processing multi-arc translational mass, resetting bodies' mass models
@@ -1085,14 +1274,14 @@ createIntegratedStateProcessors(
  * Function to reset the dynamical properties of the environment from the numerically integrated
  * dynamics solution
  * \param equationsOfMotionNumericalSolution Solution produced by the numerical integration, in the
- * 'conventional form'
+ * 'conventional form', stored as map or as ColumnarStateHistory
  * \sa SingleStateTypeDerivative::convertToOutputSolution
  * \param integratedStateProcessors List of objects (per dynamics type) used to process integrated
  * results into environment
  */
-template< typename TimeType, typename StateScalarType >
+template< typename TimeType, typename StateScalarType, typename NumericalSolutionType >
 void resetIntegratedStates(
-        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+        const NumericalSolutionType& equationsOfMotionNumericalSolution,
         const std::map< IntegratedStateType, std::vector< std::shared_ptr<
         IntegratedStateProcessor< TimeType, StateScalarType > > > >  integratedStateProcessors )
 {
@@ -28,6 +28,8 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/geodeticCoordinateConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/Ephemerides/cachedRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
@@ -35,6 +37,7 @@
 #include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Basics/parallelExecution.h"
 #include "Tudat/Basics/testMacros.h"
 
 #if USE_CSPICE
@@ -289,6 +292,30 @@ BOOST_AUTO_TEST_CASE( test_ephemerisSetup )
                     std::numeric_limits< double >::epsilon( ) );
     }
 
+    {
+        // Create Chebyshev ephemeris fit to spice
+        std::shared_ptr< EphemerisSettings > chebyshevEphemerisSettings =
+                std::make_shared< ChebyshevEphemerisSettings >(
+                    1.0E7 - 10.0 * 86400.0, 1.0E7 + 10.0 * 86400.0, "Earth", "J2000" );
+        std::shared_ptr< ephemerides::Ephemeris > chebyshevEphemeris =
+                createBodyEphemeris( chebyshevEphemerisSettings, "Moon" );
+        BOOST_CHECK( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( chebyshevEphemeris ) != nullptr );
+
+        // Compare Chebyshev ephemeris against direct spice state (sub-millimetre agreement).
+        for( double testTime = 1.0E7 - 10.0 * 86400.0; testTime <= 1.0E7 + 10.0 * 86400.0; testTime += 3791.0 )
+        {
+            Eigen::Vector6d stateDifference = spice_interface::getBodyCartesianStateAtEpoch(
+                        "Moon", "Earth", "J2000", "None", testTime ) - chebyshevEphemeris->getCartesianState( testTime );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+
+        // Check interval on which ephemeris is valid.
+        std::pair< double, double > safeInterval = getSafeInterpolationInterval( chebyshevEphemeris );
+        BOOST_CHECK_EQUAL( safeInterval.first, 1.0E7 - 10.0 * 86400.0 );
+        BOOST_CHECK_EQUAL( safeInterval.second, 1.0E7 + 10.0 * 86400.0 );
+    }
+
 
 }
 #endif
@@ -1070,6 +1097,152 @@ BOOST_AUTO_TEST_CASE( test_groundStationCreation )
     }
 }
 
+//! Test whether body states are computed only once per epoch, and whether cache statistics are correct
+BOOST_AUTO_TEST_CASE( test_bodyStateCaching )
+{
+    using namespace ephemerides;
+
+    // Create Earth with constant state w.r.t. SSB, and Moon with constant state w.r.t. Earth, counting the number of
+    // ephemeris evaluations.
+    int numberOfEarthEphemerisCalls = 0;
+    int numberOfMoonEphemerisCalls = 0;
+    Eigen::Vector6d earthState = ( Eigen::Vector6d( ) << 1.5E11, 2.0E10, 1.0E8, -3.0E3, 2.9E4, 1.0 ).finished( );
+    Eigen::Vector6d moonState = ( Eigen::Vector6d( ) << 3.8E8, -1.0E7, 2.0E7, 10.0, 1.0E3, -5.0 ).finished( );
+
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = std::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                         [ & ]( ){ numberOfEarthEphemerisCalls++; return earthState; },
+                                     "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( std::make_shared< SimpleRotationalEphemeris >(
+                                                   Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ),
+                                                   2.0 * mathematical_constants::PI / 86400.0, 0.0,
+                                                   "ECLIPJ2000", "IAU_Earth" ) );
+    bodyMap[ "Moon" ] = std::make_shared< Body >( );
+    bodyMap[ "Moon" ]->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                        [ & ]( ){ numberOfMoonEphemerisCalls++; return moonState; },
+                                    "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set Moon state at three epochs, twice per epoch, and Earth state once per epoch (after Moon).
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        double testTime = 1.0E7 + 60.0 * static_cast< double >( i );
+        bodyMap.at( "Moon" )->setStateFromEphemeris( testTime );
+        bodyMap.at( "Moon" )->setStateFromEphemeris( testTime );
+        bodyMap.at( "Earth" )->setStateFromEphemeris( testTime );
+
+        bodyMap.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris( testTime );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( bodyMap.at( "Moon" )->getState( ), ( earthState + moonState ),
+                                           std::numeric_limits< double >::epsilon( ) );
+        Eigen::Matrix3d rotationMatrixDifference =
+                bodyMap.at( "Earth" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( ) -
+                bodyMap.at( "Earth" )->getRotationalEphemeris( )->getRotationToTargetFrame( testTime ).toRotationMatrix( );
+        BOOST_CHECK_SMALL( rotationMatrixDifference.cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+    }
+
+    // Check that each ephemeris is evaluated once per epoch (Earth state is retrieved through the Moon's base frame state).
+    BOOST_CHECK_EQUAL( numberOfEarthEphemerisCalls, 3 );
+    BOOST_CHECK_EQUAL( numberOfMoonEphemerisCalls, 3 );
+
+    BodyStateCacheStatistics earthCacheStatistics = bodyMap.at( "Earth" )->getStateCacheStatistics( );
+    BOOST_CHECK_EQUAL( earthCacheStatistics.numberOfStateCacheMisses_, 3 );
+    BOOST_CHECK_EQUAL( earthCacheStatistics.numberOfStateCacheHits_, 3 );
+    BOOST_CHECK_EQUAL( earthCacheStatistics.numberOfRotationCacheHits_, 0 );
+    BOOST_CHECK_EQUAL( earthCacheStatistics.numberOfRotationCacheMisses_, 0 );
+
+    BodyStateCacheStatistics totalCacheStatistics = getStateCacheStatistics( bodyMap );
+    BOOST_CHECK_EQUAL( totalCacheStatistics.numberOfStateCacheMisses_, 6 );
+    BOOST_CHECK_EQUAL( totalCacheStatistics.numberOfStateCacheHits_, 6 );
+
+    // Retrieve Earth rotation (as used by ground stations) twice per epoch in caching scope, and check that it is
+    // computed once per epoch.
+    {
+        RotationCachingScope rotationCachingScope;
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            double testTime = 1.0E7 + 60.0 * static_cast< double >( i );
+            Eigen::Matrix3d firstRotationToTargetFrame = bodyMap.at( "Earth" )->getCachedRotationalEphemeris( )->
+                    getRotationToTargetFrame( testTime ).toRotationMatrix( );
+            Eigen::Matrix3d secondRotationToTargetFrame = bodyMap.at( "Earth" )->getCachedRotationalEphemeris( )->
+                    getRotationToTargetFrame( testTime ).toRotationMatrix( );
+            Eigen::Matrix3d expectedRotationToTargetFrame = bodyMap.at( "Earth" )->getRotationalEphemeris( )->
+                    getRotationToTargetFrame( testTime ).toRotationMatrix( );
+
+            BOOST_CHECK_SMALL( ( firstRotationToTargetFrame - expectedRotationToTargetFrame ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-15 );
+            BOOST_CHECK_EQUAL( ( secondRotationToTargetFrame - firstRotationToTargetFrame ).cwiseAbs( ).maxCoeff( ),
+                               0.0 );
+        }
+    }
+    earthCacheStatistics = bodyMap.at( "Earth" )->getStateCacheStatistics( );
+    BOOST_CHECK_EQUAL( earthCacheStatistics.numberOfRotationCacheHits_, 3 );
+    BOOST_CHECK_EQUAL( earthCacheStatistics.numberOfRotationCacheMisses_, 3 );
+    BOOST_CHECK_EQUAL( getStateCacheStatistics( bodyMap ).numberOfRotationCacheMisses_, 3 );
+
+    // Check that state is recomputed at the same epoch when requested
+    bodyMap.at( "Earth" )->recomputeStateOnNextCall( );
+    bodyMap.at( "Earth" )->setStateFromEphemeris( 1.0E7 + 120.0 );
+    BOOST_CHECK_EQUAL( numberOfEarthEphemerisCalls, 4 );
+
+    resetStateCacheStatistics( bodyMap );
+    BOOST_CHECK_EQUAL( getStateCacheStatistics( bodyMap ).numberOfStateCacheHits_, 0 );
+    BOOST_CHECK_EQUAL( getStateCacheStatistics( bodyMap ).numberOfRotationCacheHits_, 0 );
+    BOOST_CHECK_EQUAL( getStateCacheStatistics( bodyMap ).numberOfRotationCacheMisses_, 0 );
+}
+
+//! Test whether body states are only computed without caching when bodies are marked as accessed concurrently
+BOOST_AUTO_TEST_CASE( test_bodyStateCachingInParallelTasks )
+{
+    using namespace ephemerides;
+
+    Eigen::Vector6d moonState = ( Eigen::Vector6d( ) << 3.8E8, -1.0E7, 2.0E7, 10.0, 1.0E3, -5.0 ).finished( );
+
+    // Create separate body map per task (as for parallel propagation), counting the number of ephemeris evaluations
+    std::vector< NamedBodyMap > bodyMaps( 2 );
+    std::vector< int > numberOfEphemerisCalls( 2, 0 );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        bodyMaps[ i ][ "Earth" ] = std::make_shared< Body >( );
+        bodyMaps[ i ][ "Earth" ]->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                                   Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+        bodyMaps[ i ][ "Moon" ] = std::make_shared< Body >( );
+        int& currentNumberOfEphemerisCalls = numberOfEphemerisCalls[ i ];
+        bodyMaps[ i ][ "Moon" ]->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                                  [ &currentNumberOfEphemerisCalls, &moonState ]( )
+        {
+            currentNumberOfEphemerisCalls++;
+            return moonState;
+        }, "SSB", "ECLIPJ2000" ) );
+        setGlobalFrameBodyEphemerides( bodyMaps[ i ], "SSB", "ECLIPJ2000" );
+    }
+
+    // Retrieve state repeatedly at same epoch, in parallel tasks that each use their own bodies: cache is used
+    utilities::executeParallelTasks( 2, 2, [ & ]( const unsigned int taskIndex, const unsigned int )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            bodyMaps[ taskIndex ].at( "Moon" )->getStateInBaseFrameFromEphemeris( 1.0E7 );
+        }
+    } );
+    BOOST_CHECK_EQUAL( numberOfEphemerisCalls[ 0 ], 1 );
+    BOOST_CHECK_EQUAL( numberOfEphemerisCalls[ 1 ], 1 );
+
+    // Retrieve state at new epoch, with bodies marked as concurrently accessed: current state is neither used nor modified
+    {
+        utilities::ConcurrentSharedObjectAccess sharedObjectAccess;
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            Eigen::Vector6d currentMoonState = bodyMaps[ 0 ].at( "Moon" )->getStateInBaseFrameFromEphemeris( 2.0E7 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( currentMoonState, moonState, std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+    BOOST_CHECK_EQUAL( numberOfEphemerisCalls[ 0 ], 4 );
+    BOOST_CHECK_EQUAL( bodyMaps[ 0 ].at( "Moon" )->getStateCacheStatistics( ).numberOfStateCacheMisses_, 1 );
+    BOOST_CHECK_EQUAL( bodyMaps[ 0 ].at( "Moon" )->getStateCacheStatistics( ).numberOfStateCacheHits_, 2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests